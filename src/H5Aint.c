@@ -95,8 +95,6 @@ static int H5A__attr_cmp_name_inc(const void *attr1, const void *attr2);
 static int H5A__attr_cmp_name_dec(const void *attr1, const void *attr2);
 static int H5A__attr_cmp_corder_inc(const void *attr1, const void *attr2);
 static int H5A__attr_cmp_corder_dec(const void *attr1, const void *attr2);
-static herr_t H5A__attr_sort_table(H5A_attr_table_t *atable, H5_index_t idx_type,
-    H5_iter_order_t order);
 static herr_t H5A__iterate_common(hid_t loc_id, H5_index_t idx_type,
     H5_iter_order_t order, hsize_t *idx, H5A_attr_iter_op_t *attr_op, void *op_data);
 
@@ -1752,11 +1750,11 @@ H5A__attr_cmp_corder_dec(const void *attr1, const void *attr2)
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
+herr_t
 H5A__attr_sort_table(H5A_attr_table_t *atable, H5_index_t idx_type,
     H5_iter_order_t order)
 {
-    FUNC_ENTER_STATIC_NOERR
+    FUNC_ENTER_PACKAGE_NOERR
 
     /* Sanity check */
     HDassert(atable);
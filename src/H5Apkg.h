@@ -241,6 +241,8 @@ H5_DLL herr_t H5A__compact_build_table(H5F_t *f, H5O_t *oh, H5_index_t idx_type,
     H5_iter_order_t order, H5A_attr_table_t *atable);
 H5_DLL herr_t H5A__dense_build_table(H5F_t *f, const H5O_ainfo_t *ainfo,
     H5_index_t idx_type, H5_iter_order_t order, H5A_attr_table_t *atable);
+H5_DLL herr_t H5A__attr_sort_table(H5A_attr_table_t *atable, H5_index_t idx_type,
+    H5_iter_order_t order);
 H5_DLL herr_t H5A__attr_iterate_table(const H5A_attr_table_t *atable,
     hsize_t skip, hsize_t *last_attr, hid_t loc_id,
     const H5A_attr_iter_op_t *attr_op, void *op_data);
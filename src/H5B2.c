@@ -295,6 +295,47 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5B2_insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2_insert_bulk
+ *
+ * Purpose:	Builds an empty B-tree from NREC records in one pass.  The
+ *		callback is made once per record, in increasing record
+ *		order, to fill in each native record.
+ *
+ *		Records must be supplied in the order the B-tree's compare
+ *		callback sorts them, with no duplicates.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5B2_insert_bulk(H5B2_t *bt2, hsize_t nrec, H5B2_fill_t op, void *op_data)
+{
+    H5B2_hdr_t	*hdr;                   /* Pointer to the B-tree header */
+    herr_t	ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check arguments. */
+    HDassert(bt2);
+    HDassert(op);
+
+    /* Set the shared v2 B-tree header's file context for this operation */
+    bt2->hdr->f = bt2->f;
+
+    /* Get the v2 B-tree header */
+    hdr = bt2->hdr;
+
+    /* Build the B-tree */
+    if(H5B2__insert_bulk(hdr, nrec, op, op_data) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to bulk insert records into B-tree")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5B2_insert_bulk() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5B2_update
@@ -35,6 +35,7 @@
 #include "H5private.h"		/* Generic Functions			*/
 #include "H5B2pkg.h"		/* v2 B-trees				*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5VMprivate.h"	/* Vectors and arrays 			*/
 
 
@@ -59,6 +60,10 @@
 static herr_t H5B2__update_child_flush_depends(H5B2_hdr_t *hdr, 
     unsigned depth, const H5B2_node_ptr_t *node_ptrs, unsigned start_idx,
     unsigned end_idx, void *old_parent, void *new_parent);
+static herr_t H5B2__add_depth(H5B2_hdr_t *hdr);
+static herr_t H5B2__insert_bulk_node(H5B2_hdr_t *hdr, uint16_t depth,
+    const hsize_t *cap, H5B2_node_ptr_t *node_ptr, void *parent, hsize_t nrec,
+    H5B2_fill_t op, void *op_data);
 
 
 /*********************/
@@ -327,30 +332,24 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5B2__split_root
+ * Function:	H5B2__add_depth
  *
- * Purpose:	Split the root node
+ * Purpose:	Increase the depth of the B-tree by one and set up the node
+ *		info for the new level
  *
  * Return:	Success:	Non-negative
  *		Failure:	Negative
  *
- * Programmer:	Quincey Koziol
- *		koziol@ncsa.uiuc.edu
- *		Feb  3 2005
- *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5B2__split_root(H5B2_hdr_t *hdr)
+static herr_t
+H5B2__add_depth(H5B2_hdr_t *hdr)
 {
-    H5B2_internal_t *new_root = NULL;   /* Pointer to new root node */
-    unsigned new_root_flags = H5AC__NO_FLAGS_SET;   /* Cache flags for new root node */
-    H5B2_node_ptr_t old_root_ptr;       /* Old node pointer to root node in B-tree */
     size_t sz_max_nrec;                 /* Temporary variable for range checking */
     unsigned u_max_nrec_size;           /* Temporary variable for range checking */
     herr_t ret_value = SUCCEED;         /* Return value */
 
-    FUNC_ENTER_PACKAGE
+    FUNC_ENTER_STATIC
 
     /* Check arguments. */
     HDassert(hdr);
@@ -376,6 +375,42 @@ H5B2__split_root(H5B2_hdr_t *hdr)
     if(NULL == (hdr->node_info[hdr->depth].node_ptr_fac = H5FL_fac_init(sizeof(H5B2_node_ptr_t) * (hdr->node_info[hdr->depth].max_nrec + 1))))
 	HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, FAIL, "can't create internal 'branch' node node pointer block factory")
 
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5B2__add_depth() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2__split_root
+ *
+ * Purpose:	Split the root node
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ * Programmer:	Quincey Koziol
+ *		koziol@ncsa.uiuc.edu
+ *		Feb  3 2005
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5B2__split_root(H5B2_hdr_t *hdr)
+{
+    H5B2_internal_t *new_root = NULL;   /* Pointer to new root node */
+    unsigned new_root_flags = H5AC__NO_FLAGS_SET;   /* Cache flags for new root node */
+    H5B2_node_ptr_t old_root_ptr;       /* Old node pointer to root node in B-tree */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments. */
+    HDassert(hdr);
+
+    /* Update depth of B-tree */
+    if(H5B2__add_depth(hdr) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to increase depth of B-tree")
+
     /* Keep old root node pointer info */
     old_root_ptr = hdr->root;
 
@@ -1483,6 +1518,187 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5B2__insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2__insert_bulk_node
+ *
+ * Purpose:	Create a node holding NREC records in the subtree below it,
+ *		along with all of its descendants.  Records are retrieved
+ *		from the callback in order, so each node is written once
+ *		and never split.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5B2__insert_bulk_node(H5B2_hdr_t *hdr, uint16_t depth, const hsize_t *cap,
+    H5B2_node_ptr_t *node_ptr, void *parent, hsize_t nrec, H5B2_fill_t op,
+    void *op_data)
+{
+    const H5AC_class_t *node_class = NULL;  /* Pointer to node's class info */
+    void *node = NULL;                  /* Pointer to new node */
+    unsigned node_nrec;                 /* # of records in new node */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments. */
+    HDassert(hdr);
+    HDassert(cap);
+    HDassert(node_ptr);
+    HDassert(nrec > 0 && nrec <= cap[depth]);
+    HDassert(op);
+
+    /* Reset the node pointer's record counts */
+    node_ptr->node_nrec = 0;
+    node_ptr->all_nrec = 0;
+
+    if(depth > 0) {
+        H5B2_internal_t *internal;      /* Pointer to new internal node */
+        hsize_t nchild;                 /* # of children of new node */
+        hsize_t child_nrec;             /* # of records in each child's subtree */
+        hsize_t extra;                  /* # of children with one more record */
+        unsigned u;                     /* Local index variable */
+
+        /* Use the fewest children that will hold the records, and spread
+         * the records evenly between them
+         */
+        nchild = (nrec + cap[depth - 1] + 1) / (cap[depth - 1] + 1);
+        HDassert(nchild > 1 && (nchild - 1) <= hdr->node_info[depth].split_nrec);
+        child_nrec = (nrec - (nchild - 1)) / nchild;
+        extra = (nrec - (nchild - 1)) % nchild;
+
+        /* Create & protect the new internal node */
+        if(H5B2__create_internal(hdr, parent, node_ptr, depth) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to create new internal node")
+        if(NULL == (internal = H5B2__protect_internal(hdr, parent, node_ptr, depth, FALSE, H5AC__NO_FLAGS_SET)))
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTPROTECT, FAIL, "unable to protect B-tree internal node")
+        node_class = H5AC_BT2_INT;
+        node = internal;
+
+        /* Build each child, with the separating record after it */
+        for(u = 0; u < (unsigned)nchild; u++) {
+            if(H5B2__insert_bulk_node(hdr, (uint16_t)(depth - 1), cap, &internal->node_ptrs[u], internal, child_nrec + (u < extra ? 1 : 0), op, op_data) < 0)
+                HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to build B-tree child node")
+            if(u < (unsigned)(nchild - 1))
+                if((op)(H5B2_INT_NREC(internal, hdr, u), op_data) < 0)
+                    HGOTO_ERROR(H5E_BTREE, H5E_CALLBACK, FAIL, "unable to retrieve record")
+        } /* end for */
+
+        node_nrec = (unsigned)(nchild - 1);
+        internal->nrec = (uint16_t)node_nrec;
+    } /* end if */
+    else {
+        H5B2_leaf_t *leaf;              /* Pointer to new leaf node */
+        unsigned u;                     /* Local index variable */
+
+        /* Create & protect the new leaf node */
+        if(H5B2__create_leaf(hdr, parent, node_ptr) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to create new leaf node")
+        if(NULL == (leaf = H5B2__protect_leaf(hdr, parent, node_ptr, FALSE, H5AC__NO_FLAGS_SET)))
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTPROTECT, FAIL, "unable to protect B-tree leaf node")
+        node_class = H5AC_BT2_LEAF;
+        node = leaf;
+
+        /* Fill the leaf's records */
+        node_nrec = (unsigned)nrec;
+        for(u = 0; u < node_nrec; u++)
+            if((op)(H5B2_LEAF_NREC(leaf, hdr, u), op_data) < 0)
+                HGOTO_ERROR(H5E_BTREE, H5E_CALLBACK, FAIL, "unable to retrieve record")
+        leaf->nrec = (uint16_t)node_nrec;
+    } /* end else */
+
+    /* Update node pointer to the new node */
+    node_ptr->node_nrec = (uint16_t)node_nrec;
+    node_ptr->all_nrec = nrec;
+
+done:
+    /* Release the new node (marked as dirty) */
+    if(node && H5AC_unprotect(hdr->f, node_class, node_ptr->addr, node, H5AC__DIRTIED_FLAG) < 0)
+        HDONE_ERROR(H5E_BTREE, H5E_CANTUNPROTECT, FAIL, "unable to release B-tree node")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5B2__insert_bulk_node() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2__insert_bulk
+ *
+ * Purpose:	Build an empty B-tree from NREC records, which the callback
+ *		supplies one at a time in increasing order.
+ *
+ *		Nodes are filled to their split point and written once,
+ *		instead of being split and redistributed as the records are
+ *		inserted one at a time.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5B2__insert_bulk(H5B2_hdr_t *hdr, hsize_t nrec, H5B2_fill_t op, void *op_data)
+{
+    hsize_t     *cap = NULL;            /* Max. # of records in subtree at each depth */
+    herr_t	ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments. */
+    HDassert(hdr);
+    HDassert(op);
+
+    /* Only empty B-trees can be bulk loaded */
+    if(H5F_addr_defined(hdr->root.addr))
+        HGOTO_ERROR(H5E_BTREE, H5E_BADVALUE, FAIL, "B-tree is not empty")
+    HDassert(hdr->depth == 0);
+
+    /* Check for nothing to do */
+    if(0 == nrec)
+        HGOTO_DONE(SUCCEED)
+
+    /* Increase the depth of the B-tree until it can hold the records */
+    /* (Nodes are filled only to their split point, so that the next
+     *  insertion into a node doesn't overflow it)
+     */
+    if(NULL == (cap = (hsize_t *)H5MM_malloc(sizeof(hsize_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    cap[0] = hdr->node_info[0].split_nrec;
+    while(cap[hdr->depth] < nrec) {
+        hsize_t *new_cap;               /* Re-allocated capacity array */
+
+        if(H5B2__add_depth(hdr) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to increase depth of B-tree")
+        if(NULL == (new_cap = (hsize_t *)H5MM_realloc(cap, sizeof(hsize_t) * (size_t)(hdr->depth + 1))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        cap = new_cap;
+        cap[hdr->depth] = ((hsize_t)(hdr->node_info[hdr->depth].split_nrec + 1) * cap[hdr->depth - 1])
+                + hdr->node_info[hdr->depth].split_nrec;
+    } /* end while */
+
+    /* Build the B-tree from the root down */
+    if(H5B2__insert_bulk_node(hdr, hdr->depth, cap, &hdr->root, hdr, nrec, op, op_data) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to build B-tree nodes")
+
+    /* Forget any cached min & max records */
+    if(hdr->min_native_rec)
+	hdr->min_native_rec = H5MM_xfree(hdr->min_native_rec);
+    if(hdr->max_native_rec)
+	hdr->max_native_rec = H5MM_xfree(hdr->max_native_rec);
+
+    /* Mark B-tree header as dirty */
+    if(H5B2__hdr_dirty(hdr) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTMARKDIRTY, FAIL, "unable to mark B-tree header dirty")
+
+done:
+    if(cap)
+        H5MM_xfree(cap);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5B2__insert_bulk() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5B2__iterate_node
@@ -68,6 +68,9 @@ typedef herr_t (*H5B2_modify_t)(void *record, void *op_data, hbool_t *changed);
 /* Define the 'remove' callback function pointer for H5B2_remove() & H5B2_delete() */
 typedef herr_t (*H5B2_remove_t)(const void *record, void *op_data);
 
+/* Define the 'fill' callback function pointer for H5B2_insert_bulk() */
+typedef herr_t (*H5B2_fill_t)(void *record, void *op_data);
+
 /* Comparisons for H5B2_neighbor() call */
 typedef enum H5B2_compare_t {
     H5B2_COMPARE_LESS,            /* Records with keys less than query value */
@@ -127,6 +130,8 @@ H5_DLL H5B2_t *H5B2_create(H5F_t *f, const H5B2_create_t *cparam,
 H5_DLL H5B2_t *H5B2_open(H5F_t *f, haddr_t addr, void *ctx_udata);
 H5_DLL herr_t H5B2_get_addr(const H5B2_t *bt2, haddr_t *addr/*out*/);
 H5_DLL herr_t H5B2_insert(H5B2_t *bt2, void *udata);
+H5_DLL herr_t H5B2_insert_bulk(H5B2_t *bt2, hsize_t nrec, H5B2_fill_t op,
+    void *op_data);
 H5_DLL herr_t H5B2_iterate(H5B2_t *bt2, H5B2_operator_t op, void *op_data);
 H5_DLL htri_t H5B2_find(H5B2_t *bt2, void *udata, H5B2_found_t op, void *op_data);
 H5_DLL herr_t H5B2_index(H5B2_t *bt2, H5_iter_order_t order, hsize_t idx,
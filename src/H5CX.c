@@ -225,6 +225,8 @@ typedef struct H5CX_t {
     hbool_t mpio_chunk_opt_num_valid; /* Whether collective chunk threshold is valid */
     unsigned mpio_chunk_opt_ratio; /* Collective chunk ratio (H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME) */
     hbool_t mpio_chunk_opt_ratio_valid; /* Whether collective chunk ratio is valid */
+    hbool_t mpio_node_agg;      /* Whether to aggregate collective writes on each node (H5D_XFER_MPIO_NODE_AGG_NAME) */
+    hbool_t mpio_node_agg_valid; /* Whether node aggregation flag is valid */
 #endif /* H5_HAVE_PARALLEL */
     H5Z_EDC_t err_detect;       /* Error detection info (H5D_XFER_EDC_NAME) */
     hbool_t err_detect_valid;   /* Whether error detection info is valid */
@@ -243,6 +245,8 @@ typedef struct H5CX_t {
     hbool_t mpio_actual_chunk_opt_set; /* Whether chunk optimization mode used for parallel I/O is set */
     H5D_mpio_actual_io_mode_t mpio_actual_io_mode; /* Actual I/O mode used for parallel I/O (H5D_MPIO_ACTUAL_IO_MODE_NAME) */
     hbool_t mpio_actual_io_mode_set; /* Whether actual I/O mode used for parallel I/O is set */
+    hbool_t mpio_actual_node_agg;   /* Whether the write was aggregated on each node (H5D_MPIO_ACTUAL_NODE_AGG_NAME) */
+    hbool_t mpio_actual_node_agg_set; /* Whether actual node aggregation flag is set */
     uint32_t mpio_local_no_coll_cause; /* Local reason for breaking collective I/O (H5D_MPIO_LOCAL_NO_COLLECTIVE_CAUSE_NAME) */
     hbool_t mpio_local_no_coll_cause_set; /* Whether local reason for breaking collective I/O is set */
     hbool_t mpio_local_no_coll_cause_valid; /* Whether local reason for breaking collective I/O is valid */
@@ -311,6 +315,7 @@ typedef struct H5CX_dxpl_cache_t {
     H5FD_mpio_chunk_opt_t mpio_chunk_opt_mode; /* Collective chunk option (H5D_XFER_MPIO_CHUNK_OPT_HARD_NAME) */
     unsigned mpio_chunk_opt_num;    /* Collective chunk thrreshold (H5D_XFER_MPIO_CHUNK_OPT_NUM_NAME) */
     unsigned mpio_chunk_opt_ratio;  /* Collective chunk ratio (H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME) */
+    hbool_t mpio_node_agg;          /* Whether to aggregate collective writes on each node (H5D_XFER_MPIO_NODE_AGG_NAME) */
 #endif /* H5_HAVE_PARALLEL */
     H5Z_EDC_t err_detect;           /* Error detection info (H5D_XFER_EDC_NAME) */
     H5Z_cb_t filter_cb;             /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
@@ -427,6 +432,8 @@ H5CX__init_package(void)
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve chunk optimization threshold")
     if(H5P_get(dx_plist, H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME, &H5CX_def_dxpl_cache.mpio_chunk_opt_ratio) < 0)
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve chunk optimization ratio")
+    if(H5P_get(dx_plist, H5D_XFER_MPIO_NODE_AGG_NAME, &H5CX_def_dxpl_cache.mpio_node_agg) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve node aggregation flag")
 
     /* Get the local & global reasons for breaking collective I/O values */
     if(H5P_get(dx_plist, H5D_MPIO_LOCAL_NO_COLLECTIVE_CAUSE_NAME, &H5CX_def_dxpl_cache.mpio_local_no_coll_cause) < 0)
@@ -1740,6 +1747,39 @@ H5CX_get_mpio_chunk_opt_ratio(unsigned *mpio_chunk_opt_ratio)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5CX_get_mpio_chunk_opt_ratio() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_mpio_node_agg
+ *
+ * Purpose:     Retrieves whether collective writes are aggregated on each
+ *              node for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_mpio_node_agg(hbool_t *mpio_node_agg)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(mpio_node_agg);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_MPIO_NODE_AGG_NAME, mpio_node_agg)
+
+    /* Get the value */
+    *mpio_node_agg = (*head)->ctx.mpio_node_agg;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_mpio_node_agg() */
 #endif /* H5_HAVE_PARALLEL */
 
 
@@ -2381,6 +2421,35 @@ H5CX_set_mpio_actual_io_mode(H5D_mpio_actual_io_mode_t mpio_actual_io_mode)
     FUNC_LEAVE_NOAPI_VOID
 } /* end H5CX_set_mpio_actual_chunk_opt() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_set_mpio_actual_node_agg
+ *
+ * Purpose:     Sets whether the write was aggregated on each node for the current API call context.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5CX_set_mpio_actual_node_agg(hbool_t mpio_actual_node_agg)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity checks */
+    HDassert(head && *head);
+    HDassert(!((*head)->ctx.dxpl_id == H5P_DEFAULT ||
+            (*head)->ctx.dxpl_id == H5P_DATASET_XFER_DEFAULT));
+
+    /* Cache the value for later, marking it to set in DXPL when context popped */
+    (*head)->ctx.mpio_actual_node_agg = mpio_actual_node_agg;
+    (*head)->ctx.mpio_actual_node_agg_set = TRUE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5CX_set_mpio_actual_node_agg() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5CX_set_mpio_local_no_coll_cause
@@ -2722,6 +2791,7 @@ H5CX__pop_common(void)
 #ifdef H5_HAVE_PARALLEL
     H5CX_SET_PROP(H5D_MPIO_ACTUAL_CHUNK_OPT_MODE_NAME, mpio_actual_chunk_opt)
     H5CX_SET_PROP(H5D_MPIO_ACTUAL_IO_MODE_NAME, mpio_actual_io_mode)
+    H5CX_SET_PROP(H5D_MPIO_ACTUAL_NODE_AGG_NAME, mpio_actual_node_agg)
     H5CX_SET_PROP(H5D_MPIO_LOCAL_NO_COLLECTIVE_CAUSE_NAME, mpio_local_no_coll_cause)
     H5CX_SET_PROP(H5D_MPIO_GLOBAL_NO_COLLECTIVE_CAUSE_NAME, mpio_global_no_coll_cause)
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
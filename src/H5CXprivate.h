@@ -95,6 +95,7 @@ H5_DLL herr_t H5CX_get_mpio_global_no_coll_cause(uint32_t *mpio_global_no_coll_c
 H5_DLL herr_t H5CX_get_mpio_chunk_opt_mode(H5FD_mpio_chunk_opt_t *mpio_chunk_opt_mode);
 H5_DLL herr_t H5CX_get_mpio_chunk_opt_num(unsigned *mpio_chunk_opt_num);
 H5_DLL herr_t H5CX_get_mpio_chunk_opt_ratio(unsigned *mpio_chunk_opt_ratio);
+H5_DLL herr_t H5CX_get_mpio_node_agg(hbool_t *mpio_node_agg);
 #endif /* H5_HAVE_PARALLEL */
 H5_DLL herr_t H5CX_get_err_detect(H5Z_EDC_t *err_detect);
 H5_DLL herr_t H5CX_get_filter_cb(H5Z_cb_t *filter_cb);
@@ -130,6 +131,7 @@ H5_DLL herr_t H5CX_set_nlinks(size_t nlinks);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL void H5CX_set_mpio_actual_chunk_opt(H5D_mpio_actual_chunk_opt_mode_t chunk_opt);
 H5_DLL void H5CX_set_mpio_actual_io_mode(H5D_mpio_actual_io_mode_t actual_io_mode);
+H5_DLL void H5CX_set_mpio_actual_node_agg(hbool_t actual_node_agg);
 H5_DLL void H5CX_set_mpio_local_no_coll_cause(uint32_t mpio_local_no_coll_cause);
 H5_DLL void H5CX_set_mpio_global_no_coll_cause(uint32_t mpio_global_no_coll_cause);
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
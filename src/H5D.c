@@ -1113,3 +1113,55 @@ done:
     FUNC_LEAVE_API(ret_value);
 } /* H5Dget_chunk_storage_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dchunk_iter
+ *
+ * Purpose:     Calls OP for every allocated chunk in a chunked dataset,
+ *              passing it the logical offset of the chunk, its filter
+ *              mask, and its address and size in the file.
+ *
+ *              The chunk index is only traversed once, so this is much
+ *              faster than querying the chunks one at a time.  ORDER is
+ *              H5_ITER_NATIVE to visit the chunks in the order the index
+ *              holds them, or H5_ITER_INC / H5_ITER_DEC to visit them in
+ *              increasing / decreasing order of file address.
+ *
+ *              As with the other iteration routines, OP returns zero to
+ *              continue, a positive value to stop early with that value
+ *              returned, or a negative value to stop with an error.
+ *
+ * Return:      Success:    The return value of the last operator call
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dchunk_iter(hid_t dset_id, H5_iter_order_t order, H5D_chunk_iter_op_t op,
+    void *op_data)
+{
+    H5VL_object_t  *vol_obj;                /* Dataset for this operation   */
+    herr_t          op_ret = SUCCEED;       /* Return value from iteration  */
+    herr_t          ret_value = SUCCEED;    /* Return value                 */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iIox*x", dset_id, order, op, op_data);
+
+    /* Check arguments */
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id parameter is not a valid dataset identifier")
+    if(order != H5_ITER_INC && order != H5_ITER_DEC && order != H5_ITER_NATIVE)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid iteration order specified")
+    if(NULL == op)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no operator specified")
+
+    /* Iterate over the chunks */
+    if(H5VL_dataset_optional(vol_obj, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, H5VL_NATIVE_DATASET_CHUNK_ITER, (int)order, op, op_data, &op_ret) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "chunk iteration failed")
+
+    ret_value = op_ret;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Dchunk_iter() */
+
@@ -66,6 +66,13 @@ typedef struct H5D_bt2_it_ud_t {
     void *udata;                /* User data for the chunk's callback routine */
 } H5D_bt2_it_ud_t;
 
+/* Callback info for bulk insertion of chunks into v2 B-tree */
+typedef struct H5D_bt2_bulk_ud_t {
+    const H5D_chk_idx_info_t *idx_info; /* Chunked index info */
+    H5D_chunk_fill_func_t fill_cb;      /* Callback to fill in each chunk record */
+    void *fill_udata;                   /* User data for the callback */
+} H5D_bt2_bulk_ud_t;
+
 /* User data for compare callback */
 typedef struct H5D_bt2_ud_t {
     H5D_chunk_rec_t rec;    	/* The record to search for */
@@ -114,6 +121,9 @@ static herr_t H5D__bt2_remove_cb(const void *nrecord, void *_udata);
 /* Callback for H5B2_modify() which is called in H5D__bt2_idx_insert() */
 static herr_t H5D__bt2_mod_cb(void *_record, void *_op_data, hbool_t *changed);
 
+/* Callback for H5B2_insert_bulk() which is called in H5D__bt2_idx_insert_bulk() */
+static herr_t H5D__bt2_fill_cb(void *_record, void *_udata);
+
 /* Chunked layout indexing callbacks for v2 B-tree indexing */
 static herr_t H5D__bt2_idx_init(const H5D_chk_idx_info_t *idx_info,
     const H5S_t *space, haddr_t dset_ohdr_addr);
@@ -948,6 +958,98 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__bt2_idx_insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__bt2_fill_cb
+ *
+ * Purpose:	Retrieve the next chunk record for bulk insertion into a v2
+ *		B-tree.  This is the callback for H5B2_insert_bulk() which
+ *		is called in H5D__bt2_idx_insert_bulk().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__bt2_fill_cb(void *_record, void *_udata)
+{
+    H5D_chunk_rec_t *record = (H5D_chunk_rec_t *)_record;      /* Native record */
+    H5D_bt2_bulk_ud_t *udata = (H5D_bt2_bulk_ud_t *)_udata;     /* User data */
+    herr_t ret_value = SUCCEED;		/* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Retrieve the chunk record */
+    if((udata->fill_cb)(record, udata->fill_udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CALLBACK, FAIL, "unable to retrieve chunk record")
+    HDassert(H5F_addr_defined(record->chunk_addr));
+
+    /* Non-filtered chunks are always the full size, with no filters skipped */
+    if(0 == udata->idx_info->pline->nused) {
+        record->nbytes = udata->idx_info->layout->size;
+        record->filter_mask = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__bt2_fill_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__bt2_idx_insert_bulk
+ *
+ * Purpose:	Build an empty v2 B-tree index from NCHUNKS chunk records,
+ *		which the callback supplies in increasing order of their
+ *		scaled offsets.
+ *
+ *		This writes each B-tree node once, instead of splitting
+ *		nodes as the chunks are inserted one at a time.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__bt2_idx_insert_bulk(const H5D_chk_idx_info_t *idx_info, hsize_t nchunks,
+    H5D_chunk_fill_func_t fill_cb, void *fill_udata)
+{
+    H5D_bt2_bulk_ud_t udata;            /* User data for v2 B-tree callback */
+    herr_t ret_value = SUCCEED;		/* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->pline);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->storage);
+    HDassert(H5F_addr_defined(idx_info->storage->idx_addr));
+    HDassert(fill_cb);
+
+    /* Check if the v2 B-tree is open yet */
+    if(NULL == idx_info->storage->u.btree2.bt2) {
+	/* Open existing v2 B-tree */
+        if(H5D__bt2_idx_open(idx_info) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "can't open v2 B-tree")
+    } /* end if */
+    else  /* Patch the top level file pointer contained in bt2 if needed */
+	if(H5B2_patch_file(idx_info->storage->u.btree2.bt2, idx_info->f) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "can't patch v2 B-tree file pointer")
+
+    /* Set up callback info */
+    udata.idx_info = idx_info;
+    udata.fill_cb = fill_cb;
+    udata.fill_udata = fill_udata;
+
+    /* Build the v2 B-tree from the records */
+    if(H5B2_insert_bulk(idx_info->storage->u.btree2.bt2, nchunks, H5D__bt2_fill_cb, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to bulk insert records into v2 B-tree")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__bt2_idx_insert_bulk() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__bt2_found_cb
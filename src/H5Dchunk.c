@@ -72,6 +72,25 @@
 #define H5D_CHUNK_GET_NODE_INFO(map, node)  (map->use_single ? map->single_chunk_info : (H5D_chunk_info_t *)H5SL_item(node))
 #define H5D_CHUNK_GET_NEXT_NODE(map, node)  (map->use_single ? (H5SL_node_t *)NULL : H5SL_next(node))
 
+/* Number of new chunks H5D__chunk_allocate allocates file space for at once */
+#define H5D_CHUNK_ALLOC_BATCH           1024
+
+/* Most fill value data H5D__chunk_allocate writes with one I/O call */
+#define H5D_CHUNK_FILL_WRITE_SIZE       (4 * 1024 * 1024)
+
+/* Size of each shard's entry in the table at the start of a sharded chunk */
+#define H5D_CHUNK_SHARD_ENTRY_SIZE      8
+
+/* # of values in each chunk record H5D__chunk_copy holds for bulk loading
+ * the destination index: address, size, filter mask & scaled offsets
+ */
+#define H5D_CHUNK_BULK_REC_NVALS(ndims) ((size_t)(ndims) + 3)
+
+/* Bytes of chunk data held for a dataset by its chunk cache, including the
+ * chunks waiting in its write-behind queue
+ */
+#define H5D_RDCC_NBYTES_USED(rdcc) ((rdcc)->nbytes_used + ((rdcc)->wb ? (rdcc)->wb->nbytes : 0))
+
 /* Sanity check on chunk index types: commonly used by a lot of routines in this file */
 #define H5D_CHUNK_STORAGE_INDEX_CHK(storage)                                                    \
     HDassert((H5D_CHUNK_IDX_EARRAY == storage->idx_type && H5D_COPS_EARRAY == storage->ops) ||  \
@@ -112,6 +131,9 @@
 #define H5D_RDCC_NEWLY_DISABLED_FILTERS 0x02u   /* Filters have been disabled since
                                                  * the last flush */
 
+/* Minimum number of buckets in the chunk cache's hash table */
+#define H5D_CHUNK_CACHE_MIN_BUCKETS 8
+
 
 /******************/
 /* Local Typedefs */
@@ -129,11 +151,9 @@ typedef struct H5D_rdcc_ent_t {
     H5F_block_t chunk_block;    /*offset/length of chunk in file        */
     hsize_t     chunk_idx;  	/*index of chunk in dataset             */
     uint8_t	*chunk;		/*the unfiltered chunk data		*/
-    unsigned	idx;		/*index in hash table			*/
     struct H5D_rdcc_ent_t *next;/*next item in doubly-linked list	*/
     struct H5D_rdcc_ent_t *prev;/*previous item in doubly-linked list	*/
-    struct H5D_rdcc_ent_t *tmp_next;/*next item in temporary doubly-linked list */
-    struct H5D_rdcc_ent_t *tmp_prev;/*previous item in temporary doubly-linked list */
+    struct H5D_rdcc_ent_t *hash_next;/*next item in hash table bucket	*/
 } H5D_rdcc_ent_t;
 typedef H5D_rdcc_ent_t *H5D_rdcc_ent_ptr_t; /* For free lists */
 
@@ -190,9 +210,21 @@ typedef struct H5D_chunk_it_ud3_t {
     /* needed for copy object pointed by refs */
     H5O_copy_t          *cpy_info;              /* Copy options */
 
+    /* needed for resetting references that aren't expanded */
+    void                *zero_chunk;            /* Filtered chunk of reset references */
+    size_t              zero_chunk_nbytes;      /* Size of filtered chunk of reset references */
+    unsigned            zero_chunk_mask;        /* Filter mask for filtered chunk of reset references */
+
     /* needed for getting raw data from chunk cache */
     hbool_t             chunk_in_cache;
     uint8_t	            *chunk;		                /* the unfiltered chunk data		*/
+
+    /* needed for bulk loading the destination index */
+    hbool_t             bulk_insert;            /* Whether to hold chunk records for bulk loading */
+    hsize_t             *bulk_recs;             /* Chunk records, in order of scaled offset */
+    size_t              bulk_nrecs;             /* # of chunk records held */
+    size_t              bulk_nalloc;            /* # of chunk records allocated */
+    size_t              bulk_next;              /* Next chunk record to insert */
 } H5D_chunk_it_ud3_t;
 
 /* Callback info for iteration to dump index */
@@ -210,6 +242,92 @@ typedef struct H5D_chunk_it_ud5_t {
     hsize_t       	*dset_dims;             /* Dataset dimensions */
 } H5D_chunk_it_ud5_t;
 
+/* A chunk to read, for scheduling chunk reads in file address order */
+typedef struct H5D_chunk_read_sched_t {
+    H5D_chunk_info_t    *chunk_info;            /* Chunk's selection info */
+    H5D_chunk_ud_t      udata;                  /* Chunk's address & cache info */
+    size_t              sel_order;              /* Chunk's position in selection order */
+} H5D_chunk_read_sched_t;
+
+/* States of a chunk in the write-behind queue */
+typedef enum H5D_chunk_wb_state_t {
+    H5D_CHUNK_WB_QUEUED,                        /* Waiting to be filtered */
+    H5D_CHUNK_WB_FILTERING,                     /* Being filtered */
+    H5D_CHUNK_WB_FILTERED,                      /* Filtered, waiting to be written */
+    H5D_CHUNK_WB_FAILED                         /* Filtering failed */
+} H5D_chunk_wb_state_t;
+
+/* A dirty chunk in the write-behind queue */
+typedef struct H5D_chunk_wb_ent_t {
+    hsize_t             scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of the chunk */
+    hsize_t             chunk_idx;              /* Chunk index for EA, FA indexing */
+    H5F_block_t         chunk_block;            /* Offset/length of chunk in file */
+    void                *buf;                   /* Chunk data, filtered in place */
+    size_t              buf_size;               /* Size of the buffer */
+    size_t              nbytes;                 /* Size of the (filtered) data */
+    unsigned            filter_mask;            /* Excluded filters */
+    H5Z_EDC_t           err_detect;             /* Error detection info */
+    H5Z_cb_t            filter_cb;              /* I/O filter callback function */
+    H5D_chunk_wb_state_t state;                 /* Chunk's progress through the queue */
+    struct H5D_chunk_wb_ent_t *next;            /* Next (newer) chunk in queue */
+} H5D_chunk_wb_ent_t;
+
+/* Queue of dirty chunks evicted from the chunk cache, waiting to be
+ * filtered and written.  Chunks are written in the order they are queued.
+ */
+typedef struct H5D_chunk_wb_t {
+    size_t              nmax;                   /* Max. # of chunks in queue */
+    size_t              nqueued;                /* # of chunks in queue */
+    size_t              nbytes;                 /* Bytes of chunk data in queue, counted against the chunk cache size */
+    const H5O_pline_t   *pline;                 /* Dataset's I/O pipeline */
+    const H5O_layout_chunk_t *layout;           /* Dataset's chunk layout */
+    H5D_chunk_wb_ent_t  *head;                  /* Oldest chunk, next to write */
+    H5D_chunk_wb_ent_t  *tail;                  /* Newest chunk */
+#ifdef H5_HAVE_THREADSAFE
+    H5D_chunk_wb_ent_t  *next_filter;           /* Next chunk for filter thread */
+    H5TS_mutex_simple_t lock;                   /* Protects the queue */
+    H5TS_cond_t         cond;                   /* Signals changes to the queue */
+    hbool_t             started;                /* Whether starting the filter thread was tried */
+    hbool_t             running;                /* Whether the filter thread is running */
+    hbool_t             shutdown;               /* Tells filter thread to release the queue & exit */
+#endif /* H5_HAVE_THREADSAFE */
+} H5D_chunk_wb_t;
+
+/* A chunk in a batch of chunks written or read directly */
+typedef struct H5D_chunk_direct_ent_t {
+    hsize_t             scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of the chunk */
+    size_t              idx;                    /* Chunk's position in the caller's arrays */
+    H5D_chunk_ud_t      udata;                  /* Chunk's index info */
+    H5F_block_t         old_chunk;              /* Offset/length of old chunk in file */
+    hbool_t             alloc;                  /* Whether the chunk needs new file space */
+    hbool_t             need_insert;            /* Whether the chunk needs to be inserted into the index */
+} H5D_chunk_direct_ent_t;
+
+/* Fill value chunk repeated back to back, for writing runs of new chunks */
+typedef struct H5D_chunk_fill_run_t {
+    uint8_t             *buf;                   /* Repeated chunks */
+    const void          *src;                   /* Fill value chunk that was repeated */
+    size_t              chunk_size;             /* Size of each chunk */
+    size_t              nchunks;                /* # of chunks in buffer */
+} H5D_chunk_fill_run_t;
+
+/* Information about one chunk, gathered for H5D__chunk_iter */
+typedef struct H5D_chunk_iter_rec_t {
+    haddr_t             chunk_addr;             /* Address of chunk in file */
+    hsize_t             nbytes;                 /* Size of stored data */
+    uint32_t            filter_mask;            /* Excluded filters */
+    size_t              scaled_off;             /* Offset of chunk's scaled coordinates in array */
+} H5D_chunk_iter_rec_t;
+
+/* Callback info for iteration to gather chunk info for H5D__chunk_iter */
+typedef struct H5D_chunk_iter_ud_t {
+    unsigned            ndims;                  /* Number of dimensions for dataset */
+    size_t              nrecs;                  /* Number of chunk records gathered */
+    size_t              nalloc;                 /* Number of chunk records allocated */
+    H5D_chunk_iter_rec_t *recs;                 /* Chunk records */
+    hsize_t             *scaled;                /* Scaled coordinates of each chunk */
+} H5D_chunk_iter_ud_t;
+
 /* Callback info for nonexistent readvv operation */
 typedef struct H5D_chunk_readvv_ud_t {
     unsigned char *rbuf;        /* Read buffer to initialize */
@@ -249,6 +367,14 @@ static herr_t H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *ty
     hsize_t nelmts, const H5S_t *file_space, const H5S_t *mem_space,
     H5D_chunk_map_t *fm);
 static herr_t H5D__chunk_flush(H5D_t *dset);
+static int H5D__chunk_read_sched_cmp(const void *_sched1, const void *_sched2);
+static int H5D__chunk_direct_cmp_scaled(const void *_ent1, const void *_ent2);
+static int H5D__chunk_direct_cmp_addr(const void *_ent1, const void *_ent2);
+static herr_t H5D__chunk_direct_setup(const H5D_t *dset, size_t nchunks,
+    const hsize_t offsets[], H5D_chunk_direct_ent_t **ents_out);
+static int H5D__chunk_iter_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
+static int H5D__chunk_iter_cmp_inc(const void *_rec1, const void *_rec2);
+static int H5D__chunk_iter_cmp_dec(const void *_rec1, const void *_rec2);
 static herr_t H5D__chunk_io_term(const H5D_chunk_map_t *fm);
 static herr_t H5D__chunk_dest(H5D_t *dset);
 
@@ -283,15 +409,52 @@ static herr_t H5D__chunk_file_cb(void *elem, const H5T_t *type, unsigned ndims,
     const hsize_t *coords, void *fm);
 static herr_t H5D__chunk_mem_cb(void *elem, const H5T_t *type, unsigned ndims,
     const hsize_t *coords, void *fm);
-static unsigned H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled);
+static size_t H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled,
+    size_t nbuckets);
+static H5D_rdcc_ent_t *H5D__chunk_cache_find(const H5D_shared_t *shared,
+    const hsize_t *scaled);
+static herr_t H5D__chunk_cache_resize(const H5D_t *dset, size_t nbuckets);
 static herr_t H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent,
     hbool_t reset);
 static herr_t H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent,
     hbool_t flush);
+static herr_t H5D__chunk_write_block(const H5D_t *dset, H5D_chunk_ud_t *udata,
+    H5F_block_t *old_chunk, hbool_t must_alloc, const void *buf);
+static herr_t H5D__chunk_wb_create(const H5D_t *dset, size_t nmax);
+static herr_t H5D__chunk_wb_dest(H5D_chunk_wb_t *wb);
+static herr_t H5D__chunk_wb_filter(const H5D_chunk_wb_t *wb,
+    H5D_chunk_wb_ent_t *ent);
+static herr_t H5D__chunk_wb_enqueue(const H5D_t *dset, H5D_rdcc_ent_t *ent);
+static herr_t H5D__chunk_wb_retire(const H5D_t *dset, size_t nleave);
+static herr_t H5D__chunk_wb_retire_chunk(const H5D_t *dset, const hsize_t *scaled);
 static hbool_t H5D__chunk_is_partial_edge_chunk(unsigned dset_ndims,
     const uint32_t *chunk_dims, const hsize_t *chunk_scaled, const hsize_t *dset_dims);
+static herr_t H5D__chunk_file_alloc_check(const H5D_chk_idx_info_t *idx_info,
+    const H5F_block_t *old_chunk, hbool_t release_old, H5F_block_t *new_chunk,
+    hbool_t *alloc_chunk);
+static hsize_t H5D__chunk_shard_count(const H5O_layout_chunk_t *layout,
+    size_t *shard_size);
+static void H5D__chunk_shard_offset(const H5O_layout_chunk_t *layout,
+    hsize_t idx, hsize_t offset[]);
+static herr_t H5D__chunk_shard_decode(const H5O_layout_chunk_t *layout,
+    const H5O_pline_t *pline, hsize_t idx, unsigned filter_mask, H5Z_EDC_t edc,
+    H5Z_cb_t cb, const uint8_t *src, size_t nbytes, void *chunk);
+static herr_t H5D__chunk_read_shards(const H5D_t *dset, const H5O_pline_t *pline,
+    haddr_t addr, size_t nbytes, const void *chunk_buf, unsigned filter_mask,
+    H5S_t *sel, void *chunk);
+static herr_t H5D__chunk_fill_write(H5F_t *f, H5D_chunk_fill_run_t *run,
+    haddr_t addr, size_t nchunks, size_t chunk_size, const void *fill_buf);
+static herr_t H5D__chunk_allocate_batch(const H5D_t *dset,
+    const H5D_chk_idx_info_t *idx_info, H5D_chunk_direct_ent_t *ents,
+    size_t nents, void * const *fill_bufs, const size_t *fill_sizes,
+    H5D_chunk_fill_run_t *run);
+static herr_t H5D__chunk_copy_bulk_add(H5D_chunk_it_ud3_t *udata,
+    const H5D_chunk_ud_t *udata_dst);
+static herr_t H5D__chunk_copy_bulk_fill_cb(H5D_chunk_rec_t *chunk_rec,
+    void *_udata);
 static void *H5D__chunk_lock(const H5D_io_info_t *io_info,
-    H5D_chunk_ud_t *udata, hbool_t relax, hbool_t prev_unfilt_chunk);
+    H5D_chunk_ud_t *udata, hbool_t relax, hbool_t prev_unfilt_chunk,
+    const void *chunk_buf, H5S_t *chunk_sel);
 static herr_t H5D__chunk_unlock(const H5D_io_info_t *io_info,
     const H5D_chunk_ud_t *udata, hbool_t dirty, void *chunk, uint32_t naccessed);
 static herr_t H5D__chunk_cache_prune(const H5D_t *dset, size_t size);
@@ -363,6 +526,12 @@ H5FL_DEFINE(H5D_chunk_info_t);
 /* Declare a free list to manage the chunk sequence information */
 H5FL_BLK_DEFINE_STATIC(chunk);
 
+/* Declare a free list to manage the chunk read schedule information */
+H5FL_SEQ_DEFINE_STATIC(H5D_chunk_read_sched_t);
+
+/* Declare a free list to manage H5D_chunk_wb_ent_t objects */
+H5FL_DEFINE_STATIC(H5D_chunk_wb_ent_t);
+
 /* Declare extern free list to manage the H5S_sel_iter_t struct */
 H5FL_EXTERN(H5S_sel_iter_t);
 
@@ -448,12 +617,9 @@ H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters, hsize_t *offset,
 
     /* Evict the (old) entry from the cache if present, but do not flush
      * it to disk */
-    if(UINT_MAX != udata.idx_hint) {
-        const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);	/*raw data chunk cache */
-
-        if(H5D__chunk_cache_evict(dset, rdcc->slot[udata.idx_hint], FALSE) < 0)
+    if(NULL != udata.cache_ent)
+        if(H5D__chunk_cache_evict(dset, udata.cache_ent, FALSE) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
-    } /* end if */
 
     /* Write the data to the file */
     if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, udata.chunk_block.offset, data_size, buf) < 0)
@@ -490,7 +656,6 @@ H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset, uint32_t* filters,
     void *buf)
 {
     const H5O_layout_t *layout = &(dset->shared->layout);    /* Dataset layout */
-    const H5D_rdcc_t   *rdcc = &(dset->shared->cache.chunk); /* raw data chunk cache */
     H5D_chunk_ud_t     udata;          /* User data for querying chunk info */
     hsize_t scaled[H5S_MAX_RANK];       /* Scaled coordinates for this chunk */
     herr_t             ret_value = SUCCEED;        /* Return value */
@@ -517,7 +682,7 @@ H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset, uint32_t* filters,
     udata.filter_mask = 0;
     udata.chunk_block.offset = HADDR_UNDEF;
     udata.chunk_block.length = 0;
-    udata.idx_hint = UINT_MAX;
+    udata.cache_ent = NULL;
 
     /* Find out the file address of the chunk */
     if(H5D__chunk_lookup(dset, scaled, &udata) < 0)
@@ -528,25 +693,21 @@ H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset, uint32_t* filters,
             (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
 
     /* Check if the requested chunk exists in the chunk cache */
-    if(UINT_MAX != udata.idx_hint) {
-        H5D_rdcc_ent_t *ent = rdcc->slot[udata.idx_hint];
+    if(NULL != udata.cache_ent) {
+        H5D_rdcc_ent_t *ent = udata.cache_ent;
         hbool_t flush;
 
-        /* Sanity checks  */
-        HDassert(udata.idx_hint < rdcc->nslots);
-        HDassert(rdcc->slot[udata.idx_hint]);
-
         flush = (ent->dirty == TRUE) ? TRUE : FALSE;
 
         /* Flush the chunk to disk and clear the cache entry */
-        if(H5D__chunk_cache_evict(dset, rdcc->slot[udata.idx_hint], flush) < 0)
+        if(H5D__chunk_cache_evict(dset, udata.cache_ent, flush) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
 
         /* Reset fields about the chunk we are looking for */
         udata.filter_mask = 0;
         udata.chunk_block.offset = HADDR_UNDEF;
         udata.chunk_block.length = 0;
-        udata.idx_hint = UINT_MAX;
+        udata.cache_ent = NULL;
 
         /* Get the new file address / chunk size after flushing */
         if(H5D__chunk_lookup(dset, scaled, &udata) < 0)
@@ -568,6 +729,464 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__chunk_direct_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_direct_cmp_scaled
+ *
+ * Purpose:	Compare two chunks in a batch by their scaled coordinates.
+ *
+ * Return:	-1, 0 or 1, as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_direct_cmp_scaled(const void *_ent1, const void *_ent2)
+{
+    const H5D_chunk_direct_ent_t *ent1 = (const H5D_chunk_direct_ent_t *)_ent1;
+    const H5D_chunk_direct_ent_t *ent2 = (const H5D_chunk_direct_ent_t *)_ent2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5VM_vector_cmp_u(H5O_LAYOUT_NDIMS, ent1->scaled, ent2->scaled))
+} /* end H5D__chunk_direct_cmp_scaled() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_direct_cmp_addr
+ *
+ * Purpose:	Compare two pointers to chunks in a batch by the chunks'
+ *		file addresses.
+ *
+ * Return:	-1, 0 or 1, as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_direct_cmp_addr(const void *_ent1, const void *_ent2)
+{
+    const H5D_chunk_direct_ent_t *ent1 = *(const H5D_chunk_direct_ent_t * const *)_ent1;
+    const H5D_chunk_direct_ent_t *ent2 = *(const H5D_chunk_direct_ent_t * const *)_ent2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(ent1->udata.chunk_block.offset, ent2->udata.chunk_block.offset))
+} /* end H5D__chunk_direct_cmp_addr() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_direct_setup
+ *
+ * Purpose:	Check the offsets of a batch of chunks and set up an array
+ *		describing the chunks, sorted by their scaled coordinates.
+ *		A chunk may only appear once in a batch.
+ *
+ *		The array is returned in ENTS_OUT and must be freed by the
+ *		caller.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_direct_setup(const H5D_t *dset, size_t nchunks,
+    const hsize_t offsets[], H5D_chunk_direct_ent_t **ents_out)
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);   /* Dataset layout */
+    unsigned ndims = dset->shared->ndims;   /* Rank of dataset */
+    H5D_chunk_direct_ent_t *ents = NULL;    /* Chunks in batch */
+    size_t u;                               /* Local index variable */
+    herr_t ret_value = SUCCEED;             /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(nchunks > 0);
+    HDassert(offsets);
+    HDassert(ents_out);
+
+    if(NULL == (ents = (H5D_chunk_direct_ent_t *)H5MM_calloc(nchunks * sizeof(H5D_chunk_direct_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+
+    for(u = 0; u < nchunks; u++) {
+        hsize_t offset_copy[H5O_LAYOUT_NDIMS];  /* Internal copy of chunk offset */
+
+        if(H5D__get_offset_copy(dset, offsets + (u * ndims), offset_copy) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "invalid chunk offset")
+        H5VM_chunk_scaled(ndims, offset_copy, layout->u.chunk.dim, ents[u].scaled);
+        ents[u].idx = u;
+    } /* end for */
+
+    /* Sort the chunks in the order of their coordinates, which is the order
+     * of their keys in the index, and check for duplicates.
+     */
+    if(nchunks > 1) {
+        HDqsort(ents, nchunks, sizeof(H5D_chunk_direct_ent_t), H5D__chunk_direct_cmp_scaled);
+        for(u = 1; u < nchunks; u++)
+            if(0 == H5VM_vector_cmp_u(ndims, ents[u - 1].scaled, ents[u].scaled))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "chunk appears more than once in batch")
+    } /* end if */
+
+    *ents_out = ents;
+    ents = NULL;
+
+done:
+    H5MM_xfree(ents);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_direct_setup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_direct_write_multi
+ *
+ * Purpose:	Internal routine to write a batch of chunks directly into
+ *		the file.
+ *
+ *		All the chunks are looked up first.  File space for the
+ *		chunks that need it is allocated as a single block, which
+ *		is divided among the chunks in the order of their
+ *		coordinates.  Chunks that are adjacent in the file are
+ *		written with one I/O call (up to the size of the chunk
+ *		cache), and finally the new chunks are inserted into the
+ *		index, again in the order of their coordinates.
+ *
+ *		Datasets that use the implicit or single chunk index write
+ *		the chunks one by one.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_direct_write_multi(const H5D_t *dset, size_t nchunks,
+    const uint32_t filters[], const hsize_t offsets[], const size_t data_sizes[],
+    const void *bufs[])
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);   /* Dataset layout */
+    const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);  /* Raw data chunk cache */
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+    H5D_io_info_t io_info;              /* to hold the dset info */
+    H5D_chunk_direct_ent_t *ents = NULL;    /* Chunks in batch, in coordinate order */
+    H5D_chunk_direct_ent_t **by_addr = NULL;    /* Chunks in batch, in address order */
+    hsize_t alloc_size = 0;             /* Size of file space to allocate */
+    uint8_t *run_buf = NULL;            /* Buffer for writing runs of adjacent chunks */
+    size_t run_buf_size = 0;            /* Size of run_buf */
+    size_t u, v;                        /* Local index variables */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Check args */
+    HDassert(dset && H5D_CHUNKED == layout->type);
+    HDassert(0 == nchunks || filters);
+    HDassert(0 == nchunks || offsets);
+    HDassert(0 == nchunks || data_sizes);
+    HDassert(0 == nchunks || bufs);
+
+    if(0 == nchunks)
+        HGOTO_DONE(SUCCEED)
+
+    /* The implicit index has no space to allocate, and the single chunk
+     * index holds only one chunk, so just write the chunks one by one.
+     */
+    if(H5D_CHUNK_IDX_NONE == layout->storage.u.chunk.idx_type
+            || H5D_CHUNK_IDX_SINGLE == layout->storage.u.chunk.idx_type) {
+        for(u = 0; u < nchunks; u++) {
+            hsize_t offset_copy[H5O_LAYOUT_NDIMS];  /* Internal copy of chunk offset */
+
+            if(H5D__get_offset_copy(dset, offsets + (u * dset->shared->ndims), offset_copy) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "invalid chunk offset")
+            if(H5D__chunk_direct_write(dset, filters[u], offset_copy, (uint32_t)data_sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write chunk")
+        } /* end for */
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Check the chunk offsets and sort the chunks */
+    if(H5D__chunk_direct_setup(dset, nchunks, offsets, &ents) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "unable to set up chunk batch")
+
+    io_info.dset = dset;
+
+    /* Allocate dataspace and initialize it if it hasn't been. */
+    if(!(*layout->ops->is_space_alloc)(&layout->storage))
+        /* Allocate storage */
+        if(H5D__alloc_storage(&io_info, H5D_ALLOC_WRITE, FALSE, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize storage")
+
+    /* Compose chunked index info struct */
+    idx_info.f = dset->oloc.file;
+    idx_info.pline = &(dset->shared->dcpl_cache.pline);
+    idx_info.layout = &(dset->shared->layout.u.chunk);
+    idx_info.storage = &(dset->shared->layout.storage.u.chunk);
+
+    /* Look up all the chunks and work out which ones need file space */
+    for(u = 0; u < nchunks; u++) {
+        H5D_chunk_direct_ent_t *ent = &ents[u];
+
+        /* Find out the file address of the chunk (if any) */
+        if(H5D__chunk_lookup(dset, ent->scaled, &ent->udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+        /* Sanity check */
+        HDassert((H5F_addr_defined(ent->udata.chunk_block.offset) && ent->udata.chunk_block.length > 0) ||
+                (!H5F_addr_defined(ent->udata.chunk_block.offset) && ent->udata.chunk_block.length == 0));
+
+        /* Evict the (old) entry from the cache if present, but do not flush
+         * it to disk */
+        if(NULL != ent->udata.cache_ent) {
+            if(H5D__chunk_cache_evict(dset, ent->udata.cache_ent, FALSE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
+            ent->udata.cache_ent = NULL;
+        } /* end if */
+
+        /* Set the file block information for the old chunk */
+        ent->old_chunk = ent->udata.chunk_block;
+
+        /* Set up the new chunk */
+        ent->udata.chunk_block.offset = HADDR_UNDEF;
+        ent->udata.chunk_block.length = data_sizes[ent->idx];
+
+        if(0 == idx_info.pline->nused && H5F_addr_defined(ent->old_chunk.offset))
+            /* If there are no filters and we are overwriting the chunk we can just set values */
+            ent->udata.chunk_block.offset = ent->old_chunk.offset;
+        else {
+            /* Otherwise, check if the chunk doesn't exist or its size has
+             * changed.  The old chunk is released only after the new
+             * chunks have been written and inserted into the index, so the
+             * index never points at freed space if the batch fails.
+             */
+            if(H5D__chunk_file_alloc_check(&idx_info, &ent->old_chunk, FALSE, &ent->udata.chunk_block, &ent->alloc) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
+            if(ent->alloc)
+                alloc_size += ent->udata.chunk_block.length;
+        } /* end else */
+    } /* end for */
+
+    /* Allocate space for all the new chunks at once */
+    if(alloc_size > 0) {
+        haddr_t addr;                   /* Address of next new chunk */
+
+        if(HADDR_UNDEF == (addr = H5MF_alloc(dset->oloc.file, H5FD_MEM_DRAW, alloc_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "file allocation failed")
+        for(u = 0; u < nchunks; u++)
+            if(ents[u].alloc) {
+                ents[u].udata.chunk_block.offset = addr;
+                ents[u].need_insert = TRUE;
+                addr += ents[u].udata.chunk_block.length;
+            } /* end if */
+    } /* end if */
+
+    /* Write the chunks in file address order, with a single I/O call for
+     * runs of chunks that are adjacent in the file.
+     */
+    if(NULL == (by_addr = (H5D_chunk_direct_ent_t **)H5MM_malloc(nchunks * sizeof(H5D_chunk_direct_ent_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+    for(u = 0; u < nchunks; u++) {
+        /* Make sure the address of the chunk is defined */
+        if(!H5F_addr_defined(ents[u].udata.chunk_block.offset))
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk address isn't defined")
+        by_addr[u] = &ents[u];
+    } /* end for */
+    HDqsort(by_addr, nchunks, sizeof(H5D_chunk_direct_ent_t *), H5D__chunk_direct_cmp_addr);
+    for(u = 0; u < nchunks; u = v) {
+        const H5F_block_t *block = &by_addr[u]->udata.chunk_block;
+        size_t run_len = (size_t)block->length;     /* Length of run of chunks */
+
+        for(v = u + 1; v < nchunks; v++) {
+            const H5F_block_t *next_block = &by_addr[v]->udata.chunk_block;
+
+            if(next_block->offset != block->offset + run_len
+                    || run_len + next_block->length > rdcc->nbytes_max)
+                break;
+            run_len += (size_t)next_block->length;
+        } /* end for */
+
+        if(v > u + 1) {
+            size_t w;                       /* Local index variable */
+            size_t run_off = 0;             /* Offset of chunk in run_buf */
+
+            /* Make sure the buffer is large enough */
+            if(run_len > run_buf_size) {
+                run_buf = (uint8_t *)H5MM_xfree(run_buf);
+                if(NULL == (run_buf = (uint8_t *)H5MM_malloc(run_len)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunks")
+                run_buf_size = run_len;
+            } /* end if */
+
+            /* Gather the chunks into the buffer */
+            for(w = u; w < v; w++) {
+                HDmemcpy(run_buf + run_off, bufs[by_addr[w]->idx], (size_t)by_addr[w]->udata.chunk_block.length);
+                run_off += (size_t)by_addr[w]->udata.chunk_block.length;
+            } /* end for */
+
+            if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, block->offset, run_len, run_buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+        } /* end if */
+        else
+            if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, block->offset, run_len, bufs[by_addr[u]->idx]) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+    } /* end for */
+
+    /* Insert the new chunk records into the index */
+    for(u = 0; u < nchunks; u++) {
+        H5D_chunk_direct_ent_t *ent = &ents[u];
+
+        if(ent->need_insert && layout->storage.u.chunk.ops->insert) {
+            /* Set the chunk's filter mask to the new settings */
+            ent->udata.filter_mask = filters[ent->idx];
+
+            if((layout->storage.u.chunk.ops->insert)(&idx_info, &ent->udata, dset) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+
+            /* Cache the new chunk information */
+            H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, &ent->udata);
+        } /* end if */
+    } /* end for */
+
+    /* Release the old chunks that were moved.  Only free the old locations
+     * if not doing SWMR writes - otherwise we must keep the old chunks
+     * around in case a reader has an outdated version of the index.
+     */
+    if(!(H5F_INTENT(dset->oloc.file) & H5F_ACC_SWMR_WRITE))
+        for(u = 0; u < nchunks; u++)
+            if(ents[u].alloc && H5F_addr_defined(ents[u].old_chunk.offset))
+                if(H5MF_xfree(dset->oloc.file, H5FD_MEM_DRAW, ents[u].old_chunk.offset, ents[u].old_chunk.length) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk")
+
+done:
+    H5MM_xfree(ents);
+    H5MM_xfree(by_addr);
+    H5MM_xfree(run_buf);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_direct_write_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_direct_read_multi
+ *
+ * Purpose:	Internal routine to read a batch of chunks directly from
+ *		the file.  The chunks are read in file address order, with
+ *		a single I/O call for runs of chunks that are adjacent in
+ *		the file (up to the size of the chunk cache).
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_direct_read_multi(const H5D_t *dset, size_t nchunks,
+    const hsize_t offsets[], uint32_t filters[], void *bufs[])
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);   /* Dataset layout */
+    const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);  /* Raw data chunk cache */
+    H5D_chunk_direct_ent_t *ents = NULL;    /* Chunks in batch, in coordinate order */
+    H5D_chunk_direct_ent_t **by_addr = NULL;    /* Chunks in batch, in address order */
+    uint8_t *run_buf = NULL;            /* Buffer for reading runs of adjacent chunks */
+    size_t run_buf_size = 0;            /* Size of run_buf */
+    size_t u, v;                        /* Local index variables */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Check args */
+    HDassert(dset && H5D_CHUNKED == layout->type);
+    HDassert(0 == nchunks || offsets);
+    HDassert(0 == nchunks || filters);
+    HDassert(0 == nchunks || bufs);
+
+    if(0 == nchunks)
+        HGOTO_DONE(SUCCEED)
+
+    /* Allocate dataspace and initialize it if it hasn't been. */
+    if(!(*layout->ops->is_space_alloc)(&layout->storage))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "storage is not initialized")
+
+    /* Check the chunk offsets and sort the chunks */
+    if(H5D__chunk_direct_setup(dset, nchunks, offsets, &ents) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "unable to set up chunk batch")
+
+    /* Flush any of the chunks that are in the chunk cache to the file */
+    for(u = 0; u < nchunks; u++) {
+        H5D_chunk_direct_ent_t *ent = &ents[u];
+
+        if(H5D__chunk_lookup(dset, ent->scaled, &ent->udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+        if(NULL != ent->udata.cache_ent)
+            if(H5D__chunk_cache_evict(dset, ent->udata.cache_ent, ent->udata.cache_ent->dirty) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
+    } /* end for */
+
+    /* Get the file addresses of the chunks (after flushing) */
+    if(NULL == (by_addr = (H5D_chunk_direct_ent_t **)H5MM_malloc(nchunks * sizeof(H5D_chunk_direct_ent_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+    for(u = 0; u < nchunks; u++) {
+        H5D_chunk_direct_ent_t *ent = &ents[u];
+
+        if(NULL != ent->udata.cache_ent)
+            if(H5D__chunk_lookup(dset, ent->scaled, &ent->udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+        /* Make sure the address of the chunk is returned. */
+        if(!H5F_addr_defined(ent->udata.chunk_block.offset))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "chunk address isn't defined")
+        by_addr[u] = ent;
+    } /* end for */
+    HDqsort(by_addr, nchunks, sizeof(H5D_chunk_direct_ent_t *), H5D__chunk_direct_cmp_addr);
+
+    /* Read the chunks */
+    for(u = 0; u < nchunks; u = v) {
+        const H5F_block_t *block = &by_addr[u]->udata.chunk_block;
+        size_t run_len = (size_t)block->length;     /* Length of run of chunks */
+
+        for(v = u + 1; v < nchunks; v++) {
+            const H5F_block_t *next_block = &by_addr[v]->udata.chunk_block;
+
+            if(next_block->offset != block->offset + run_len
+                    || run_len + next_block->length > rdcc->nbytes_max)
+                break;
+            run_len += (size_t)next_block->length;
+        } /* end for */
+
+        if(v > u + 1) {
+            size_t w;                       /* Local index variable */
+            size_t run_off = 0;             /* Offset of chunk in run_buf */
+
+            /* Make sure the buffer is large enough */
+            if(run_len > run_buf_size) {
+                run_buf = (uint8_t *)H5MM_xfree(run_buf);
+                if(NULL == (run_buf = (uint8_t *)H5MM_malloc(run_len)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunks")
+                run_buf_size = run_len;
+            } /* end if */
+
+            if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, block->offset, run_len, run_buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+
+            /* Scatter the chunks to the caller's buffers */
+            for(w = u; w < v; w++) {
+                HDmemcpy(bufs[by_addr[w]->idx], run_buf + run_off, (size_t)by_addr[w]->udata.chunk_block.length);
+                run_off += (size_t)by_addr[w]->udata.chunk_block.length;
+            } /* end for */
+        } /* end if */
+        else
+            if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, block->offset, run_len, bufs[by_addr[u]->idx]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+    } /* end for */
+
+    /* Return the filter masks */
+    for(u = 0; u < nchunks; u++)
+        filters[ents[u].idx] = ents[u].udata.filter_mask;
+
+done:
+    H5MM_xfree(ents);
+    H5MM_xfree(by_addr);
+    H5MM_xfree(run_buf);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_direct_read_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__get_chunk_storage_size
@@ -585,7 +1204,6 @@ herr_t
 H5D__get_chunk_storage_size(H5D_t *dset, const hsize_t *offset, hsize_t *storage_size)
 {
     const H5O_layout_t *layout = &(dset->shared->layout);    /* Dataset layout */
-    const H5D_rdcc_t   *rdcc = &(dset->shared->cache.chunk); /* raw data chunk cache */
     hsize_t scaled[H5S_MAX_RANK];       /* Scaled coordinates for this chunk */
     H5D_chunk_ud_t     udata;           /* User data for querying chunk info */
     herr_t             ret_value = SUCCEED;        /* Return value */
@@ -610,7 +1228,7 @@ H5D__get_chunk_storage_size(H5D_t *dset, const hsize_t *offset, hsize_t *storage
     /* Reset fields about the chunk we are looking for */
     udata.chunk_block.offset = HADDR_UNDEF;
     udata.chunk_block.length = 0;
-    udata.idx_hint = UINT_MAX;
+    udata.cache_ent = NULL;
 
     /* Find out the file address of the chunk */
     if(H5D__chunk_lookup(dset, scaled, &udata) < 0)
@@ -621,29 +1239,25 @@ H5D__get_chunk_storage_size(H5D_t *dset, const hsize_t *offset, hsize_t *storage
             (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
 
     /* The requested chunk is not in cache or on disk */
-    if(!H5F_addr_defined(udata.chunk_block.offset) && UINT_MAX == udata.idx_hint)
+    if(!H5F_addr_defined(udata.chunk_block.offset) && NULL == udata.cache_ent)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "chunk storage is not allocated")
 
     /* Check if there are filters registered to the dataset */
     if( dset->shared->dcpl_cache.pline.nused > 0 ) {
         /* Check if the requested chunk exists in the chunk cache */
-        if(UINT_MAX != udata.idx_hint) {
-            H5D_rdcc_ent_t *ent = rdcc->slot[udata.idx_hint];
-
-            /* Sanity checks  */
-            HDassert(udata.idx_hint < rdcc->nslots);
-            HDassert(rdcc->slot[udata.idx_hint]);
+        if(NULL != udata.cache_ent) {
+            H5D_rdcc_ent_t *ent = udata.cache_ent;
 
             /* If the cached chunk is dirty, it must be flushed to get accurate size */
             if( ent->dirty == TRUE ) {
                 /* Flush the chunk to disk and clear the cache entry */
-                if(H5D__chunk_cache_evict(dset, rdcc->slot[udata.idx_hint], TRUE) < 0)
+                if(H5D__chunk_cache_evict(dset, udata.cache_ent, TRUE) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
 
                 /* Reset fields about the chunk we are looking for */
                 udata.chunk_block.offset = HADDR_UNDEF;
                 udata.chunk_block.length = 0;
-                udata.idx_hint = UINT_MAX;
+                udata.cache_ent = NULL;
 
                 /* Get the new file address / chunk size after flushing */
                 if(H5D__chunk_lookup(dset, scaled, &udata) < 0)
@@ -668,61 +1282,235 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__chunk_set_info_real
+ * Function:    H5D__chunk_iter_cb
  *
- * Purpose:	Internal routine to set the information about chunks for a dataset
- *
- * Return:	Non-negative on success/Negative on failure
+ * Purpose:     Callback when gathering information about all the chunks
+ *              for H5D__chunk_iter.
  *
- * Programmer:	Quincey Koziol
- *              Tuesday, June 30, 2009
+ * Return:      Success:        H5_ITER_CONT
+ *              Failure:        H5_ITER_ERROR
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5D__chunk_set_info_real(H5O_layout_chunk_t *layout, unsigned ndims,
-    const hsize_t *curr_dims, const hsize_t *max_dims)
+static int
+H5D__chunk_iter_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
 {
-    unsigned u;                 /* Local index variable */
-    herr_t ret_value = SUCCEED; /* Return value */
+    H5D_chunk_iter_ud_t *udata = (H5D_chunk_iter_ud_t *)_udata;    /* User data for callback */
+    H5D_chunk_iter_rec_t *rec;          /* Record for this chunk */
+    int ret_value = H5_ITER_CONT;       /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Sanity checks */
-    HDassert(layout);
-    HDassert(ndims > 0);
-    HDassert(curr_dims);
-
-    /* Compute the # of chunks in dataset dimensions */
-    for(u = 0, layout->nchunks = 1, layout->max_nchunks = 1; u < ndims; u++) {
-        /* Sanity check */
-        HDassert(layout->dim[u] > 0);
-        
-        /* Round up to the next integer # of chunks, to accommodate partial chunks */
-        layout->chunks[u] = ((curr_dims[u] + layout->dim[u]) - 1) / layout->dim[u];
-        if(H5S_UNLIMITED == max_dims[u])
-            layout->max_chunks[u] = H5S_UNLIMITED;
-        else
-            layout->max_chunks[u] = ((max_dims[u] + layout->dim[u]) - 1) / layout->dim[u];
-
-        /* Accumulate the # of chunks */
-        layout->nchunks *= layout->chunks[u];
-        layout->max_nchunks *= layout->max_chunks[u];
-    } /* end for */
+    /* Make room for another record, if necessary */
+    if(udata->nrecs == udata->nalloc) {
+        size_t nalloc = MAX(256, udata->nalloc * 2);
+        H5D_chunk_iter_rec_t *recs;
+        hsize_t *scaled;
+
+        if(NULL == (recs = (H5D_chunk_iter_rec_t *)H5MM_realloc(udata->recs, nalloc * sizeof(H5D_chunk_iter_rec_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, H5_ITER_ERROR, "unable to allocate chunk records")
+        udata->recs = recs;
+        if(NULL == (scaled = (hsize_t *)H5MM_realloc(udata->scaled, nalloc * udata->ndims * sizeof(hsize_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, H5_ITER_ERROR, "unable to allocate chunk coordinates")
+        udata->scaled = scaled;
+        udata->nalloc = nalloc;
+    } /* end if */
 
-    /* Get the "down" sizes for each dimension */
-    if(H5VM_array_down(ndims, layout->chunks, layout->down_chunks) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't compute 'down' chunk size value")
-    if(H5VM_array_down(ndims, layout->max_chunks, layout->max_down_chunks) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't compute 'down' chunk size value")
+    /* Remember the chunk */
+    rec = &udata->recs[udata->nrecs];
+    rec->chunk_addr = chunk_rec->chunk_addr;
+    rec->nbytes = chunk_rec->nbytes;
+    rec->filter_mask = chunk_rec->filter_mask;
+    rec->scaled_off = udata->nrecs * udata->ndims;
+    HDmemcpy(&udata->scaled[rec->scaled_off], chunk_rec->scaled, udata->ndims * sizeof(hsize_t));
+    udata->nrecs++;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_set_info_real() */
+} /* H5D__chunk_iter_cb() */
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__chunk_set_info
+ * Function:    H5D__chunk_iter_cmp_inc
+ *
+ * Purpose:     Compare two chunk records by increasing file address.
+ *
+ * Return:      -1, 0 or 1, as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_iter_cmp_inc(const void *_rec1, const void *_rec2)
+{
+    const H5D_chunk_iter_rec_t *rec1 = (const H5D_chunk_iter_rec_t *)_rec1;
+    const H5D_chunk_iter_rec_t *rec2 = (const H5D_chunk_iter_rec_t *)_rec2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(rec1->chunk_addr, rec2->chunk_addr))
+} /* H5D__chunk_iter_cmp_inc() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_iter_cmp_dec
+ *
+ * Purpose:     Compare two chunk records by decreasing file address.
+ *
+ * Return:      -1, 0 or 1, as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_iter_cmp_dec(const void *_rec1, const void *_rec2)
+{
+    const H5D_chunk_iter_rec_t *rec1 = (const H5D_chunk_iter_rec_t *)_rec1;
+    const H5D_chunk_iter_rec_t *rec2 = (const H5D_chunk_iter_rec_t *)_rec2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(rec2->chunk_addr, rec1->chunk_addr))
+} /* H5D__chunk_iter_cmp_dec() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_iter
+ *
+ * Purpose:     Internal routine to make a callback for every allocated
+ *              chunk in a dataset.  The chunk index is only traversed
+ *              once, to gather the information about all the chunks, and
+ *              then the callback is made for each chunk, either in the
+ *              order the index holds them (H5_ITER_NATIVE) or in order of
+ *              file address (H5_ITER_INC / H5_ITER_DEC).
+ *
+ *              Dirty chunks in the chunk cache are flushed first, so
+ *              that their addresses and sizes are known.
+ *
+ * Return:      Success:        The return value of the last callback
+ *                              (zero, or positive if iteration was
+ *                              stopped early)
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_iter(H5D_t *dset, H5_iter_order_t order, H5D_chunk_iter_op_t op,
+    void *op_data)
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);    /* Dataset layout */
+    H5D_chunk_iter_ud_t udata;          /* User data for iteration callback */
+    hsize_t offset[H5O_LAYOUT_NDIMS];   /* Logical offset of chunk */
+    size_t u;                           /* Local index variable */
+    unsigned v;                         /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Check args */
+    HDassert(dset && H5D_CHUNKED == layout->type);
+    HDassert(order == H5_ITER_INC || order == H5_ITER_DEC || order == H5_ITER_NATIVE);
+    HDassert(op);
+
+    HDmemset(&udata, 0, sizeof(udata));
+    udata.ndims = dset->shared->ndims;
+
+    /* Write any dirty chunks, so they are in the index */
+    if(H5D__chunk_flush(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush cached chunks")
+
+    /* Gather the information for all the chunks */
+    if((*layout->ops->is_space_alloc)(&layout->storage)) {
+        H5D_chk_idx_info_t idx_info;    /* Chunked index info */
+
+        /* Compose chunked index info struct */
+        idx_info.f = dset->oloc.file;
+        idx_info.pline = &dset->shared->dcpl_cache.pline;
+        idx_info.layout = &dset->shared->layout.u.chunk;
+        idx_info.storage = &dset->shared->layout.storage.u.chunk;
+
+        if((layout->storage.u.chunk.ops->iterate)(&idx_info, H5D__chunk_iter_cb, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to iterate over chunk index")
+    } /* end if */
+
+    /* Sort the chunks by address, if requested */
+    if(udata.nrecs > 1 && order != H5_ITER_NATIVE)
+        HDqsort(udata.recs, udata.nrecs, sizeof(H5D_chunk_iter_rec_t),
+                (order == H5_ITER_INC ? H5D__chunk_iter_cmp_inc : H5D__chunk_iter_cmp_dec));
+
+    /* Make the callback for each chunk */
+    for(u = 0; u < udata.nrecs && ret_value == 0; u++) {
+        const H5D_chunk_iter_rec_t *rec = &udata.recs[u];
+
+        for(v = 0; v < udata.ndims; v++)
+            offset[v] = udata.scaled[rec->scaled_off + v] * layout->u.chunk.dim[v];
+
+        if((ret_value = (op)(offset, rec->filter_mask, rec->chunk_addr, rec->nbytes, op_data)) < 0)
+            HERROR(H5E_DATASET, H5E_CANTNEXT, "iteration operator failed");
+    } /* end for */
+
+done:
+    H5MM_xfree(udata.recs);
+    H5MM_xfree(udata.scaled);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* H5D__chunk_iter() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_set_info_real
+ *
+ * Purpose:	Internal routine to set the information about chunks for a dataset
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ * Programmer:	Quincey Koziol
+ *              Tuesday, June 30, 2009
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_set_info_real(H5O_layout_chunk_t *layout, unsigned ndims,
+    const hsize_t *curr_dims, const hsize_t *max_dims)
+{
+    unsigned u;                 /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(layout);
+    HDassert(ndims > 0);
+    HDassert(curr_dims);
+
+    /* Compute the # of chunks in dataset dimensions */
+    for(u = 0, layout->nchunks = 1, layout->max_nchunks = 1; u < ndims; u++) {
+        /* Sanity check */
+        HDassert(layout->dim[u] > 0);
+        
+        /* Round up to the next integer # of chunks, to accommodate partial chunks */
+        layout->chunks[u] = ((curr_dims[u] + layout->dim[u]) - 1) / layout->dim[u];
+        if(H5S_UNLIMITED == max_dims[u])
+            layout->max_chunks[u] = H5S_UNLIMITED;
+        else
+            layout->max_chunks[u] = ((max_dims[u] + layout->dim[u]) - 1) / layout->dim[u];
+
+        /* Accumulate the # of chunks */
+        layout->nchunks *= layout->chunks[u];
+        layout->max_nchunks *= layout->max_chunks[u];
+    } /* end for */
+
+    /* Get the "down" sizes for each dimension */
+    if(H5VM_array_down(ndims, layout->chunks, layout->down_chunks) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't compute 'down' chunk size value")
+    if(H5VM_array_down(ndims, layout->max_chunks, layout->max_down_chunks) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't compute 'down' chunk size value")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_set_info_real() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_set_info
  *
  * Purpose:	Sets the information about chunks for a dataset
  *
@@ -786,6 +1574,7 @@ H5D__chunk_set_sizes(H5D_t *dset)
 
     /* Set the last dimension of the chunk size to the size of the datatype */
     dset->shared->layout.u.chunk.dim[dset->shared->layout.u.chunk.ndims - 1] = (uint32_t)H5T_GET_SIZE(dset->shared->type);
+    dset->shared->layout.u.chunk.shard_dim[dset->shared->layout.u.chunk.ndims - 1] = (uint32_t)H5T_GET_SIZE(dset->shared->type);
 
     /* Compute number of bytes to use for encoding chunk dimensions */
     max_enc_bytes_per_dim = 0;
@@ -873,6 +1662,22 @@ H5D__chunk_construct(H5F_t H5_ATTR_UNUSED *f, H5D_t *dset)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "chunk size must be <= maximum dimension size for fixed-sized dimensions")
     } /* end for */
 
+    /* Check the shard dimensions */
+    if(dset->shared->layout.u.chunk.flags & H5O_LAYOUT_CHUNK_SHARDED) {
+        if(dset->shared->layout.version < H5O_LAYOUT_VERSION_4)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "sharded chunks require the latest layout message version")
+        for(u = 0; u < dset->shared->layout.u.chunk.ndims - 1; u++)
+            if(0 == dset->shared->layout.u.chunk.shard_dim[u]
+                    || (dset->shared->layout.u.chunk.dim[u] % dset->shared->layout.u.chunk.shard_dim[u]))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "chunk size must be a multiple of the shard size, dim = %u ", u)
+
+        /* These filters set themselves up for the size of a whole chunk */
+        if(H5Z_filter_in_pline(&dset->shared->dcpl_cache.pline, H5Z_FILTER_NBIT)
+                || H5Z_filter_in_pline(&dset->shared->dcpl_cache.pline, H5Z_FILTER_SCALEOFFSET)
+                || H5Z_filter_in_pline(&dset->shared->dcpl_cache.pline, H5Z_FILTER_SZIP))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "filter can't be used with sharded chunks")
+    } /* end if */
+
     /* Reset address and pointer of the array struct for the chunked storage index */
     if(H5D_chunk_idx_reset(&dset->shared->layout.storage.u.chunk, TRUE) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to reset chunked storage index")
@@ -901,6 +1706,7 @@ H5D__chunk_init(H5F_t *f, const H5D_t *dset, hid_t dapl_id)
     H5D_chk_idx_info_t idx_info;        /* Chunked index info */
     H5D_rdcc_t	*rdcc = &(dset->shared->cache.chunk);   /* Convenience pointer to dataset's chunk cache */
     H5P_genplist_t *dapl;               /* Data access property list object pointer */
+    size_t      wb_nchunks;             /* Size of chunk write-behind queue */
     H5O_storage_chunk_t *sc = &(dset->shared->layout.storage.u.chunk);
     herr_t      ret_value = SUCCEED;    /* Return value */
 
@@ -930,11 +1736,38 @@ H5D__chunk_init(H5F_t *f, const H5D_t *dset, hid_t dapl_id)
     if(rdcc->w0 < 0)
         rdcc->w0 = H5F_RDCC_W0(f);
 
+    /* Create the write-behind queue for dirty chunks, if requested.  (Not
+     * with parallel I/O, where filtered chunks aren't written through the
+     * chunk cache.)
+     */
+    if(H5P_get(dapl, H5D_ACS_CHUNK_WRITE_BEHIND_NAME, &wb_nchunks) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk write-behind queue size")
+    if(wb_nchunks > 0 && dset->shared->dcpl_cache.pline.nused > 0
+#ifdef H5_HAVE_PARALLEL
+            && !H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI)
+#endif /* H5_HAVE_PARALLEL */
+            )
+        if(H5D__chunk_wb_create(dset, wb_nchunks) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create chunk write-behind queue")
+
     /* If nbytes_max or nslots is 0, set them both to 0 and avoid allocating space */
     if(!rdcc->nbytes_max || !rdcc->nslots)
         rdcc->nbytes_max = rdcc->nslots = 0;
     else {
-        rdcc->slot = H5FL_SEQ_CALLOC(H5D_rdcc_ent_ptr_t, rdcc->nslots);
+        size_t nchunks;         /* Number of chunks that fit in the cache */
+
+        /* The number of slots is only a hint for the initial size of the
+         * hash table, which grows with the number of chunks actually cached.
+         * Don't start out larger than the # of chunks that can fit.
+         */
+        nchunks = rdcc->nslots;
+        if(dset->shared->layout.u.chunk.size > 0)
+            nchunks = MIN(nchunks, rdcc->nbytes_max / dset->shared->layout.u.chunk.size);
+        nchunks = MAX(nchunks, H5D_CHUNK_CACHE_MIN_BUCKETS);
+        H5_CHECKED_ASSIGN(rdcc->nbuckets_min, size_t, H5VM_power2up((hsize_t)nchunks), hsize_t);
+        rdcc->nbuckets = rdcc->nbuckets_min;
+
+        rdcc->slot = H5FL_SEQ_CALLOC(H5D_rdcc_ent_ptr_t, rdcc->nbuckets);
         if(NULL == rdcc->slot)
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
 
@@ -942,32 +1775,6 @@ H5D__chunk_init(H5F_t *f, const H5D_t *dset, hid_t dapl_id)
         H5D__chunk_cinfo_cache_reset(&(rdcc->last));
     } /* end else */
 
-    /* Compute scaled dimension info, if dataset dims > 1 */
-    if(dset->shared->ndims > 1) {
-        unsigned u;                         /* Local index value */
-
-        for(u = 0; u < dset->shared->ndims; u++) {
-            hsize_t scaled_power2up;    /* Scaled value, rounded to next power of 2 */
-
-            /* Initial scaled dimension sizes */
-            if(dset->shared->layout.u.chunk.dim[u] == 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk size must be > 0, dim = %u ", u)
-
-            /* Round up to the next integer # of chunks, to accommodate partial chunks */
-            rdcc->scaled_dims[u] = (dset->shared->curr_dims[u] + dset->shared->layout.u.chunk.dim[u] - 1) /
-                dset->shared->layout.u.chunk.dim[u];
-
-            if( !(scaled_power2up = H5VM_power2up(rdcc->scaled_dims[u])) )
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get the next power of 2")
-
-            /* Inital 'power2up' values for scaled dimensions */
-            rdcc->scaled_power2up[u] = scaled_power2up;
-
-            /* Number of bits required to encode scaled dimension size */
-            rdcc->scaled_encode_bits[u] = H5VM_log2_gen(rdcc->scaled_power2up[u]);
-        } /* end for */
-    } /* end if */
-
     /* Compose chunked index info struct */
     idx_info.f = f;
     idx_info.pline = &dset->shared->dcpl_cache.pline;
@@ -1409,118 +2216,548 @@ H5D__chunk_mem_realloc(void *chk, size_t size, const H5O_pline_t *pline)
 } /* H5D__chunk_mem_realloc() */
 
 
-/*--------------------------------------------------------------------------
- NAME
-    H5D__free_chunk_info
- PURPOSE
-    Internal routine to destroy a chunk info node
- USAGE
-    void H5D__free_chunk_info(chunk_info)
-        void *chunk_info;    IN: Pointer to chunk info to destroy
- RETURNS
-    No return value
- DESCRIPTION
-    Releases all the memory for a chunk info node.  Called by H5SL_free
- GLOBAL VARIABLES
- COMMENTS, BUGS, ASSUMPTIONS
- EXAMPLES
- REVISION LOG
---------------------------------------------------------------------------*/
-static herr_t
-H5D__free_chunk_info(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *opdata)
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_shard_count
+ *
+ * Purpose:     Compute the number of shards in each chunk of a sharded
+ *              chunk layout, and the size of each shard in bytes.
+ *
+ * Return:      Number of shards in a chunk (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5D__chunk_shard_count(const H5O_layout_chunk_t *layout, size_t *shard_size)
 {
-    H5D_chunk_info_t *chunk_info = (H5D_chunk_info_t *)item;
+    hsize_t     nshards = 1;            /* Number of shards in a chunk */
+    unsigned    u;                      /* Local index variable */
 
     FUNC_ENTER_STATIC_NOERR
 
-    HDassert(chunk_info);
+    HDassert(layout);
+    HDassert(layout->flags & H5O_LAYOUT_CHUNK_SHARDED);
+    HDassert(shard_size);
+
+    /* (The last dimension is the element size, which shards don't split) */
+    *shard_size = layout->shard_dim[layout->ndims - 1];
+    for(u = 0; u < layout->ndims - 1; u++) {
+        HDassert(layout->shard_dim[u] > 0);
+        nshards *= layout->dim[u] / layout->shard_dim[u];
+        *shard_size *= layout->shard_dim[u];
+    } /* end for */
 
-    /* Close the chunk's file dataspace, if it's not shared */
-    if(!chunk_info->fspace_shared)
-        (void)H5S_close(chunk_info->fspace);
-    else
-        H5S_select_all(chunk_info->fspace, TRUE);
+    FUNC_LEAVE_NOAPI(nshards)
+} /* end H5D__chunk_shard_count() */
 
-    /* Close the chunk's memory dataspace, if it's not shared */
-    if(!chunk_info->mspace_shared && chunk_info->mspace)
-        (void)H5S_close(chunk_info->mspace);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_shard_offset
+ *
+ * Purpose:     Compute the offset of a shard within its chunk, in
+ *              elements, from the shard's index.  Shards are numbered in
+ *              row-major order.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_shard_offset(const H5O_layout_chunk_t *layout, hsize_t idx,
+    hsize_t offset[])
+{
+    unsigned    u;                      /* Local index variable */
 
-    /* Free the actual chunk info */
-    chunk_info = H5FL_FREE(H5D_chunk_info_t, chunk_info);
+    FUNC_ENTER_STATIC_NOERR
 
-    FUNC_LEAVE_NOAPI(0)
-}   /* H5D__free_chunk_info() */
+    HDassert(layout);
+    HDassert(offset);
+
+    offset[layout->ndims - 1] = 0;
+    for(u = layout->ndims - 1; u > 0; u--) {
+        hsize_t nshards = layout->dim[u - 1] / layout->shard_dim[u - 1];
+
+        offset[u - 1] = (idx % nshards) * layout->shard_dim[u - 1];
+        idx /= nshards;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_shard_offset() */
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__create_chunk_map_single
- *
- * Purpose:	Create chunk selections when appending a single record
+ * Function:    H5D__chunk_shard_decode
  *
- * Return:	Non-negative on success/Negative on failure
+ * Purpose:     Unfilter one shard of a sharded chunk, from NBYTES bytes
+ *              at SRC, and copy it into place in the (unfiltered) CHUNK.
  *
- * Programmer:	Quincey Koziol
- *		Tuesday, November 20, 2007
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__create_chunk_map_single(H5D_chunk_map_t *fm, const H5D_io_info_t
-#ifndef H5_HAVE_PARALLEL
-    H5_ATTR_UNUSED
-#endif /* H5_HAVE_PARALLEL */
-    *io_info)
+H5D__chunk_shard_decode(const H5O_layout_chunk_t *layout, const H5O_pline_t *pline,
+    hsize_t idx, unsigned filter_mask, H5Z_EDC_t edc, H5Z_cb_t cb,
+    const uint8_t *src, size_t nbytes, void *chunk)
 {
-    H5D_chunk_info_t *chunk_info;           /* Chunk information to insert into skip list */
-    hsize_t     coords[H5O_LAYOUT_NDIMS];   /* Coordinates of chunk */
-    hsize_t     sel_start[H5O_LAYOUT_NDIMS]; /* Offset of low bound of file selection */
-    hsize_t     sel_end[H5O_LAYOUT_NDIMS];  /* Offset of high bound of file selection */
-    unsigned    u;                          /* Local index variable */
-    herr_t	ret_value = SUCCEED;        /* Return value */
+    hsize_t     size[H5O_LAYOUT_NDIMS];         /* Size of shard, in elements */
+    hsize_t     chunk_dims[H5O_LAYOUT_NDIMS];   /* Size of chunk, in elements */
+    hsize_t     offset[H5O_LAYOUT_NDIMS];       /* Offset of shard in chunk */
+    hsize_t     zero[H5O_LAYOUT_NDIMS];         /* Offset of shard in its own buffer */
+    size_t      shard_size;                     /* Size of shard, in bytes */
+    size_t      buf_size = nbytes;              /* Size of shard buffer */
+    void        *buf = NULL;                    /* Buffer for the shard */
+    unsigned    u;                              /* Local index variable */
+    herr_t      ret_value = SUCCEED;            /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Sanity check */
-    HDassert(fm->f_ndims > 0);
-
-    /* Get coordinate for selection */
-    if(H5S_SELECT_BOUNDS(fm->file_space, sel_start, sel_end) < 0)
-        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
+    HDassert(layout);
+    HDassert(pline);
+    HDassert(src);
+    HDassert(chunk);
 
-    /* Initialize the 'single chunk' file & memory chunk information */
-    chunk_info = fm->single_chunk_info;
-    chunk_info->chunk_points = 1;
+    (void)H5D__chunk_shard_count(layout, &shard_size);
+    if(0 == nbytes)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "empty shard in sharded chunk")
 
-    /* Set chunk location & hyperslab size */
-    for(u = 0; u < fm->f_ndims; u++) {
-        /* Validate this chunk dimension */
-        if(fm->layout->u.chunk.dim[u] == 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk size must be > 0, dim = %u ", u)
-        HDassert(sel_start[u] == sel_end[u]);
-        chunk_info->scaled[u] = sel_start[u] / fm->layout->u.chunk.dim[u];
-        coords[u] = chunk_info->scaled[u] * fm->layout->u.chunk.dim[u];
+    if(NULL == (buf = H5MM_malloc(buf_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for shard")
+    HDmemcpy(buf, src, nbytes);
+    if(H5Z_pipeline(pline, H5Z_FLAG_REVERSE, &filter_mask, edc, cb, &nbytes, &buf_size, &buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "data pipeline read failed")
+    if(nbytes != shard_size)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "shard has wrong size after unfiltering")
+
+    /* Copy the shard into the chunk */
+    for(u = 0; u < layout->ndims; u++) {
+        size[u] = layout->shard_dim[u];
+        chunk_dims[u] = layout->dim[u];
+        zero[u] = 0;
     } /* end for */
-    chunk_info->scaled[fm->f_ndims] = 0;
-
-    /* Calculate the index of this chunk */
-    chunk_info->index = H5VM_array_offset_pre(fm->f_ndims, fm->layout->u.chunk.down_chunks, chunk_info->scaled);
+    H5D__chunk_shard_offset(layout, idx, offset);
+    if(H5VM_hyper_copy(layout->ndims, size, chunk_dims, offset, chunk, size, zero, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "unable to copy shard into chunk")
 
-    /* Copy selection for file's dataspace into chunk dataspace */
-    if(H5S_select_copy(fm->single_space, fm->file_space, FALSE) < 0)
-        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file selection")
-
-    /* Move selection back to have correct offset in chunk */
-    if(H5S_SELECT_ADJUST_U(fm->single_space, coords) < 0)
-        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust chunk selection")
+done:
+    H5MM_xfree(buf);
 
-#ifdef H5_HAVE_PARALLEL
-    /* store chunk selection information */
-    if(io_info->using_mpi_vfd)
-        fm->select_chunk[chunk_info->index] = chunk_info;
-#endif /* H5_HAVE_PARALLEL */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_shard_decode() */
 
-    /* Set the file dataspace for the chunk to the shared 'single' dataspace */
-    chunk_info->fspace = fm->single_space;
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_filter
+ *
+ * Purpose:     Run a chunk through the I/O filter pipeline, the same way
+ *              as H5Z_pipeline() does, but taking the chunk's layout
+ *              into account.
+ *
+ *              Chunks split into shards are filtered one shard at a time.
+ *              The filtered chunk then starts with a table holding the
+ *              filtered size (4 bytes) and filter mask (4 bytes) of each
+ *              shard, followed by the filtered shards themselves, in
+ *              row-major order.  The filter mask of the chunk as a whole
+ *              only holds the filters skipped for every shard.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_filter(const H5O_layout_chunk_t *layout, const H5O_pline_t *pline,
+    unsigned flags, unsigned *filter_mask/*in,out*/, H5Z_EDC_t edc, H5Z_cb_t cb,
+    size_t *nbytes/*in,out*/, size_t *buf_size/*in,out*/, void **buf/*in,out*/)
+{
+    hsize_t     nshards;                /* Number of shards in chunk */
+    size_t      shard_size;             /* Size of a shard, in bytes */
+    size_t      table_size;             /* Size of shard table, in bytes */
+    uint8_t     *out = NULL;            /* Output buffer */
+    void        *tmp = NULL;            /* Buffer for filtering one shard */
+    hsize_t     u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(layout);
+    HDassert(filter_mask);
+    HDassert(nbytes && *nbytes > 0);
+    HDassert(buf_size && *buf_size > 0);
+    HDassert(buf && *buf);
+
+    /* Chunks that aren't split into shards are filtered as a whole */
+    /* (Leave error reporting to the caller, as when calling H5Z_pipeline() directly) */
+    if(!(layout->flags & H5O_LAYOUT_CHUNK_SHARDED))
+        HGOTO_DONE(H5Z_pipeline(pline, flags, filter_mask, edc, cb, nbytes, buf_size, buf))
+
+    nshards = H5D__chunk_shard_count(layout, &shard_size);
+    H5_CHECKED_ASSIGN(table_size, size_t, nshards * H5D_CHUNK_SHARD_ENTRY_SIZE, hsize_t);
+
+    if(flags & H5Z_FLAG_REVERSE) {
+        const uint8_t *p = (const uint8_t *)*buf;       /* Pointer into shard table */
+        size_t      shard_off = table_size;             /* Offset of current shard */
+
+        if(*nbytes < table_size)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "sharded chunk is too small for its shard table")
+        if(NULL == (out = (uint8_t *)H5MM_malloc((size_t)layout->size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk")
+
+        /* Unfilter each shard into place */
+        for(u = 0; u < nshards; u++) {
+            uint32_t    shard_nbytes;   /* Filtered size of shard */
+            unsigned    shard_mask;     /* Filter mask for shard */
+
+            UINT32DECODE(p, shard_nbytes);
+            UINT32DECODE(p, shard_mask);
+            if(shard_nbytes > *nbytes - shard_off)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "shard extends past end of chunk")
+            if(H5D__chunk_shard_decode(layout, pline, u, shard_mask | *filter_mask, edc, cb,
+                    (const uint8_t *)*buf + shard_off, (size_t)shard_nbytes, out) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "unable to unfilter shard")
+            shard_off += shard_nbytes;
+        } /* end for */
+
+        *nbytes = *buf_size = (size_t)layout->size;
+    } /* end if */
+    else {
+        hsize_t     size[H5O_LAYOUT_NDIMS];         /* Size of shard, in elements */
+        hsize_t     chunk_dims[H5O_LAYOUT_NDIMS];   /* Size of chunk, in elements */
+        hsize_t     offset[H5O_LAYOUT_NDIMS];       /* Offset of shard in chunk */
+        hsize_t     zero[H5O_LAYOUT_NDIMS];         /* Offset of shard in its own buffer */
+        size_t      out_size;                       /* Size of output buffer */
+        size_t      out_used = table_size;          /* Bytes used in output buffer */
+        unsigned    v;                              /* Local index variable */
+
+        for(v = 0; v < layout->ndims; v++) {
+            size[v] = layout->shard_dim[v];
+            chunk_dims[v] = layout->dim[v];
+            zero[v] = 0;
+        } /* end for */
+
+        /* Start with room for the table and the chunk, unfiltered */
+        out_size = table_size + *nbytes;
+        if(NULL == (out = (uint8_t *)H5MM_malloc(out_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk")
+
+        /* Filter each shard, and append it to the output */
+        for(u = 0; u < nshards; u++) {
+            uint8_t     *p = out + u * H5D_CHUNK_SHARD_ENTRY_SIZE;    /* Pointer to shard's table entry */
+            size_t      shard_nbytes = shard_size;      /* Filtered size of shard */
+            size_t      tmp_size = shard_size;          /* Size of shard buffer */
+            unsigned    shard_mask = *filter_mask;      /* Filter mask for shard */
+
+            if(NULL == (tmp = H5MM_malloc(tmp_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for shard")
+            H5D__chunk_shard_offset(layout, u, offset);
+            if(H5VM_hyper_copy(layout->ndims, size, size, zero, tmp, chunk_dims, offset, *buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "unable to copy shard out of chunk")
+            if(H5Z_pipeline(pline, flags, &shard_mask, edc, cb, &shard_nbytes, &tmp_size, &tmp) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
+            if(shard_nbytes > (size_t)0xffffffff)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "filtered shard is too large")
+
+            /* Make room for the shard */
+            if(out_used + shard_nbytes > out_size) {
+                uint8_t *new_out;       /* Reallocated output buffer */
+
+                out_size = MAX(out_size * 2, out_used + shard_nbytes);
+                if(NULL == (new_out = (uint8_t *)H5MM_realloc(out, out_size)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk")
+                out = new_out;
+                p = out + u * H5D_CHUNK_SHARD_ENTRY_SIZE;
+            } /* end if */
+
+            UINT32ENCODE(p, shard_nbytes);
+            UINT32ENCODE(p, shard_mask);
+            HDmemcpy(out + out_used, tmp, shard_nbytes);
+            out_used += shard_nbytes;
+            tmp = H5MM_xfree(tmp);
+        } /* end for */
+
+        *nbytes = out_used;
+        *buf_size = out_size;
+    } /* end else */
+
+    /* Hand back the new buffer */
+    H5MM_xfree(*buf);
+    *buf = out;
+    out = NULL;
+
+done:
+    H5MM_xfree(tmp);
+    H5MM_xfree(out);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_filter() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_read_shards
+ *
+ * Purpose:     Read and unfilter only the shards of a sharded chunk that
+ *              intersect the selection SEL, into CHUNK.  The rest of
+ *              CHUNK is left uninitialized.
+ *
+ *              The chunk is NBYTES long in the file at ADDR.  If
+ *              CHUNK_BUF is non-NULL, it holds the chunk as stored in the
+ *              file and nothing is read.  Shards that are next to each
+ *              other are read with a single I/O operation.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_read_shards(const H5D_t *dset, const H5O_pline_t *pline, haddr_t addr,
+    size_t nbytes, const void *chunk_buf, unsigned filter_mask, H5S_t *sel,
+    void *chunk)
+{
+    const H5O_layout_chunk_t *layout = &(dset->shared->layout.u.chunk); /* Chunk layout */
+    H5Z_EDC_t   err_detect;             /* Error detection info */
+    H5Z_cb_t    filter_cb;              /* I/O filter callback function */
+    hsize_t     sel_start[H5O_LAYOUT_NDIMS]; /* Selection bounds */
+    hsize_t     sel_end[H5O_LAYOUT_NDIMS];
+    hsize_t     offset[H5O_LAYOUT_NDIMS];    /* Offset of shard in chunk */
+    hsize_t     shard_end[H5O_LAYOUT_NDIMS]; /* End of shard in chunk */
+    hbool_t     use_bounds;             /* Whether to intersect with the selection bounds */
+    hsize_t     nshards;                /* Number of shards in chunk */
+    size_t      shard_size;             /* Size of a shard, in bytes */
+    size_t      table_size;             /* Size of shard table, in bytes */
+    uint8_t     *table = NULL;          /* Shard table, if read from the file */
+    const uint8_t *p;                   /* Pointer into shard table */
+    size_t      *shard_off = NULL;      /* Offset of each shard in chunk */
+    uint8_t     *run_buf = NULL;        /* Buffer for reading shards */
+    size_t      run_buf_size = 0;       /* Size of run_buf */
+    hsize_t     u, v;                   /* Local index variables */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset);
+    HDassert(pline && pline->nused);
+    HDassert(layout->flags & H5O_LAYOUT_CHUNK_SHARDED);
+    HDassert(sel);
+    HDassert(chunk);
+
+    /* Retrieve filter settings from API context */
+    if(H5CX_get_err_detect(&err_detect) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+    if(H5CX_get_filter_cb(&filter_cb) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+
+    nshards = H5D__chunk_shard_count(layout, &shard_size);
+    H5_CHECKED_ASSIGN(table_size, size_t, nshards * H5D_CHUNK_SHARD_ENTRY_SIZE, hsize_t);
+    if(nbytes < table_size)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "sharded chunk is too small for its shard table")
+
+    /* Get the shard table */
+    if(chunk_buf)
+        p = (const uint8_t *)chunk_buf;
+    else {
+        if(NULL == (table = (uint8_t *)H5MM_malloc(table_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for shard table")
+        if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, addr, table_size, table) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read shard table")
+        p = table;
+    } /* end else */
+
+    /* Work out where each shard is */
+    if(NULL == (shard_off = (size_t *)H5MM_malloc((size_t)(nshards + 1) * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for shard offsets")
+    shard_off[0] = table_size;
+    for(u = 0; u < nshards; u++) {
+        uint32_t    shard_nbytes;       /* Filtered size of shard */
+
+        UINT32DECODE(p, shard_nbytes);
+        p += 4;
+        if(shard_nbytes > nbytes - shard_off[u])
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "shard extends past end of chunk")
+        shard_off[u + 1] = shard_off[u] + shard_nbytes;
+    } /* end for */
+    p = chunk_buf ? (const uint8_t *)chunk_buf : table;
+
+    /* Hyperslab selections are checked against each shard exactly, other
+     * selections against their bounding box */
+    use_bounds = (H5S_GET_SELECT_TYPE(sel) != H5S_SEL_ALL && H5S_GET_SELECT_TYPE(sel) != H5S_SEL_HYPERSLABS);
+    if(use_bounds && H5S_SELECT_BOUNDS(sel, sel_start, sel_end) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get selection bounds")
+
+    for(u = 0; u < nshards; u = v) {
+        htri_t      needed = TRUE;      /* Whether the shard intersects the selection */
+        const uint8_t *src;             /* Filtered shards */
+        unsigned    w;                  /* Local index variable */
+
+        /* Find the next run of shards that intersect the selection */
+        for(v = u; v < nshards; v++) {
+            H5D__chunk_shard_offset(layout, v, offset);
+            for(w = 0; w < layout->ndims - 1; w++)
+                shard_end[w] = offset[w] + layout->shard_dim[w] - 1;
+            if(use_bounds) {
+                needed = TRUE;
+                for(w = 0; w < layout->ndims - 1; w++)
+                    if(offset[w] > sel_end[w] || shard_end[w] < sel_start[w])
+                        needed = FALSE;
+            } /* end if */
+            else if((needed = H5S_hyper_intersect_block(sel, offset, shard_end)) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "can't check shard against selection")
+            if(!needed)
+                break;
+        } /* end for */
+        if(v == u) {
+            v++;
+            continue;
+        } /* end if */
+
+        /* Get the filtered shards */
+        if(chunk_buf)
+            src = (const uint8_t *)chunk_buf + shard_off[u];
+        else {
+            size_t run_len = shard_off[v] - shard_off[u];     /* Length of run of shards */
+
+            if(run_len > run_buf_size) {
+                run_buf = (uint8_t *)H5MM_xfree(run_buf);
+                run_buf_size = 0;
+                if(NULL == (run_buf = (uint8_t *)H5MM_malloc(run_len)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for shards")
+                run_buf_size = run_len;
+            } /* end if */
+            if(run_len > 0 && H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, addr + shard_off[u], run_len, run_buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read shards")
+            src = run_buf;
+        } /* end else */
+
+        /* Unfilter them into the chunk */
+        for(w = 0; u + w < v; w++) {
+            const uint8_t *q = p + (u + w) * H5D_CHUNK_SHARD_ENTRY_SIZE + 4;   /* Pointer to shard's filter mask */
+            unsigned    shard_mask;     /* Filter mask for shard */
+
+            UINT32DECODE(q, shard_mask);
+            if(H5D__chunk_shard_decode(layout, pline, u + w, shard_mask | filter_mask, err_detect, filter_cb,
+                    src + (shard_off[u + w] - shard_off[u]), shard_off[u + w + 1] - shard_off[u + w], chunk) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "unable to unfilter shard")
+        } /* end for */
+    } /* end for */
+
+done:
+    H5MM_xfree(table);
+    H5MM_xfree(shard_off);
+    H5MM_xfree(run_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_read_shards() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__free_chunk_info
+ PURPOSE
+    Internal routine to destroy a chunk info node
+ USAGE
+    void H5D__free_chunk_info(chunk_info)
+        void *chunk_info;    IN: Pointer to chunk info to destroy
+ RETURNS
+    No return value
+ DESCRIPTION
+    Releases all the memory for a chunk info node.  Called by H5SL_free
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static herr_t
+H5D__free_chunk_info(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *opdata)
+{
+    H5D_chunk_info_t *chunk_info = (H5D_chunk_info_t *)item;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(chunk_info);
+
+    /* Close the chunk's file dataspace, if it's not shared */
+    if(!chunk_info->fspace_shared)
+        (void)H5S_close(chunk_info->fspace);
+    else
+        H5S_select_all(chunk_info->fspace, TRUE);
+
+    /* Close the chunk's memory dataspace, if it's not shared */
+    if(!chunk_info->mspace_shared && chunk_info->mspace)
+        (void)H5S_close(chunk_info->mspace);
+
+    /* Free the actual chunk info */
+    chunk_info = H5FL_FREE(H5D_chunk_info_t, chunk_info);
+
+    FUNC_LEAVE_NOAPI(0)
+}   /* H5D__free_chunk_info() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__create_chunk_map_single
+ *
+ * Purpose:	Create chunk selections when appending a single record
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ * Programmer:	Quincey Koziol
+ *		Tuesday, November 20, 2007
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__create_chunk_map_single(H5D_chunk_map_t *fm, const H5D_io_info_t
+#ifndef H5_HAVE_PARALLEL
+    H5_ATTR_UNUSED
+#endif /* H5_HAVE_PARALLEL */
+    *io_info)
+{
+    H5D_chunk_info_t *chunk_info;           /* Chunk information to insert into skip list */
+    hsize_t     coords[H5O_LAYOUT_NDIMS];   /* Coordinates of chunk */
+    hsize_t     sel_start[H5O_LAYOUT_NDIMS]; /* Offset of low bound of file selection */
+    hsize_t     sel_end[H5O_LAYOUT_NDIMS];  /* Offset of high bound of file selection */
+    unsigned    u;                          /* Local index variable */
+    herr_t	ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(fm->f_ndims > 0);
+
+    /* Get coordinate for selection */
+    if(H5S_SELECT_BOUNDS(fm->file_space, sel_start, sel_end) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
+
+    /* Initialize the 'single chunk' file & memory chunk information */
+    chunk_info = fm->single_chunk_info;
+    chunk_info->chunk_points = 1;
+
+    /* Set chunk location & hyperslab size */
+    for(u = 0; u < fm->f_ndims; u++) {
+        /* Validate this chunk dimension */
+        if(fm->layout->u.chunk.dim[u] == 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk size must be > 0, dim = %u ", u)
+        HDassert(sel_start[u] == sel_end[u]);
+        chunk_info->scaled[u] = sel_start[u] / fm->layout->u.chunk.dim[u];
+        coords[u] = chunk_info->scaled[u] * fm->layout->u.chunk.dim[u];
+    } /* end for */
+    chunk_info->scaled[fm->f_ndims] = 0;
+
+    /* Calculate the index of this chunk */
+    chunk_info->index = H5VM_array_offset_pre(fm->f_ndims, fm->layout->u.chunk.down_chunks, chunk_info->scaled);
+
+    /* Copy selection for file's dataspace into chunk dataspace */
+    if(H5S_select_copy(fm->single_space, fm->file_space, FALSE) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file selection")
+
+    /* Move selection back to have correct offset in chunk */
+    if(H5S_SELECT_ADJUST_U(fm->single_space, coords) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust chunk selection")
+
+#ifdef H5_HAVE_PARALLEL
+    /* store chunk selection information */
+    if(io_info->using_mpi_vfd)
+        fm->select_chunk[chunk_info->index] = chunk_info;
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Set the file dataspace for the chunk to the shared 'single' dataspace */
+    chunk_info->fspace = fm->single_space;
 
     /* Indicate that the chunk's file dataspace is shared */
     chunk_info->fspace_shared = TRUE;
@@ -2126,6 +3363,41 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_cacheable() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_read_sched_cmp
+ *
+ * Purpose:	Compare two chunks to read by file address.  Chunks that
+ *		aren't allocated sort after those that are, and chunks are
+ *		otherwise kept in selection order.
+ *
+ * Return:	-1, 0 or 1, as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_read_sched_cmp(const void *_sched1, const void *_sched2)
+{
+    const H5D_chunk_read_sched_t *sched1 = (const H5D_chunk_read_sched_t *)_sched1;
+    const H5D_chunk_read_sched_t *sched2 = (const H5D_chunk_read_sched_t *)_sched2;
+    haddr_t addr1 = sched1->udata.chunk_block.offset;
+    haddr_t addr2 = sched2->udata.chunk_block.offset;
+    int ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(H5F_addr_defined(addr1) && H5F_addr_defined(addr2))
+        ret_value = H5F_addr_cmp(addr1, addr2);
+    else if(H5F_addr_defined(addr1))
+        ret_value = -1;
+    else if(H5F_addr_defined(addr2))
+        ret_value = 1;
+    if(0 == ret_value)
+        ret_value = (sched1->sel_order < sched2->sel_order) ? -1 : (sched1->sel_order > sched2->sel_order);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_read_sched_cmp() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_read
@@ -2153,6 +3425,14 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     hbool_t     cpt_dirty;              /* Temporary placeholder for compact storage "dirty" flag */
     uint32_t    src_accessed_bytes = 0; /* Total accessed size in a chunk */
     hbool_t     skip_missing_chunks = FALSE;    /* Whether to skip missing chunks */
+    const H5D_rdcc_t *rdcc = &(io_info->dset->shared->cache.chunk);    /* Raw data chunk cache */
+    H5D_chunk_read_sched_t *chunks = NULL;  /* Chunks to read, in file address order */
+    size_t      nchunks;                /* Number of chunks to read */
+    uint8_t     *run_buf = NULL;        /* Buffer for reading runs of adjacent chunks */
+    size_t      run_buf_size = 0;       /* Size of run_buf */
+    haddr_t     run_addr = HADDR_UNDEF; /* Address of chunks in run_buf */
+    size_t      run_end = 0;            /* Index of chunk after run in run_buf */
+    size_t      u;                      /* Local index variable */
     herr_t	ret_value = SUCCEED;	/*return value		*/
 
     FUNC_ENTER_STATIC
@@ -2201,25 +3481,56 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
             skip_missing_chunks = TRUE;
     }
 
-    /* Iterate through nodes in chunk skip list */
+    /* Look up the file addresses of all the chunks first, so that they can
+     * be read in file address order instead of the order of their
+     * coordinates, which avoids seeking back and forth if the chunks were
+     * written out of order.
+     */
+    nchunks = fm->use_single ? 1 : H5SL_count(fm->sel_chunks);
+    if(0 == nchunks)
+        HGOTO_DONE(SUCCEED)
+    if(NULL == (chunks = H5FL_SEQ_MALLOC(H5D_chunk_read_sched_t, nchunks)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk read schedule")
+    u = 0;
     chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
     while(chunk_node) {
-        H5D_chunk_info_t *chunk_info;   /* Chunk information */
-        H5D_chunk_ud_t udata;		/* Chunk index pass-through	*/
+        HDassert(u < nchunks);
 
         /* Get the actual chunk information from the skip list node */
-        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+        chunks[u].chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+        chunks[u].sel_order = u;
 
         /* Get the info for the chunk in the file */
-        if(H5D__chunk_lookup(io_info->dset, chunk_info->scaled, &udata) < 0)
+        if(H5D__chunk_lookup(io_info->dset, chunks[u].chunk_info->scaled, &chunks[u].udata) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
 
         /* Sanity check */
-        HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) || 
-                (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
+        HDassert((H5F_addr_defined(chunks[u].udata.chunk_block.offset) && chunks[u].udata.chunk_block.length > 0) || 
+                (!H5F_addr_defined(chunks[u].udata.chunk_block.offset) && chunks[u].udata.chunk_block.length == 0));
+
+        /* Advance to next chunk in list */
+        u++;
+        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+    } /* end while */
+    HDassert(u == nchunks);
+    if(nchunks > 1)
+        HDqsort(chunks, nchunks, sizeof(H5D_chunk_read_sched_t), H5D__chunk_read_sched_cmp);
+
+    /* Read the chunks */
+    for(u = 0; u < nchunks; u++) {
+        H5D_chunk_info_t *chunk_info = chunks[u].chunk_info;   /* Chunk information */
+        H5D_chunk_ud_t *udata = &chunks[u].udata;   /* Chunk index pass-through */
+
+        /* If the chunk was in the cache, it may have been evicted (and moved
+         * in the file, if it was dirty) while reading the earlier chunks,
+         * so look it up again.
+         */
+        if(NULL != udata->cache_ent)
+            if(H5D__chunk_lookup(io_info->dset, chunk_info->scaled, udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
 
         /* Check for non-existant chunk & skip it if appropriate */
-        if(H5F_addr_defined(udata.chunk_block.offset) || UINT_MAX != udata.idx_hint
+        if(H5F_addr_defined(udata->chunk_block.offset) || NULL != udata->cache_ent
                 || !skip_missing_chunks) {
             H5D_io_info_t *chk_io_info;     /* Pointer to I/O info object for this chunk */
             void *chunk = NULL;             /* Pointer to locked chunk buffer */
@@ -2229,17 +3540,65 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
             io_info->store->chunk.scaled = chunk_info->scaled;
 
             /* Determine if we should use the chunk cache */
-            if((cacheable = H5D__chunk_cacheable(io_info, udata.chunk_block.offset, FALSE)) < 0)
+            if((cacheable = H5D__chunk_cacheable(io_info, udata->chunk_block.offset, FALSE)) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
             if(cacheable) {
+                const void *chunk_buf = NULL;   /* Chunk's data, if already read */
+
                 /* Load the chunk into cache and lock it. */
 
+                /* Read this chunk and any following ones that are adjacent to
+                 * it in the file and also need to be loaded into the cache
+                 * with a single I/O operation, up to the size of the cache.
+                 */
+                if(u >= run_end && NULL == udata->cache_ent && H5F_addr_defined(udata->chunk_block.offset)) {
+                    hsize_t run_len = udata->chunk_block.length;    /* Length of run of chunks */
+                    size_t v;                   /* Local index variable */
+
+                    for(v = u + 1; v < nchunks; v++) {
+                        const H5D_chunk_ud_t *next_udata = &chunks[v].udata;
+                        htri_t next_cacheable;  /* Whether the next chunk is cacheable */
+
+                        if(NULL != next_udata->cache_ent
+                                || !H5F_addr_defined(next_udata->chunk_block.offset)
+                                || next_udata->chunk_block.offset != udata->chunk_block.offset + run_len
+                                || run_len + next_udata->chunk_block.length > rdcc->nbytes_max)
+                            break;
+                        io_info->store->chunk.scaled = chunks[v].chunk_info->scaled;
+                        if((next_cacheable = H5D__chunk_cacheable(io_info, next_udata->chunk_block.offset, FALSE)) < 0)
+                            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
+                        if(!next_cacheable)
+                            break;
+                        run_len += next_udata->chunk_block.length;
+                    } /* end for */
+                    io_info->store->chunk.scaled = chunk_info->scaled;
+
+                    if(v > u + 1) {
+                        /* Make sure the buffer is large enough */
+                        if(run_len > run_buf_size) {
+                            run_buf = (uint8_t *)H5MM_xfree(run_buf);
+                            H5_CHECKED_ASSIGN(run_buf_size, size_t, run_len, hsize_t);
+                            if(NULL == (run_buf = (uint8_t *)H5MM_malloc(run_buf_size))) {
+                                run_buf_size = 0;
+                                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunks")
+                            } /* end if */
+                        } /* end if */
+
+                        if(H5F_block_read(io_info->dset->oloc.file, H5FD_MEM_DRAW, udata->chunk_block.offset, (size_t)run_len, run_buf) < 0)
+                            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+                        run_addr = udata->chunk_block.offset;
+                        run_end = v;
+                    } /* end if */
+                } /* end if */
+                if(u < run_end)
+                    chunk_buf = run_buf + (udata->chunk_block.offset - run_addr);
+
                 /* Compute # of bytes accessed in chunk */
                 H5_CHECK_OVERFLOW(type_info->src_type_size, /*From:*/ size_t, /*To:*/ uint32_t);
                 src_accessed_bytes = chunk_info->chunk_points * (uint32_t)type_info->src_type_size;
 
                 /* Lock the chunk into the cache */
-                if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, FALSE, FALSE)))
+                if(NULL == (chunk = H5D__chunk_lock(io_info, udata, FALSE, FALSE, chunk_buf, chunk_info->fspace)))
                     HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
 
                 /* Set up the storage buffer information for this chunk */
@@ -2248,9 +3607,9 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                 /* Point I/O info at contiguous I/O info for this chunk */
                 chk_io_info = &cpt_io_info;
             } /* end if */
-            else if(H5F_addr_defined(udata.chunk_block.offset)) {
+            else if(H5F_addr_defined(udata->chunk_block.offset)) {
                 /* Set up the storage address information for this chunk */
-                ctg_store.contig.dset_addr = udata.chunk_block.offset;
+                ctg_store.contig.dset_addr = udata->chunk_block.offset;
 
                 /* Point I/O info at temporary I/O info for this chunk */
                 chk_io_info = &ctg_io_info;
@@ -2266,15 +3625,16 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                 HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked read failed")
 
             /* Release the cache lock on the chunk. */
-            if(chunk && H5D__chunk_unlock(io_info, &udata, FALSE, chunk, src_accessed_bytes) < 0)
+            if(chunk && H5D__chunk_unlock(io_info, udata, FALSE, chunk, src_accessed_bytes) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
         } /* end if */
-
-        /* Advance to next chunk in list */
-        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
-    } /* end while */
+    } /* end for */
 
 done:
+    if(chunks)
+        chunks = H5FL_SEQ_FREE(H5D_chunk_read_sched_t, chunks);
+    H5MM_xfree(run_buf);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_read() */
 
@@ -2373,7 +3733,7 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                 entire_chunk = FALSE;
 
             /* Lock the chunk into the cache */
-            if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, entire_chunk, FALSE)))
+            if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, entire_chunk, FALSE, NULL, NULL)))
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
 
             /* Set up the storage buffer information for this chunk */
@@ -2467,6 +3827,10 @@ H5D__chunk_flush(H5D_t *dset)
     /* Sanity check */
     HDassert(dset);
 
+    /* Write the chunks in the write-behind queue */
+    if(H5D__chunk_wb_retire(dset, (size_t)0) < 0)
+        nerrors++;
+
     /* Loop over all entries in the chunk cache */
     for(ent = rdcc->head; ent; ent = next) {
 	next = ent->next;
@@ -2567,7 +3931,16 @@ H5D__chunk_dest(H5D_t *dset)
         if(H5D__chunk_cache_evict(dset, ent, TRUE) < 0)
             nerrors++;
     } /* end for */
-    
+
+    /* Write the chunks in the write-behind queue, and release it */
+    if(rdcc->wb) {
+        if(H5D__chunk_wb_retire(dset, (size_t)0) < 0)
+            nerrors++;
+        if(H5D__chunk_wb_dest(rdcc->wb) < 0)
+            nerrors++;
+        rdcc->wb = NULL;
+    } /* end if */
+
     /* Continue even if there are failures. */
     if(nerrors)
         HDONE_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
@@ -2796,8 +4169,9 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_hash_val
  *
- * Purpose:	To calculate an index based on the dataset's scaled
- *		coordinates and sizes of the faster dimensions.
+ * Purpose:	To calculate a hash table bucket index from a chunk's scaled
+ *		coordinates.  The coordinates are mixed together so that
+ *		the index doesn't depend on the dataset's current dimensions.
  *
  * Return:	Hash value index
  *
@@ -2805,12 +4179,12 @@ done:
  *
  *-------------------------------------------------------------------------
  */
-static unsigned
-H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled)
+static size_t
+H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled,
+    size_t nbuckets)
 {
-    hsize_t val;        /* Intermediate value */
+    hsize_t val = 0;    /* Intermediate value */
     unsigned ndims = shared->ndims;      /* Rank of dataset */
-    unsigned ret = 0;   /* Value to return */
     unsigned u;         /* Local index variable */
 
     FUNC_ENTER_STATIC_NOERR
@@ -2818,51 +4192,128 @@ H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled)
     /* Sanity check */
     HDassert(shared);
     HDassert(scaled);
+    HDassert(nbuckets > 0);
+    HDassert(0 == (nbuckets & (nbuckets - 1)));
 
-    /* If the fastest changing dimension doesn't have enough entropy, use
-     *  other dimensions too
-     */
-    val = scaled[0];
-    for(u = 1; u < ndims; u++) {
-        val <<= shared->cache.chunk.scaled_encode_bits[u];
-        val ^= scaled[u];
-    } /* end for */
+    /* Mix each coordinate into the value */
+    for(u = 0; u < ndims; u++)
+        val = (val ^ scaled[u]) * (hsize_t)0x9E3779B1;
 
-    /* Modulo value against the number of array slots */
-    ret = (unsigned)(val % shared->cache.chunk.nslots);
+    /* Fold the high bits down, since only the low bits are used */
+    val ^= val >> 32;
+    val ^= val >> 16;
 
-    FUNC_LEAVE_NOAPI(ret)
+    FUNC_LEAVE_NOAPI((size_t)(val & (nbuckets - 1)))
 } /* H5D__chunk_hash_val() */
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__chunk_lookup
- *
- * Purpose:	Loops up a chunk in cache and on disk, and retrieves
- *              information about that chunk.
+ * Function:	H5D__chunk_cache_find
  *
- * Return:	Non-negative on success/Negative on failure
+ * Purpose:	Looks up a chunk in the dataset's chunk cache.
  *
- * Programmer:	Albert Cheng
- *              June 27, 1998
+ * Return:	Success:	Pointer to the chunk's cache entry
+ *		Not cached:	NULL
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled,
-    H5D_chunk_ud_t *udata)
+static H5D_rdcc_ent_t *
+H5D__chunk_cache_find(const H5D_shared_t *shared, const hsize_t *scaled)
 {
-    H5D_rdcc_ent_t  *ent = NULL;        /* Cache entry */
-    H5O_storage_chunk_t *sc = &(dset->shared->layout.storage.u.chunk);
-    unsigned idx;                       /* Index of chunk in cache, if present */
-    hbool_t found = FALSE;              /* In cache? */
-    herr_t ret_value = SUCCEED;	        /* Return value */
+    const H5D_rdcc_t *rdcc = &(shared->cache.chunk);    /* Raw data chunk cache */
+    H5D_rdcc_ent_t *ent = NULL; /* Cache entry */
 
-    FUNC_ENTER_PACKAGE
+    FUNC_ENTER_STATIC_NOERR
 
-    /* Sanity checks */
-    HDassert(dset);
-    HDassert(dset->shared->layout.u.chunk.ndims > 0);
+    /* Sanity check */
+    HDassert(rdcc->nslots > 0);
+    HDassert(scaled);
+
+    /* Walk the chain of entries in the chunk's bucket */
+    for(ent = rdcc->slot[H5D__chunk_hash_val(shared, scaled, rdcc->nbuckets)]; ent; ent = ent->hash_next) {
+        unsigned u;         /* Local index variable */
+
+        for(u = 0; u < shared->ndims; u++)
+            if(scaled[u] != ent->scaled[u])
+                break;
+        if(u == shared->ndims)
+            break;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(ent)
+} /* H5D__chunk_cache_find() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_resize
+ *
+ * Purpose:	Changes the number of buckets in the chunk cache's hash
+ *		table and moves every cached chunk to its new bucket.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_resize(const H5D_t *dset, size_t nbuckets)
+{
+    H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);    /* Raw data chunk cache */
+    H5D_rdcc_ent_ptr_t *slot;   /* New hash table */
+    H5D_rdcc_ent_t *ent;        /* Cache entry */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(nbuckets >= rdcc->nbuckets_min);
+    HDassert(0 == (nbuckets & (nbuckets - 1)));
+
+    if(NULL == (slot = H5FL_SEQ_CALLOC(H5D_rdcc_ent_ptr_t, nbuckets)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+    /* Re-hash every entry in the cache */
+    for(ent = rdcc->head; ent; ent = ent->next) {
+        size_t idx = H5D__chunk_hash_val(dset->shared, ent->scaled, nbuckets);
+
+        ent->hash_next = slot[idx];
+        slot[idx] = ent;
+    } /* end for */
+
+    rdcc->slot = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, rdcc->slot);
+    rdcc->slot = slot;
+    rdcc->nbuckets = nbuckets;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_cache_resize() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_lookup
+ *
+ * Purpose:	Loops up a chunk in cache and on disk, and retrieves
+ *              information about that chunk.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ * Programmer:	Albert Cheng
+ *              June 27, 1998
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled,
+    H5D_chunk_ud_t *udata)
+{
+    H5D_rdcc_ent_t  *ent = NULL;        /* Cache entry */
+    H5O_storage_chunk_t *sc = &(dset->shared->layout.storage.u.chunk);
+    herr_t ret_value = SUCCEED;	        /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(dset);
+    HDassert(dset->shared->layout.u.chunk.ndims > 0);
     H5D_CHUNK_STORAGE_INDEX_CHK(sc);
     HDassert(scaled);
     HDassert(udata);
@@ -2879,37 +4330,26 @@ H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled,
     udata->new_unfilt_chunk = FALSE;
 
     /* Check for chunk in cache */
-    if(dset->shared->cache.chunk.nslots > 0) {
-        /* Determine the chunk's location in the hash table */
-        idx = H5D__chunk_hash_val(dset->shared, scaled);
-
-        /* Get the chunk cache entry for that location */
-        ent = dset->shared->cache.chunk.slot[idx];
-        if(ent) {
-            unsigned u;                  /* Counter */
-
-            /* Speculatively set the 'found' flag */
-            found = TRUE;
-
-            /* Verify that the cache entry is the correct chunk */
-            for(u = 0; u < dset->shared->ndims; u++)
-                if(scaled[u] != ent->scaled[u]) {
-                    found = FALSE;
-                    break;
-                } /* end if */
-        } /* end if */
-    } /* end if */
+    if(dset->shared->cache.chunk.nslots > 0)
+        ent = H5D__chunk_cache_find(dset->shared, scaled);
 
     /* Retrieve chunk addr */
-    if(found) {
-        udata->idx_hint = idx;
+    if(ent) {
+        udata->cache_ent = ent;
         udata->chunk_block.offset = ent->chunk_block.offset;
         udata->chunk_block.length = ent->chunk_block.length;;
         udata->chunk_idx = ent->chunk_idx;
     } /* end if */
     else {
-        /* Invalidate idx_hint, to signal that the chunk is not in cache */
-        udata->idx_hint = UINT_MAX;
+        /* Reset cache_ent, to signal that the chunk is not in cache */
+        udata->cache_ent = NULL;
+
+        /* If the chunk is waiting to be written, write it now so that the
+         * index is up to date
+         */
+        if(dset->shared->cache.chunk.wb && dset->shared->cache.chunk.wb->head)
+            if(H5D__chunk_wb_retire_chunk(dset, scaled) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write queued chunk")
 
         /* Check for cached information */
         if(!H5D__chunk_cinfo_cache_found(&dset->shared->cache.chunk.last, udata)) {
@@ -2986,6 +4426,76 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_lookup() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_write_block
+ *
+ * Purpose:     Writes a chunk's (possibly filtered) data to the file,
+ *              creating the chunk or reallocating it if MUST_ALLOC is set,
+ *              and inserts the chunk into the index if necessary.
+ *              OLD_CHUNK is updated with the chunk's new location.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_write_block(const H5D_t *dset, H5D_chunk_ud_t *udata,
+    H5F_block_t *old_chunk, hbool_t must_alloc, const void *buf)
+{
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+    hbool_t need_insert = FALSE;        /* Whether the chunk needs to be inserted into the index */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset);
+    HDassert(udata);
+    HDassert(old_chunk);
+    HDassert(buf);
+
+    /* Compose chunked index info struct */
+    idx_info.f = dset->oloc.file;
+    idx_info.pline = &dset->shared->dcpl_cache.pline;
+    idx_info.layout = &dset->shared->layout.u.chunk;
+    idx_info.storage = &dset->shared->layout.storage.u.chunk;
+
+    /* Check if the chunk needs to be allocated (it also could exist already
+     *      and the chunk alloc operation could resize it)
+     */
+    if(must_alloc) {
+        /* Create the chunk it if it doesn't exist, or reallocate the chunk
+         *  if its size changed.
+         */
+        if(H5D__chunk_file_alloc(&idx_info, old_chunk, &udata->chunk_block, &need_insert, udata->common.scaled) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
+
+        /* Update the chunk's info, in case it was allocated or relocated */
+        old_chunk->offset = udata->chunk_block.offset;
+        old_chunk->length = udata->chunk_block.length;
+    } /* end if */
+
+    /* Write the data to the file */
+    HDassert(H5F_addr_defined(udata->chunk_block.offset));
+    H5_CHECK_OVERFLOW(udata->chunk_block.length, hsize_t, size_t);
+    if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, udata->chunk_block.offset, (size_t)udata->chunk_block.length, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+
+    /* Insert the chunk record into the index */
+    if(need_insert && dset->shared->layout.storage.u.chunk.ops->insert)
+        if((dset->shared->layout.storage.u.chunk.ops->insert)(&idx_info, udata, dset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+
+    /* Cache the chunk's info, in case it's accessed again shortly */
+    H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, udata);
+
+    /* Increment # of flushed entries */
+    dset->shared->cache.chunk.stats.nflushes++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_write_block() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_flush_entry
@@ -3019,11 +4529,23 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
     HDassert(!ent->locked);
 
     buf = ent->chunk;
-    if(ent->dirty) {
-        H5D_chk_idx_info_t idx_info;    /* Chunked index info */
+    if(ent->dirty && reset && dset->shared->cache.chunk.wb
+            && dset->shared->dcpl_cache.pline.nused
+            && !(ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)) {
+        /* Hand the chunk to the write-behind queue, which takes ownership
+         * of the chunk's buffer and filters & writes it later.
+         */
+        if(H5D__chunk_wb_enqueue(dset, ent) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to queue chunk for writing")
+        HDassert(NULL == ent->chunk);
+        buf = NULL;
+
+        /* Mark cache entry as clean */
+        ent->dirty = FALSE;
+    } /* end if */
+    else if(ent->dirty) {
         H5D_chunk_ud_t 	udata;		/* pass through B-tree		*/
         hbool_t must_alloc = FALSE;     /* Whether the chunk must be allocated */
-        hbool_t need_insert = FALSE;    /* Whether the chunk needs to be inserted into the index */
 
         /* Set up user data for index callbacks */
         udata.common.layout = &dset->shared->layout.u.chunk;
@@ -3070,7 +4592,7 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
                 ent->chunk = NULL;
             } /* end else */
             H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
-            if(H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask),
+            if(H5D__chunk_filter(&dset->shared->layout.u.chunk, &(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask),
                     err_detect, filter_cb, &nbytes, &alloc, &buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
 #if H5_SIZEOF_SIZE_T > 4
@@ -3104,46 +4626,12 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
 
         HDassert(!(ent->edge_chunk_state & H5D_RDCC_NEWLY_DISABLED_FILTERS));
 
-        /* Check if the chunk needs to be allocated (it also could exist already
-         *      and the chunk alloc operation could resize it)
-         */
-        if(must_alloc) {
-            /* Compose chunked index info struct */
-            idx_info.f = dset->oloc.file;
-            idx_info.pline = &dset->shared->dcpl_cache.pline;
-            idx_info.layout = &dset->shared->layout.u.chunk;
-            idx_info.storage = &dset->shared->layout.storage.u.chunk;
-
-            /* Create the chunk it if it doesn't exist, or reallocate the chunk
-             *  if its size changed.
-             */
-            if(H5D__chunk_file_alloc(&idx_info, &(ent->chunk_block), &udata.chunk_block, &need_insert, ent->scaled) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
-
-            /* Update the chunk entry's info, in case it was allocated or relocated */
-            ent->chunk_block.offset = udata.chunk_block.offset;
-            ent->chunk_block.length = udata.chunk_block.length;
-        } /* end if */
-
-        /* Write the data to the file */
-        HDassert(H5F_addr_defined(udata.chunk_block.offset));
-        H5_CHECK_OVERFLOW(udata.chunk_block.length, hsize_t, size_t);
-        if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, udata.chunk_block.offset, (size_t)udata.chunk_block.length, buf) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
-
-        /* Insert the chunk record into the index */
-        if(need_insert && dset->shared->layout.storage.u.chunk.ops->insert)
-            if((dset->shared->layout.storage.u.chunk.ops->insert)(&idx_info, &udata, dset) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
-
-        /* Cache the chunk's info, in case it's accessed again shortly */
-        H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, &udata);
+        /* Allocate the chunk if necessary, write it and index it */
+        if(H5D__chunk_write_block(dset, &udata, &(ent->chunk_block), must_alloc, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write chunk")
 
         /* Mark cache entry as clean */
         ent->dirty = FALSE;
-
-        /* Increment # of flushed entries */
-        dset->shared->cache.chunk.stats.nflushes++;
     } /* end if */
 
     /* Reset, but do not free or removed from list */
@@ -3203,7 +4691,6 @@ H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
     HDassert(dset);
     HDassert(ent);
     HDassert(!ent->locked);
-    HDassert(ent->idx < rdcc->nslots);
 
     if(flush) {
         /* Flush */
@@ -3229,32 +4716,570 @@ H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
         rdcc->tail = ent->prev;
     ent->prev = ent->next = NULL;
 
-    /* Unlink from temporary list */
-    if(ent->tmp_prev) {
-        HDassert(rdcc->tmp_head->tmp_next);
-        ent->tmp_prev->tmp_next = ent->tmp_next;
-        if(ent->tmp_next) {
-            ent->tmp_next->tmp_prev = ent->tmp_prev;
-            ent->tmp_next = NULL;
-        } /* end if */
-        ent->tmp_prev = NULL;
-    } /* end if */
-    else
-        /* Only clear hash table slot if the chunk was not on the temporary list
-         */
-        rdcc->slot[ent->idx] = NULL;
+    /* Unlink from hash table bucket */
+    {
+        H5D_rdcc_ent_t **ent_ptr;       /* Pointer to link to entry in bucket */
+
+        ent_ptr = &(rdcc->slot[H5D__chunk_hash_val(dset->shared, ent->scaled, rdcc->nbuckets)]);
+        while(*ent_ptr != ent) {
+            HDassert(*ent_ptr);
+            ent_ptr = &((*ent_ptr)->hash_next);
+        } /* end while */
+        *ent_ptr = ent->hash_next;
+        ent->hash_next = NULL;
+    } /* end block */
+
+    /* Remove from cache */
+    rdcc->nbytes_used -= dset->shared->layout.u.chunk.size;
+    --rdcc->nused;
+
+    /* Free */
+    ent = H5FL_FREE(H5D_rdcc_ent_t, ent);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_evict() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_wb_create
+ *
+ * Purpose:     Creates the write-behind queue for a dataset's dirty
+ *              chunks, which holds up to NMAX chunks.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_wb_create(const H5D_t *dset, size_t nmax)
+{
+    H5D_chunk_wb_t *wb = NULL;          /* Write-behind queue */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset);
+    HDassert(nmax > 0);
+    HDassert(NULL == dset->shared->cache.chunk.wb);
+
+    if(NULL == (wb = (H5D_chunk_wb_t *)H5MM_calloc(sizeof(H5D_chunk_wb_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for write-behind queue")
+    wb->nmax = nmax;
+    wb->pline = &dset->shared->dcpl_cache.pline;
+    wb->layout = &dset->shared->layout.u.chunk;
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_init(&wb->lock);
+    H5TS_cond_init(&wb->cond);
+#endif /* H5_HAVE_THREADSAFE */
+
+    dset->shared->cache.chunk.wb = wb;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_wb_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_wb_dest
+ *
+ * Purpose:     Releases a write-behind queue.  Any chunks still in the
+ *              queue are discarded; the queue should be emptied before
+ *              calling this routine.
+ *
+ *              If the filter thread is running, it's told to exit and
+ *              releases the queue itself, since it may be waiting for
+ *              the API lock held by this thread.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_wb_dest(H5D_chunk_wb_t *wb)
+{
+    H5D_chunk_wb_ent_t *head;           /* Chunks left in the queue */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(wb);
+
+    head = wb->head;
+#ifdef H5_HAVE_THREADSAFE
+    if(wb->running) {
+        H5D_chunk_wb_ent_t *ent;        /* Queued chunk */
+
+        H5TS_mutex_lock_simple(&wb->lock);
+
+        /* Wait for the filter thread to finish with the chunk it's filtering */
+        for(ent = wb->head; ent; ent = ent->next)
+            while(ent->state == H5D_CHUNK_WB_FILTERING)
+                H5TS_cond_wait(&wb->cond, &wb->lock);
+
+        /* Take the chunks out of the queue and hand it to the thread */
+        wb->head = wb->tail = wb->next_filter = NULL;
+        wb->shutdown = TRUE;
+        H5TS_cond_broadcast(&wb->cond);
+        H5TS_mutex_unlock_simple(&wb->lock);
+        wb = NULL;
+    } /* end if */
+    else {
+        (void)H5TS_cond_destroy(&wb->cond);
+        H5TS_mutex_destroy(&wb->lock);
+    } /* end else */
+#endif /* H5_HAVE_THREADSAFE */
+
+    /* Discard any chunks left in the queue */
+    while(head) {
+        H5D_chunk_wb_ent_t *ent = head;
+
+        head = ent->next;
+        H5MM_xfree(ent->buf);
+        ent = H5FL_FREE(H5D_chunk_wb_ent_t, ent);
+    } /* end while */
+
+    if(wb)
+        H5MM_xfree(wb);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__chunk_wb_dest() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_wb_filter
+ *
+ * Purpose:     Runs a queued chunk through the dataset's I/O pipeline.
+ *
+ *              Called on the filter thread in thread-safe builds, with
+ *              the API lock held, so this must not touch anything except
+ *              the chunk and the pipeline.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_wb_filter(const H5D_chunk_wb_t *wb, H5D_chunk_wb_ent_t *ent)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(wb);
+    HDassert(ent);
+    HDassert(ent->buf);
+
+    if(H5D__chunk_filter(wb->layout, wb->pline, 0, &(ent->filter_mask), ent->err_detect,
+            ent->filter_cb, &(ent->nbytes), &(ent->buf_size), &(ent->buf)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
+#if H5_SIZEOF_SIZE_T > 4
+    /* Check for the chunk expanding too much to encode in a 32-bit value */
+    if(ent->nbytes > ((size_t)0xffffffff))
+        HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk too large for 32-bit length")
+#endif /* H5_SIZEOF_SIZE_T > 4 */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_wb_filter() */
+
+#ifdef H5_HAVE_THREADSAFE
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_wb_thread
+ *
+ * Purpose:     Main routine of the filter thread for a write-behind
+ *              queue: filters the queued chunks in order until told to
+ *              exit, then releases the queue.
+ *
+ *              The I/O pipeline, the filter table, the free lists and the
+ *              error stacks aren't safe to use while the library is
+ *              running on another thread, so each chunk is filtered with
+ *              the API lock held.  Chunks are therefore only filtered
+ *              in the background between API calls; the library thread
+ *              filters the chunks it needs itself (see
+ *              H5D__chunk_wb_retire).  Allocating space in the file and
+ *              writing the chunks are always left to the library thread.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5D__chunk_wb_thread(void *_wb)
+{
+    H5D_chunk_wb_t *wb = (H5D_chunk_wb_t *)_wb;
+
+    H5TS_mutex_lock_simple(&wb->lock);
+    while(!wb->shutdown) {
+        H5D_chunk_wb_ent_t *ent;        /* Chunk to filter */
+
+        /* Wait for a chunk to filter */
+        if(NULL == wb->next_filter) {
+            H5TS_cond_wait(&wb->cond, &wb->lock);
+            continue;
+        } /* end if */
+        H5TS_mutex_unlock_simple(&wb->lock);
+
+        /* Acquire the API lock, then check the chunk is still waiting to
+         * be filtered, since the library thread may have taken it
+         */
+        H5_API_LOCK
+        H5TS_mutex_lock_simple(&wb->lock);
+        if(!wb->shutdown && NULL != (ent = wb->next_filter)) {
+            herr_t status;              /* Outcome of filtering */
+
+            wb->next_filter = ent->next;
+            ent->state = H5D_CHUNK_WB_FILTERING;
+            H5TS_mutex_unlock_simple(&wb->lock);
+
+            /* Filter the chunk.  Errors are reported by the library thread
+             * when the chunk is retired, so drop this thread's error stack.
+             */
+            if((status = H5D__chunk_wb_filter(wb, ent)) < 0)
+                H5E_clear_stack(NULL);
+
+            /* Let the library know the chunk is ready */
+            H5TS_mutex_lock_simple(&wb->lock);
+            ent->state = (status < 0) ? H5D_CHUNK_WB_FAILED : H5D_CHUNK_WB_FILTERED;
+            H5TS_cond_broadcast(&wb->cond);
+        } /* end if */
+        H5TS_mutex_unlock_simple(&wb->lock);
+        H5_API_UNLOCK
+
+        H5TS_mutex_lock_simple(&wb->lock);
+    } /* end while */
+    H5TS_mutex_unlock_simple(&wb->lock);
+
+    /* The queue was handed over to this thread when it was shut down */
+    H5_API_LOCK
+    (void)H5TS_cond_destroy(&wb->cond);
+    H5TS_mutex_destroy(&wb->lock);
+    H5MM_xfree(wb);
+    H5_API_UNLOCK
+
+    return NULL;
+} /* end H5D__chunk_wb_thread() */
+#endif /* H5_HAVE_THREADSAFE */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_wb_enqueue
+ *
+ * Purpose:     Adds an evicted dirty chunk to the dataset's write-behind
+ *              queue, taking ownership of the chunk's buffer.  If the
+ *              queue is full, writes the oldest chunks first.
+ *
+ *              Chunks in the queue count against the size of the chunk
+ *              cache, so the queue never holds more than the cache size.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_wb_enqueue(const H5D_t *dset, H5D_rdcc_ent_t *ent)
+{
+    H5D_chunk_wb_t *wb = dset->shared->cache.chunk.wb;  /* Write-behind queue */
+    H5D_chunk_wb_ent_t *wb_ent = NULL;  /* Queued chunk */
+    size_t chunk_size = dset->shared->layout.u.chunk.size;  /* Size of an unfiltered chunk */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(wb);
+    HDassert(ent);
+    HDassert(ent->chunk);
+
+    /* Write any chunks that are ready, and make room for this one */
+    if(H5D__chunk_wb_retire(dset, wb->nmax - 1) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write queued chunks")
+    while(wb->nqueued > 0 && (wb->nbytes + chunk_size) > dset->shared->cache.chunk.nbytes_max)
+        if(H5D__chunk_wb_retire(dset, wb->nqueued - 1) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write queued chunks")
+
+    if(NULL == (wb_ent = H5FL_MALLOC(H5D_chunk_wb_ent_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for queued chunk")
+
+    /* Retrieve filter settings from API context, since they aren't
+     * available when the chunk is filtered
+     */
+    if(H5CX_get_err_detect(&wb_ent->err_detect) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+    if(H5CX_get_filter_cb(&wb_ent->filter_cb) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+
+    HDmemcpy(wb_ent->scaled, ent->scaled, sizeof(wb_ent->scaled));
+    wb_ent->chunk_idx = ent->chunk_idx;
+    wb_ent->chunk_block = ent->chunk_block;
+    wb_ent->buf = ent->chunk;
+    wb_ent->buf_size = wb_ent->nbytes = chunk_size;
+    wb_ent->filter_mask = 0;
+    wb_ent->state = H5D_CHUNK_WB_QUEUED;
+    wb_ent->next = NULL;
+
+    /* The queue owns the chunk's buffer now */
+    ent->chunk = NULL;
+
+    /* Append the chunk to the queue */
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_lock_simple(&wb->lock);
+#endif /* H5_HAVE_THREADSAFE */
+    if(wb->tail)
+        wb->tail->next = wb_ent;
+    else
+        wb->head = wb_ent;
+    wb->tail = wb_ent;
+    wb->nqueued++;
+    wb->nbytes += chunk_size;
+#ifdef H5_HAVE_THREADSAFE
+    if(NULL == wb->next_filter)
+        wb->next_filter = wb_ent;
+    H5TS_cond_broadcast(&wb->cond);
+    H5TS_mutex_unlock_simple(&wb->lock);
+
+    /* Start the filter thread, the first time it's needed.  If the thread
+     * can't be created, the chunks are filtered when they are written.
+     */
+    if(!wb->started) {
+        wb->started = TRUE;
+        wb->running = (H5TS_create_detached_thread(H5D__chunk_wb_thread, wb) >= 0);
+    } /* end if */
+#endif /* H5_HAVE_THREADSAFE */
+    wb_ent = NULL;
+
+done:
+    if(wb_ent)
+        wb_ent = H5FL_FREE(H5D_chunk_wb_ent_t, wb_ent);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_wb_enqueue() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_wb_retire
+ *
+ * Purpose:     Writes chunks from the front of the dataset's write-behind
+ *              queue until no more than NLEAVE chunks remain, filtering
+ *              them if necessary.  Chunks that have already been filtered
+ *              are written as well, even if that leaves fewer than NLEAVE
+ *              chunks.
+ *
+ *              Pass NLEAVE as zero to empty the queue.  Does nothing if
+ *              the dataset has no write-behind queue.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_wb_retire(const H5D_t *dset, size_t nleave)
+{
+    H5D_chunk_wb_t *wb = dset->shared->cache.chunk.wb;  /* Write-behind queue */
+    unsigned nerrors = 0;               /* Count of chunks that couldn't be written */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC_TAG(dset->oloc.addr)
+
+    if(NULL == wb)
+        HGOTO_DONE(SUCCEED)
+
+    while(wb->head) {
+        H5D_chunk_wb_ent_t *ent = wb->head; /* Chunk to write */
+        H5D_chunk_ud_t udata;           /* Chunk's index info */
+        hbool_t filter = TRUE;          /* Whether to filter the chunk here */
+
+#ifdef H5_HAVE_THREADSAFE
+        H5TS_mutex_lock_simple(&wb->lock);
+
+        /* Stop when enough chunks are left, unless the next one is ready */
+        if(wb->nqueued <= nleave && ent->state < H5D_CHUNK_WB_FILTERED) {
+            H5TS_mutex_unlock_simple(&wb->lock);
+            break;
+        } /* end if */
+
+        /* Filter the chunk here if the filter thread hasn't started on it,
+         * instead of waiting for the thread, which can't filter while this
+         * thread holds the API lock.  Otherwise wait for the thread to
+         * finish with it.
+         */
+        if(ent->state == H5D_CHUNK_WB_QUEUED) {
+            HDassert(wb->next_filter == ent);
+            wb->next_filter = ent->next;
+        } /* end if */
+        else {
+            while(ent->state == H5D_CHUNK_WB_FILTERING)
+                H5TS_cond_wait(&wb->cond, &wb->lock);
+            filter = FALSE;
+        } /* end else */
+#else /* H5_HAVE_THREADSAFE */
+        if(wb->nqueued <= nleave)
+            break;
+#endif /* H5_HAVE_THREADSAFE */
+
+        /* Remove the chunk from the queue */
+        wb->head = ent->next;
+        if(NULL == wb->head)
+            wb->tail = NULL;
+        wb->nqueued--;
+        wb->nbytes -= dset->shared->layout.u.chunk.size;
+#ifdef H5_HAVE_THREADSAFE
+        H5TS_mutex_unlock_simple(&wb->lock);
+#endif /* H5_HAVE_THREADSAFE */
+
+        /* Filter the chunk */
+        if(filter) {
+            if(H5D__chunk_wb_filter(wb, ent) < 0) {
+                HDONE_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
+                ent->state = H5D_CHUNK_WB_FAILED;
+            } /* end if */
+            else
+                ent->state = H5D_CHUNK_WB_FILTERED;
+        } /* end if */
+
+        /* Write the chunk */
+        if(ent->state == H5D_CHUNK_WB_FILTERED) {
+            udata.common.layout = &dset->shared->layout.u.chunk;
+            udata.common.storage = &dset->shared->layout.storage.u.chunk;
+            udata.common.scaled = ent->scaled;
+            udata.chunk_block.offset = ent->chunk_block.offset;
+            H5_CHECKED_ASSIGN(udata.chunk_block.length, hsize_t, ent->nbytes, size_t);
+            udata.filter_mask = ent->filter_mask;
+            udata.chunk_idx = ent->chunk_idx;
+
+            if(H5D__chunk_write_block(dset, &udata, &(ent->chunk_block), TRUE, ent->buf) < 0) {
+                HDONE_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write queued chunk")
+                nerrors++;
+            } /* end if */
+        } /* end if */
+        else {
+            /* Errors from the filter thread aren't on this thread's stack */
+            if(!filter)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
+            nerrors++;
+        } /* end else */
+
+        H5MM_xfree(ent->buf);
+        ent = H5FL_FREE(H5D_chunk_wb_ent_t, ent);
+    } /* end while */
+
+    if(nerrors)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to write one or more queued chunks")
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_wb_retire() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_wb_retire_chunk
+ *
+ * Purpose:     If the chunk at SCALED is in the dataset's write-behind
+ *              queue, writes it (and the chunks queued before it), so
+ *              that the chunk index is up to date for the chunk.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_wb_retire_chunk(const H5D_t *dset, const hsize_t *scaled)
+{
+    H5D_chunk_wb_t *wb = dset->shared->cache.chunk.wb;  /* Write-behind queue */
+    const H5D_chunk_wb_ent_t *ent;      /* Queued chunk */
+    size_t ndims;                       /* # of chunk dimensions to compare */
+    size_t pos;                         /* Position of chunk in queue */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(wb);
+    HDassert(scaled);
+
+    /* Only the library thread adds or removes chunks, so the queue can be
+     * searched without locking it
+     */
+    ndims = dset->shared->ndims;
+    for(ent = wb->head, pos = 0; ent; ent = ent->next, pos++)
+        if(!HDmemcmp(ent->scaled, scaled, ndims * sizeof(hsize_t)))
+            break;
+
+    /* Write the chunk, and all chunks before it */
+    if(ent)
+        if(H5D__chunk_wb_retire(dset, wb->nqueued - (pos + 1)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write queued chunk")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_wb_retire_chunk() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_wb_flush
+ *
+ * Purpose:     Writes all chunks in a dataset's write-behind queue, for
+ *              operations outside this file that change the chunk index.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_wb_flush(const H5D_t *dset)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset);
+
+    if(H5D__chunk_wb_retire(dset, (size_t)0) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write queued chunks")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_wb_flush() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D_chunk_wb_flush_opened
+ *
+ * Purpose:     Writes all chunks in the write-behind queue of a dataset
+ *              that is open in the file, given the location of its object
+ *              header and its shared information from H5FO_opened.  Used
+ *              before copying an open dataset, which reads its chunks from
+ *              the chunk index.
+ *
+ * Note:        Must be called while the dataset's object header is not
+ *              protected, since writing a chunk may update the layout
+ *              message.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D_chunk_wb_flush_opened(const H5O_loc_t *oloc, void *shared_fo)
+{
+    H5D_shared_t *shared = (H5D_shared_t *)shared_fo;   /* Open dataset's shared info */
+    H5D_t dset;                         /* Dataset to write the chunks for */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
 
-    /* Remove from cache */
-    HDassert(rdcc->slot[ent->idx] != ent);
-    ent->idx = UINT_MAX;
-    rdcc->nbytes_used -= dset->shared->layout.u.chunk.size;
-    --rdcc->nused;
+    HDassert(oloc);
+    HDassert(shared);
 
-    /* Free */
-    ent = H5FL_FREE(H5D_rdcc_ent_t, ent);
+    if(H5D_CHUNKED == shared->layout.type && shared->cache.chunk.wb) {
+        HDmemset(&dset, 0, sizeof(dset));
+        dset.oloc = *oloc;
+        dset.shared = shared;
 
+        if(H5D__chunk_wb_retire(&dset, (size_t)0) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write queued chunks")
+    } /* end if */
+
+done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_cache_evict() */
+} /* end H5D_chunk_wb_flush_opened() */
 
 
 /*-------------------------------------------------------------------------
@@ -3299,7 +5324,7 @@ H5D__chunk_cache_prune(const H5D_t *dset, size_t size)
     p[0] = rdcc->head;
     p[1] = NULL;
 
-    while((p[0] || p[1]) && (rdcc->nbytes_used + size) > total) {
+    while((p[0] || p[1]) && (H5D_RDCC_NBYTES_USED(rdcc) + size) > total) {
         int i;          /* Local index variable */
 
 	/* Introduce new pointers */
@@ -3312,7 +5337,7 @@ H5D__chunk_cache_prune(const H5D_t *dset, size_t size)
             n[i] = p[i] ? p[i]->next : NULL;
 
 	/* Give each method a chance */
-	for(i = 0; i < nmeth && (rdcc->nbytes_used + size) > total; i++) {
+	for(i = 0; i < nmeth && (H5D_RDCC_NBYTES_USED(rdcc) + size) > total; i++) {
 	    if(0 == i && p[0] && !p[0]->locked &&
                     ((0 == p[0]->rd_count && 0 == p[0]->wr_count) ||
                      (0 == p[0]->rd_count && dset->shared->layout.u.chunk.size == p[0]->wr_count) ||
@@ -3382,6 +5407,17 @@ done:
  *		for output functions that are about to overwrite the entire
  *		chunk.
  *
+ *		If CHUNK_BUF is non-NULL, it holds the chunk's data as stored
+ *		in the file (i.e. still filtered), which the caller has
+ *		already read, and it is used instead of reading the chunk
+ *		from the file.
+ *
+ *		If CHUNK_SEL is non-NULL, it is the part of the chunk that
+ *		the caller is about to read.  A chunk split into shards that
+ *		won't be cached then only has the shards which intersect
+ *		CHUNK_SEL read and unfiltered; the rest of the returned
+ *		buffer is undefined.
+ *
  * Return:	Success:	Ptr to a file chunk.
  *
  *		Failure:	NULL
@@ -3393,7 +5429,8 @@ done:
  */
 static void *
 H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
-    hbool_t relax, hbool_t prev_unfilt_chunk)
+    hbool_t relax, hbool_t prev_unfilt_chunk, const void *chunk_buf,
+    H5S_t *chunk_sel)
 {
     const H5D_t         *dset = io_info->dset;  /* Local pointer to the dataset info */
     const H5O_pline_t   *pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info - always equal to the pline passed to H5D__chunk_mem_alloc */
@@ -3417,20 +5454,15 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
     HDassert(udata);
     HDassert(dset);
     HDassert(!(udata->new_unfilt_chunk && prev_unfilt_chunk));
-    HDassert(!rdcc->tmp_head);
 
     /* Get the chunk's size */
     HDassert(layout->u.chunk.size > 0);
     H5_CHECKED_ASSIGN(chunk_size, size_t, layout->u.chunk.size, uint32_t);
 
     /* Check if the chunk is in the cache */
-    if(UINT_MAX != udata->idx_hint) {
-        /* Sanity check */
-        HDassert(udata->idx_hint < rdcc->nslots);
-        HDassert(rdcc->slot[udata->idx_hint]);
-
+    if(NULL != udata->cache_ent) {
         /* Get the entry */
-        ent = rdcc->slot[udata->idx_hint];
+        ent = udata->cache_ent;
 
 #ifndef NDEBUG
 {
@@ -3591,7 +5623,22 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
              */
 
             /* Check if the chunk exists on disk */
-            if(H5F_addr_defined(chunk_addr)) {
+            if(H5F_addr_defined(chunk_addr) && chunk_sel && old_pline && old_pline->nused
+                    && (layout->u.chunk.flags & H5O_LAYOUT_CHUNK_SHARDED)
+                    && !udata->new_unfilt_chunk
+                    && !(rdcc->nslots > 0 && chunk_size <= rdcc->nbytes_max)) {
+                /* Only read the shards that are needed, since the chunk
+                 * won't be kept around for later accesses */
+                if(NULL == (chunk = H5D__chunk_mem_alloc(chunk_size, pline)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
+                if(H5D__chunk_read_shards(dset, old_pline, chunk_addr, (size_t)chunk_alloc,
+                        chunk_buf, udata->filter_mask, chunk_sel, chunk) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, NULL, "unable to read shards of raw data chunk")
+
+                /* Increment # of cache misses */
+                rdcc->stats.nmisses++;
+            } /* end if */
+            else if(H5F_addr_defined(chunk_addr)) {
                 size_t my_chunk_alloc = chunk_alloc;	/* Allocated buffer size */
                 size_t buf_alloc = chunk_alloc;	        /* [Re-]allocated buffer size */
 
@@ -3599,7 +5646,9 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
                  * size in memory, so allocate memory big enough. */
                 if(NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc, (udata->new_unfilt_chunk ? old_pline : pline))))
                     HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
-                if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, chunk_addr, my_chunk_alloc, chunk) < 0)
+                if(chunk_buf)
+                    HDmemcpy(chunk, chunk_buf, my_chunk_alloc);
+                else if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, chunk_addr, my_chunk_alloc, chunk) < 0)
                     HGOTO_ERROR(H5E_IO, H5E_READERROR, NULL, "unable to read raw data chunk")
 
                 if(old_pline && old_pline->nused) {
@@ -3612,7 +5661,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
                     if(H5CX_get_filter_cb(&filter_cb) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't get I/O filter callback function")
 
-                    if(H5Z_pipeline(old_pline, H5Z_FLAG_REVERSE, &(udata->filter_mask),
+                    if(H5D__chunk_filter(&layout->u.chunk, old_pline, H5Z_FLAG_REVERSE, &(udata->filter_mask),
                             err_detect, filter_cb, &my_chunk_alloc, &buf_alloc, &chunk) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, NULL, "data pipeline read failed")
 
@@ -3679,60 +5728,57 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
 
         /* See if the chunk can be cached */
         if(rdcc->nslots > 0 && chunk_size <= rdcc->nbytes_max) {
-            /* Calculate the index */
-            udata->idx_hint = H5D__chunk_hash_val(io_info->dset->shared, udata->common.scaled);
-
-            /* Add the chunk to the cache only if the slot is not already locked */
-            ent = rdcc->slot[udata->idx_hint];
-            if(!ent || !ent->locked) {
-                /* Preempt enough things from the cache to make room */
-                if(ent) {
-                    if(H5D__chunk_cache_evict(io_info->dset, ent, TRUE) < 0)
-                        HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk from cache")
-                } /* end if */
-                if(H5D__chunk_cache_prune(io_info->dset, chunk_size) < 0)
-                    HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from cache")
-
-                /* Create a new entry */
-                if(NULL == (ent = H5FL_CALLOC(H5D_rdcc_ent_t)))
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "can't allocate raw data chunk entry")
-
-                ent->edge_chunk_state = disable_filters ? H5D_RDCC_DISABLE_FILTERS : 0;
-                if(udata->new_unfilt_chunk)
-                    ent->edge_chunk_state |= H5D_RDCC_NEWLY_DISABLED_FILTERS;
-
-                /* Initialize the new entry */
-                ent->chunk_block.offset = chunk_addr;
-                ent->chunk_block.length = chunk_alloc;
-                ent->chunk_idx = udata->chunk_idx;
-                HDmemcpy(ent->scaled, udata->common.scaled, sizeof(hsize_t) * layout->u.chunk.ndims);
-                H5_CHECKED_ASSIGN(ent->rd_count, uint32_t, chunk_size, size_t);
-                H5_CHECKED_ASSIGN(ent->wr_count, uint32_t, chunk_size, size_t);
-                ent->chunk = (uint8_t *)chunk;
+            size_t idx;                 /* Hash table bucket for the chunk */
+
+            /* Preempt enough things from the cache to make room */
+            HDassert(NULL == udata->cache_ent);
+            if(H5D__chunk_cache_prune(io_info->dset, chunk_size) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from cache")
+
+            /* Grow the hash table when it fills up, and shrink it again
+             * when most of the chunks have left the cache */
+            if((size_t)rdcc->nused >= rdcc->nbuckets) {
+                if(H5D__chunk_cache_resize(io_info->dset, rdcc->nbuckets * 2) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "unable to grow chunk cache hash table")
+            } /* end if */
+            else if(rdcc->nbuckets > rdcc->nbuckets_min && (size_t)rdcc->nused < rdcc->nbuckets / 8)
+                if(H5D__chunk_cache_resize(io_info->dset, rdcc->nbuckets / 2) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "unable to shrink chunk cache hash table")
 
-                /* Add it to the cache */
-                HDassert(NULL == rdcc->slot[udata->idx_hint]);
-                rdcc->slot[udata->idx_hint] = ent;
-                ent->idx = udata->idx_hint;
-                rdcc->nbytes_used += chunk_size;
-                rdcc->nused++;
-
-                /* Add it to the linked list */
-                if(rdcc->tail) {
-                    rdcc->tail->next = ent;
-                    ent->prev = rdcc->tail;
-                    rdcc->tail = ent;
-                } /* end if */
-                else
-                    rdcc->head = rdcc->tail = ent;
-                ent->tmp_next = NULL;
-                ent->tmp_prev = NULL;
+            /* Create a new entry */
+            if(NULL == (ent = H5FL_CALLOC(H5D_rdcc_ent_t)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "can't allocate raw data chunk entry")
+
+            ent->edge_chunk_state = disable_filters ? H5D_RDCC_DISABLE_FILTERS : 0;
+            if(udata->new_unfilt_chunk)
+                ent->edge_chunk_state |= H5D_RDCC_NEWLY_DISABLED_FILTERS;
 
+            /* Initialize the new entry */
+            ent->chunk_block.offset = chunk_addr;
+            ent->chunk_block.length = chunk_alloc;
+            ent->chunk_idx = udata->chunk_idx;
+            HDmemcpy(ent->scaled, udata->common.scaled, sizeof(hsize_t) * layout->u.chunk.ndims);
+            H5_CHECKED_ASSIGN(ent->rd_count, uint32_t, chunk_size, size_t);
+            H5_CHECKED_ASSIGN(ent->wr_count, uint32_t, chunk_size, size_t);
+            ent->chunk = (uint8_t *)chunk;
+
+            /* Add it to the cache */
+            idx = H5D__chunk_hash_val(io_info->dset->shared, ent->scaled, rdcc->nbuckets);
+            ent->hash_next = rdcc->slot[idx];
+            rdcc->slot[idx] = ent;
+            udata->cache_ent = ent;
+            rdcc->nbytes_used += chunk_size;
+            rdcc->nused++;
+
+            /* Add it to the linked list */
+            if(rdcc->tail) {
+                rdcc->tail->next = ent;
+                ent->prev = rdcc->tail;
+                rdcc->tail = ent;
             } /* end if */
             else
-                /* We did not add the chunk to cache */
-                ent = NULL;
-        } /* end else */
+                rdcc->head = rdcc->tail = ent;
+        } /* end if */
         else /* No cache set up, or chunk is too large: chunk is uncacheable */
             ent = NULL;
     } /* end else */
@@ -3749,7 +5795,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
          * reason all those arguments have to be repeated for the unlock
          * function.
          */
-        udata->idx_hint = UINT_MAX;
+        udata->cache_ent = NULL;
 
     /* Set return value */
     ret_value = chunk;
@@ -3795,7 +5841,6 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
     hbool_t dirty, void *chunk, uint32_t naccessed)
 {
     const H5O_layout_t *layout = &(io_info->dset->shared->layout); /* Dataset layout */
-    const H5D_rdcc_t	*rdcc = &(io_info->dset->shared->cache.chunk);
     herr_t              ret_value = SUCCEED;      /* Return value */
 
     FUNC_ENTER_STATIC
@@ -3804,7 +5849,7 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
     HDassert(io_info);
     HDassert(udata);
 
-    if(UINT_MAX == udata->idx_hint) {
+    if(NULL == udata->cache_ent) {
         /*
          * It's not in the cache, probably because it's too big.  If it's
          * dirty then flush it to disk.  In any case, free the chunk.
@@ -3850,17 +5895,14 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
         } /* end else */
     } /* end if */
     else {
-        H5D_rdcc_ent_t	*ent;   /* Chunk's entry in the cache */
+        H5D_rdcc_ent_t	*ent = udata->cache_ent;   /* Chunk's entry in the cache */
 
         /* Sanity check */
-	HDassert(udata->idx_hint < rdcc->nslots);
-	HDassert(rdcc->slot[udata->idx_hint]);
-	HDassert(rdcc->slot[udata->idx_hint]->chunk == chunk);
+	HDassert(ent->chunk == chunk);
 
         /*
          * It's in the cache so unlock it.
          */
-        ent = rdcc->slot[udata->idx_hint];
         HDassert(ent->locked);
         if(dirty) {
             ent->dirty = TRUE;
@@ -3932,6 +5974,10 @@ H5D__chunk_allocated(const H5D_t *dset, hsize_t *nbytes)
     HDassert(dset->shared);
     H5D_CHUNK_STORAGE_INDEX_CHK(sc);
 
+    /* Write the chunks in the write-behind queue */
+    if(H5D__chunk_wb_retire(dset, (size_t)0) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write queued chunks")
+
     /* Search for cached chunks that haven't been written out */
     for(ent = rdcc->head; ent; ent = ent->next)
         /* Flush the chunk out to disk, to make certain the size is correct later */
@@ -3955,6 +6001,155 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_allocated() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_fill_write
+ *
+ * Purpose:	Write NCHUNKS copies of the fill value chunk FILL_BUF, each
+ *		CHUNK_SIZE bytes long, to the file, one after the other,
+ *		starting at ADDR.  The copies are written from RUN's buffer,
+ *		which holds the chunk repeated back to back, with as few
+ *		I/O calls as possible.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_fill_write(H5F_t *f, H5D_chunk_fill_run_t *run, haddr_t addr,
+    size_t nchunks, size_t chunk_size, const void *fill_buf)
+{
+    size_t      max_nchunks;            /* Most copies of the chunk to write at once */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(f);
+    HDassert(run);
+    HDassert(nchunks > 0);
+    HDassert(chunk_size > 0);
+    HDassert(fill_buf);
+
+    /* Set up the buffer of repeated chunks, if it doesn't fit this run */
+    max_nchunks = MIN(MAX(H5D_CHUNK_FILL_WRITE_SIZE / chunk_size, 1), nchunks);
+    if(run->src != fill_buf || run->chunk_size != chunk_size || run->nchunks < max_nchunks) {
+        size_t u;                       /* Local index variable */
+
+        run->buf = (uint8_t *)H5MM_xfree(run->buf);
+        run->src = NULL;
+        if(NULL == (run->buf = (uint8_t *)H5MM_malloc(max_nchunks * chunk_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for fill value chunks")
+        for(u = 0; u < max_nchunks; u++)
+            HDmemcpy(run->buf + (u * chunk_size), fill_buf, chunk_size);
+        run->src = fill_buf;
+        run->chunk_size = chunk_size;
+        run->nchunks = max_nchunks;
+    } /* end if */
+
+    /* Write the chunks */
+    while(nchunks > 0) {
+        size_t n = MIN(nchunks, run->nchunks);     /* # of chunks to write now */
+
+        if(H5F_block_write(f, H5FD_MEM_DRAW, addr, n * chunk_size, run->buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+        addr += n * chunk_size;
+        nchunks -= n;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_fill_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_allocate_batch
+ *
+ * Purpose:	Allocate file space for a batch of new chunks found by
+ *		H5D__chunk_allocate, write their fill values and insert
+ *		them into the chunk index.
+ *
+ *		Space for all the chunks is allocated at once (unless the
+ *		index works out the chunk addresses itself), so the chunks
+ *		end up next to each other in the file and runs of chunks
+ *		with the same fill value can be written together.  Each
+ *		chunk's IDX field tells which of FILL_BUFS and FILL_SIZES
+ *		to use for it.  FILL_BUFS is NULL if fill values aren't
+ *		written.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_allocate_batch(const H5D_t *dset, const H5D_chk_idx_info_t *idx_info,
+    H5D_chunk_direct_ent_t *ents, size_t nents, void * const *fill_bufs,
+    const size_t *fill_sizes, H5D_chunk_fill_run_t *run)
+{
+    const H5D_chunk_ops_t *ops = idx_info->storage->ops;    /* Chunk index operations */
+    size_t      u, v;                   /* Local index variables */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset);
+    HDassert(idx_info);
+    HDassert(ents);
+    HDassert(run);
+
+    /* Allocate space for the chunks */
+    if(H5D_CHUNK_IDX_NONE == idx_info->storage->idx_type
+            || H5D_CHUNK_IDX_SINGLE == idx_info->storage->idx_type) {
+        for(u = 0; u < nents; u++)
+            if(H5D__chunk_file_alloc(idx_info, NULL, &ents[u].udata.chunk_block, &ents[u].need_insert, ents[u].scaled) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
+    } /* end if */
+    else {
+        hsize_t alloc_size = 0;         /* Size of space for new chunks */
+        haddr_t addr;                   /* Address of next new chunk */
+
+        for(u = 0; u < nents; u++) {
+            if(H5D__chunk_file_alloc_check(idx_info, NULL, FALSE, &ents[u].udata.chunk_block, &ents[u].alloc) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to check chunk allocation")
+            HDassert(ents[u].alloc);
+            alloc_size += ents[u].udata.chunk_block.length;
+        } /* end for */
+
+        if(HADDR_UNDEF == (addr = H5MF_alloc(idx_info->f, H5FD_MEM_DRAW, alloc_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "file allocation failed")
+        for(u = 0; u < nents; u++) {
+            ents[u].udata.chunk_block.offset = addr;
+            ents[u].need_insert = TRUE;
+            addr += ents[u].udata.chunk_block.length;
+        } /* end for */
+    } /* end else */
+
+    /* Write the fill values, for runs of adjacent chunks at a time */
+    if(fill_bufs)
+        for(u = 0; u < nents; u = v) {
+            const H5F_block_t *block = &ents[u].udata.chunk_block;
+            size_t chunk_size = fill_sizes[ents[u].idx];   /* Size of each chunk in the run */
+
+            HDassert(block->length == chunk_size);
+            for(v = u + 1; v < nents; v++)
+                if(ents[v].idx != ents[u].idx
+                        || ents[v].udata.chunk_block.offset != block->offset + ((v - u) * chunk_size))
+                    break;
+
+            if(H5D__chunk_fill_write(idx_info->f, run, block->offset, v - u, chunk_size, fill_bufs[ents[u].idx]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write fill values to file")
+        } /* end for */
+
+    /* Insert the chunk records into the index */
+    if(ops->insert)
+        for(u = 0; u < nents; u++)
+            if(ents[u].need_insert)
+                if((ops->insert)(idx_info, &ents[u].udata, dset) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_allocate_batch() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_allocate
@@ -3990,6 +6185,11 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
     hbool_t     should_fill = FALSE; /* Whether fill values should be written */
     void        *unfilt_fill_buf = NULL; /* Unfiltered fill value buffer */
     void        **fill_buf = NULL;      /* Pointer to the fill buffer to use for a chunk */
+    H5D_chunk_direct_ent_t *batch = NULL; /* Chunks waiting for file space */
+    size_t      nbatch = 0;             /* # of chunks in batch */
+    void        *batch_fill_bufs[2];    /* Fill buffers for filtered & unfiltered chunks in batch */
+    size_t      batch_fill_sizes[2];    /* Sizes of chunks in batch_fill_bufs */
+    H5D_chunk_fill_run_t fill_run;      /* Fill value chunks repeated for writing */
 #ifdef H5_HAVE_PARALLEL
     hbool_t     blocks_written = FALSE; /* Flag to indicate that chunk was actually written */
     hbool_t     using_mpi = FALSE;    /* Flag to indicate that the file is being accessed with an MPI-capable file driver */
@@ -4011,6 +6211,8 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
 
     FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
 
+    HDmemset(&fill_run, 0, sizeof(fill_run));
+
     /* Check args */
     HDassert(dset && H5D_CHUNKED == layout->type);
     HDassert(layout->u.chunk.ndims > 0 && layout->u.chunk.ndims <= H5O_LAYOUT_NDIMS);
@@ -4049,9 +6251,8 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
      * assume here that all elements of space_dim are > 0.  This is checked at
      * the top of this function. */
     for(op_dim=0; op_dim<space_ndims; op_dim++) {
-        /* Validate this chunk dimension */
-        if(chunk_dim[op_dim] == 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk size must be > 0, dim = %u ", op_dim)
+        /* (Chunk dimensions are checked when the layout is created or decoded) */
+        HDassert(chunk_dim[op_dim] > 0);
         min_unalloc[op_dim] = (old_dim[op_dim] + chunk_dim[op_dim] - 1) / chunk_dim[op_dim];
         max_unalloc[op_dim] = (space_dim[op_dim] - 1) / chunk_dim[op_dim];
 
@@ -4130,7 +6331,7 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
 
             /* Push the chunk through the filters */
-            if(H5Z_pipeline(pline, 0, &filter_mask, err_detect, filter_cb, &orig_chunk_size, &buf_size, &fb_info.fill_buf) < 0)
+            if(H5D__chunk_filter(&layout->u.chunk, pline, 0, &filter_mask, err_detect, filter_cb, &orig_chunk_size, &buf_size, &fb_info.fill_buf) < 0)
                 HGOTO_ERROR(H5E_PLINE, H5E_WRITEERROR, FAIL, "output pipeline failed")
 #if H5_SIZEOF_SIZE_T > 4
             /* Check for the chunk expanding too much to encode in a 32-bit value */
@@ -4146,6 +6347,25 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
     idx_info.layout = &dset->shared->layout.u.chunk;
     idx_info.storage = &dset->shared->layout.storage.u.chunk;
 
+    /* Unless each chunk gets its own fill values, allocate file space for
+     * the chunks and write them in batches (the parallel case already
+     * writes all the chunks together at the end)
+     */
+    if(!(fb_info_init && fb_info.has_vlen_fill_type)
+#ifdef H5_HAVE_PARALLEL
+            && !using_mpi
+#endif /* H5_HAVE_PARALLEL */
+            ) {
+        if(NULL == (batch = (H5D_chunk_direct_ent_t *)H5MM_malloc(H5D_CHUNK_ALLOC_BATCH * sizeof(H5D_chunk_direct_ent_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+        if(should_fill) {
+            batch_fill_bufs[0] = fb_info.fill_buf;
+            batch_fill_sizes[0] = orig_chunk_size;
+            batch_fill_bufs[1] = unfilt_fill_buf;
+            batch_fill_sizes[1] = layout->u.chunk.size;
+        } /* end if */
+    } /* end if */
+
     /* Loop over all chunks */
     /* The algorithm is:
      *  For each dimension:
@@ -4270,7 +6490,7 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
 
                     /* Push the chunk through the filters */
-                    if(H5Z_pipeline(pline, 0, &filter_mask, err_detect, filter_cb, &nbytes, &fb_info.fill_buf_size, &fb_info.fill_buf) < 0)
+                    if(H5D__chunk_filter(&layout->u.chunk, pline, 0, &filter_mask, err_detect, filter_cb, &nbytes, &fb_info.fill_buf_size, &fb_info.fill_buf) < 0)
                         HGOTO_ERROR(H5E_PLINE, H5E_WRITEERROR, FAIL, "output pipeline failed")
 
 #if H5_SIZEOF_SIZE_T > 4
@@ -4296,50 +6516,70 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
             H5_CHECKED_ASSIGN(udata.chunk_block.length, uint32_t, chunk_size, size_t);
             udata.filter_mask = filter_mask;
 
-            /* Allocate the chunk (with all processes) */
-	    if(H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert, scaled) < 0)
-		HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
-            HDassert(H5F_addr_defined(udata.chunk_block.offset));
-
-            /* Check if fill values should be written to chunks */
-            if(should_fill) {
-                /* Sanity check */
-                HDassert(fb_info_init);
-                HDassert(udata.chunk_block.length == chunk_size);
+            /* Add the chunk to the batch */
+            if(batch) {
+                H5D_chunk_direct_ent_t *ent = &batch[nbatch++];
+
+                HDmemcpy(ent->scaled, scaled, sizeof(hsize_t) * (space_ndims + 1));
+                ent->udata = udata;
+                ent->udata.common.scaled = ent->scaled;
+                ent->idx = (fill_buf == &unfilt_fill_buf) ? 1 : 0;
+                ent->alloc = FALSE;
+                ent->need_insert = FALSE;
+
+                if(nbatch == H5D_CHUNK_ALLOC_BATCH) {
+                    if(H5D__chunk_allocate_batch(dset, &idx_info, batch, nbatch,
+                            should_fill ? batch_fill_bufs : NULL, batch_fill_sizes, &fill_run) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunks")
+                    nbatch = 0;
+                } /* end if */
+            } /* end if */
+            else {
+                /* Allocate the chunk (with all processes) */
+                if(H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert, scaled) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
+                HDassert(H5F_addr_defined(udata.chunk_block.offset));
+
+                /* Check if fill values should be written to chunks */
+                if(should_fill) {
+                    /* Sanity check */
+                    HDassert(fb_info_init);
+                    HDassert(udata.chunk_block.length == chunk_size);
 
 #ifdef H5_HAVE_PARALLEL
-                /* Check if this file is accessed with an MPI-capable file driver */
-                if(using_mpi) {
-                    /* collect all chunk addresses to be written to
-                       write collectively at the end */
-                    /* allocate/resize address array if no more space left */
-                    /* Note that if we add support for parallel filters we must
-                     * also store an array of chunk sizes and pass it to the
-                     * apporpriate collective write function */
-                    if(0 == chunk_info.num_io % 1024)
-                        if(NULL == (chunk_info.addr = (haddr_t *)H5MM_realloc(chunk_info.addr, (chunk_info.num_io + 1024) * sizeof(haddr_t))))
-                            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed for chunk addresses")
-
-                    /* Store the chunk's address for later */
-                    chunk_info.addr[chunk_info.num_io] = udata.chunk_block.offset;
-                    chunk_info.num_io++;
-
-                    /* Indicate that blocks will be written */
-                    blocks_written = TRUE;
-                } /* end if */
-                else {
+                    /* Check if this file is accessed with an MPI-capable file driver */
+                    if(using_mpi) {
+                        /* collect all chunk addresses to be written to
+                           write collectively at the end */
+                        /* allocate/resize address array if no more space left */
+                        /* Note that if we add support for parallel filters we must
+                         * also store an array of chunk sizes and pass it to the
+                         * apporpriate collective write function */
+                        if(0 == chunk_info.num_io % 1024)
+                            if(NULL == (chunk_info.addr = (haddr_t *)H5MM_realloc(chunk_info.addr, (chunk_info.num_io + 1024) * sizeof(haddr_t))))
+                                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed for chunk addresses")
+
+                        /* Store the chunk's address for later */
+                        chunk_info.addr[chunk_info.num_io] = udata.chunk_block.offset;
+                        chunk_info.num_io++;
+
+                        /* Indicate that blocks will be written */
+                        blocks_written = TRUE;
+                    } /* end if */
+                    else {
 #endif /* H5_HAVE_PARALLEL */
-                    if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, udata.chunk_block.offset, chunk_size, *fill_buf) < 0)
-                        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+                        if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, udata.chunk_block.offset, chunk_size, *fill_buf) < 0)
+                            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
 #ifdef H5_HAVE_PARALLEL
-                } /* end else */
+                    } /* end else */
 #endif /* H5_HAVE_PARALLEL */
-            } /* end if */
+                } /* end if */
 
-            /* Insert the chunk record into the index */
-	    if(need_insert && ops->insert)
-                if((ops->insert)(&idx_info, &udata, dset) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+                /* Insert the chunk record into the index */
+                if(need_insert && ops->insert)
+                    if((ops->insert)(&idx_info, &udata, dset) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+            } /* end else */
 
             /* Increment indices and adjust the edge chunk state */
             carry = TRUE;
@@ -4390,6 +6630,12 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
             max_unalloc[op_dim] = min_unalloc[op_dim] - 1;
     } /* end for(op_dim=0...) */
 
+    /* Allocate the last batch of chunks */
+    if(nbatch > 0)
+        if(H5D__chunk_allocate_batch(dset, &idx_info, batch, nbatch,
+                should_fill ? batch_fill_bufs : NULL, batch_fill_sizes, &fill_run) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunks")
+
 #ifdef H5_HAVE_PARALLEL
     /* do final collective I/O */
     if(using_mpi && blocks_written)
@@ -4408,6 +6654,10 @@ done:
     /* Free the unfiltered fill value buffer */
     unfilt_fill_buf = H5D__chunk_mem_xfree(unfilt_fill_buf, &def_pline);
 
+    /* Free the batch of chunks */
+    H5MM_xfree(batch);
+    H5MM_xfree(fill_run.buf);
+
 #ifdef H5_HAVE_PARALLEL
     if(using_mpi && chunk_info.addr)
         H5MM_free(chunk_info.addr);
@@ -4547,10 +6797,10 @@ H5D__chunk_update_old_edge_chunks(H5D_t *dset, hsize_t old_dim[])
             /* If this chunk does not exist in cache or on disk, no need to do
              * anything */
             if(H5F_addr_defined(chk_udata.chunk_block.offset)
-                    || (UINT_MAX != chk_udata.idx_hint)) {
+                    || (NULL != chk_udata.cache_ent)) {
                 /* Lock the chunk into cache.  H5D__chunk_lock will take care of
                 * updating the chunk to no longer be an edge chunk. */
-                if(NULL == (chunk = (void *)H5D__chunk_lock(&chk_io_info, &chk_udata, FALSE, TRUE)))
+                if(NULL == (chunk = (void *)H5D__chunk_lock(&chk_io_info, &chk_udata, FALSE, TRUE, NULL, NULL)))
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to lock raw data chunk")
 
                 /* Unlock the chunk */
@@ -4784,7 +7034,7 @@ H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata, hbool_t new_unfilt_chunk)
     chk_udata.new_unfilt_chunk = new_unfilt_chunk;
 
     /* If this chunk does not exist in cache or on disk, no need to do anything */
-    if(!H5F_addr_defined(chk_udata.chunk_block.offset) && UINT_MAX == chk_udata.idx_hint)
+    if(!H5F_addr_defined(chk_udata.chunk_block.offset) && NULL == chk_udata.cache_ent)
         HGOTO_DONE(SUCCEED)
 
     /* Initialize the fill value buffer, if necessary */
@@ -4813,7 +7063,7 @@ H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata, hbool_t new_unfilt_chunk)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to select hyperslab")
 
     /* Lock the chunk into the cache, to get a pointer to the chunk buffer */
-    if(NULL == (chunk = (void *)H5D__chunk_lock(io_info, &chk_udata, FALSE, FALSE)))
+    if(NULL == (chunk = (void *)H5D__chunk_lock(io_info, &chk_udata, FALSE, FALSE, NULL, NULL)))
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to lock raw data chunk")
 
 
@@ -4979,7 +7229,6 @@ H5D__chunk_prune_by_extent(H5D_t *dset, const hsize_t *old_dim)
     H5D_io_info_t           chk_io_info;        /* Chunked I/O info object */
     H5D_storage_t           chk_store;          /* Chunk storage information */
     const H5O_layout_t     *layout = &(dset->shared->layout);   /* Dataset's layout */
-    const H5D_rdcc_t       *rdcc = &(dset->shared->cache.chunk);	/*raw data chunk cache */
     unsigned                space_ndims;        /* Dataset's space rank */
     const hsize_t          *space_dim;          /* Current dataspace dimensions */
     unsigned                op_dim;             /* Current operating dimension */
@@ -5215,8 +7464,8 @@ H5D__chunk_prune_by_extent(H5D_t *dset, const hsize_t *old_dim)
 
                 /* Evict the entry from the cache if present, but do not flush
                  * it to disk */
-                if(UINT_MAX != chk_udata.idx_hint)
-                    if(H5D__chunk_cache_evict(dset, rdcc->slot[chk_udata.idx_hint], FALSE) < 0)
+                if(NULL != chk_udata.cache_ent)
+                    if(H5D__chunk_cache_evict(dset, chk_udata.cache_ent, FALSE) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
 
                 /* Remove the chunk from disk, if present */
@@ -5455,116 +7704,100 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__chunk_update_cache
- *
- * Purpose:	Update any cached chunks index values after the dataspace
- *              size has changed
+ * Function:    H5D__chunk_copy_bulk_add
  *
- * Return:	Success:	Non-negative
- *		Failure:	negative
+ * Purpose:     Hold a copied chunk's record, to be inserted later when the
+ *              destination index is bulk loaded.  Records are kept sorted
+ *              by scaled offset.
  *
- * Programmer:	Quincey Koziol
- *              Saturday, May 29, 2004
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D__chunk_update_cache(H5D_t *dset)
+static herr_t
+H5D__chunk_copy_bulk_add(H5D_chunk_it_ud3_t *udata, const H5D_chunk_ud_t *udata_dst)
 {
-    H5D_rdcc_t         *rdcc = &(dset->shared->cache.chunk);	/*raw data chunk cache */
-    H5D_rdcc_ent_t     *ent, *next;	/*cache entry  */
-    H5D_rdcc_ent_t     tmp_head;        /* Sentinel entry for temporary entry list */
-    H5D_rdcc_ent_t     *tmp_tail;       /* Tail pointer for temporary entry list */
-    herr_t              ret_value = SUCCEED;      /* Return value */
+    unsigned    ndims = udata_dst->common.layout->ndims - 1;    /* Rank of chunk offsets */
+    size_t      rec_nvals = H5D_CHUNK_BULK_REC_NVALS(ndims);    /* # of values in each record */
+    size_t      idx = udata->bulk_nrecs;    /* Index of new record */
+    hsize_t     *rec;                       /* Pointer to new record */
+    herr_t      ret_value = SUCCEED;        /* Return value */
 
-    FUNC_ENTER_PACKAGE
+    FUNC_ENTER_STATIC
 
-    /* Check args */
-    HDassert(dset && H5D_CHUNKED == dset->shared->layout.type);
-    HDassert(dset->shared->layout.u.chunk.ndims > 0 && dset->shared->layout.u.chunk.ndims <= H5O_LAYOUT_NDIMS);
+    /* Make room for the record */
+    if(udata->bulk_nrecs == udata->bulk_nalloc) {
+        size_t new_nalloc = MAX(1024, 2 * udata->bulk_nalloc);
+        hsize_t *new_recs;
 
-    /* Check the rank */
-    HDassert((dset->shared->layout.u.chunk.ndims - 1) > 1);
+        if(NULL == (new_recs = (hsize_t *)H5MM_realloc(udata->bulk_recs, new_nalloc * rec_nvals * sizeof(hsize_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk records")
+        udata->bulk_recs = new_recs;
+        udata->bulk_nalloc = new_nalloc;
+    } /* end if */
 
-    /* Add temporary entry list to rdcc */
-    (void)HDmemset(&tmp_head, 0, sizeof(tmp_head));
-    rdcc->tmp_head = &tmp_head;
-    tmp_tail = &tmp_head;
+    /* Chunks from the source index arrive in order, but chunks only in the
+     * chunk cache do not, so search for the record's place if needed
+     */
+    if(idx > 0 && H5VM_vector_cmp_u(ndims, udata_dst->common.scaled, udata->bulk_recs + ((idx - 1) * rec_nvals) + 3) < 0) {
+        size_t lo = 0, hi = idx - 1;
 
-    /* Recompute the index for each cached chunk that is in a dataset */
-    for(ent = rdcc->head; ent; ent = next) {
-        unsigned	    old_idx;	/* Previous index number	*/
+        while(lo < hi) {
+            size_t mid = (lo + hi) / 2;
 
-        /* Get the pointer to the next cache entry */
-        next = ent->next;
+            if(H5VM_vector_cmp_u(ndims, udata_dst->common.scaled, udata->bulk_recs + (mid * rec_nvals) + 3) < 0)
+                hi = mid;
+            else
+                lo = mid + 1;
+        } /* end while */
+        idx = lo;
+        HDmemmove(udata->bulk_recs + ((idx + 1) * rec_nvals), udata->bulk_recs + (idx * rec_nvals), (udata->bulk_nrecs - idx) * rec_nvals * sizeof(hsize_t));
+    } /* end if */
 
-        /* Compute the index for the chunk entry */
-        old_idx = ent->idx;   /* Save for later */
-        ent->idx = H5D__chunk_hash_val(dset->shared, ent->scaled);
-
-        if(old_idx != ent->idx) {
-            H5D_rdcc_ent_t     *old_ent;	/* Old cache entry  */
-
-            /* Check if there is already a chunk at this chunk's new location */
-            old_ent = rdcc->slot[ent->idx];
-            if(old_ent != NULL) {
-                HDassert(old_ent->locked == FALSE);
-                HDassert(old_ent->deleted == FALSE);
-
-                /* Insert the old entry into the temporary list, but do not
-                 * evict (yet).  Make sure we do not make any calls to the index
-                 * until all chunks have updated indices! */
-                HDassert(!old_ent->tmp_next);
-                HDassert(!old_ent->tmp_prev);
-                tmp_tail->tmp_next = old_ent;
-                old_ent->tmp_prev = tmp_tail;
-                tmp_tail = old_ent;
-            } /* end if */
+    /* Set the record */
+    rec = udata->bulk_recs + (idx * rec_nvals);
+    rec[0] = (hsize_t)udata_dst->chunk_block.offset;
+    rec[1] = udata_dst->chunk_block.length;
+    rec[2] = udata_dst->filter_mask;
+    HDmemcpy(rec + 3, udata_dst->common.scaled, ndims * sizeof(hsize_t));
+    udata->bulk_nrecs++;
 
-            /* Insert this chunk into correct location in hash table */
-            rdcc->slot[ent->idx] = ent;
-
-            /* If this chunk was previously on the temporary list and therefore
-             * not in the hash table, remove it from the temporary list.
-             * Otherwise clear the old hash table slot. */
-            if(ent->tmp_prev) {
-                HDassert(tmp_head.tmp_next);
-                HDassert(tmp_tail != &tmp_head);
-                ent->tmp_prev->tmp_next = ent->tmp_next;
-                if(ent->tmp_next) {
-                    ent->tmp_next->tmp_prev = ent->tmp_prev;
-                    ent->tmp_next = NULL;
-                } /* end if */
-                else {
-                    HDassert(tmp_tail == ent);
-                    tmp_tail = ent->tmp_prev;
-                } /* end else */
-                ent->tmp_prev = NULL;
-            } /* end if */
-            else
-                rdcc->slot[old_idx] = NULL;
-        } /* end if */
-    } /* end for */
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_copy_bulk_add() */
 
-    /* tmp_tail is no longer needed, and will be invalidated by
-     * H5D_chunk_cache_evict anyways. */
-    tmp_tail = NULL;
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_copy_bulk_fill_cb
+ *
+ * Purpose:     Supply the next chunk record held by H5D__chunk_copy_cb
+ *              when bulk loading the destination index
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_copy_bulk_fill_cb(H5D_chunk_rec_t *chunk_rec, void *_udata)
+{
+    H5D_chunk_it_ud3_t *udata = (H5D_chunk_it_ud3_t *)_udata;   /* User data for callback */
+    unsigned    ndims = udata->common.layout->ndims - 1;        /* Rank of chunk offsets */
+    const hsize_t *rec;                 /* Pointer to chunk record */
 
-    /* Evict chunks that are still on the temporary list */
-    while(tmp_head.tmp_next) {
-        ent = tmp_head.tmp_next;
+    FUNC_ENTER_STATIC_NOERR
 
-        /* Remove the old entry from the cache */
-        if(H5D__chunk_cache_evict(dset, ent, TRUE) < 0)
-            HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
-    } /* end while */
+    HDassert(udata->bulk_next < udata->bulk_nrecs);
 
-done:
-    /* Remove temporary list from rdcc */
-    rdcc->tmp_head = NULL;
+    /* Retrieve the next record */
+    rec = udata->bulk_recs + (udata->bulk_next * H5D_CHUNK_BULK_REC_NVALS(ndims));
+    chunk_rec->chunk_addr = (haddr_t)rec[0];
+    chunk_rec->nbytes = (uint32_t)rec[1];
+    chunk_rec->filter_mask = (uint32_t)rec[2];
+    HDmemcpy(chunk_rec->scaled, rec + 3, ndims * sizeof(hsize_t));
+    udata->bulk_next++;
 
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_update_cache() */
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__chunk_copy_bulk_fill_cb() */
 
 
 /*-------------------------------------------------------------------------
@@ -5588,6 +7821,9 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
     hbool_t                 is_vlen = FALSE;            /* Whether datatype is variable-length */
     hbool_t                 fix_ref = FALSE;            /* Whether to fix up references in the dest. file */
     hbool_t                 need_insert = FALSE;    /* Whether the chunk needs to be inserted into the index */
+    hbool_t                 defer = FALSE;          /* Whether the chunk's bytes are copied after the object headers */
+    hbool_t                 reset_ref = FALSE;      /* Whether references are reset to zero in the dest. file */
+    hbool_t                 zero_cached = FALSE;    /* Whether the filtered chunk of reset references is reused */
 
     /* General information about chunk copy */
     void                    *bkg = udata->bkg;          /* Background buffer for datatype conversion */
@@ -5629,9 +7865,24 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
         else
             HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, H5_ITER_ERROR, "unable to copy dataset elements")
     } /* end if */
+    /* Chunks that are copied as they are can be copied after the object headers */
+    else if(!udata->chunk_in_cache && H5O_copy_raw_can_defer(udata->cpy_info, udata->file_src, udata->idx_info_dst->f))
+        defer = TRUE;
+
+    /* References that aren't expanded are reset to zero, so the source chunk isn't needed */
+    if(fix_ref && !udata->cpy_info->expand_ref) {
+        reset_ref = TRUE;
+        if(must_filter) {
+            H5_CHECKED_ASSIGN(nbytes, size_t, udata->common.layout->size, uint32_t);
+
+            /* Reuse the filtered chunk of reset references, if it's already made */
+            if(udata->zero_chunk && chunk_rec->filter_mask == 0)
+                zero_cached = TRUE;
+        } /* end if */
+    } /* end if */
 
     /* Resize the buf if it is too small to hold the data */
-    if(nbytes > buf_size) {
+    if(nbytes > buf_size && !defer && !zero_cached) {
         void *new_buf;          /* New buffer for data */
 
         /* Re-allocate memory for copying the chunk */
@@ -5652,37 +7903,24 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
         udata->buf_size = buf_size = nbytes;
     } /* end if */
 
-    if(udata->chunk_in_cache && udata->chunk) {
+    if(reset_ref) {
+        if(!zero_cached)
+            HDmemset(buf, 0, nbytes);
+    } /* end if */
+    else if(udata->chunk_in_cache && udata->chunk) {
         HDassert(!H5F_addr_defined(chunk_rec->chunk_addr));
         HDmemcpy(buf, udata->chunk, nbytes);
         udata->chunk = NULL;
     }
-    else {
+    else if(!defer) {
         H5D_rdcc_ent_t *ent = NULL;    /* Cache entry */
-        unsigned idx;                   /* Index of chunk in cache, if present */
-        unsigned u;                     /* Counter */
         H5D_shared_t *shared_fo = (H5D_shared_t *)udata->cpy_info->shared_fo;
 
         /* See if the written chunk is in the chunk cache */
-        if(shared_fo && shared_fo->cache.chunk.nslots > 0) {
-            /* Determine the chunk's location in the hash table */
-            idx = H5D__chunk_hash_val(shared_fo, chunk_rec->scaled);
-
-            /* Get the chunk cache entry for that location */
-            ent = shared_fo->cache.chunk.slot[idx];
-            if(ent) {
-                /* Speculatively set the 'found' flag */
+        if(shared_fo && shared_fo->cache.chunk.nslots > 0)
+            if(NULL != (ent = H5D__chunk_cache_find(shared_fo, chunk_rec->scaled)))
                 udata->chunk_in_cache = TRUE;
 
-                /* Verify that the cache entry is the correct chunk */
-                for(u = 0; u < shared_fo->ndims; u++)
-                    if(chunk_rec->scaled[u] != ent->scaled[u]) {
-                        udata->chunk_in_cache = FALSE;
-                        break;
-                    } /* end if */
-            } /* end if */
-        } /* end if */
-
         if(udata->chunk_in_cache) {
             HDassert(H5F_addr_defined(chunk_rec->chunk_addr));
             HDassert(H5F_addr_defined(ent->chunk_block.offset));
@@ -5698,10 +7936,10 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
     }
 
     /* Need to uncompress filtered variable-length & reference data elements that are not found in chunk cache */
-    if(must_filter && (is_vlen || fix_ref) && !udata->chunk_in_cache) {
+    if(must_filter && (is_vlen || fix_ref) && !reset_ref && !udata->chunk_in_cache) {
         unsigned filter_mask = chunk_rec->filter_mask;
 
-        if(H5Z_pipeline(pline, H5Z_FLAG_REVERSE, &filter_mask, H5Z_NO_EDC, filter_cb, &nbytes, &buf_size, &buf) < 0)
+        if(H5D__chunk_filter(udata->common.layout, pline, H5Z_FLAG_REVERSE, &filter_mask, H5Z_NO_EDC, filter_cb, &nbytes, &buf_size, &buf) < 0)
             HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, H5_ITER_ERROR, "data pipeline read failed")
     } /* end if */
 
@@ -5735,22 +7973,18 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
         if(H5D_vlen_reclaim(tid_mem, buf_space, reclaim_buf) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_BADITER, H5_ITER_ERROR, "unable to reclaim variable-length data")
     } /* end if */
-    else if(fix_ref) {
-        /* Check for expanding references */
-        /* (background buffer has already been zeroed out, if not expanding) */
-        if(udata->cpy_info->expand_ref) {
-            size_t ref_count;
-            size_t dt_size;
-
-            /* Determine # of reference elements to copy */
-            if((dt_size = H5T_get_size(udata->dt_src)) == 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "size must not be 0")
-            ref_count = nbytes / dt_size;
-
-            /* Copy the reference elements */
-            if(H5O_copy_expand_ref(udata->file_src, buf, udata->idx_info_dst->f, bkg, ref_count, H5T_get_ref_type(udata->dt_src), udata->cpy_info) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, H5_ITER_ERROR, "unable to copy reference attribute")
-        } /* end if */
+    else if(fix_ref && !reset_ref) {
+        size_t ref_count;
+        size_t dt_size;
+
+        /* Determine # of reference elements to copy */
+        if((dt_size = H5T_get_size(udata->dt_src)) == 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "size must not be 0")
+        ref_count = nbytes / dt_size;
+
+        /* Copy the reference elements */
+        if(H5O_copy_expand_ref(udata->file_src, buf, udata->idx_info_dst->f, bkg, ref_count, H5T_get_ref_type(udata->dt_src), udata->cpy_info) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, H5_ITER_ERROR, "unable to copy reference attribute")
 
         /* After fix ref, copy the new reference elements to the buffer to write out */
         HDmemcpy(buf, bkg, buf_size);
@@ -5764,9 +7998,15 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
     udata_dst.chunk_block.length = chunk_rec->nbytes;
     udata_dst.filter_mask = chunk_rec->filter_mask;
 
+    /* Use the filtered chunk of reset references made for an earlier chunk */
+    if(zero_cached) {
+        nbytes = udata->zero_chunk_nbytes;
+        udata_dst.filter_mask = udata->zero_chunk_mask;
+        H5_CHECKED_ASSIGN(udata_dst.chunk_block.length, uint32_t, nbytes, size_t);
+    } /* end if */
     /* Need to compress variable-length or reference data elements or a chunk found in cache before writing to file */
-    if(must_filter && (is_vlen || fix_ref || udata->chunk_in_cache) ) {
-        if(H5Z_pipeline(pline, 0, &(udata_dst.filter_mask), H5Z_NO_EDC, filter_cb, &nbytes, &buf_size, &buf) < 0)
+    else if(must_filter && (is_vlen || fix_ref || udata->chunk_in_cache) ) {
+        if(H5D__chunk_filter(udata->common.layout, pline, 0, &(udata_dst.filter_mask), H5Z_NO_EDC, filter_cb, &nbytes, &buf_size, &buf) < 0)
             HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, H5_ITER_ERROR, "output pipeline failed")
 #if H5_SIZEOF_SIZE_T > 4
         /* Check for the chunk expanding too much to encode in a 32-bit value */
@@ -5776,6 +8016,15 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
         H5_CHECKED_ASSIGN(udata_dst.chunk_block.length, uint32_t, nbytes, size_t);
         udata->buf = buf;
         udata->buf_size = buf_size;
+
+        /* Keep the filtered chunk of reset references, since every such chunk is the same */
+        if(reset_ref && chunk_rec->filter_mask == 0 && NULL == udata->zero_chunk) {
+            if(NULL == (udata->zero_chunk = H5MM_malloc(nbytes)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, H5_ITER_ERROR, "memory allocation failed for raw data chunk")
+            HDmemcpy(udata->zero_chunk, buf, nbytes);
+            udata->zero_chunk_nbytes = nbytes;
+            udata->zero_chunk_mask = udata_dst.filter_mask;
+        } /* end if */
     } /* end if */
 
     udata->chunk_in_cache = FALSE;
@@ -5787,21 +8036,32 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
     if(H5D__chunk_file_alloc(udata->idx_info_dst, NULL, &udata_dst.chunk_block, &need_insert, udata_dst.common.scaled) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
 
-    /* Write chunk data to destination file */
+    /* Write chunk data to destination file, or queue the copy */
     HDassert(H5F_addr_defined(udata_dst.chunk_block.offset));
-    if(H5F_block_write(udata->idx_info_dst->f, H5FD_MEM_DRAW, udata_dst.chunk_block.offset, nbytes, buf) < 0)
+    if(defer) {
+        if(H5O_copy_raw_defer(udata->cpy_info, chunk_rec->chunk_addr, udata_dst.chunk_block.offset, (hsize_t)nbytes) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, H5_ITER_ERROR, "unable to queue raw data copy")
+    } /* end if */
+    else if(H5F_block_write(udata->idx_info_dst->f, H5FD_MEM_DRAW, udata_dst.chunk_block.offset, nbytes, zero_cached ? udata->zero_chunk : buf) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, H5_ITER_ERROR, "unable to write raw data to file")
 
-    /* Set metadata tag in API context */
-    H5_BEGIN_TAG(H5AC__COPIED_TAG);
+    /* Hold chunk record to bulk load the index, after all chunks are copied */
+    if(need_insert && udata->bulk_insert) {
+        if(H5D__chunk_copy_bulk_add(udata, &udata_dst) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, H5_ITER_ERROR, "unable to hold chunk record for index")
+    } /* end if */
+    else {
+        /* Set metadata tag in API context */
+        H5_BEGIN_TAG(H5AC__COPIED_TAG);
 
-    /* Insert chunk record into index */
-    if(need_insert && udata->idx_info_dst->storage->ops->insert)
-        if((udata->idx_info_dst->storage->ops->insert)(udata->idx_info_dst, &udata_dst, NULL) < 0)
-            HGOTO_ERROR_TAG(H5E_DATASET, H5E_CANTINSERT, H5_ITER_ERROR, "unable to insert chunk addr into index")
+        /* Insert chunk record into index */
+        if(need_insert && udata->idx_info_dst->storage->ops->insert)
+            if((udata->idx_info_dst->storage->ops->insert)(udata->idx_info_dst, &udata_dst, NULL) < 0)
+                HGOTO_ERROR_TAG(H5E_DATASET, H5E_CANTINSERT, H5_ITER_ERROR, "unable to insert chunk addr into index")
 
-    /* Reset metadata tag in API context */
-    H5_END_TAG
+        /* Reset metadata tag in API context */
+        H5_END_TAG
+    } /* end else */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -5853,6 +8113,9 @@ H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src,
 
     FUNC_ENTER_PACKAGE
 
+    /* Reset the callback structure, so it's safe to clean up on errors */
+    HDmemset(&udata, 0, sizeof udata);
+
     /* Check args */
     HDassert(f_src);
     HDassert(storage_src);
@@ -5984,7 +8247,8 @@ H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src,
         do_convert = TRUE;
     } /* end if */
     else {
-        if(H5T_get_class(dt_src, FALSE) == H5T_REFERENCE) {
+        /* References within the same file are copied as they are */
+        if((H5T_get_class(dt_src, FALSE) == H5T_REFERENCE) && (f_src != f_dst)) {
             /* Indicate that type conversion should be performed */
             do_convert = TRUE;
         } /* end if */
@@ -6011,7 +8275,6 @@ H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src,
         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
 
     /* Initialize the callback structure for the source */
-    HDmemset(&udata, 0, sizeof udata);
     udata.common.layout = layout_src;
     udata.common.storage = storage_src;
     udata.file_src = f_src;
@@ -6037,6 +8300,9 @@ H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src,
     udata.chunk_in_cache = FALSE;
     udata.chunk = NULL;
 
+    /* Build a v2 B-tree index in one pass, instead of record by record */
+    udata.bulk_insert = (H5D_CHUNK_IDX_BT2 == storage_dst->idx_type);
+
     /* Iterate over chunks to copy data */
     if((storage_src->ops->iterate)(&idx_info_src, H5D__chunk_copy_cb, &udata) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "unable to iterate over chunk index to copy data")
@@ -6063,11 +8329,27 @@ H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src,
         } /* end for */
     }
 
+    /* Bulk load the destination index with the records of the copied chunks */
+    if(udata.bulk_nrecs > 0) {
+        /* Set metadata tag in API context */
+        H5_BEGIN_TAG(H5AC__COPIED_TAG);
+
+        if(H5D__bt2_idx_insert_bulk(&idx_info_dst, (hsize_t)udata.bulk_nrecs, H5D__chunk_copy_bulk_fill_cb, &udata) < 0)
+            HGOTO_ERROR_TAG(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addresses into index")
+
+        /* Reset metadata tag in API context */
+        H5_END_TAG
+    } /* end if */
+
     /* I/O buffers may have been re-allocated */
     buf = udata.buf;
     bkg = udata.bkg;
 
 done:
+    if(udata.bulk_recs)
+        H5MM_xfree(udata.bulk_recs);
+    if(udata.zero_chunk)
+        H5MM_xfree(udata.zero_chunk);
     if(sid_buf > 0 && H5I_dec_ref(sid_buf) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't decrement temporary dataspace ID")
     if(tid_src > 0 && H5I_dec_ref(tid_src) < 0)
@@ -6248,6 +8530,10 @@ H5D__chunk_dump_index(H5D_t *dset, FILE *stream)
         H5D_chk_idx_info_t idx_info;    /* Chunked index info */
         H5D_chunk_it_ud4_t udata;       /* User data for callback */
 
+        /* Write the chunks in the write-behind queue */
+        if(H5D__chunk_wb_retire(dset, (size_t)0) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write queued chunks")
+
         /* Display info for index */
         if((dset->shared->layout.storage.u.chunk.ops->dump)(&dset->shared->layout.storage.u.chunk, stream) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unable to dump chunk index info")
@@ -6481,24 +8767,24 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_file_alloc()
+ * Function:    H5D__chunk_file_alloc_check()
  *
- * Purpose:     Chunk allocation:  
- *		  Create the chunk if it doesn't exist, or reallocate the
- *                chunk if its size changed.
- *		  The coding is moved and modified from each index structure.
+ * Purpose:     Check whether a chunk needs file space allocated for it:
+ *		  either it doesn't exist yet, or its size changed, in
+ *                which case the old chunk is released if RELEASE_OLD is
+ *                set (otherwise the caller must release it).  If the
+ *                chunk can stay where it is, its address is set in
+ *                NEW_CHUNK.
  *
  * Return:      Non-negative on success/Negative on failure
  *
- * Programmer:  Vailin Choi; June 2014
- *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
-    H5F_block_t *new_chunk, hbool_t *need_insert, hsize_t scaled[])
+static herr_t
+H5D__chunk_file_alloc_check(const H5D_chk_idx_info_t *idx_info,
+    const H5F_block_t *old_chunk, hbool_t release_old, H5F_block_t *new_chunk,
+    hbool_t *alloc_chunk)
 {
-    hbool_t alloc_chunk = FALSE;	/* Whether to allocate chunk */
     herr_t ret_value = SUCCEED;   	/* Return value         */
 
     FUNC_ENTER_STATIC
@@ -6510,9 +8796,9 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
     HDassert(idx_info->layout);
     HDassert(idx_info->storage);
     HDassert(new_chunk);
-    HDassert(need_insert);
+    HDassert(alloc_chunk);
 
-    *need_insert = FALSE;
+    *alloc_chunk = FALSE;
 
     /* Check for filters on chunks */
     if(idx_info->pline->nused > 0) {
@@ -6550,10 +8836,10 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
                  * we must keep the old chunk around in case a reader has an
                  * outdated version of the B-tree node
                  */
-                if(!(H5F_INTENT(idx_info->f) & H5F_ACC_SWMR_WRITE))
+                if(release_old && !(H5F_INTENT(idx_info->f) & H5F_ACC_SWMR_WRITE))
                     if(H5MF_xfree(idx_info->f, H5FD_MEM_DRAW, old_chunk->offset, old_chunk->length) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk")
-                alloc_chunk = TRUE;
+                *alloc_chunk = TRUE;
             } /* end if */
             else {
                 /* Don't need to reallocate chunk, but send its address back up */
@@ -6563,15 +8849,58 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
         } /* end if */
         else {
             HDassert(!H5F_addr_defined(new_chunk->offset));
-            alloc_chunk = TRUE;
+            *alloc_chunk = TRUE;
         } /* end else */
     } /* end if */
     else {
 	HDassert(!H5F_addr_defined(new_chunk->offset));
 	HDassert(new_chunk->length == idx_info->layout->size);
-	alloc_chunk = TRUE;
+	*alloc_chunk = TRUE;
     }  /* end else */
 
+done: 
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_file_alloc_check() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_file_alloc()
+ *
+ * Purpose:     Chunk allocation:  
+ *		  Create the chunk if it doesn't exist, or reallocate the
+ *                chunk if its size changed.
+ *		  The coding is moved and modified from each index structure.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Vailin Choi; June 2014
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
+    H5F_block_t *new_chunk, hbool_t *need_insert, const hsize_t scaled[])
+{
+    hbool_t alloc_chunk = FALSE;	/* Whether to allocate chunk */
+    herr_t ret_value = SUCCEED;   	/* Return value         */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->pline);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->storage);
+    HDassert(new_chunk);
+    HDassert(need_insert);
+
+    *need_insert = FALSE;
+
+    /* Check if the chunk needs to be (re)allocated */
+    if(H5D__chunk_file_alloc_check(idx_info, old_chunk, TRUE, new_chunk, &alloc_chunk) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to check chunk allocation")
+
     /* Actually allocate space for the chunk in the file */
     if(alloc_chunk) {
         switch(idx_info->storage->idx_type) {
@@ -6735,6 +9064,10 @@ H5D__chunk_format_convert(H5D_t *dset, H5D_chk_idx_info_t *idx_info, H5D_chk_idx
     /* Check args */
     HDassert(dset);
 
+    /* Write the chunks in the write-behind queue */
+    if(H5D__chunk_wb_retire(dset, (size_t)0) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write queued chunks")
+
     /* Set up user data */
     udata.new_idx_info = new_idx_info;
     udata.dset_ndims = dset->shared->ndims;
@@ -1457,6 +1457,13 @@ H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src,
         src_nbytes = dst_nbytes = mem_nbytes = buf_size;
     } /* end else */
 
+    /* Data that is copied as it is can be copied after the object headers */
+    if(!is_vlen && !fix_ref && H5O_copy_raw_can_defer(cpy_info, f_src, f_dst)) {
+        if(H5O_copy_raw_defer(cpy_info, storage_src->addr, storage_dst->addr, storage_dst->size) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "unable to queue raw data copy")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Allocate space for copy buffer */
     HDassert(buf_size);
     if(NULL == (buf = H5FL_BLK_MALLOC(type_conv, buf_size)))
@@ -2776,6 +2776,11 @@ H5D__set_extent(H5D_t *dset, const hsize_t *size)
     if(H5D__check_filters(dset) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't apply filters")
 
+    /* Write any chunks queued for writing, before the chunk index changes */
+    if(H5D_CHUNKED == dset->shared->layout.type)
+        if(H5D__chunk_wb_flush(dset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write queued chunks")
+
     /* Keep the current dataspace dimensions for later */
     HDcompile_assert(sizeof(curr_dims) == sizeof(dset->shared->curr_dims));
     HDmemcpy(curr_dims, dset->shared->curr_dims, H5S_MAX_RANK * sizeof(curr_dims[0]));
@@ -2788,7 +2793,6 @@ H5D__set_extent(H5D_t *dset, const hsize_t *size)
     if(changed) {
         hbool_t shrink = FALSE;         /* Flag to indicate a dimension has shrank */
         hbool_t expand = FALSE;         /* Flag to indicate a dimension has grown */
-        hbool_t update_chunks = FALSE;  /* Flag to indicate chunk cache update is needed */
 
         /* Determine if we are shrinking and/or expanding any dimensions */
         for(dim_idx = 0; dim_idx < dset->shared->ndims; dim_idx++) {
@@ -2800,41 +2804,13 @@ H5D__set_extent(H5D_t *dset, const hsize_t *size)
 
             /* Chunked storage specific checks */
             if(H5D_CHUNKED == dset->shared->layout.type && dset->shared->ndims > 1) {
-                hsize_t scaled;             /* Scaled value */
-
-                /* Compute the scaled dimension size value */
                 if(dset->shared->layout.u.chunk.dim[dim_idx] == 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk size must be > 0, dim = %u ", dim_idx)
 
-                scaled = size[dim_idx] / dset->shared->layout.u.chunk.dim[dim_idx];
-
-                /* Check if scaled dimension size changed */
-                if(scaled != dset->shared->cache.chunk.scaled_dims[dim_idx]) {
-                    hsize_t scaled_power2up;    /* Scaled value, rounded to next power of 2 */
-
-                    /* Update the scaled dimension size value for the current dimension */
-                    dset->shared->cache.chunk.scaled_dims[dim_idx] = scaled;
-
-                    /* Check if algorithm for computing hash values will change */
-                    if((scaled > dset->shared->cache.chunk.nslots &&
-                                dset->shared->cache.chunk.scaled_dims[dim_idx] <= dset->shared->cache.chunk.nslots)
-                            || (scaled <= dset->shared->cache.chunk.nslots &&
-                                dset->shared->cache.chunk.scaled_dims[dim_idx] > dset->shared->cache.chunk.nslots))
-                        update_chunks = TRUE;
-
-                    if(!(scaled_power2up = H5VM_power2up(scaled)))
-                        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get the next power of 2")
-
-                    /* Check if the number of bits required to encode the scaled size value changed */
-                    if(dset->shared->cache.chunk.scaled_power2up[dim_idx] != scaled_power2up) {
-                        /* Update the 'power2up' & 'encode_bits' values for the current dimension */
-                        dset->shared->cache.chunk.scaled_power2up[dim_idx] = scaled_power2up;
-                        dset->shared->cache.chunk.scaled_encode_bits[dim_idx] = H5VM_log2_gen(scaled_power2up);
-
-                        /* Indicate that the cached chunk indices need to be updated */
-                        update_chunks = TRUE;
-                    } /* end if */
-                } /* end if */
+                /* Reject sizes with more chunks in a dimension than can be
+                 * rounded up to a power of 2, as the chunk indices require */
+                if(!H5VM_power2up(size[dim_idx] / dset->shared->layout.u.chunk.dim[dim_idx]))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get the next power of 2")
             } /* end if */
 
             /* Update the cached copy of the dataset's dimensions */
@@ -2845,19 +2821,11 @@ H5D__set_extent(H5D_t *dset, const hsize_t *size)
          * Modify the dataset storage
          *-------------------------------------------------------------------------
          */
-        /* Update the index values for the cached chunks for this dataset */
-        if(H5D_CHUNKED == dset->shared->layout.type) {
-            /* Set the cached chunk info */
+        /* Update the cached chunk info for this dataset */
+        if(H5D_CHUNKED == dset->shared->layout.type)
             if(H5D__chunk_set_info(dset) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to update # of chunks")
 
-            /* Check if updating the chunk cache indices is necessary */
-            if(update_chunks)
-                /* Update the chunk cache indices */
-                if(H5D__chunk_update_cache(dset) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to update cached chunk indices")
-        } /* end if */
-
         /* Operations for virtual datasets */
         if(H5D_VIRTUAL == dset->shared->layout.type) {
             /* Check that the dimensions of the VDS are large enough */
@@ -3052,6 +3020,10 @@ H5D__format_convert(H5D_t *dataset)
         case H5D_CHUNKED:
             HDassert(dataset->shared->layout.u.chunk.idx_type != H5D_CHUNK_IDX_BTREE);
 
+            /* Version 1 B-tree indexed chunks can't be split into shards */
+            if(dataset->shared->layout.u.chunk.flags & H5O_LAYOUT_CHUNK_SHARDED)
+                HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "can't convert a dataset with sharded chunks")
+
             if(NULL == (newlayout = (H5O_layout_t *)H5MM_calloc(sizeof(H5O_layout_t))))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate buffer")
 
@@ -251,6 +251,66 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread_chunk() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_chunks
+ *
+ * Purpose:     Reads NCHUNKS entire chunks from the file directly.
+ *              OFFSETS holds the logical offset of each chunk, one
+ *              after the other (NCHUNKS * rank values).  The chunks are
+ *              read in file address order, and chunks that are adjacent
+ *              in the file are read with a single I/O call.  Each buffer
+ *              in BUFS must be large enough for its chunk, as returned
+ *              by H5Dget_chunk_storage_size.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *---------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_chunks(hid_t dset_id, hid_t dxpl_id, size_t nchunks,
+         const hsize_t offsets[], uint32_t filters[], void *bufs[])
+{
+    H5VL_object_t  *vol_obj = NULL;
+    size_t          u;                              /* Local index variable */
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE6("e", "iiz*h*Iu**x", dset_id, dxpl_id, nchunks, offsets, filters, bufs);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+    if (nchunks > 0) {
+        if (!bufs)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "bufs cannot be NULL")
+        if (!offsets)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offsets cannot be NULL")
+        if (!filters)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "filters cannot be NULL")
+        for (u = 0; u < nchunks; u++)
+            if (!bufs[u])
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buffer for chunk cannot be NULL")
+    }
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dxpl_id is not a dataset transfer property list ID")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Read the raw chunks */
+    if(H5VL_dataset_optional(vol_obj, dxpl_id, H5_REQUEST_NULL, H5VL_NATIVE_DATASET_CHUNK_READ_MULTI, nchunks, offsets, filters, bufs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read unprocessed chunk data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_chunks() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Dwrite
@@ -379,6 +439,77 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite_chunk() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dwrite_chunks
+ *
+ * Purpose:     Writes NCHUNKS entire chunks to the file directly.
+ *              OFFSETS holds the logical offset of each chunk, one
+ *              after the other (NCHUNKS * rank values).  File space for
+ *              the new chunks is allocated at once, chunks that are
+ *              adjacent in the file are written with a single I/O call,
+ *              and the chunk index is updated after all the data has
+ *              been written.  A chunk may only appear once in a batch.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_chunks(hid_t dset_id, hid_t dxpl_id, size_t nchunks,
+         const uint32_t filters[], const hsize_t offsets[],
+         const size_t data_sizes[], const void *bufs[])
+{
+    H5VL_object_t  *vol_obj = NULL;
+    size_t          u;                              /* Local index variable */
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iiz*Iu*h*z**x", dset_id, dxpl_id, nchunks, filters, offsets,
+             data_sizes, bufs);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataset ID")
+    if (nchunks > 0) {
+        if (!bufs)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "bufs cannot be NULL")
+        if (!offsets)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offsets cannot be NULL")
+        if (!filters)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "filters cannot be NULL")
+        if (!data_sizes)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "data_sizes cannot be NULL")
+        for (u = 0; u < nchunks; u++) {
+            if (!bufs[u])
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buffer for chunk cannot be NULL")
+            if (0 == data_sizes[u])
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "data size of chunk cannot be zero")
+
+            /* Make sure data size is less than 4 GiB */
+            if (data_sizes[u] != (size_t)((uint32_t)data_sizes[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid data size - chunks cannot be > 4 GiB")
+        }
+    }
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dxpl_id is not a dataset transfer property list ID")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Write the chunks */
+    if(H5VL_dataset_optional(vol_obj, dxpl_id, H5_REQUEST_NULL, H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI, nchunks, filters, offsets, data_sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write unprocessed chunk data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_chunks() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__read
@@ -414,6 +545,8 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
                                         /* Note that if this variable is used, the        */
                                         /* projected mem space must be discarded at the   */
                                         /* end of the function to avoid a memory leak.    */
+    H5S_t *sorted_file_space = NULL;    /* Point selection in file order, if sorted */
+    H5S_t *sorted_mem_space = NULL;     /* Memory selection matching sorted_file_space */
     H5D_storage_t store;                /*union of EFL and chunk pointer in file space */
     hssize_t	snelmts;                /*total number of elmts	(signed) */
     hsize_t	nelmts;                 /*total number of elmts	*/
@@ -541,6 +674,36 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
             HGOTO_DONE(SUCCEED)
     } /* end if */
 
+    /* Point selections are read in the order the points were selected,
+     * which costs a chunk lookup and a separate sequence for each point
+     * when the points are scattered through the file.  Sort the points
+     * into file order (chunk by chunk for chunked datasets), so adjacent
+     * points coalesce, and permute the memory selection to match.  (Not
+     * done for MPI-based drivers, which build their own I/O ordering)
+     */
+    if(nelmts > 1 && H5S_GET_SELECT_TYPE(file_space) == H5S_SEL_POINTS
+#ifdef H5_HAVE_PARALLEL
+            && !(H5F_HAS_FEATURE(dataset->oloc.file, H5FD_FEAT_HAS_MPI))
+#endif /*H5_HAVE_PARALLEL*/
+            ) {
+        hsize_t chunk_dims[H5O_LAYOUT_NDIMS];   /* Chunk dimensions */
+        hbool_t chunked = FALSE;                /* Whether the dataset is chunked */
+
+        if(dataset->shared->layout.type == H5D_CHUNKED) {
+            unsigned u;                 /* Local index variable */
+
+            for(u = 0; u < dataset->shared->layout.u.chunk.ndims; u++)
+                chunk_dims[u] = dataset->shared->layout.u.chunk.dim[u];
+            chunked = TRUE;
+        } /* end if */
+        if(H5S_select_sort_points(file_space, mem_space, (chunked ? chunk_dims : NULL), &sorted_file_space, &sorted_mem_space) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to sort point selection")
+        if(sorted_file_space) {
+            file_space = sorted_file_space;
+            mem_space = sorted_mem_space;
+        } /* end if */
+    } /* end if */
+
     /* Set up I/O operation */
     io_info.op_type = H5D_IO_OP_READ;
     io_info.u.rbuf = buf;
@@ -588,6 +751,14 @@ done:
         if(H5S_close(projected_mem_space) < 0)
             HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down projected memory dataspace")
 
+    /* discard sorted point selections if they were created */
+    if(NULL != sorted_file_space)
+        if(H5S_close(sorted_file_space) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down sorted file dataspace")
+    if(NULL != sorted_mem_space)
+        if(H5S_close(sorted_mem_space) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down sorted memory dataspace")
+
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__read() */
 
@@ -1104,6 +1275,7 @@ H5D__ioinfo_adjust(H5D_io_info_t *io_info, const H5D_t *dset,
     if(!H5CX_is_def_dxpl()) {
         H5CX_set_mpio_actual_chunk_opt(H5D_MPIO_NO_CHUNK_OPTIMIZATION);
         H5CX_set_mpio_actual_io_mode(H5D_MPIO_NO_COLLECTIVE);
+        H5CX_set_mpio_actual_node_agg(FALSE);
     } /* end if */
 
     /* Make any parallel I/O adjustments */
@@ -223,6 +223,10 @@ H5D__layout_meta_size(const H5F_t *f, const H5O_layout_t *layout, hbool_t includ
                 /* Dimension sizes */
                 ret_value += layout->u.chunk.ndims * layout->u.chunk.enc_bytes_per_dim;
 
+                /* Shard dimension sizes */
+                if(layout->u.chunk.flags & H5O_LAYOUT_CHUNK_SHARDED)
+                    ret_value += layout->u.chunk.ndims * layout->u.chunk.enc_bytes_per_dim;
+
                 /* Type of chunk index */
                 ret_value++;
 
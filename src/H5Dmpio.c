@@ -138,6 +138,10 @@ typedef enum H5D_mpio_no_rank0_bcast_cause_t {
  *   buf - A pointer which serves the dual purpose of holding either the chunk data which is to be
  *         written to the file or the chunk data which has been read from the file.
  *
+ *   buf_size - The allocated size of the buffer pointed to by buf. When writing, the chunk is only
+ *              filtered once the modification data from the other processors writing to it has
+ *              arrived, so the size must be kept until then.
+ *
  *   chunk_states - In the case of dataset writes only, this struct is used to track a chunk's size and
  *                  address in the file before and after the filtering operation has occurred.
  *
@@ -173,17 +177,13 @@ typedef enum H5D_mpio_no_rank0_bcast_cause_t {
  *
  *                Its fields are as follows:
  *
- *                receive_requests_array - An array containing one MPI_Request for each of the
- *                                         asynchronous MPI receive calls the owning processor of this
- *                                         chunk makes to another processor in order to receive that
- *                                         processor's chunk modification data and selection in the chunk.
- *
  *                receive_buffer_array - An array of buffers into which the owning processor of this chunk
  *                                       will store chunk modification data and the selection in the chunk
- *                                       received from another processor.
+ *                                       received from another processor. The buffers are allocated as
+ *                                       the messages arrive, since their sizes aren't known before then.
  *
- *                num_receive_requests - The number of entries in the receive_request_array and
- *                                       receive_buffer_array fields.
+ *                num_receive_requests - The number of entries in the receive_buffer_array field, one for
+ *                                       each other processor writing to the chunk.
  */
 typedef struct H5D_filtered_collective_io_info_t {
   hsize_t             index;
@@ -192,6 +192,7 @@ typedef struct H5D_filtered_collective_io_info_t {
   size_t              num_writers;
   size_t              io_size;
   void               *buf;
+  size_t              buf_size;
 
   struct {
       H5F_block_t     chunk_current;
@@ -204,12 +205,52 @@ typedef struct H5D_filtered_collective_io_info_t {
   } owners;
 
   struct {
-      MPI_Request    *receive_requests_array;
       unsigned char **receive_buffer_array;
       int             num_receive_requests;
   } async_info;
 } H5D_filtered_collective_io_info_t;
 
+/*
+ * The sends of chunk modification data from a process to the new owners of the
+ * chunks it has selected in a collective filtered write. The sends are started
+ * when shared chunks are redistributed, but are only completed after the process
+ * has updated and filtered the chunks that it owns, so that the data is in flight
+ * while the chunks are being filtered.
+ *
+ *   requests - An array containing one MPI_Request for each asynchronous send of
+ *              chunk modification data.
+ *
+ *   bufs - The buffers of chunk modification data being sent, which are freed once
+ *          the sends have completed.
+ *
+ *   num_requests - The number of entries in the requests and bufs fields.
+ */
+typedef struct H5D_filtered_collective_io_sends_t {
+  MPI_Request        *requests;
+  unsigned char     **bufs;
+  size_t              num_requests;
+} H5D_filtered_collective_io_sends_t;
+
+/*
+ * A sequence of bytes in a collective write, when the writes of the processes
+ * on each node are aggregated before being written.  Each process sends the
+ * sequences it writes to its node's aggregator, along with their data.
+ *
+ *   off - The offset of the sequence in the file, from the start of the storage
+ *         being written (the dataset or chunk address).
+ *
+ *   len - The length of the sequence, in bytes.
+ *
+ *   data_off - The offset of the sequence's data in the data sent by the
+ *              process, which the aggregator changes to the offset of the
+ *              data in the data gathered from all the processes on the node.
+ */
+typedef struct H5D_mpio_node_seq_t {
+    hsize_t off;
+    hsize_t len;
+    hsize_t data_off;
+} H5D_mpio_node_seq_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -229,6 +270,13 @@ static herr_t H5D__inter_collective_io(H5D_io_info_t *io_info,
 static herr_t H5D__final_collective_io(H5D_io_info_t *io_info,
     const H5D_type_info_t *type_info, hsize_t nelmts, MPI_Datatype mpi_file_type,
     MPI_Datatype mpi_buf_type);
+static herr_t H5D__node_agg_collective_write(H5D_io_info_t *io_info,
+    const H5D_type_info_t *type_info, const H5S_t *file_space,
+    const H5S_t *mem_space, hbool_t *aggregated);
+static herr_t H5D__node_agg_flatten(const H5D_io_info_t *io_info,
+    const H5D_type_info_t *type_info, const H5S_t *file_space,
+    const H5S_t *mem_space, H5D_mpio_node_seq_t **seqs, size_t *nseqs,
+    unsigned char **data, size_t *data_size);
 static herr_t H5D__sort_chunk(H5D_io_info_t *io_info, const H5D_chunk_map_t *fm,
     H5D_chunk_addr_info_t chunk_addr_info_array[], int many_chunk_opt);
 static herr_t H5D__obtain_mpio_mode(H5D_io_info_t *io_info, H5D_chunk_map_t *fm,
@@ -237,12 +285,15 @@ static herr_t H5D__mpio_get_sum_chunk(const H5D_io_info_t *io_info,
     const H5D_chunk_map_t *fm, int *sum_chunkf);
 static herr_t H5D__construct_filtered_io_info_list(const H5D_io_info_t *io_info,
     const H5D_type_info_t *type_info, const H5D_chunk_map_t *fm,
-    H5D_filtered_collective_io_info_t **chunk_list, size_t *num_entries);
+    H5D_filtered_collective_io_info_t **chunk_list, size_t *num_entries,
+    H5D_filtered_collective_io_sends_t *sends);
 #if MPI_VERSION >= 3
 static herr_t H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info,
     const H5D_type_info_t *type_info, const H5D_chunk_map_t *fm,
-    H5D_filtered_collective_io_info_t *local_chunk_array, size_t *local_chunk_array_num_entries);
+    H5D_filtered_collective_io_info_t *local_chunk_array, size_t *local_chunk_array_num_entries,
+    H5D_filtered_collective_io_sends_t *sends);
 #endif
+static herr_t H5D__filtered_collective_io_sends_complete(H5D_filtered_collective_io_sends_t *sends);
 static herr_t H5D__mpio_array_gatherv(void *local_array, size_t local_array_num_entries,
     size_t array_entry_size, void **gathered_array, size_t *gathered_array_num_entries,
     hbool_t allgather, int root, MPI_Comm comm, int (*sort_func)(const void *, const void *));
@@ -250,11 +301,19 @@ static herr_t H5D__mpio_filtered_collective_write_type(
     H5D_filtered_collective_io_info_t *chunk_list, size_t num_entries,
     MPI_Datatype *new_mem_type, hbool_t *mem_type_derived,
     MPI_Datatype *new_file_type, hbool_t *file_type_derived);
+static herr_t H5D__filtered_collective_chunk_list_update(H5D_filtered_collective_io_info_t *chunk_list,
+    size_t num_entries, const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+    const H5D_chunk_map_t *fm);
 static herr_t H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk_entry,
     const H5D_io_info_t *io_info, const H5D_type_info_t *type_info, const H5D_chunk_map_t *fm);
+static herr_t H5D__filtered_collective_chunk_entry_finish(H5D_filtered_collective_io_info_t *chunk_entry,
+    const H5D_io_info_t *io_info, const H5D_type_info_t *type_info);
 static int H5D__cmp_chunk_addr(const void *chunk_addr_info1, const void *chunk_addr_info2);
+static int H5D__cmp_node_seq(const void *node_seq1, const void *node_seq2);
 static int H5D__cmp_filtered_collective_io_info_entry(const void *filtered_collective_io_info_entry1,
     const void *filtered_collective_io_info_entry2);
+static int H5D__cmp_filtered_collective_io_info_entry_index(const void *filtered_collective_io_info_entry1,
+    const void *filtered_collective_io_info_entry2);
 #if MPI_VERSION >= 3
 static int H5D__cmp_filtered_collective_io_info_entry_owner(const void *filtered_collective_io_info_entry1,
     const void *filtered_collective_io_info_entry2);
@@ -1291,6 +1350,12 @@ if(H5DEBUG(D))
  *                         processes and update the chunk data with these
  *                         modifications
  *                    IV. Filter the chunk
+ *
+ *                    Chunks are filtered as soon as the modification data
+ *                    from other processes has arrived for them, rather than
+ *                    in order, so that chunks are filtered while the data
+ *                    for others is still in flight (see
+ *                    H5D__filtered_collective_chunk_list_update)
  *                 B. Contribute the modified chunks to an array gathered
  *                    by all processes which contains the new sizes of
  *                    every chunk modified in the collective IO operation
@@ -1319,6 +1384,7 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
 {
     H5D_filtered_collective_io_info_t *chunk_list = NULL; /* The list of chunks being read/written */
     H5D_filtered_collective_io_info_t *collective_chunk_list = NULL; /* The list of chunks used during collective operations */
+    H5D_filtered_collective_io_sends_t sends = {NULL, NULL, 0}; /* Sends of modification data to the owners of other chunks */
     H5D_storage_t                      ctg_store;                        /* Chunk storage information as contiguous dataset */
     MPI_Datatype                       mem_type = MPI_BYTE;
     MPI_Datatype                       file_type = MPI_BYTE;
@@ -1352,7 +1418,7 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
     H5CX_set_mpio_actual_io_mode(H5D_MPIO_CHUNK_COLLECTIVE);
 
     /* Build a list of selected chunks in the collective io operation */
-    if (H5D__construct_filtered_io_info_list(io_info, type_info, fm, &chunk_list, &chunk_list_num_entries) < 0)
+    if (H5D__construct_filtered_io_info_list(io_info, type_info, fm, &chunk_list, &chunk_list_num_entries, &sends) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "couldn't construct filtered I/O info list")
 
     if (io_info->op_type == H5D_IO_OP_WRITE) { /* Filtered collective write */
@@ -1371,14 +1437,16 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
         udata.common.storage = index_info.storage;
         udata.filter_mask = 0;
 
-        /* Iterate through all the chunks in the collective write operation,
-         * updating each chunk with the data modifications from other processes,
-         * then re-filtering the chunk.
+        /* Update all the chunks in the collective write operation with the
+         * data modifications from this and other processes, then re-filter
+         * the chunks.
          */
-        for (i = 0; i < chunk_list_num_entries; i++)
-            if (mpi_rank == chunk_list[i].owners.new_owner)
-                if (H5D__filtered_collective_chunk_entry_io(&chunk_list[i], io_info, type_info, fm) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't process chunk entry")
+        if (H5D__filtered_collective_chunk_list_update(chunk_list, chunk_list_num_entries, io_info, type_info, fm) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't update chunks")
+
+        /* Wait for the modification data sent to the owners of other chunks to be received */
+        if (H5D__filtered_collective_io_sends_complete(&sends) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't complete chunk modification data sends")
 
         /* Gather the new chunk sizes to all processes for a collective reallocation
          * of the chunks in the file.
@@ -1461,6 +1529,10 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
     } /* end if */
 
 done:
+    /* Complete any sends still in progress after a failure, which frees their buffers */
+    if (H5D__filtered_collective_io_sends_complete(&sends) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "couldn't complete chunk modification data sends")
+
     /* Free resources used by a process which had some selection */
     if (chunk_list) {
         for (i = 0; i < chunk_list_num_entries; i++)
@@ -1717,20 +1789,27 @@ done:
  *                         processes and update the chunk data with these
  *                         modifications
  *                    IV. Filter the chunk
- *                    V. Contribute the chunk to an array gathered by
- *                        all processes which contains every chunk
- *                        modified in this iteration (up to one chunk
- *                        per process, some processes may not have a
- *                        selection/may have less chunks to work on than
- *                        other processes)
- *                    VI. All processes collectively re-allocate each
+ *
+ *                    Chunks are filtered as soon as the modification data
+ *                    from other processes has arrived for them, rather than
+ *                    in order, so that chunks are filtered while the data
+ *                    for others is still in flight (see
+ *                    H5D__filtered_collective_chunk_list_update)
+ *                 B. Loop through each chunk in the operation
+ *                    I. Contribute the chunk to an array gathered by
+ *                       all processes which contains every chunk
+ *                       modified in this iteration (up to one chunk
+ *                       per process, some processes may not have a
+ *                       selection/may have less chunks to work on than
+ *                       other processes)
+ *                    II. All processes collectively re-allocate each
  *                        chunk from the gathered array with their new
  *                        sizes after the filter operation
- *                    VII. Proceed with the collective write operation
- *                        for the chunks modified on this iteration
- *                    VIII. All processes collectively re-insert each
- *                       chunk from the gathered array into the chunk
- *                       index
+ *                    III. Proceed with the collective write operation
+ *                         for the chunks modified on this iteration
+ *                    IV. All processes collectively re-insert each
+ *                        chunk from the gathered array into the chunk
+ *                        index
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -1745,6 +1824,7 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
 {
     H5D_filtered_collective_io_info_t *chunk_list = NULL; /* The list of chunks being read/written */
     H5D_filtered_collective_io_info_t *collective_chunk_list = NULL; /* The list of chunks used during collective operations */
+    H5D_filtered_collective_io_sends_t sends = {NULL, NULL, 0}; /* Sends of modification data to the owners of other chunks */
     H5D_storage_t                      store;                /* union of EFL and chunk pointer in file space */
     H5D_io_info_t                      ctg_io_info;          /* Contiguous I/O info object */
     H5D_storage_t                      ctg_store;            /* Chunk storage information as contiguous dataset */
@@ -1780,7 +1860,7 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
     H5CX_set_mpio_actual_io_mode(H5D_MPIO_CHUNK_COLLECTIVE);
 
     /* Build a list of selected chunks in the collective IO operation */
-    if (H5D__construct_filtered_io_info_list(io_info, type_info, fm, &chunk_list, &chunk_list_num_entries) < 0)
+    if (H5D__construct_filtered_io_info_list(io_info, type_info, fm, &chunk_list, &chunk_list_num_entries, &sends) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "couldn't construct filtered I/O info list")
 
     /* Set up contiguous I/O info object */
@@ -1817,6 +1897,17 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
         udata.common.storage = index_info.storage;
         udata.filter_mask = 0;
 
+        /* Update all the chunks this process is writing with the data
+         * modifications from this and other processes, then re-filter the
+         * chunks, before they are written one at a time below.
+         */
+        if (H5D__filtered_collective_chunk_list_update(chunk_list, chunk_list_num_entries, io_info, type_info, fm) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't update chunks")
+
+        /* Wait for the modification data sent to the owners of other chunks to be received */
+        if (H5D__filtered_collective_io_sends_complete(&sends) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't complete chunk modification data sends")
+
         /* Retrieve the maximum number of chunks being written among all processes */
         if (MPI_SUCCESS != (mpi_code = MPI_Allreduce(&chunk_list_num_entries, &max_num_chunks,
                 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, io_info->comm)))
@@ -1848,10 +1939,6 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
             /* Check if this process has a chunk to work on for this iteration */
             hbool_t have_chunk_to_process = (i < chunk_list_num_entries) && (mpi_rank == chunk_list[i].owners.new_owner);
 
-            if (have_chunk_to_process)
-                if (H5D__filtered_collective_chunk_entry_io(&chunk_list[i], io_info, type_info, fm) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't process chunk entry")
-
             /* Gather the new chunk sizes to all processes for a collective re-allocation
              * of the chunks in the file
              */
@@ -1961,6 +2048,10 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
     } /* end else */
 
 done:
+    /* Complete any sends still in progress after a failure, which frees their buffers */
+    if (H5D__filtered_collective_io_sends_complete(&sends) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "couldn't complete chunk modification data sends")
+
     if (chunk_list) {
         for (i = 0; i < chunk_list_num_entries; i++)
             if (chunk_list[i].buf)
@@ -2010,6 +2101,29 @@ H5D__inter_collective_io(H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
 
     FUNC_ENTER_STATIC
 
+    /* Check for aggregating collective writes on each node */
+    if(io_info->op_type == H5D_IO_OP_WRITE) {
+        H5FD_mpio_collective_opt_t coll_opt_mode;   /* Collective or independent I/O */
+        hbool_t node_agg;                           /* Whether to aggregate writes on each node */
+
+        if(H5CX_get_mpio_node_agg(&node_agg) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get node aggregation property")
+        if(H5CX_get_mpio_coll_opt(&coll_opt_mode) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get MPI-I/O collective_op property")
+        if(node_agg && coll_opt_mode == H5FD_MPIO_COLLECTIVE_IO) {
+            hbool_t aggregated = FALSE;             /* Whether the write was aggregated */
+
+            if(H5D__node_agg_collective_write(io_info, type_info, file_space, mem_space, &aggregated) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "couldn't finish node aggregated collective write")
+
+            /* Write without aggregation if any process couldn't aggregate */
+            if(aggregated) {
+                H5CX_set_mpio_actual_node_agg(TRUE);
+                HGOTO_DONE(SUCCEED)
+            } /* end if */
+        } /* end if */
+    } /* end if */
+
     if((file_space != NULL) && (mem_space != NULL)) {
         int  mpi_file_count;         /* Number of file "objects" to transfer */
         hsize_t *permute_map = NULL; /* array that holds the mapping from the old, 
@@ -2133,6 +2247,373 @@ if(H5DEBUG(D))
       FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__final_collective_io */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__node_agg_collective_write
+ *
+ * Purpose:     Routine for a collective write that is aggregated on each
+ *              node before it's written.
+ *
+ *              Each process flattens its file selection into sequences of
+ *              bytes, gathers its data in the same order and sends both to
+ *              the first process on its node, the node's aggregator, over
+ *              the node's communicator.  The aggregator sorts the sequences
+ *              from all the processes on the node by their offset in the
+ *              file, merges the adjacent ones and copies their data into
+ *              one buffer in file order.  The aggregators then write the
+ *              data for their nodes in one collective write, with the other
+ *              processes taking part without any data, so that MPI-IO sees
+ *              a few large writes rather than many small ones.
+ *
+ *              Where sequences overlap, the data from the sequence that
+ *              starts first in the file is written, and of sequences that
+ *              start at the same offset, the data from the lower ranked
+ *              process.
+ *
+ *              Before anything is sent to the aggregator, the processes on
+ *              the node agree whether they could set up the aggregation.
+ *              If any couldn't (e.g. from running out of memory, or having
+ *              too much data for MPI's counts), none of them write anything
+ *              and AGGREGATED is set to FALSE, so the caller can write
+ *              without aggregation instead.  Every process still takes part
+ *              in exactly one collective write, whether its node aggregates
+ *              or not.
+ *
+ *              The merged blocks aren't aligned to the file's alignment
+ *              or the file system's stripe size here: the aggregators'
+ *              collective write goes through MPI-IO's own collective
+ *              buffering, which splits the file into domains on stripe
+ *              boundaries (from the "striping_unit" and "cb_*" hints).
+ *              Only MPI-IO files do collective writes, so there's no
+ *              path for other drivers.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__node_agg_collective_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+    const H5S_t *file_space, const H5S_t *mem_space, hbool_t *aggregated)
+{
+    H5D_mpio_node_seq_t *seqs = NULL;   /* Sequences written by this process */
+    size_t nseqs = 0;                   /* # of sequences written by this process */
+    unsigned char *data = NULL;         /* Data written by this process, in selection order */
+    size_t data_size = 0;               /* Size of data written by this process */
+    H5D_mpio_node_seq_t *node_seqs = NULL;  /* Sequences written by all the processes on the node */
+    unsigned char *node_data = NULL;    /* Data written by all the processes on the node */
+    unsigned char *agg_buf = NULL;      /* Data written by the node, in file order */
+    hsize_t agg_size = 0;               /* Size of data written by the node */
+    int *counts = NULL;                 /* Sizes & displacements of the sequences & data from each process */
+    int *blocklens = NULL;              /* Lengths of the merged sequences */
+    MPI_Aint *displs = NULL;            /* Offsets of the merged sequences */
+    MPI_Datatype mpi_file_type = MPI_BYTE;  /* MPI description of the merged sequences */
+    hbool_t mft_is_derived = FALSE;     /* Whether the file type is derived */
+    const void *wbuf = io_info->u.wbuf; /* Application's write buffer */
+    MPI_Comm node_comm;                 /* Communicator for processes on this node */
+    int node_rank, node_size;           /* Rank of this process & # of processes on the node */
+    int local_counts[2];                /* Sizes of the sequences & data from this process */
+    hsize_t seq_total = 0, data_total = 0;  /* Total size of sequences & data on the node */
+    int can_agg = TRUE;                 /* Whether this process can aggregate */
+    int node_can_agg;                   /* Whether all the processes on the node can aggregate */
+    int mpi_code;                       /* MPI return code */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(aggregated);
+    *aggregated = FALSE;
+
+    /* Get the node communicator */
+    if(MPI_COMM_NULL == (node_comm = H5F_mpi_get_node_comm(io_info->dset->oloc.file)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get node communicator")
+    if(MPI_SUCCESS != (mpi_code = MPI_Comm_rank(node_comm, &node_rank)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Comm_rank failed", mpi_code)
+    if(MPI_SUCCESS != (mpi_code = MPI_Comm_size(node_comm, &node_size)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Comm_size failed", mpi_code)
+
+    /* Flatten this process's file selection into sequences, and gather its
+     * data in the same order.  A failure here only stops this process from
+     * aggregating, which the processes on the node agree on below, so that
+     * none of them are left waiting on the others.
+     */
+    if(H5D__node_agg_flatten(io_info, type_info, file_space, mem_space, &seqs, &nseqs, &data, &data_size) < 0) {
+        H5E_clear_stack(NULL);
+        can_agg = FALSE;
+    } /* end if */
+    else if(nseqs * sizeof(H5D_mpio_node_seq_t) > (size_t)INT_MAX || data_size > (size_t)INT_MAX)
+        can_agg = FALSE;
+
+    if(node_rank == 0)
+        /* (Sizes from each process, then sequence counts & displacements, then data counts & displacements) */
+        if(NULL == (counts = (int *)H5MM_malloc(6 * (size_t)node_size * sizeof(int))))
+            can_agg = FALSE;
+
+    /* Agree whether the processes on the node can aggregate so far */
+    if(MPI_SUCCESS != (mpi_code = MPI_Allreduce(&can_agg, &node_can_agg, 1, MPI_INT, MPI_LAND, node_comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Allreduce failed", mpi_code)
+    if(!node_can_agg)
+        HGOTO_DONE(SUCCEED)
+
+    /* Tell the node's aggregator how much this process is writing */
+    local_counts[0] = (int)(nseqs * sizeof(H5D_mpio_node_seq_t));
+    local_counts[1] = (int)data_size;
+    if(MPI_SUCCESS != (mpi_code = MPI_Gather(local_counts, 2, MPI_INT, counts, 2, MPI_INT, 0, node_comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Gather failed", mpi_code)
+
+    /* Set up the aggregator's buffers */
+    if(node_rank == 0) {
+        int *seq_counts = counts + 2 * node_size;       /* Size of sequences from each process */
+        int *seq_displs = counts + 3 * node_size;       /* Displacement of sequences from each process */
+        int *data_counts = counts + 4 * node_size;      /* Size of data from each process */
+        int *data_displs = counts + 5 * node_size;      /* Displacement of data from each process */
+        int i;                                          /* Local index variable */
+
+        for(i = 0; i < node_size && can_agg; i++) {
+            seq_counts[i] = counts[2 * i];
+            seq_displs[i] = (int)seq_total;
+            data_counts[i] = counts[2 * i + 1];
+            data_displs[i] = (int)data_total;
+            seq_total += (hsize_t)seq_counts[i];
+            data_total += (hsize_t)data_counts[i];
+            if(seq_total > (hsize_t)INT_MAX || data_total > (hsize_t)INT_MAX)
+                can_agg = FALSE;
+        } /* end for */
+
+        if(can_agg && seq_total > 0) {
+            size_t node_nseqs = (size_t)seq_total / sizeof(H5D_mpio_node_seq_t);   /* # of sequences on the node */
+
+            if(NULL == (node_seqs = (H5D_mpio_node_seq_t *)H5MM_malloc((size_t)seq_total))
+                    || NULL == (node_data = (unsigned char *)H5MM_malloc((size_t)data_total))
+                    || NULL == (agg_buf = (unsigned char *)H5MM_malloc((size_t)data_total))
+                    || NULL == (blocklens = (int *)H5MM_malloc(node_nseqs * sizeof(int)))
+                    || NULL == (displs = (MPI_Aint *)H5MM_malloc(node_nseqs * sizeof(MPI_Aint))))
+                can_agg = FALSE;
+        } /* end if */
+    } /* end if */
+
+    /* Agree whether the aggregator could set up its buffers, before any data is sent */
+    if(MPI_SUCCESS != (mpi_code = MPI_Bcast(&can_agg, 1, MPI_INT, 0, node_comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+    if(!can_agg)
+        HGOTO_DONE(SUCCEED)
+
+    /* Send the sequences & data to the aggregator */
+    if(node_rank == 0) {
+        int *seq_counts = counts + 2 * node_size;       /* Size of sequences from each process */
+        int *seq_displs = counts + 3 * node_size;       /* Displacement of sequences from each process */
+        int *data_counts = counts + 4 * node_size;      /* Size of data from each process */
+        int *data_displs = counts + 5 * node_size;      /* Displacement of data from each process */
+        int i;                                          /* Local index variable */
+
+        if(MPI_SUCCESS != (mpi_code = MPI_Gatherv(seqs, local_counts[0], MPI_BYTE, node_seqs, seq_counts, seq_displs, MPI_BYTE, 0, node_comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Gatherv failed", mpi_code)
+        if(MPI_SUCCESS != (mpi_code = MPI_Gatherv(data, local_counts[1], MPI_BYTE, node_data, data_counts, data_displs, MPI_BYTE, 0, node_comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Gatherv failed", mpi_code)
+
+        if(seq_total > 0) {
+            size_t node_nseqs = (size_t)seq_total / sizeof(H5D_mpio_node_seq_t);   /* # of sequences on the node */
+            hsize_t end = 0;            /* End of the last merged sequence */
+            int nblocks = 0;            /* # of merged sequences */
+            size_t u, v;                /* Local index variables */
+
+            /* Point each sequence at its data in the data from all the processes */
+            for(i = 0, u = 0; i < node_size; i++) {
+                size_t proc_nseqs = (size_t)seq_counts[i] / sizeof(H5D_mpio_node_seq_t);
+
+                for(v = 0; v < proc_nseqs; v++, u++)
+                    node_seqs[u].data_off += (hsize_t)data_displs[i];
+            } /* end for */
+
+            /* Sort the sequences in file order */
+            HDqsort(node_seqs, node_nseqs, sizeof(H5D_mpio_node_seq_t), H5D__cmp_node_seq);
+
+            /* Copy the data into file order, merging adjacent sequences */
+            for(u = 0; u < node_nseqs; u++) {
+                hsize_t off = node_seqs[u].off;
+                hsize_t len = node_seqs[u].len;
+                hsize_t data_off = node_seqs[u].data_off;
+
+                /* Skip the part of the sequence that's already been written */
+                if(nblocks > 0 && off < end) {
+                    if(off + len <= end)
+                        continue;
+                    data_off += end - off;
+                    len -= end - off;
+                    off = end;
+                } /* end if */
+
+                HDmemcpy(agg_buf + agg_size, node_data + data_off, (size_t)len);
+                if(nblocks > 0 && off == end)
+                    blocklens[nblocks - 1] += (int)len;
+                else {
+                    displs[nblocks] = (MPI_Aint)off;
+                    blocklens[nblocks] = (int)len;
+                    nblocks++;
+                } /* end else */
+                end = off + len;
+                agg_size += len;
+            } /* end for */
+
+            /* Describe the merged sequences in the file */
+            if(MPI_SUCCESS != (mpi_code = MPI_Type_create_hindexed(nblocks, blocklens, displs, MPI_BYTE, &mpi_file_type)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_hindexed failed", mpi_code)
+            mft_is_derived = TRUE;
+            if(MPI_SUCCESS != (mpi_code = MPI_Type_commit(&mpi_file_type)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+
+            /* Write from the aggregated data */
+            io_info->u.wbuf = agg_buf;
+        } /* end if */
+    } /* end if */
+    else {
+        if(MPI_SUCCESS != (mpi_code = MPI_Gatherv(seqs, local_counts[0], MPI_BYTE, NULL, NULL, NULL, MPI_BYTE, 0, node_comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Gatherv failed", mpi_code)
+        if(MPI_SUCCESS != (mpi_code = MPI_Gatherv(data, local_counts[1], MPI_BYTE, NULL, NULL, NULL, MPI_BYTE, 0, node_comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Gatherv failed", mpi_code)
+    } /* end else */
+
+    /* Perform final collective I/O operation, with only the aggregators writing data */
+    *aggregated = TRUE;
+    if(H5D__final_collective_io(io_info, type_info, agg_size, mpi_file_type, MPI_BYTE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "couldn't finish collective MPI-IO")
+
+done:
+    io_info->u.wbuf = wbuf;
+    if(mft_is_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&mpi_file_type)))
+        HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
+    if(seqs)
+        H5MM_free(seqs);
+    if(data)
+        H5MM_free(data);
+    if(counts)
+        H5MM_free(counts);
+    if(node_seqs)
+        H5MM_free(node_seqs);
+    if(node_data)
+        H5MM_free(node_data);
+    if(agg_buf)
+        H5MM_free(agg_buf);
+    if(blocklens)
+        H5MM_free(blocklens);
+    if(displs)
+        H5MM_free(displs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__node_agg_collective_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__node_agg_flatten
+ *
+ * Purpose:     Flatten a process's file selection into sequences of bytes
+ *              and gather the data it writes in the same order, for
+ *              H5D__node_agg_collective_write.
+ *
+ *              The sequences & data are returned in SEQS and DATA, which
+ *              the caller frees, even when this routine fails.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__node_agg_flatten(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+    const H5S_t *file_space, const H5S_t *mem_space, H5D_mpio_node_seq_t **seqs,
+    size_t *nseqs, unsigned char **data, size_t *data_size)
+{
+    H5S_sel_iter_t *mem_iter = NULL;    /* Memory selection iterator */
+    H5S_sel_iter_t *file_iter = NULL;   /* File selection iterator */
+    hbool_t mem_iter_init = FALSE;      /* Whether the memory iterator is initialized */
+    hbool_t file_iter_init = FALSE;     /* Whether the file iterator is initialized */
+    size_t seqs_alloc = 0;              /* # of sequences allocated */
+    hssize_t snelmts;                   /* # of elements selected (signed) */
+    size_t nelmts;                      /* # of elements selected */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(seqs && !*seqs);
+    HDassert(nseqs);
+    HDassert(data && !*data);
+    HDassert(data_size);
+
+    *nseqs = 0;
+    *data_size = 0;
+
+    /* Check for no selection */
+    if(!file_space || !mem_space)
+        HGOTO_DONE(SUCCEED)
+    if((snelmts = H5S_GET_SELECT_NPOINTS(file_space)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOUNT, FAIL, "dataspace is invalid")
+    nelmts = (size_t)snelmts;
+
+    if(nelmts > 0) {
+        hsize_t off[H5D_IO_VECTOR_SIZE];    /* Array to store sequence offsets */
+        size_t len[H5D_IO_VECTOR_SIZE];     /* Array to store sequence lengths */
+        size_t nelmts_left = nelmts;        /* # of elements left to flatten */
+        hsize_t data_off = 0;               /* Offset of sequence's data */
+
+        /* Gather the data written */
+        *data_size = nelmts * type_info->src_type_size;
+        if(NULL == (*data = (unsigned char *)H5MM_malloc(*data_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate node aggregation send buffer")
+        if(NULL == (mem_iter = (H5S_sel_iter_t *)H5MM_malloc(sizeof(H5S_sel_iter_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate memory iterator")
+        if(H5S_select_iter_init(mem_iter, mem_space, type_info->src_type_size) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize memory selection information")
+        mem_iter_init = TRUE;
+        if(nelmts != H5D__gather_mem(io_info->u.wbuf, mem_space, mem_iter, nelmts, *data))
+            HGOTO_ERROR(H5E_IO, H5E_CANTGATHER, FAIL, "couldn't gather from write buffer")
+
+        /* Flatten the file selection, in the order the data was gathered */
+        if(NULL == (file_iter = (H5S_sel_iter_t *)H5MM_malloc(sizeof(H5S_sel_iter_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate file iterator")
+        if(H5S_select_iter_init(file_iter, file_space, type_info->src_type_size) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize file selection information")
+        file_iter_init = TRUE;
+        while(nelmts_left > 0) {
+            size_t nseq;            /* # of sequences retrieved */
+            size_t nelem;           /* # of elements in sequences */
+            size_t v;               /* Local index variable */
+
+            if(H5S_SELECT_GET_SEQ_LIST(file_space, 0, file_iter, (size_t)H5D_IO_VECTOR_SIZE, nelmts_left, &nseq, &nelem, off, len) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "sequence length generation failed")
+
+            /* Make room for the sequences */
+            if(*nseqs + nseq > seqs_alloc) {
+                size_t new_alloc = MAX(2 * seqs_alloc, *nseqs + nseq);  /* New # of sequences allocated */
+                H5D_mpio_node_seq_t *new_seqs;      /* New array of sequences */
+
+                if(NULL == (new_seqs = (H5D_mpio_node_seq_t *)H5MM_realloc(*seqs, new_alloc * sizeof(H5D_mpio_node_seq_t))))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate node aggregation sequences")
+                *seqs = new_seqs;
+                seqs_alloc = new_alloc;
+            } /* end if */
+
+            for(v = 0; v < nseq; v++, (*nseqs)++) {
+                (*seqs)[*nseqs].off = off[v];
+                (*seqs)[*nseqs].len = (hsize_t)len[v];
+                (*seqs)[*nseqs].data_off = data_off;
+                data_off += (hsize_t)len[v];
+            } /* end for */
+
+            nelmts_left -= nelem;
+        } /* end while */
+    } /* end if */
+
+done:
+    if(mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "couldn't release selection iterator")
+    if(file_iter_init && H5S_SELECT_ITER_RELEASE(file_iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "couldn't release selection iterator")
+    if(mem_iter)
+        H5MM_free(mem_iter);
+    if(file_iter)
+        H5MM_free(file_iter);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__node_agg_flatten() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__cmp_chunk_addr
@@ -2191,6 +2672,37 @@ H5D__cmp_filtered_collective_io_info_entry(const void *filtered_collective_io_in
     FUNC_LEAVE_NOAPI(H5F_addr_cmp(addr1, addr2))
 } /* end H5D__cmp_filtered_collective_io_info_entry() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cmp_filtered_collective_io_info_entry_index
+ *
+ * Purpose:     Routine to compare pointers to filtered collective chunk io
+ *              info entries by their chunk index fields
+ *
+ * Description: Callback for qsort() and bsearch() to compare pointers to
+ *              filtered collective chunk io info entries by their chunk
+ *              index fields
+ *
+ * Return:      -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__cmp_filtered_collective_io_info_entry_index(const void *filtered_collective_io_info_entry1, const void *filtered_collective_io_info_entry2)
+{
+    hsize_t index1, index2;
+    int ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    index1 = (*(const H5D_filtered_collective_io_info_t * const *) filtered_collective_io_info_entry1)->index;
+    index2 = (*(const H5D_filtered_collective_io_info_t * const *) filtered_collective_io_info_entry2)->index;
+    if (index1 != index2)
+        ret_value = (index1 < index2) ? -1 : 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cmp_filtered_collective_io_info_entry_index() */
+
 #if MPI_VERSION >= 3
 
 /*-------------------------------------------------------------------------
@@ -2224,6 +2736,39 @@ H5D__cmp_filtered_collective_io_info_entry_owner(const void *filtered_collective
 } /* end H5D__cmp_filtered_collective_io_info_entry_owner() */
 #endif
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cmp_node_seq
+ *
+ * Purpose:     Routine to compare sequences written by the processes on a
+ *              node, for node-local aggregation of collective writes
+ *
+ * Description: Callback for qsort() to compare the file offsets of the
+ *              sequences, then the offsets of their data, so that of the
+ *              sequences starting at the same offset, the ones from lower
+ *              ranked processes come first.
+ *
+ * Return:      -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__cmp_node_seq(const void *node_seq1, const void *node_seq2)
+{
+    const H5D_mpio_node_seq_t *seq1 = (const H5D_mpio_node_seq_t *)node_seq1;
+    const H5D_mpio_node_seq_t *seq2 = (const H5D_mpio_node_seq_t *)node_seq2;
+    int ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(seq1->off != seq2->off)
+        ret_value = (seq1->off < seq2->off) ? -1 : 1;
+    else if(seq1->data_off != seq2->data_off)
+        ret_value = (seq1->data_off < seq2->data_off) ? -1 : 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cmp_node_seq() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__sort_chunk
@@ -2569,6 +3114,10 @@ done:
  *              on every chunk, such as chunk re-allocation, insertion of
  *              chunks into the chunk index, etc.
  *
+ *              For a write, the sends of modification data for chunks now
+ *              owned by other processes are returned in SENDS, and must be
+ *              completed with H5D__filtered_collective_io_sends_complete.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Jordan Henderson
@@ -2578,7 +3127,8 @@ done:
  */
 static herr_t
 H5D__construct_filtered_io_info_list(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
-    const H5D_chunk_map_t *fm, H5D_filtered_collective_io_info_t **chunk_list, size_t *num_entries)
+    const H5D_chunk_map_t *fm, H5D_filtered_collective_io_info_t **chunk_list, size_t *num_entries,
+    H5D_filtered_collective_io_sends_t *sends)
 {
     H5D_filtered_collective_io_info_t *local_info_array = NULL; /* The list of initially selected chunks for this process */
     size_t                             num_chunks_selected;
@@ -2593,6 +3143,7 @@ H5D__construct_filtered_io_info_list(const H5D_io_info_t *io_info, const H5D_typ
     HDassert(fm);
     HDassert(chunk_list);
     HDassert(num_entries);
+    HDassert(sends);
 
     if ((mpi_rank = H5F_mpi_get_rank(io_info->dset->oloc.file)) < 0)
         HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi rank")
@@ -2621,10 +3172,10 @@ H5D__construct_filtered_io_info_list(const H5D_io_info_t *io_info, const H5D_typ
             local_info_array[i].num_writers = 0;
             local_info_array[i].owners.original_owner = local_info_array[i].owners.new_owner = mpi_rank;
             local_info_array[i].buf = NULL;
+            local_info_array[i].buf_size = 0;
             
             local_info_array[i].async_info.num_receive_requests = 0;
             local_info_array[i].async_info.receive_buffer_array = NULL;
-            local_info_array[i].async_info.receive_requests_array = NULL;
 
             HDmemcpy(local_info_array[i].scaled, chunk_info->scaled, sizeof(chunk_info->scaled));
 
@@ -2652,7 +3203,7 @@ H5D__construct_filtered_io_info_list(const H5D_io_info_t *io_info, const H5D_typ
     /* Redistribute shared chunks to new owners as necessary */
     if (io_info->op_type == H5D_IO_OP_WRITE)
 #if MPI_VERSION >= 3
-        if (H5D__chunk_redistribute_shared_chunks(io_info, type_info, fm, local_info_array, &num_chunks_selected) < 0)
+        if (H5D__chunk_redistribute_shared_chunks(io_info, type_info, fm, local_info_array, &num_chunks_selected, sends) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to redistribute shared chunks")
 #else
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to redistribute shared chunks - MPI version < 3 (MPI_Mprobe and MPI_Imrecv missing)")
@@ -2699,6 +3250,12 @@ done:
  *                modified. Rank 0 then scatters each segment of the list
  *                back to its corresponding rank
  *
+ *              Each process then starts sending its modification data for
+ *              the chunks it no longer owns, before posting the receives
+ *              for the chunks it owns. The sends are returned in SENDS
+ *              rather than waited on here, so that the process can go on
+ *              to update its own chunks while the data is in flight.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Jordan Henderson
@@ -2708,16 +3265,13 @@ done:
  */
 static herr_t
 H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
-    const H5D_chunk_map_t *fm, H5D_filtered_collective_io_info_t *local_chunk_array, size_t *local_chunk_array_num_entries)
+    const H5D_chunk_map_t *fm, H5D_filtered_collective_io_info_t *local_chunk_array, size_t *local_chunk_array_num_entries,
+    H5D_filtered_collective_io_sends_t *sends)
 {
     H5D_filtered_collective_io_info_t  *shared_chunks_info_array = NULL; /* The list of all chunks selected in the operation by all processes */
     H5S_sel_iter_t                     *mem_iter = NULL; /* Memory iterator for H5D__gather_mem */
-    unsigned char                     **mod_data = NULL; /* Array of chunk modification data buffers sent by a process to new chunk owners */
-    MPI_Request                        *send_requests = NULL; /* Array of MPI_Isend chunk modification data send requests */
-    MPI_Status                         *send_statuses = NULL; /* Array of MPI_Isend chunk modification send statuses */
     hbool_t                             mem_iter_init = FALSE;
     size_t                              shared_chunks_info_array_num_entries = 0;
-    size_t                              num_send_requests = 0;
     size_t                             *num_assigned_chunks_array = NULL;
     size_t                              i, last_assigned_idx;
     int                                *send_counts = NULL;
@@ -2732,6 +3286,8 @@ H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info, const H5D_ty
     HDassert(type_info);
     HDassert(fm);
     HDassert(local_chunk_array_num_entries);
+    HDassert(sends);
+    HDassert(0 == sends->num_requests);
 
     if ((mpi_rank = H5F_mpi_get_rank(io_info->dset->oloc.file)) < 0)
         HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi rank")
@@ -2739,7 +3295,7 @@ H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info, const H5D_ty
         HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi size")
 
     if (*local_chunk_array_num_entries)
-        if (NULL == (send_requests = (MPI_Request *) H5MM_malloc(*local_chunk_array_num_entries * sizeof(MPI_Request))))
+        if (NULL == (sends->requests = (MPI_Request *) H5MM_malloc(*local_chunk_array_num_entries * sizeof(MPI_Request))))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate send requests buffer")
 
     if (NULL == (mem_iter = (H5S_sel_iter_t *) H5MM_malloc(sizeof(H5S_sel_iter_t))))
@@ -2819,15 +3375,15 @@ H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info, const H5D_ty
     } /* end if */
 
     /* Now that the chunks have been redistributed, each process must send its modification data
-     * to the new owners of any of the chunks it previously possessed. Accordingly, each process
-     * must also issue asynchronous receives for any messages it may receive for each of the
-     * chunks it is assigned, in order to avoid potential deadlocking issues.
+     * to the new owners of any of the chunks it previously possessed. The new owners receive
+     * the data while they update their chunks (see H5D__filtered_collective_chunk_list_update),
+     * so only the number of messages to expect for each chunk is recorded here.
      */
     if (*local_chunk_array_num_entries)
-        if (NULL == (mod_data = (unsigned char **) H5MM_malloc(*local_chunk_array_num_entries * sizeof(unsigned char *))))
+        if (NULL == (sends->bufs = (unsigned char **) H5MM_malloc(*local_chunk_array_num_entries * sizeof(unsigned char *))))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate modification data buffer array")
 
-    for (i = 0, last_assigned_idx = 0; i < *local_chunk_array_num_entries; i++) {
+    for (i = 0; i < *local_chunk_array_num_entries; i++) {
         H5D_filtered_collective_io_info_t *chunk_entry = &local_chunk_array[i];
 
         if (mpi_rank != chunk_entry->owners.new_owner) {
@@ -2851,11 +3407,11 @@ H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info, const H5D_ty
 
             mod_data_size += (size_t) iter_nelmts * type_info->src_type_size;
 
-            if (NULL == (mod_data[num_send_requests] = (unsigned char *) H5MM_malloc(mod_data_size)))
+            if (NULL == (mod_data_p = (unsigned char *) H5MM_malloc(mod_data_size)))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate chunk modification send buffer")
+            sends->bufs[sends->num_requests] = mod_data_p;
 
             /* Serialize the chunk's file dataspace into the buffer */
-            mod_data_p = mod_data[num_send_requests];
             if (H5S_encode(chunk_info->fspace, &mod_data_p, &mod_data_size) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTENCODE, FAIL, "unable to encode dataspace")
 
@@ -2871,88 +3427,39 @@ H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info, const H5D_ty
             /* Send modification data to new owner */
             H5_CHECK_OVERFLOW(mod_data_size, size_t, int)
             H5_CHECK_OVERFLOW(chunk_entry->index, hsize_t, int)
-            if (MPI_SUCCESS != (mpi_code = MPI_Isend(mod_data[num_send_requests], (int) mod_data_size, MPI_BYTE,
-                    chunk_entry->owners.new_owner, (int) chunk_entry->index, io_info->comm, &send_requests[num_send_requests])))
+            if (MPI_SUCCESS != (mpi_code = MPI_Isend(sends->bufs[sends->num_requests], (int) mod_data_size, MPI_BYTE,
+                    chunk_entry->owners.new_owner, (int) chunk_entry->index, io_info->comm, &sends->requests[sends->num_requests])))
                 HMPI_GOTO_ERROR(FAIL, "MPI_Isend failed", mpi_code)
+            sends->num_requests++;
 
             if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "couldn't release memory selection iterator")
             mem_iter_init = FALSE;
-
-            num_send_requests++;
         } /* end if */
-        else {
-            /* Allocate all necessary buffers for an asynchronous receive operation */
-            if (chunk_entry->num_writers > 1) {
-                MPI_Message message;
-                MPI_Status  status;
-                size_t      j;
+    } /* end for */
 
-                chunk_entry->async_info.num_receive_requests = (int) chunk_entry->num_writers - 1;
-                if (NULL == (chunk_entry->async_info.receive_requests_array = (MPI_Request *) H5MM_malloc((size_t) chunk_entry->async_info.num_receive_requests * sizeof(MPI_Request))))
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate async requests array")
+    for (i = 0, last_assigned_idx = 0; i < *local_chunk_array_num_entries; i++) {
+        H5D_filtered_collective_io_info_t *chunk_entry = &local_chunk_array[i];
 
-                if (NULL == (chunk_entry->async_info.receive_buffer_array = (unsigned char **) H5MM_malloc((size_t) chunk_entry->async_info.num_receive_requests * sizeof(unsigned char *))))
+        if (mpi_rank == chunk_entry->owners.new_owner) {
+            /* Allocate the array of buffers for the modification data from the other writers */
+            if (chunk_entry->num_writers > 1) {
+                chunk_entry->async_info.num_receive_requests = (int) chunk_entry->num_writers - 1;
+                if (NULL == (chunk_entry->async_info.receive_buffer_array = (unsigned char **) H5MM_calloc((size_t) chunk_entry->async_info.num_receive_requests * sizeof(unsigned char *))))
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate async receive buffers")
-
-                for (j = 0; j < chunk_entry->num_writers - 1; j++) {
-                    int count = 0;
-
-                    /* Probe for a particular message from any process, removing that message
-                     * from the receive queue in the process and allocating that much memory
-                     * for the asynchronous receive
-                     */
-                    if (MPI_SUCCESS != (mpi_code = MPI_Mprobe(MPI_ANY_SOURCE, (int) chunk_entry->index, io_info->comm, &message, &status)))
-                        HMPI_GOTO_ERROR(FAIL, "MPI_Mprobe failed", mpi_code)
-
-                    if (MPI_SUCCESS != (mpi_code = MPI_Get_count(&status, MPI_BYTE, &count)))
-                        HMPI_GOTO_ERROR(FAIL, "MPI_Get_count failed", mpi_code)
-
-                    HDassert(count >= 0);
-                    if (NULL == (chunk_entry->async_info.receive_buffer_array[j] = (unsigned char *) H5MM_malloc((size_t) count * sizeof(char *))))
-                        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate modification data receive buffer")
-
-                    if (MPI_SUCCESS != (mpi_code = MPI_Imrecv(chunk_entry->async_info.receive_buffer_array[j], count, MPI_BYTE,
-                            &message, &chunk_entry->async_info.receive_requests_array[j])))
-                        HMPI_GOTO_ERROR(FAIL, "MPI_Imrecv failed", mpi_code)
-                } /* end for */
             } /* end if */
 
             local_chunk_array[last_assigned_idx++] = local_chunk_array[i];
-        } /* end else */
+        } /* end if */
     } /* end for */
 
     *local_chunk_array_num_entries = last_assigned_idx;
 
-    /* Wait for all async send requests to complete before returning */
-    if (num_send_requests) {
-        if (NULL == (send_statuses = (MPI_Status *) H5MM_malloc(num_send_requests * sizeof(MPI_Status))))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate send statuses buffer")
-
-        H5_CHECK_OVERFLOW(num_send_requests, size_t, int);
-        if (MPI_SUCCESS != (mpi_code = MPI_Waitall((int) num_send_requests, send_requests, send_statuses)))
-            HMPI_GOTO_ERROR(FAIL, "MPI_Waitall failed", mpi_code)
-    } /* end if */
-
 done:
-    /* Now that all async send requests have completed, free up the send
-     * buffers used in the async operations
-     */
-    for (i = 0; i < num_send_requests; i++) {
-        if (mod_data[i])
-            H5MM_free(mod_data[i]);
-    } /* end for */
-
-    if (send_requests)
-        H5MM_free(send_requests);
-    if (send_statuses)
-        H5MM_free(send_statuses);
     if (send_counts)
         H5MM_free(send_counts);
     if (send_displacements)
         H5MM_free(send_displacements);
-    if (mod_data)
-        H5MM_free(mod_data);
     if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "couldn't release selection iterator")
     if (mem_iter)
@@ -2966,6 +3473,53 @@ done:
 } /* end H5D__chunk_redistribute_shared_chunks() */
 #endif
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__filtered_collective_io_sends_complete
+ *
+ * Purpose:     Waits for the sends of chunk modification data started
+ *              when shared chunks were redistributed to complete, then
+ *              frees their buffers and resets SENDS.
+ *
+ *              The buffers are freed even if waiting on the sends fails.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__filtered_collective_io_sends_complete(H5D_filtered_collective_io_sends_t *sends)
+{
+    size_t i;
+    int    mpi_code;
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(sends);
+
+    if (sends->num_requests) {
+        H5_CHECK_OVERFLOW(sends->num_requests, size_t, int);
+        if (MPI_SUCCESS != (mpi_code = MPI_Waitall((int) sends->num_requests, sends->requests, MPI_STATUSES_IGNORE)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Waitall failed", mpi_code)
+    } /* end if */
+
+done:
+    for (i = 0; i < sends->num_requests; i++)
+        H5MM_free(sends->bufs[i]);
+
+    if (sends->requests)
+        H5MM_free(sends->requests);
+    if (sends->bufs)
+        H5MM_free(sends->bufs);
+
+    sends->requests = NULL;
+    sends->bufs = NULL;
+    sends->num_requests = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__filtered_collective_io_sends_complete() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__mpio_filtered_collective_write_type
@@ -3054,6 +3608,234 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__mpio_filtered_collective_write_type() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__filtered_collective_chunk_list_update
+ *
+ * Purpose:     Updates each of the chunks owned by this process in a
+ *              collective filtered write with the modifications from this
+ *              and any other processes writing to it, then filters it.
+ *
+ *              Rather than waiting for the modification data of each chunk
+ *              in turn, the data for all of the chunks is received in the
+ *              order it arrives.  The chunks which other processes also
+ *              write to are read and updated with this process'
+ *              modifications first.  Then the chunks which only this
+ *              process writes to are updated and filtered, checking for
+ *              arrived data in between, and each shared chunk is filtered
+ *              as soon as all of its modification data is in.  This keeps
+ *              the process filtering chunks while the data for other
+ *              chunks is still in flight.
+ *
+ *              The messages from other processes are tagged with the index
+ *              of their chunk.  Since their sizes aren't known in advance,
+ *              the receive for each one is only started once MPI_Improbe
+ *              finds it has arrived.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__filtered_collective_chunk_list_update(H5D_filtered_collective_io_info_t *chunk_list,
+    size_t num_entries, const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+    const H5D_chunk_map_t *fm)
+{
+    H5D_filtered_collective_io_info_t **recv_chunks = NULL; /* Chunks receiving data, in order of chunk index */
+    MPI_Request *requests = NULL;       /* Receive requests for all of the chunks */
+    size_t      *request_chunks = NULL; /* Index of the chunk each receive request is for */
+    size_t      *first_request = NULL;  /* Index of the first receive request for each chunk */
+    size_t      *num_started = NULL;    /* Number of receives started for each chunk */
+    size_t      *num_pending = NULL;    /* Number of receives still pending for each chunk */
+    int         *completed = NULL;      /* Indices of the receive requests completed */
+    size_t       num_requests = 0;
+    size_t       num_recv_chunks = 0;
+    size_t       num_unstarted;         /* Number of receives not started yet */
+    size_t       num_active = 0;        /* Number of receives started, but not completed */
+    size_t       num_outstanding;       /* Number of receives not completed */
+    size_t       i, j, k;
+    int          mpi_code;
+    herr_t       ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(chunk_list || 0 == num_entries);
+    HDassert(io_info);
+    HDassert(io_info->op_type == H5D_IO_OP_WRITE);
+    HDassert(type_info);
+    HDassert(fm);
+
+    /* Set aside a receive request for each message expected for the chunks,
+     * in one array, so that they can be completed in whatever order the data
+     * arrives
+     */
+    for (i = 0; i < num_entries; i++)
+        if (chunk_list[i].async_info.num_receive_requests) {
+            num_requests += (size_t) chunk_list[i].async_info.num_receive_requests;
+            num_recv_chunks++;
+        } /* end if */
+
+    if (num_requests) {
+        H5_CHECK_OVERFLOW(num_requests, size_t, int);
+
+        if (NULL == (recv_chunks = (H5D_filtered_collective_io_info_t **) H5MM_malloc(num_recv_chunks * sizeof(H5D_filtered_collective_io_info_t *))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate receiving chunks array")
+        if (NULL == (requests = (MPI_Request *) H5MM_malloc(num_requests * sizeof(MPI_Request))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate receive requests array")
+        if (NULL == (request_chunks = (size_t *) H5MM_malloc(num_requests * sizeof(size_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate receive request chunks array")
+        if (NULL == (completed = (int *) H5MM_malloc(num_requests * sizeof(int))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate completed requests array")
+        if (NULL == (first_request = (size_t *) H5MM_calloc(num_entries * sizeof(size_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate first receives array")
+        if (NULL == (num_started = (size_t *) H5MM_calloc(num_entries * sizeof(size_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate started receives array")
+        if (NULL == (num_pending = (size_t *) H5MM_calloc(num_entries * sizeof(size_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate pending receives array")
+
+        for (i = 0, j = 0, k = 0; i < num_entries; i++) {
+            size_t num_receives = (size_t) chunk_list[i].async_info.num_receive_requests;
+
+            if (num_receives)
+                recv_chunks[j++] = &chunk_list[i];
+            first_request[i] = k;
+            for (; k < first_request[i] + num_receives; k++) {
+                requests[k] = MPI_REQUEST_NULL;
+                request_chunks[k] = i;
+            } /* end for */
+            num_pending[i] = num_receives;
+        } /* end for */
+
+        /* Sort the receiving chunks, to look them up by the tags of their messages */
+        HDqsort(recv_chunks, num_recv_chunks, sizeof(H5D_filtered_collective_io_info_t *), H5D__cmp_filtered_collective_io_info_entry_index);
+    } /* end if */
+    num_unstarted = num_outstanding = num_requests;
+
+    /* Read the chunks which other processes are also writing to and update
+     * them with this process' modifications, while their other modification
+     * data arrives
+     */
+    for (i = 0; i < num_entries; i++)
+        if (chunk_list[i].async_info.num_receive_requests)
+            if (H5D__filtered_collective_chunk_entry_io(&chunk_list[i], io_info, type_info, fm) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't process chunk entry")
+
+    /* Update and filter the chunks which only this process writes to,
+     * filtering each of the other chunks once all of its modification
+     * data has arrived
+     */
+    i = 0;
+    while (i < num_entries || num_outstanding) {
+        int num_completed = 0;
+
+#if MPI_VERSION >= 3
+        /* Start receiving the modification data which has arrived */
+        while (num_unstarted) {
+            H5D_filtered_collective_io_info_t   key_entry;
+            H5D_filtered_collective_io_info_t  *key = &key_entry;
+            H5D_filtered_collective_io_info_t **found;
+            MPI_Message message;
+            MPI_Status  status;
+            size_t      chunk_idx, recv_idx;
+            int         flag = 0;
+            int         count = 0;
+
+            /* When there's nothing else to do, wait for the data to arrive */
+            if (i >= num_entries && 0 == num_active) {
+                if (MPI_SUCCESS != (mpi_code = MPI_Mprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, io_info->comm, &message, &status)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Mprobe failed", mpi_code)
+            } /* end if */
+            else {
+                if (MPI_SUCCESS != (mpi_code = MPI_Improbe(MPI_ANY_SOURCE, MPI_ANY_TAG, io_info->comm, &flag, &message, &status)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Improbe failed", mpi_code)
+                if (!flag)
+                    break;
+            } /* end else */
+
+            /* Find the chunk the data is for */
+            key_entry.index = (hsize_t) status.MPI_TAG;
+            if (NULL == (found = (H5D_filtered_collective_io_info_t **) HDbsearch(&key, recv_chunks, num_recv_chunks,
+                    sizeof(H5D_filtered_collective_io_info_t *), H5D__cmp_filtered_collective_io_info_entry_index)))
+                HGOTO_ERROR(H5E_DATASET, H5E_NOTFOUND, FAIL, "received modification data for unknown chunk")
+            chunk_idx = (size_t) (*found - chunk_list);
+            if (num_started[chunk_idx] >= (size_t) chunk_list[chunk_idx].async_info.num_receive_requests)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "received too much modification data for chunk")
+            recv_idx = num_started[chunk_idx]++;
+
+            /* Allocate a buffer for the data and start receiving it */
+            if (MPI_SUCCESS != (mpi_code = MPI_Get_count(&status, MPI_BYTE, &count)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Get_count failed", mpi_code)
+
+            HDassert(count >= 0);
+            if (NULL == (chunk_list[chunk_idx].async_info.receive_buffer_array[recv_idx] = (unsigned char *) H5MM_malloc((size_t) count)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate modification data receive buffer")
+
+            if (MPI_SUCCESS != (mpi_code = MPI_Imrecv(chunk_list[chunk_idx].async_info.receive_buffer_array[recv_idx], count, MPI_BYTE,
+                    &message, &requests[first_request[chunk_idx] + recv_idx])))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Imrecv failed", mpi_code)
+            num_unstarted--;
+            num_active++;
+        } /* end while */
+#endif
+
+        /* Find the next chunk which doesn't need data from other processes */
+        while (i < num_entries && chunk_list[i].async_info.num_receive_requests)
+            i++;
+
+        if (i < num_entries) {
+            if (H5D__filtered_collective_chunk_entry_io(&chunk_list[i], io_info, type_info, fm) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't process chunk entry")
+            if (H5D__filtered_collective_chunk_entry_finish(&chunk_list[i], io_info, type_info) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't finish chunk entry")
+            i++;
+
+            /* Check for modification data which has been received, without waiting */
+            if (num_active)
+                if (MPI_SUCCESS != (mpi_code = MPI_Testsome((int) num_requests, requests, &num_completed,
+                        completed, MPI_STATUSES_IGNORE)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Testsome failed", mpi_code)
+        } /* end if */
+        else if (num_active) {
+            /* Nothing is left to do until more modification data is received */
+            if (MPI_SUCCESS != (mpi_code = MPI_Waitsome((int) num_requests, requests, &num_completed,
+                    completed, MPI_STATUSES_IGNORE)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Waitsome failed", mpi_code)
+        } /* end else-if */
+
+        /* Filter the chunks which now have all of their modification data */
+        for (j = 0; j < (size_t) num_completed; j++) {
+            size_t chunk_idx = request_chunks[completed[j]];
+
+            HDassert(num_active > 0);
+            HDassert(num_outstanding > 0);
+            HDassert(num_pending[chunk_idx] > 0);
+            num_active--;
+            num_outstanding--;
+            if (0 == --num_pending[chunk_idx])
+                if (H5D__filtered_collective_chunk_entry_finish(&chunk_list[chunk_idx], io_info, type_info) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't finish chunk entry")
+        } /* end for */
+    } /* end while */
+
+done:
+    if (recv_chunks)
+        H5MM_free(recv_chunks);
+    if (requests)
+        H5MM_free(requests);
+    if (request_chunks)
+        H5MM_free(request_chunks);
+    if (completed)
+        H5MM_free(completed);
+    if (first_request)
+        H5MM_free(first_request);
+    if (num_started)
+        H5MM_free(num_started);
+    if (num_pending)
+        H5MM_free(num_pending);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__filtered_collective_chunk_list_update() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__filtered_collective_chunk_entry_io
@@ -3063,6 +3845,12 @@ done:
  *              write, or for reading the chunk from file during a
  *              collective read.
  *
+ *              When writing, the chunk is only updated with the current
+ *              process' modifications. The modifications from other
+ *              processes are applied and the chunk is filtered by
+ *              H5D__filtered_collective_chunk_entry_finish, once they
+ *              have arrived.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Jordan Henderson
@@ -3086,12 +3874,9 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
     hbool_t           mem_iter_init = FALSE;
     hbool_t           file_iter_init = FALSE;
     size_t            buf_size;
-    size_t            i;
-    H5S_t            *dataspace = NULL; /* Other process' dataspace for the chunk */
     void             *tmp_gath_buf = NULL; /* Temporary gather buffer to gather into from application buffer
                                               before scattering out to the chunk data buffer (when writing data),
                                               or vice versa (when reading data) */
-    int               mpi_code;
     herr_t            ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
@@ -3153,7 +3938,7 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
         if(H5CX_set_io_xfer_mode(xfer_mode) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set MPI-I/O transfer mode")
 
-        if(H5Z_pipeline(&io_info->dset->shared->dcpl_cache.pline, H5Z_FLAG_REVERSE,
+        if(H5D__chunk_filter(&io_info->dset->shared->layout.u.chunk, &io_info->dset->shared->dcpl_cache.pline, H5Z_FLAG_REVERSE,
                 &filter_mask, err_detect, filter_cb, (size_t *)&chunk_entry->chunk_states.new_chunk.length,
                 &buf_size, &chunk_entry->buf) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "couldn't unfilter chunk for modifying")
@@ -3173,8 +3958,7 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
     /* If this is a read operation, scatter the read chunk data to the user's buffer.
      *
      * If this is a write operation, update the chunk data buffer with the modifications
-     * from the current process, then apply any modifications from other processes. Finally,
-     * filter the newly-updated chunk.
+     * from the current process.
      */
     switch (io_info->op_type) {
         case H5D_IO_OP_READ:
@@ -3235,54 +4019,8 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "couldn't release selection iterator")
             mem_iter_init = FALSE;
 
-            if (MPI_SUCCESS != (mpi_code = MPI_Waitall(chunk_entry->async_info.num_receive_requests,
-                    chunk_entry->async_info.receive_requests_array, MPI_STATUSES_IGNORE)))
-                HMPI_GOTO_ERROR(FAIL, "MPI_Waitall failed", mpi_code)
-
-            /* For each asynchronous receive call previously posted, receive the chunk modification
-             * buffer from another rank and update the chunk data
-             */
-            for (i = 0; i < (size_t) chunk_entry->async_info.num_receive_requests; i++) {
-                const unsigned char *mod_data_p;
-
-                /* Decode the process' chunk file dataspace */
-                mod_data_p = chunk_entry->async_info.receive_buffer_array[i];
-                if (NULL == (dataspace = H5S_decode(&mod_data_p)))
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTDECODE, FAIL, "unable to decode dataspace")
-
-                if (H5S_select_iter_init(mem_iter, dataspace, type_info->dst_type_size) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize memory selection information")
-                mem_iter_init = TRUE;
-
-                if ((iter_nelmts = H5S_GET_SELECT_NPOINTS(dataspace)) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTCOUNT, FAIL, "dataspace is invalid")
-
-                /* Update the chunk data with the received modification data */
-                if(H5D__scatter_mem(mod_data_p, dataspace, mem_iter, (size_t) iter_nelmts, chunk_entry->buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't scatter to write buffer")
-
-                if (H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "couldn't release selection iterator")
-                mem_iter_init = FALSE;
-                if (dataspace) {
-                    if (H5S_close(dataspace) < 0)
-                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTFREE, FAIL, "can't close dataspace")
-                    dataspace = NULL;
-                }
-                H5MM_free(chunk_entry->async_info.receive_buffer_array[i]);
-            } /* end for */
-
-            /* Filter the chunk */
-            if(H5Z_pipeline(&io_info->dset->shared->dcpl_cache.pline, 0, &filter_mask,
-                    err_detect, filter_cb, (size_t *)&chunk_entry->chunk_states.new_chunk.length,
-                    &buf_size, &chunk_entry->buf) < 0)
-                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "output pipeline failed")
-
-#if H5_SIZEOF_SIZE_T > 4
-            /* Check for the chunk expanding too much to encode in a 32-bit value */
-            if (chunk_entry->chunk_states.new_chunk.length > ((size_t) 0xffffffff))
-                HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk too large for 32-bit length")
-#endif
+            /* Keep the buffer size for filtering the chunk */
+            chunk_entry->buf_size = buf_size;
             break;
 
         default:
@@ -3290,10 +4028,6 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
     } /* end switch */
 
 done:
-    if (chunk_entry->async_info.receive_buffer_array)
-        H5MM_free(chunk_entry->async_info.receive_buffer_array);
-    if (chunk_entry->async_info.receive_requests_array)
-        H5MM_free(chunk_entry->async_info.receive_requests_array);
     if (tmp_gath_buf)
         H5MM_free(tmp_gath_buf);
     if (file_iter_init && H5S_SELECT_ITER_RELEASE(file_iter) < 0)
@@ -3304,11 +4038,120 @@ done:
         HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "couldn't release selection iterator")
     if (mem_iter)
         H5MM_free(mem_iter);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__filtered_collective_chunk_entry_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__filtered_collective_chunk_entry_finish
+ *
+ * Purpose:     Given an entry for a filtered chunk being written, which
+ *              has been updated with the current process' modifications
+ *              by H5D__filtered_collective_chunk_entry_io, updates the
+ *              chunk data with the modifications received from other
+ *              processes, then filters the chunk.
+ *
+ *              All of the receives for the chunk must have completed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__filtered_collective_chunk_entry_finish(H5D_filtered_collective_io_info_t *chunk_entry,
+    const H5D_io_info_t *io_info, const H5D_type_info_t *type_info)
+{
+    H5S_sel_iter_t   *mem_iter = NULL;  /* Memory iterator for H5D__scatter_mem */
+    H5Z_EDC_t         err_detect;       /* Error detection info */
+    H5Z_cb_t          filter_cb;        /* I/O filter callback function */
+    unsigned          filter_mask = 0;
+    hssize_t          iter_nelmts;      /* Number of points to iterate over for the chunk IO operation */
+    hbool_t           mem_iter_init = FALSE;
+    size_t            i;
+    H5S_t            *dataspace = NULL; /* Other process' dataspace for the chunk */
+    herr_t            ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(chunk_entry);
+    HDassert(chunk_entry->buf);
+    HDassert(io_info);
+    HDassert(io_info->op_type == H5D_IO_OP_WRITE);
+    HDassert(type_info);
+
+    /* Retrieve filter settings from API context */
+    if(H5CX_get_err_detect(&err_detect) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+    if(H5CX_get_filter_cb(&filter_cb) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+
+    if (chunk_entry->async_info.num_receive_requests)
+        if (NULL == (mem_iter = (H5S_sel_iter_t *) H5MM_malloc(sizeof(H5S_sel_iter_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate memory iterator")
+
+    /* For each asynchronous receive call previously posted, update the chunk
+     * data with the chunk modification buffer received from another rank
+     */
+    for (i = 0; i < (size_t) chunk_entry->async_info.num_receive_requests; i++) {
+        const unsigned char *mod_data_p;
+
+        /* Decode the process' chunk file dataspace */
+        mod_data_p = chunk_entry->async_info.receive_buffer_array[i];
+        if (NULL == (dataspace = H5S_decode(&mod_data_p)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTDECODE, FAIL, "unable to decode dataspace")
+
+        if (H5S_select_iter_init(mem_iter, dataspace, type_info->dst_type_size) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize memory selection information")
+        mem_iter_init = TRUE;
+
+        if ((iter_nelmts = H5S_GET_SELECT_NPOINTS(dataspace)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCOUNT, FAIL, "dataspace is invalid")
+
+        /* Update the chunk data with the received modification data */
+        if(H5D__scatter_mem(mod_data_p, dataspace, mem_iter, (size_t) iter_nelmts, chunk_entry->buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't scatter to write buffer")
+
+        if (H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "couldn't release selection iterator")
+        mem_iter_init = FALSE;
+        if (H5S_close(dataspace) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTFREE, FAIL, "can't close dataspace")
+        dataspace = NULL;
+
+        H5MM_free(chunk_entry->async_info.receive_buffer_array[i]);
+        chunk_entry->async_info.receive_buffer_array[i] = NULL;
+    } /* end for */
+
+    /* Filter the chunk */
+    if(H5D__chunk_filter(&io_info->dset->shared->layout.u.chunk, &io_info->dset->shared->dcpl_cache.pline, 0, &filter_mask,
+            err_detect, filter_cb, (size_t *)&chunk_entry->chunk_states.new_chunk.length,
+            &chunk_entry->buf_size, &chunk_entry->buf) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "output pipeline failed")
+
+#if H5_SIZEOF_SIZE_T > 4
+    /* Check for the chunk expanding too much to encode in a 32-bit value */
+    if (chunk_entry->chunk_states.new_chunk.length > ((size_t) 0xffffffff))
+        HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk too large for 32-bit length")
+#endif
+
+done:
+    if (chunk_entry->async_info.receive_buffer_array) {
+        for (i = 0; i < (size_t) chunk_entry->async_info.num_receive_requests; i++)
+            if (chunk_entry->async_info.receive_buffer_array[i])
+                H5MM_free(chunk_entry->async_info.receive_buffer_array[i]);
+        H5MM_free(chunk_entry->async_info.receive_buffer_array);
+        chunk_entry->async_info.receive_buffer_array = NULL;
+    } /* end if */
+    if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "couldn't release selection iterator")
+    if (mem_iter)
+        H5MM_free(mem_iter);
     if (dataspace)
         if (H5S_close(dataspace) < 0)
             HDONE_ERROR(H5E_DATASPACE, H5E_CANTFREE, FAIL, "can't close dataspace")
 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__filtered_collective_chunk_entry_io() */
+} /* end H5D__filtered_collective_chunk_entry_finish() */
 #endif  /* H5_HAVE_PARALLEL */
 
@@ -261,12 +261,13 @@ typedef struct H5D_chunk_common_ud_t {
 } H5D_chunk_common_ud_t;
 
 /* B-tree callback info for various operations */
+struct H5D_rdcc_ent_t;  /* Forward declaration of struct used below */
 typedef struct H5D_chunk_ud_t {
     /* Downward */
     H5D_chunk_common_ud_t common;       /* Common info for B-tree user data (must be first) */
 
     /* Upward */
-    unsigned    idx_hint;               /* Index of chunk in cache, if present */
+    struct H5D_rdcc_ent_t *cache_ent;   /* Chunk's entry in cache, if present */
     H5F_block_t chunk_block;            /* Offset/length of chunk in file */
     unsigned    filter_mask;            /* Excluded filters */
     hbool_t     new_unfilt_chunk;       /* Whether the chunk just became unfiltered */
@@ -277,6 +278,10 @@ typedef struct H5D_chunk_ud_t {
 typedef int (*H5D_chunk_cb_func_t)(const H5D_chunk_rec_t *chunk_rec,
     void *udata);
 
+/* Typedef for callbacks that supply chunk records when bulk loading an index */
+typedef herr_t (*H5D_chunk_fill_func_t)(H5D_chunk_rec_t *chunk_rec,
+    void *udata);
+
 /* Typedefs for chunk operations */
 typedef herr_t (*H5D_chunk_init_func_t)(const H5D_chk_idx_info_t *idx_info,
     const H5S_t *space, haddr_t dset_ohdr_addr);
@@ -386,7 +391,6 @@ typedef struct H5D_virtual_held_file_t {
 } H5D_virtual_held_file_t;
 
 /* The raw data chunk cache */
-struct H5D_rdcc_ent_t;  /* Forward declaration of struct used below */
 typedef struct H5D_rdcc_t {
     struct {
         unsigned    ninits;    /* Number of chunk creations        */
@@ -395,23 +399,20 @@ typedef struct H5D_rdcc_t {
         unsigned    nflushes;  /* Number of cache flushes        */
     } stats;
     size_t        nbytes_max;  /* Maximum cached raw data in bytes    */
-    size_t        nslots;      /* Number of chunk slots allocated    */
+    size_t        nslots;      /* Number of chunk slots requested (hint for initial # of hash buckets) */
     double        w0;          /* Chunk preemption policy          */
     struct H5D_rdcc_ent_t *head; /* Head of doubly linked list        */
     struct H5D_rdcc_ent_t *tail; /* Tail of doubly linked list        */
-    struct H5D_rdcc_ent_t *tmp_head; /* Head of temporary doubly linked list.  Chunks on this list are not in the hash table (slot).  The head entry is a sentinel (does not refer to an actual chunk). */
     size_t        nbytes_used;  /* Current cached raw data in bytes */
-    int           nused;        /* Number of chunk slots in use        */
+    int           nused;        /* Number of chunks in the cache       */
     H5D_chunk_cached_t last;    /* Cached copy of last chunk information */
-    struct H5D_rdcc_ent_t **slot; /* Chunk slots, each points to a chunk*/
+    size_t        nbuckets;     /* Number of hash table buckets (power of 2) */
+    size_t        nbuckets_min; /* Minimum number of hash table buckets */
+    struct H5D_rdcc_ent_t **slot; /* Hash table buckets, each a chain of chunks */
     H5SL_t        *sel_chunks;    /* Skip list containing information for each chunk selected */
     H5S_t         *single_space;  /* Dataspace for single element I/O on chunks */
     H5D_chunk_info_t    *single_chunk_info;  /* Pointer to single chunk's info */
-
-    /* Cached information about scaled dataspace dimensions */
-    hsize_t             scaled_dims[H5S_MAX_RANK];          /* The scaled dim sizes */
-    hsize_t             scaled_power2up[H5S_MAX_RANK];      /* The scaled dim sizes, rounded up to next power of 2 */
-    unsigned            scaled_encode_bits[H5S_MAX_RANK];   /* The number of bits needed to encode the scaled dim sizes */
+    struct H5D_chunk_wb_t *wb;    /* Write-behind queue for evicted dirty chunks (NULL if disabled) */
 } H5D_rdcc_t;
 
 /* The raw data contiguous data cache */
@@ -562,6 +563,9 @@ H5_DLL herr_t H5D__get_space_status(const H5D_t *dset, H5D_space_status_t *alloc
 H5_DLL herr_t H5D__alloc_storage(const H5D_io_info_t *io_info, H5D_time_alloc_t time_alloc, hbool_t full_overwrite, hsize_t old_dim[]);
 H5_DLL herr_t H5D__get_storage_size(const H5D_t *dset, hsize_t *storage_size);
 H5_DLL herr_t H5D__get_chunk_storage_size(H5D_t *dset, const hsize_t *offset, hsize_t *storage_size);
+H5_DLL herr_t H5D__chunk_wb_flush(const H5D_t *dset);
+H5_DLL herr_t H5D__chunk_iter(H5D_t *dset, H5_iter_order_t order,
+    H5D_chunk_iter_op_t op, void *op_data);
 H5_DLL haddr_t H5D__get_offset(const H5D_t *dset);
 H5_DLL void *H5D__vlen_get_buf_size_alloc(size_t size, void *info);
 H5_DLL herr_t H5D__vlen_get_buf_size(void *elem, hid_t type_id, unsigned ndim, const hsize_t *point, void *op_data);
@@ -641,14 +645,16 @@ H5_DLL herr_t H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled,
 H5_DLL herr_t H5D__chunk_allocated(const H5D_t *dset, hsize_t *nbytes);
 H5_DLL herr_t H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_t old_dim[]);
 H5_DLL herr_t H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
-    H5F_block_t *new_chunk, hbool_t *need_insert, hsize_t scaled[]);
+    H5F_block_t *new_chunk, hbool_t *need_insert, const hsize_t scaled[]);
 H5_DLL herr_t H5D__chunk_update_old_edge_chunks(H5D_t *dset, hsize_t old_dim[]);
 H5_DLL herr_t H5D__chunk_prune_by_extent(H5D_t *dset, const hsize_t *old_dim);
 H5_DLL herr_t H5D__chunk_set_sizes(H5D_t *dset);
+H5_DLL herr_t H5D__chunk_filter(const H5O_layout_chunk_t *layout,
+    const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask,
+    H5Z_EDC_t edc, H5Z_cb_t cb, size_t *nbytes, size_t *buf_size, void **buf);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5D__chunk_addrmap(const H5D_io_info_t *io_info, haddr_t chunk_addr[]);
 #endif /* H5_HAVE_PARALLEL */
-H5_DLL herr_t H5D__chunk_update_cache(H5D_t *dset);
 H5_DLL herr_t H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src,
     H5O_layout_chunk_t *layout_src, H5F_t *f_dst, H5O_storage_chunk_t *storage_dst,
     const H5S_extent_t *ds_extent_src, const H5T_t *dt_src,
@@ -662,6 +668,11 @@ H5_DLL herr_t H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters,
          hsize_t *offset, uint32_t data_size, const void *buf);
 H5_DLL herr_t H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset,
          uint32_t *filters, void *buf);
+H5_DLL herr_t H5D__chunk_direct_write_multi(const H5D_t *dset, size_t nchunks,
+         const uint32_t filters[], const hsize_t offsets[], const size_t data_sizes[],
+         const void *bufs[]);
+H5_DLL herr_t H5D__chunk_direct_read_multi(const H5D_t *dset, size_t nchunks,
+         const hsize_t offsets[], uint32_t filters[], void *bufs[]);
 #ifdef H5D_CHUNK_DEBUG
 H5_DLL herr_t H5D__chunk_stats(const H5D_t *dset, hbool_t headers);
 #endif /* H5D_CHUNK_DEBUG */
@@ -669,6 +680,10 @@ H5_DLL herr_t H5D__chunk_stats(const H5D_t *dset, hbool_t headers);
 /* format convert */
 H5_DLL herr_t H5D__chunk_format_convert(H5D_t *dset, H5D_chk_idx_info_t *idx_info, H5D_chk_idx_info_t *new_idx_info);
 
+/* Functions that operate on v2 B-tree chunk indices */
+H5_DLL herr_t H5D__bt2_idx_insert_bulk(const H5D_chk_idx_info_t *idx_info,
+    hsize_t nchunks, H5D_chunk_fill_func_t fill_cb, void *fill_udata);
+
 /* Functions that operate on compact dataset storage */
 H5_DLL herr_t H5D__compact_fill(const H5D_t *dset);
 H5_DLL herr_t H5D__compact_copy(H5F_t *f_src, H5O_storage_compact_t *storage_src,
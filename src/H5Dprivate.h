@@ -56,6 +56,7 @@
 #define H5D_ACS_VDS_PREFIX_NAME             "vds_prefix"     /* VDS file prefix */
 #define H5D_ACS_APPEND_FLUSH_NAME           "append_flush"   /* Append flush actions */
 #define H5D_ACS_EFILE_PREFIX_NAME           "external file prefix" /* External file prefix */
+#define H5D_ACS_CHUNK_WRITE_BEHIND_NAME     "chunk_write_behind" /* Max. # of dirty chunks queued for writing */
 
 /* ======== Data transfer properties ======== */
 #define H5D_XFER_MAX_TEMP_BUF_NAME      "max_temp_buf"  /* Maximum temp buffer size */
@@ -75,8 +76,10 @@
 #define H5D_XFER_MPIO_CHUNK_OPT_HARD_NAME "mpio_chunk_opt_hard"
 #define H5D_XFER_MPIO_CHUNK_OPT_NUM_NAME "mpio_chunk_opt_num"
 #define H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME "mpio_chunk_opt_ratio"
+#define H5D_XFER_MPIO_NODE_AGG_NAME "mpio_node_agg"      /* Aggregate collective writes on each node */
 #define H5D_MPIO_ACTUAL_CHUNK_OPT_MODE_NAME "actual_chunk_opt_mode"
 #define H5D_MPIO_ACTUAL_IO_MODE_NAME    "actual_io_mode"
+#define H5D_MPIO_ACTUAL_NODE_AGG_NAME   "actual_node_agg"    /* Whether the write was aggregated on each node */
 #define H5D_MPIO_LOCAL_NO_COLLECTIVE_CAUSE_NAME "local_no_collective_cause"    /* cause of broken collective I/O in each process */
 #define H5D_MPIO_GLOBAL_NO_COLLECTIVE_CAUSE_NAME "global_no_collective_cause"  /* cause of broken collective I/O in all processes */
 #define H5D_XFER_EDC_NAME               "err_detect"     /* EDC */
@@ -176,6 +179,7 @@ H5_DLL herr_t H5D_vlen_reclaim(hid_t type_id, H5S_t *space, void *buf);
 
 /* Functions that operate on chunked storage */
 H5_DLL herr_t H5D_chunk_idx_reset(H5O_storage_chunk_t *storage, hbool_t reset_addr);
+H5_DLL herr_t H5D_chunk_wb_flush_opened(const H5O_loc_t *oloc, void *shared_fo);
 
 /* Functions that operate on virtual storage */
 H5_DLL herr_t H5D_virtual_check_mapping_pre(const H5S_t *vspace,
@@ -117,6 +117,10 @@ typedef herr_t (*H5D_scatter_func_t)(const void **src_buf/*out*/,
 typedef herr_t (*H5D_gather_func_t)(const void *dst_buf,
                                     size_t dst_buf_bytes_used, void *op_data);
 
+/* Define the operator function pointer for H5Dchunk_iter() */
+typedef int (*H5D_chunk_iter_op_t)(const hsize_t *offset, uint32_t filter_mask,
+                                   haddr_t addr, hsize_t nbytes, void *op_data);
+
 
 /********************/
 /* Public Variables */
@@ -151,6 +155,13 @@ H5_DLL herr_t H5Dwrite_chunk(hid_t dset_id, hid_t dxpl_id, uint32_t filters,
             const hsize_t *offset, size_t data_size, const void *buf);
 H5_DLL herr_t H5Dread_chunk(hid_t dset_id, hid_t dxpl_id,
             const hsize_t *offset, uint32_t *filters, void *buf);
+H5_DLL herr_t H5Dwrite_chunks(hid_t dset_id, hid_t dxpl_id, size_t nchunks,
+            const uint32_t filters[], const hsize_t offsets[],
+            const size_t data_sizes[], const void *bufs[]);
+H5_DLL herr_t H5Dread_chunks(hid_t dset_id, hid_t dxpl_id, size_t nchunks,
+            const hsize_t offsets[], uint32_t filters[], void *bufs[]);
+H5_DLL herr_t H5Dchunk_iter(hid_t dset_id, H5_iter_order_t order,
+            H5D_chunk_iter_op_t op, void *op_data);
 H5_DLL herr_t H5Diterate(void *buf, hid_t type_id, hid_t space_id,
             H5D_operator_t op, void *operator_data);
 H5_DLL herr_t H5Dvlen_reclaim(hid_t type_id, hid_t space_id, hid_t plist_id, void *buf);
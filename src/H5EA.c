@@ -74,7 +74,8 @@ typedef herr_t (*H5EA__unprotect_func_t)(void *thing, unsigned cache_flags);
 static herr_t
 H5EA__lookup_elmt(const H5EA_t *ea, hsize_t idx, hbool_t will_extend,
     unsigned thing_acc, void **thing, uint8_t **thing_elmt_buf,
-    hsize_t *thing_elmt_idx, H5EA__unprotect_func_t *thing_unprot_func);
+    hsize_t *thing_elmt_idx, size_t *thing_nelmts,
+    H5EA__unprotect_func_t *thing_unprot_func);
 static H5EA_t *H5EA__new(H5F_t *f, haddr_t ea_addr, hbool_t from_open,
     void *ctx_udata);
 
@@ -341,7 +342,8 @@ END_FUNC(PRIV)  /* end H5EA_get_addr() */
  * Function:	H5EA__lookup_elmt
  *
  * Purpose:	Retrieve the metadata object and the element buffer for a
- *              given element in the array.
+ *              given element in the array, along with the number of
+ *              elements in the buffer.
  *
  * Return:	SUCCEED/FAIL
  *
@@ -355,7 +357,8 @@ BEGIN_FUNC(STATIC, ERR,
 herr_t, SUCCEED, FAIL,
 H5EA__lookup_elmt(const H5EA_t *ea, hsize_t idx, hbool_t will_extend,
     unsigned thing_acc, void **thing, uint8_t **thing_elmt_buf,
-    hsize_t *thing_elmt_idx, H5EA__unprotect_func_t *thing_unprot_func))
+    hsize_t *thing_elmt_idx, size_t *thing_nelmts,
+    H5EA__unprotect_func_t *thing_unprot_func))
 
     /* Local variables */
     H5EA_hdr_t *hdr = ea->hdr;          /* Header for EA */
@@ -375,6 +378,7 @@ H5EA__lookup_elmt(const H5EA_t *ea, hsize_t idx, hbool_t will_extend,
     HDassert(hdr);
     HDassert(thing);
     HDassert(thing_elmt_buf);
+    HDassert(thing_nelmts);
     HDassert(thing_unprot_func);
 
     /* only the H5AC__READ_ONLY_FLAG may be set in thing_acc */
@@ -387,6 +391,7 @@ H5EA__lookup_elmt(const H5EA_t *ea, hsize_t idx, hbool_t will_extend,
     *thing = NULL;
     *thing_elmt_buf = NULL;
     *thing_elmt_idx = 0;
+    *thing_nelmts = 0;
     *thing_unprot_func = (H5EA__unprotect_func_t)NULL;
 
     /* Check if we should create the index block */
@@ -413,6 +418,7 @@ H5EA__lookup_elmt(const H5EA_t *ea, hsize_t idx, hbool_t will_extend,
         *thing = iblock;
         *thing_elmt_buf = (uint8_t *)iblock->elmts;
         *thing_elmt_idx = idx;
+        *thing_nelmts = hdr->cparam.idx_blk_elmts;
         *thing_unprot_func = (H5EA__unprotect_func_t)H5EA__iblock_unprotect;
     } /* end if */
     else {
@@ -471,6 +477,7 @@ H5EA__lookup_elmt(const H5EA_t *ea, hsize_t idx, hbool_t will_extend,
             *thing = dblock;
             *thing_elmt_buf = (uint8_t *)dblock->elmts;
             *thing_elmt_idx = elmt_idx;
+            *thing_nelmts = dblock->nelmts;
             *thing_unprot_func = (H5EA__unprotect_func_t)H5EA__dblock_unprotect;
         } /* end if */
         else {
@@ -588,6 +595,7 @@ H5EA__lookup_elmt(const H5EA_t *ea, hsize_t idx, hbool_t will_extend,
                 *thing = dblk_page;
                 *thing_elmt_buf = (uint8_t *)dblk_page->elmts;
                 *thing_elmt_idx = elmt_idx;
+                *thing_nelmts = hdr->dblk_page_nelmts;
                 *thing_unprot_func = (H5EA__unprotect_func_t)H5EA__dblk_page_unprotect;
             } /* end if */
             else {
@@ -606,6 +614,7 @@ H5EA__lookup_elmt(const H5EA_t *ea, hsize_t idx, hbool_t will_extend,
                 *thing = dblock;
                 *thing_elmt_buf = (uint8_t *)dblock->elmts;
                 *thing_elmt_idx = elmt_idx;
+                *thing_nelmts = dblock->nelmts;
                 *thing_unprot_func = (H5EA__unprotect_func_t)H5EA__dblock_unprotect;
             } /* end else */
         } /* end else */
@@ -621,6 +630,7 @@ CATCH
         *thing = NULL;
         *thing_elmt_buf = NULL;
         *thing_elmt_idx = 0;
+        *thing_nelmts = 0;
         *thing_unprot_func = (H5EA__unprotect_func_t)NULL;
     } /* end if */
 
@@ -669,6 +679,7 @@ H5EA_set(const H5EA_t *ea, hsize_t idx, const void *elmt))
     void *thing = NULL;                 /* Pointer to the array metadata containing the array index we are interested in */
     uint8_t *thing_elmt_buf;            /* Pointer to the element buffer for the array metadata */
     hsize_t thing_elmt_idx;             /* Index of the element in the element buffer for the array metadata */
+    size_t thing_nelmts;                /* Number of elements in the element buffer for the array metadata */
     H5EA__unprotect_func_t thing_unprot_func;   /* Function pointer for unprotecting the array metadata */
     hbool_t will_extend;                /* Flag indicating if setting the element will extend the array */
     unsigned thing_cache_flags = H5AC__NO_FLAGS_SET;   /* Flags for unprotecting array metadata */
@@ -682,19 +693,34 @@ H5EA_set(const H5EA_t *ea, hsize_t idx, const void *elmt))
     /* Set the shared array header's file context for this operation */
     hdr->f = ea->f;
 
-    /* Look up the array metadata containing the element we want to set */
+    /* Check if the element is in the lookup view */
+    /* (Extending the array also requires a flush dependency on the header) */
     will_extend = (idx >= hdr->stats.stored.max_idx_set);
-    if(H5EA__lookup_elmt(ea, idx, will_extend, H5AC__NO_FLAGS_SET, &thing, &thing_elmt_buf, &thing_elmt_idx, &thing_unprot_func) < 0)
-        H5E_THROW(H5E_CANTPROTECT, "unable to protect array metadata")
+    if(idx >= hdr->lookup.start && (idx - hdr->lookup.start) < hdr->lookup.nelmts
+            && (!will_extend || hdr->lookup.hdr_depend)) {
+        /* Set element in the view's element buffer */
+        HDmemcpy(hdr->lookup.elmts + (hdr->cparam.cls->nat_elmt_size * (idx - hdr->lookup.start)), elmt, hdr->cparam.cls->nat_elmt_size);
+        if(H5AC_mark_entry_dirty(hdr->lookup.thing) < 0)
+            H5E_THROW(H5E_CANTMARKDIRTY, "unable to mark extensible array metadata as dirty")
+    } /* end if */
+    else {
+        /* Look up the array metadata containing the element we want to set */
+        if(H5EA__lookup_elmt(ea, idx, will_extend, H5AC__NO_FLAGS_SET, &thing, &thing_elmt_buf, &thing_elmt_idx, &thing_nelmts, &thing_unprot_func) < 0)
+            H5E_THROW(H5E_CANTPROTECT, "unable to protect array metadata")
 
-    /* Sanity check */
-    HDassert(thing);
-    HDassert(thing_elmt_buf);
-    HDassert(thing_unprot_func);
+        /* Sanity check */
+        HDassert(thing);
+        HDassert(thing_elmt_buf);
+        HDassert(thing_unprot_func);
 
-    /* Set element in thing's element buffer */
-    HDmemcpy(thing_elmt_buf + (hdr->cparam.cls->nat_elmt_size * thing_elmt_idx), elmt, hdr->cparam.cls->nat_elmt_size);
-    thing_cache_flags |= H5AC__DIRTIED_FLAG;
+        /* Set element in thing's element buffer */
+        HDmemcpy(thing_elmt_buf + (hdr->cparam.cls->nat_elmt_size * thing_elmt_idx), elmt, hdr->cparam.cls->nat_elmt_size);
+        thing_cache_flags |= H5AC__DIRTIED_FLAG;
+
+        /* Point the lookup view at the thing, for the following elements */
+        if(H5EA__hdr_lookup_set(hdr, thing, thing_elmt_buf, idx - thing_elmt_idx, thing_nelmts, will_extend) < 0)
+            H5E_THROW(H5E_CANTSET, "unable to set extensible array lookup view")
+    } /* end else */
 
     /* Update max. element set in array, if appropriate */
     if(will_extend) {
@@ -746,15 +772,19 @@ H5EA_get(const H5EA_t *ea, hsize_t idx, void *elmt))
         if((hdr->cparam.cls->fill)(elmt, (size_t)1) < 0)
             H5E_THROW(H5E_CANTSET, "can't set element to class's fill value")
     } /* end if */
+    else if(idx >= hdr->lookup.start && (idx - hdr->lookup.start) < hdr->lookup.nelmts)
+        /* Get element from the lookup view's element buffer */
+        HDmemcpy(elmt, hdr->lookup.elmts + (hdr->cparam.cls->nat_elmt_size * (idx - hdr->lookup.start)), hdr->cparam.cls->nat_elmt_size);
     else {
         uint8_t *thing_elmt_buf;        /* Pointer to the element buffer for the array metadata */
         hsize_t thing_elmt_idx;         /* Index of the element in the element buffer for the array metadata */
+        size_t thing_nelmts;            /* Number of elements in the element buffer for the array metadata */
 
         /* Set the shared array header's file context for this operation */
         hdr->f = ea->f;
 
         /* Look up the array metadata containing the element we want to set */
-        if(H5EA__lookup_elmt(ea, idx, FALSE, H5AC__READ_ONLY_FLAG, &thing, &thing_elmt_buf, &thing_elmt_idx, &thing_unprot_func) < 0)
+        if(H5EA__lookup_elmt(ea, idx, FALSE, H5AC__READ_ONLY_FLAG, &thing, &thing_elmt_buf, &thing_elmt_idx, &thing_nelmts, &thing_unprot_func) < 0)
             H5E_THROW(H5E_CANTPROTECT, "unable to protect array metadata")
 
         /* Check if the thing holding the element has been created yet */
@@ -763,9 +793,14 @@ H5EA_get(const H5EA_t *ea, hsize_t idx, void *elmt))
             if((hdr->cparam.cls->fill)(elmt, (size_t)1) < 0)
                 H5E_THROW(H5E_CANTSET, "can't set element to class's fill value")
         } /* end if */
-        else
+        else {
             /* Get element from thing's element buffer */
             HDmemcpy(elmt, thing_elmt_buf + (hdr->cparam.cls->nat_elmt_size * thing_elmt_idx), hdr->cparam.cls->nat_elmt_size);
+
+            /* Point the lookup view at the thing, for the following elements */
+            if(H5EA__hdr_lookup_set(hdr, thing, thing_elmt_buf, idx - thing_elmt_idx, thing_nelmts, FALSE) < 0)
+                H5E_THROW(H5E_CANTSET, "unable to set extensible array lookup view")
+        } /* end else */
     } /* end else */
 
 CATCH
@@ -862,6 +897,10 @@ H5EA_close(H5EA_t *ea))
 
             /* Shut down anything that can't be put in the header's 'flush' callback */
 
+            /* Release the lookup view */
+            if(H5EA__hdr_lookup_reset(ea->hdr) < 0)
+                H5E_THROW(H5E_CANTUNPIN, "unable to release extensible array lookup view")
+
             /* Check for pending array deletion */
             if(ea->hdr->pending_delete) {
                 /* Set local info, so array deletion can occur after decrementing the
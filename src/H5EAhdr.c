@@ -609,6 +609,82 @@ CATCH
 
 END_FUNC(PKG)   /* end H5EA__hdr_modified() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5EA__hdr_lookup_set
+ *
+ * Purpose:	Point the header's lookup view at the elements held in a
+ *              piece of array metadata, pinning it in the metadata cache
+ *              so that later lookups can index its buffer directly.  The
+ *              metadata must currently be protected.  HDR_DEPEND
+ *              records whether the metadata already has a flush
+ *              dependency on the header, so that appends may use the view.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+BEGIN_FUNC(PKG, ERR,
+herr_t, SUCCEED, FAIL,
+H5EA__hdr_lookup_set(H5EA_hdr_t *hdr, void *thing, uint8_t *elmts,
+    hsize_t start, size_t nelmts, hbool_t hdr_depend))
+
+    /* Sanity check */
+    HDassert(hdr);
+    HDassert(thing);
+    HDassert(elmts);
+    HDassert(nelmts > 0);
+
+    /* Pin the metadata, if the view is moving to another piece of it */
+    if(hdr->lookup.thing != thing) {
+        if(H5EA__hdr_lookup_reset(hdr) < 0)
+            H5E_THROW(H5E_CANTUNPIN, "unable to reset extensible array lookup view")
+        if(H5AC_pin_protected_entry(thing) < 0)
+            H5E_THROW(H5E_CANTPIN, "unable to pin extensible array metadata")
+        hdr->lookup.thing = thing;
+    } /* end if */
+
+    /* Set the view */
+    hdr->lookup.elmts = elmts;
+    hdr->lookup.start = start;
+    hdr->lookup.nelmts = nelmts;
+    if(hdr_depend)
+        hdr->lookup.hdr_depend = TRUE;
+
+CATCH
+
+END_FUNC(PKG)   /* end H5EA__hdr_lookup_set() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5EA__hdr_lookup_reset
+ *
+ * Purpose:	Release the header's lookup view, unpinning the array
+ *              metadata it refers to.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+BEGIN_FUNC(PKG, ERR,
+herr_t, SUCCEED, FAIL,
+H5EA__hdr_lookup_reset(H5EA_hdr_t *hdr))
+
+    /* Sanity check */
+    HDassert(hdr);
+
+    /* Unpin the metadata holding the elements */
+    if(hdr->lookup.thing)
+        if(H5AC_unpin_entry(hdr->lookup.thing) < 0)
+            H5E_THROW(H5E_CANTUNPIN, "unable to unpin extensible array metadata")
+
+    /* Reset the view */
+    HDmemset(&hdr->lookup, 0, sizeof(hdr->lookup));
+
+CATCH
+
+END_FUNC(PKG)   /* end H5EA__hdr_lookup_reset() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5EA__hdr_protect
@@ -776,6 +852,7 @@ H5EA__hdr_dest(H5EA_hdr_t *hdr))
     /* Check arguments */
     HDassert(hdr);
     HDassert(hdr->rc == 0);
+    HDassert(NULL == hdr->lookup.thing);
 
     /* Destroy the callback context */
     if(hdr->cb_ctx) {
@@ -202,6 +202,15 @@ typedef struct H5EA_hdr_t {
     /* Data block information (not stored) */
     size_t dblk_page_nelmts;            /* # of elements per data block page */
 
+    /* Lookup view of recently used elements (not stored) */
+    struct {
+        void *thing;                    /* Pinned array metadata holding the elements */
+        uint8_t *elmts;                 /* Element buffer of the pinned metadata */
+        hsize_t start;                  /* Array index of first element in buffer */
+        size_t nelmts;                  /* Number of elements in buffer */
+        hbool_t hdr_depend;             /* Whether the metadata depends on the header already */
+    } lookup;
+
     /* Client information (not stored) */
     void *cb_ctx;                       /* Callback context */
 
@@ -405,6 +414,9 @@ H5_DLL herr_t H5EA__hdr_decr(H5EA_hdr_t *hdr);
 H5_DLL herr_t H5EA__hdr_fuse_incr(H5EA_hdr_t *hdr);
 H5_DLL size_t H5EA__hdr_fuse_decr(H5EA_hdr_t *hdr);
 H5_DLL herr_t H5EA__hdr_modified(H5EA_hdr_t *hdr);
+H5_DLL herr_t H5EA__hdr_lookup_set(H5EA_hdr_t *hdr, void *thing,
+    uint8_t *elmts, hsize_t start, size_t nelmts, hbool_t hdr_depend);
+H5_DLL herr_t H5EA__hdr_lookup_reset(H5EA_hdr_t *hdr);
 H5_DLL H5EA_hdr_t *H5EA__hdr_protect(H5F_t *f, haddr_t ea_addr,
     void *ctx_udata, unsigned flags);
 H5_DLL herr_t H5EA__hdr_unprotect(H5EA_hdr_t *hdr, unsigned cache_flags);
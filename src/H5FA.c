@@ -364,6 +364,17 @@ H5FA_set(const H5FA_t *fa, hsize_t idx, const void *elmt))
 
     HDassert(idx < hdr->cparam.nelmts);
 
+    /* Check if the element is in the lookup view */
+    if(idx >= hdr->lookup.start && (idx - hdr->lookup.start) < hdr->lookup.nelmts) {
+        /* Set element in the view's element buffer */
+        HDmemcpy(hdr->lookup.elmts + (hdr->cparam.cls->nat_elmt_size * (idx - hdr->lookup.start)), elmt, hdr->cparam.cls->nat_elmt_size);
+        if(H5AC_mark_entry_dirty(hdr->lookup.thing) < 0)
+            H5E_THROW(H5E_CANTMARKDIRTY, "unable to mark fixed array metadata as dirty")
+
+        /* We've set the value, leave now */
+        H5_LEAVE(SUCCEED)
+    } /* end if */
+
     /* Protect data block */
     if(NULL == (dblock = H5FA__dblock_protect(hdr, hdr->dblk_addr, H5AC__NO_FLAGS_SET)))
         H5E_THROW(H5E_CANTPROTECT, "unable to protect fixed array data block, address = %llu", (unsigned long long)hdr->dblk_addr)
@@ -373,6 +384,10 @@ H5FA_set(const H5FA_t *fa, hsize_t idx, const void *elmt))
         /* Set element in data block */
         HDmemcpy(((uint8_t *)dblock->elmts) + (hdr->cparam.cls->nat_elmt_size * idx), elmt, hdr->cparam.cls->nat_elmt_size);
         dblock_cache_flags |= H5AC__DIRTIED_FLAG;
+
+        /* Point the lookup view at the data block, for the following elements */
+        if(H5FA__hdr_lookup_set(hdr, dblock, (uint8_t *)dblock->elmts, (hsize_t)0, (size_t)hdr->cparam.nelmts) < 0)
+            H5E_THROW(H5E_CANTSET, "unable to set fixed array lookup view")
     } /* end if */
     else { /* paging */
         size_t  page_idx;      		/* Index of page within data block */
@@ -412,6 +427,10 @@ H5FA_set(const H5FA_t *fa, hsize_t idx, const void *elmt))
         /* Set the element in the data block page */
         HDmemcpy(((uint8_t *)dblk_page->elmts) + (hdr->cparam.cls->nat_elmt_size * elmt_idx), elmt, hdr->cparam.cls->nat_elmt_size);
         dblk_page_cache_flags |= H5AC__DIRTIED_FLAG;
+
+        /* Point the lookup view at the data block page, for the following elements */
+        if(H5FA__hdr_lookup_set(hdr, dblk_page, (uint8_t *)dblk_page->elmts, idx - elmt_idx, dblk_page_nelmts) < 0)
+            H5E_THROW(H5E_CANTSET, "unable to set fixed array lookup view")
     } /* end else */
 
 CATCH
@@ -465,6 +484,9 @@ H5FA_get(const H5FA_t *fa, hsize_t idx, void *elmt))
         if((hdr->cparam.cls->fill)(elmt, (size_t)1) < 0)
             H5E_THROW(H5E_CANTSET, "can't set element to class's fill value")
     } /* end if */
+    else if(idx >= hdr->lookup.start && (idx - hdr->lookup.start) < hdr->lookup.nelmts)
+        /* Get element from the lookup view's element buffer */
+        HDmemcpy(elmt, hdr->lookup.elmts + (hdr->cparam.cls->nat_elmt_size * (idx - hdr->lookup.start)), hdr->cparam.cls->nat_elmt_size);
     else {
         /* Get the data block */
         HDassert(H5F_addr_defined(hdr->dblk_addr));
@@ -472,9 +494,14 @@ H5FA_get(const H5FA_t *fa, hsize_t idx, void *elmt))
             H5E_THROW(H5E_CANTPROTECT, "unable to protect fixed array data block, address = %llu", (unsigned long long)hdr->dblk_addr)
 
         /* Check for paged data block */
-        if(!dblock->npages)
+        if(!dblock->npages) {
             /* Retrieve element from data block */
             HDmemcpy(elmt, ((uint8_t *)dblock->elmts) + (hdr->cparam.cls->nat_elmt_size * idx), hdr->cparam.cls->nat_elmt_size);
+
+            /* Point the lookup view at the data block, for the following elements */
+            if(H5FA__hdr_lookup_set(hdr, dblock, (uint8_t *)dblock->elmts, (hsize_t)0, (size_t)hdr->cparam.nelmts) < 0)
+                H5E_THROW(H5E_CANTSET, "unable to set fixed array lookup view")
+        } /* end if */
         else { /* paging */
             size_t  page_idx;           /* Index of page within data block */
 
@@ -513,6 +540,10 @@ H5FA_get(const H5FA_t *fa, hsize_t idx, void *elmt))
 
                 /* Retrieve element from data block */
                 HDmemcpy(elmt, ((uint8_t *)dblk_page->elmts) + (hdr->cparam.cls->nat_elmt_size * elmt_idx), hdr->cparam.cls->nat_elmt_size);
+
+                /* Point the lookup view at the data block page, for the following elements */
+                if(H5FA__hdr_lookup_set(hdr, dblk_page, (uint8_t *)dblk_page->elmts, idx - elmt_idx, dblk_page_nelmts) < 0)
+                    H5E_THROW(H5E_CANTSET, "unable to set fixed array lookup view")
             } /* end else */
         } /* end else */
     } /* end else */
@@ -560,6 +591,10 @@ H5FA_close(H5FA_t *fa))
 
             /* Shut down anything that can't be put in the header's 'flush' callback */
 
+            /* Release the lookup view */
+            if(H5FA__hdr_lookup_reset(fa->hdr) < 0)
+                H5E_THROW(H5E_CANTUNPIN, "unable to release fixed array lookup view")
+
             /* Check for pending array deletion */
             if(fa->hdr->pending_delete) {
                 /* Set local info, so array deletion can occur after decrementing the
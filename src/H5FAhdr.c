@@ -404,6 +404,78 @@ CATCH
 
 END_FUNC(PKG)   /* end H5FA__hdr_modified() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FA__hdr_lookup_set
+ *
+ * Purpose:     Point the header's lookup view at the elements held in a
+ *              piece of array metadata, pinning it in the metadata cache
+ *              so that later lookups can index its buffer directly.  The
+ *              metadata must currently be protected.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+BEGIN_FUNC(PKG, ERR,
+herr_t, SUCCEED, FAIL,
+H5FA__hdr_lookup_set(H5FA_hdr_t *hdr, void *thing, uint8_t *elmts,
+    hsize_t start, size_t nelmts))
+
+    /* Sanity check */
+    HDassert(hdr);
+    HDassert(thing);
+    HDassert(elmts);
+    HDassert(nelmts > 0);
+
+    /* Pin the metadata, if the view is moving to another piece of it */
+    if(hdr->lookup.thing != thing) {
+        if(H5FA__hdr_lookup_reset(hdr) < 0)
+            H5E_THROW(H5E_CANTUNPIN, "unable to reset fixed array lookup view")
+        if(H5AC_pin_protected_entry(thing) < 0)
+            H5E_THROW(H5E_CANTPIN, "unable to pin fixed array metadata")
+        hdr->lookup.thing = thing;
+    } /* end if */
+
+    /* Set the view */
+    hdr->lookup.elmts = elmts;
+    hdr->lookup.start = start;
+    hdr->lookup.nelmts = nelmts;
+
+CATCH
+
+END_FUNC(PKG)   /* end H5FA__hdr_lookup_set() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FA__hdr_lookup_reset
+ *
+ * Purpose:     Release the header's lookup view, unpinning the array
+ *              metadata it refers to.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+BEGIN_FUNC(PKG, ERR,
+herr_t, SUCCEED, FAIL,
+H5FA__hdr_lookup_reset(H5FA_hdr_t *hdr))
+
+    /* Sanity check */
+    HDassert(hdr);
+
+    /* Unpin the metadata holding the elements */
+    if(hdr->lookup.thing)
+        if(H5AC_unpin_entry(hdr->lookup.thing) < 0)
+            H5E_THROW(H5E_CANTUNPIN, "unable to unpin fixed array metadata")
+
+    /* Reset the view */
+    HDmemset(&hdr->lookup, 0, sizeof(hdr->lookup));
+
+CATCH
+
+END_FUNC(PKG)   /* end H5FA__hdr_lookup_reset() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FA__hdr_protect
@@ -568,6 +640,7 @@ H5FA__hdr_dest(H5FA_hdr_t *hdr))
     /* Check arguments */
     HDassert(hdr);
     HDassert(hdr->rc == 0);
+    HDassert(NULL == hdr->lookup.thing);
 
     /* Destroy the callback context */
     if(hdr->cb_ctx) {
@@ -140,6 +140,14 @@ typedef struct H5FA_hdr_t {
     size_t sizeof_addr;                 /* Size of file addresses                                       */
     size_t sizeof_size;                 /* Size of file sizes                                           */
 
+    /* Lookup view of recently used elements (not stored) */
+    struct {
+        void *thing;                    /* Pinned data block or page holding the elements */
+        uint8_t *elmts;                 /* Element buffer of the pinned metadata */
+        hsize_t start;                  /* Array index of first element in buffer */
+        size_t nelmts;                  /* Number of elements in buffer */
+    } lookup;
+
     /* Client information (not stored) */
     void *cb_ctx;                       /* Callback context */
 
@@ -275,6 +283,9 @@ H5_DLL herr_t H5FA__hdr_decr(H5FA_hdr_t *hdr);
 H5_DLL herr_t H5FA__hdr_fuse_incr(H5FA_hdr_t *hdr);
 H5_DLL size_t H5FA__hdr_fuse_decr(H5FA_hdr_t *hdr);
 H5_DLL herr_t H5FA__hdr_modified(H5FA_hdr_t *hdr);
+H5_DLL herr_t H5FA__hdr_lookup_set(H5FA_hdr_t *hdr, void *thing,
+    uint8_t *elmts, hsize_t start, size_t nelmts);
+H5_DLL herr_t H5FA__hdr_lookup_reset(H5FA_hdr_t *hdr);
 H5_DLL H5FA_hdr_t *H5FA__hdr_protect(H5F_t *f, haddr_t fa_addr, void *ctx_udata, unsigned flags);
 H5_DLL herr_t H5FA__hdr_unprotect(H5FA_hdr_t *hdr, unsigned cache_flags);
 H5_DLL herr_t H5FA__hdr_delete(H5FA_hdr_t *hdr);
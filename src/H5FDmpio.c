@@ -669,6 +669,45 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_dxpl_mpio_chunk_opt_ratio() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_dxpl_mpio_node_agg
+ *
+ * Purpose:	To set whether collective writes are aggregated on each node
+ *
+ * Note:	When set, the processes on each node send the data they write
+ *		collectively to one process on that node, which merges it
+ *		into larger blocks and writes it for them.  All processes
+ *		must use the same setting.
+ *
+ * Return:	Success:	Non-negative
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_dxpl_mpio_node_agg(hid_t dxpl_id, hbool_t node_agg)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", dxpl_id, node_agg);
+
+    /* Check arguments */
+    if(dxpl_id == H5P_DEFAULT)
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list")
+    if(NULL == (plist = H5P_object_verify(dxpl_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADTYPE, FAIL, "not a dxpl")
+
+    /* Set the node aggregation flag */
+    if(H5P_set(plist, H5D_XFER_MPIO_NODE_AGG_NAME, &node_agg) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_dxpl_mpio_node_agg() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FD__mpio_fapl_get
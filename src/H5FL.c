@@ -130,17 +130,17 @@ static H5FL_track_t *H5FL_out_head_g = NULL;
 #endif /* H5FL_TRACK */
 
 /* Forward declarations of local static functions */
-static herr_t H5FL__reg_gc(void);
-static herr_t H5FL__reg_gc_list(H5FL_reg_head_t *head);
+static herr_t H5FL__reg_gc(hbool_t trim);
+static herr_t H5FL__reg_gc_list(H5FL_reg_head_t *head, hbool_t trim);
 static int H5FL__reg_term(void);
-static herr_t H5FL__arr_gc(void);
-static herr_t H5FL__arr_gc_list(H5FL_arr_head_t *head);
+static herr_t H5FL__arr_gc(hbool_t trim);
+static herr_t H5FL__arr_gc_list(H5FL_arr_head_t *head, hbool_t trim);
 static int H5FL__arr_term(void);
-static herr_t H5FL__blk_gc(void);
-static herr_t H5FL__blk_gc_list(H5FL_blk_head_t *head);
+static herr_t H5FL__blk_gc(hbool_t trim);
+static herr_t H5FL__blk_gc_list(H5FL_blk_head_t *head, hbool_t trim);
 static int H5FL__blk_term(void);
-static herr_t H5FL__fac_gc(void);
-static herr_t H5FL__fac_gc_list(H5FL_fac_head_t *head);
+static herr_t H5FL__fac_gc(hbool_t trim);
+static herr_t H5FL__fac_gc_list(H5FL_fac_head_t *head, hbool_t trim);
 static int H5FL__fac_term_all(void);
 
 /* Declare a free list to manage the H5FL_blk_node_t struct */
@@ -379,12 +379,12 @@ H5FL_reg_free(H5FL_reg_head_t *head, void *obj)
     /* Check for exceeding free list memory use limits */
     /* First check this particular list */
     if(head->onlist * head->size > H5FL_reg_lst_mem_lim)
-        if(H5FL__reg_gc_list(head) < 0)
+        if(H5FL__reg_gc_list(head, TRUE) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
 
     /* Then check the global amount memory on regular free lists */
     if(H5FL_reg_gc_head.mem_freed>H5FL_reg_glb_mem_lim)
-        if(H5FL__reg_gc() < 0)
+        if(H5FL__reg_gc(TRUE) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
 
 done:
@@ -510,7 +510,9 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5FL__reg_gc_list
  *
- * Purpose:	Garbage collect on a particular object free list
+ * Purpose:	Garbage collect on a particular object free list.  If TRIM
+ *      is set, only the older half of the free blocks are released, keeping
+ *      the rest for reuse.
  *
  * Return:	Success:	Non-negative
  * 		Failure:	Negative
@@ -521,18 +523,28 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FL__reg_gc_list(H5FL_reg_head_t *head)
+H5FL__reg_gc_list(H5FL_reg_head_t *head, hbool_t trim)
 {
+    H5FL_reg_node_t **last;     /* Pointer to the link to the first node released */
     H5FL_reg_node_t *free_list; /* Pointer to nodes in free list being garbage collected */
-    size_t total_mem;   /* Total memory used on list */
+    unsigned nkeep;     /* Number of nodes to keep on the list */
+    unsigned u;         /* Local index variable */
+    size_t total_mem;   /* Total memory released from list */
 
     FUNC_ENTER_STATIC_NOERR
 
-    /* Calculate the total memory used on this list */
-    total_mem = head->onlist * head->size;
+    /* Keep the most recently freed half of the nodes, if trimming the list */
+    nkeep = trim ? head->onlist / 2 : 0;
+    last = &head->list;
+    for(u = 0; u < nkeep; u++)
+        last = &(*last)->next;
+
+    /* Calculate the total memory released from this list */
+    total_mem = (head->onlist - nkeep) * head->size;
 
     /* For each free list being garbage collected, walk through the nodes and free them */
-    free_list = head->list;
+    free_list = *last;
+    *last = NULL;
     while(free_list != NULL) {
         void *tmp;          /* Temporary node pointer */
 
@@ -546,9 +558,8 @@ H5FL__reg_gc_list(H5FL_reg_head_t *head)
         free_list = (H5FL_reg_node_t *)tmp;
     } /* end while */
 
-    /* Indicate no free nodes on the free list */
-    head->list = NULL;
-    head->onlist = 0;
+    /* Update the number of free nodes on the free list */
+    head->onlist = nkeep;
 
     /* Decrement global count of free memory on "regular" lists */
     H5FL_reg_gc_head.mem_freed -= total_mem;
@@ -560,7 +571,8 @@ H5FL__reg_gc_list(H5FL_reg_head_t *head)
 /*-------------------------------------------------------------------------
  * Function:	H5FL__reg_gc
  *
- * Purpose:	Garbage collect on all the object free lists
+ * Purpose:	Garbage collect on all the object free lists.  If TRIM is set, only
+ *      the older half of the free blocks on each list are released.
  *
  * Return:	Success:	Non-negative
  * 		Failure:	Negative
@@ -575,7 +587,7 @@ H5FL__reg_gc_list(H5FL_reg_head_t *head)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FL__reg_gc(void)
+H5FL__reg_gc(hbool_t trim)
 {
     H5FL_reg_gc_node_t *gc_node;    /* Pointer into the list of things to garbage collect */
     herr_t ret_value = SUCCEED;   /* return value*/
@@ -586,7 +598,7 @@ H5FL__reg_gc(void)
     gc_node = H5FL_reg_gc_head.first;
     while(gc_node != NULL) {
         /* Release the free nodes on the list */
-        if(H5FL__reg_gc_list(gc_node->list) < 0)
+        if(H5FL__reg_gc_list(gc_node->list, trim) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection of list failed")
 
         /* Go on to the next free list to garbage collect */
@@ -594,7 +606,7 @@ H5FL__reg_gc(void)
     } /* end while */
 
     /* Double check that all the memory on the free lists is recycled */
-    HDassert(H5FL_reg_gc_head.mem_freed == 0);
+    HDassert(trim || H5FL_reg_gc_head.mem_freed == 0);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1087,12 +1099,12 @@ H5FL_blk_free(H5FL_blk_head_t *head, void *block)
     /* Check for exceeding free list memory use limits */
     /* First check this particular list */
     if(head->list_mem > H5FL_blk_lst_mem_lim)
-        if(H5FL__blk_gc_list(head) < 0)
+        if(H5FL__blk_gc_list(head, TRUE) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
 
     /* Then check the global amount memory on block free lists */
     if(H5FL_blk_gc_head.mem_freed > H5FL_blk_glb_mem_lim)
-        if(H5FL__blk_gc() < 0)
+        if(H5FL__blk_gc(TRUE) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
 
 done:
@@ -1178,7 +1190,9 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5FL__blk_gc_list
  *
- * Purpose:	Garbage collect a priority queue
+ * Purpose:	Garbage collect a priority queue.  If TRIM is set, only the
+ *      older half of the free blocks of each size are released, keeping the
+ *      rest for reuse.
  *
  * Return:	Success:	Non-negative
  * 		Failure:	Negative
@@ -1189,19 +1203,36 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FL__blk_gc_list(H5FL_blk_head_t *head)
+H5FL__blk_gc_list(H5FL_blk_head_t *head, hbool_t trim)
 {
+    H5FL_blk_node_t *blk_head;  /* The free list node for blocks of a particular size */
+
     FUNC_ENTER_STATIC_NOERR
 
     /* Loop through all the nodes in the block free list queue */
-    while(head->head != NULL) {
+    blk_head = head->head;
+    while(blk_head != NULL) {
+        H5FL_blk_list_t **last; /* Pointer to the link to the first block released */
         H5FL_blk_list_t *list; /* The free list of native nodes of a particular size */
-        void *temp;     /* Temp. ptr to the free list page node */
+        H5FL_blk_node_t *temp;  /* Temp. ptr to the next free list node */
+
+        temp = blk_head->next;
 
-        temp = head->head->next;
+        /* Keep the most recently freed half of the blocks, if trimming the list */
+        last = &blk_head->list;
+        if(trim) {
+            H5FL_blk_list_t *fast;  /* Pointer advancing twice as fast as LAST */
+
+            fast = blk_head->list;
+            while(fast != NULL && fast->next != NULL) {
+                last = &(*last)->next;
+                fast = fast->next->next;
+            } /* end while */
+        } /* end if */
 
-        /* Loop through all the blocks in the free list, freeing them */
-        list = head->head->list;
+        /* Loop through the rest of the blocks in the free list, freeing them */
+        list = *last;
+        *last = NULL;
         while(list != NULL) {
             void *next;     /* Temp. ptr to the free list list node */
 
@@ -1209,10 +1240,11 @@ H5FL__blk_gc_list(H5FL_blk_head_t *head)
 
             /* Decrement the number of blocks & memory allocated from this PQ */
             head->allocated--;
-            head->list_mem -= head->head->size;
+            head->onlist--;
+            head->list_mem -= blk_head->size;
 
             /* Decrement global count of free memory on "block" lists */
-            H5FL_blk_gc_head.mem_freed -= head->head->size;
+            H5FL_blk_gc_head.mem_freed -= blk_head->size;
 
             /* Free the block */
             H5MM_free(list);
@@ -1220,19 +1252,19 @@ H5FL__blk_gc_list(H5FL_blk_head_t *head)
             list = (H5FL_blk_list_t *)next;
         } /* end while */
 
-        /* Free the free list node */
-        head->head = H5FL_FREE(H5FL_blk_node_t, head->head);
+        /* Free the free list node, unless it still has blocks */
+        if(!trim) {
+            HDassert(blk_head == head->head);
+            head->head = H5FL_FREE(H5FL_blk_node_t, blk_head);
+            head->head = temp;
+        } /* end if */
 
         /* Advance to the next free list */
-        head->head = (H5FL_blk_node_t *)temp;
+        blk_head = temp;
     } /* end while */
 
-    /* Indicate no free nodes on the free list */
-    head->head = NULL;
-    head->onlist = 0;
-
     /* Double check that all the memory on this list is recycled */
-    HDassert(0 == head->list_mem);
+    HDassert(trim || (NULL == head->head && 0 == head->onlist && 0 == head->list_mem));
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 }   /* end H5FL__blk_gc_list() */
@@ -1241,7 +1273,8 @@ H5FL__blk_gc_list(H5FL_blk_head_t *head)
 /*-------------------------------------------------------------------------
  * Function:	H5FL__blk_gc
  *
- * Purpose:	Garbage collect on all the priority queues
+ * Purpose:	Garbage collect on all the priority queues.  If TRIM is set, only
+ *      the older half of the free blocks on each list are released.
  *
  * Return:	Success:	Non-negative
  * 		Failure:	Negative
@@ -1252,7 +1285,7 @@ H5FL__blk_gc_list(H5FL_blk_head_t *head)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FL__blk_gc(void)
+H5FL__blk_gc(hbool_t trim)
 {
     H5FL_blk_gc_node_t *gc_node;    /* Pointer into the list of things to garbage collect */
     herr_t ret_value = SUCCEED;   /* return value*/
@@ -1263,7 +1296,7 @@ H5FL__blk_gc(void)
     gc_node = H5FL_blk_gc_head.first;
     while(gc_node != NULL) {
         /* For each free list being garbage collected, walk through the nodes and free them */
-        if(H5FL__blk_gc_list(gc_node->pq) < 0)
+        if(H5FL__blk_gc_list(gc_node->pq, trim) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection of list failed")
 
         /* Go on to the next free list to garbage collect */
@@ -1271,7 +1304,7 @@ H5FL__blk_gc(void)
     } /* end while */
 
     /* Double check that all the memory on the free lists are recycled */
-    HDassert(H5FL_blk_gc_head.mem_freed == 0);
+    HDassert(trim || H5FL_blk_gc_head.mem_freed == 0);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1457,12 +1490,12 @@ H5FL_arr_free(H5FL_arr_head_t *head, void *obj)
     /* Check for exceeding free list memory use limits */
     /* First check this particular list */
     if(head->list_mem > H5FL_arr_lst_mem_lim)
-        if(H5FL__arr_gc_list(head) < 0)
+        if(H5FL__arr_gc_list(head, TRUE) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
 
     /* Then check the global amount memory on array free lists */
     if(H5FL_arr_gc_head.mem_freed > H5FL_arr_glb_mem_lim)
-        if(H5FL__arr_gc() < 0)
+        if(H5FL__arr_gc(TRUE) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
 
 done:
@@ -1646,7 +1679,9 @@ H5FL_arr_realloc(H5FL_arr_head_t *head, void * obj, size_t new_elem)
 /*-------------------------------------------------------------------------
  * Function:	H5FL__arr_gc_list
  *
- * Purpose:	Garbage collect on an array object free list
+ * Purpose:	Garbage collect on an array object free list.  If TRIM is
+ *      set, only the older half of the free blocks of each size are
+ *      released, keeping the rest for reuse.
  *
  * Return:	Success:	Non-negative
  * 		Failure:	Negative
@@ -1657,7 +1692,7 @@ H5FL_arr_realloc(H5FL_arr_head_t *head, void * obj, size_t new_elem)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FL__arr_gc_list(H5FL_arr_head_t *head)
+H5FL__arr_gc_list(H5FL_arr_head_t *head, hbool_t trim)
 {
     unsigned u;     /* Counter for array of free lists */
 
@@ -1666,14 +1701,24 @@ H5FL__arr_gc_list(H5FL_arr_head_t *head)
     /* Walk through the array of free lists */
     for(u = 0; u < (unsigned)head->maxelem; u++) {
         if(head->list_arr[u].onlist > 0) {
+            H5FL_arr_list_t **last;         /* Pointer to the link to the first node released */
             H5FL_arr_list_t *arr_free_list; /* Pointer to nodes in free list being garbage collected */
-            size_t total_mem;   /* Total memory used on list */
+            unsigned nkeep;     /* Number of nodes to keep on the list */
+            unsigned v;         /* Local index variable */
+            size_t total_mem;   /* Total memory released from list */
 
-            /* Calculate the total memory used on this list */
-            total_mem = head->list_arr[u].onlist * head->list_arr[u].size;
+            /* Keep the most recently freed half of the nodes, if trimming the list */
+            nkeep = trim ? head->list_arr[u].onlist / 2 : 0;
+            last = &head->list_arr[u].list;
+            for(v = 0; v < nkeep; v++)
+                last = &(*last)->next;
+
+            /* Calculate the total memory released from this list */
+            total_mem = (head->list_arr[u].onlist - nkeep) * head->list_arr[u].size;
 
             /* For each free list being garbage collected, walk through the nodes and free them */
-            arr_free_list = head->list_arr[u].list;
+            arr_free_list = *last;
+            *last = NULL;
             while(arr_free_list != NULL) {
                 void *tmp;      /* Temporary node pointer */
 
@@ -1686,9 +1731,8 @@ H5FL__arr_gc_list(H5FL_arr_head_t *head)
                 arr_free_list = (H5FL_arr_list_t *)tmp;
             } /* end while */
 
-            /* Indicate no free nodes on the free list */
-            head->list_arr[u].list = NULL;
-            head->list_arr[u].onlist = 0;
+            /* Update the number of free nodes on the free list */
+            head->list_arr[u].onlist = nkeep;
 
             /* Decrement count of free memory on this "array" list */
             head->list_mem -= total_mem;
@@ -1699,7 +1743,7 @@ H5FL__arr_gc_list(H5FL_arr_head_t *head)
     } /* end for */
 
     /* Double check that all the memory on this list is recycled */
-    HDassert(head->list_mem == 0);
+    HDassert(trim || head->list_mem == 0);
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 }   /* end H5FL__arr_gc_list() */
@@ -1708,7 +1752,8 @@ H5FL__arr_gc_list(H5FL_arr_head_t *head)
 /*-------------------------------------------------------------------------
  * Function:	H5FL__arr_gc
  *
- * Purpose:	Garbage collect on all the array object free lists
+ * Purpose:	Garbage collect on all the array object free lists.  If TRIM is set, only
+ *      the older half of the free blocks on each list are released.
  *
  * Return:	Success:	Non-negative
  * 		Failure:	Negative
@@ -1719,7 +1764,7 @@ H5FL__arr_gc_list(H5FL_arr_head_t *head)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FL__arr_gc(void)
+H5FL__arr_gc(hbool_t trim)
 {
     H5FL_gc_arr_node_t *gc_arr_node;    /* Pointer into the list of things to garbage collect */
     herr_t ret_value = SUCCEED;   /* return value*/
@@ -1730,7 +1775,7 @@ H5FL__arr_gc(void)
     gc_arr_node = H5FL_arr_gc_head.first;
     while(gc_arr_node != NULL) {
         /* Release the free nodes on the list */
-        if(H5FL__arr_gc_list(gc_arr_node->list) < 0)
+        if(H5FL__arr_gc_list(gc_arr_node->list, trim) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection of list failed")
 
         /* Go on to the next free list to garbage collect */
@@ -1738,7 +1783,7 @@ H5FL__arr_gc(void)
     } /* end while */
 
     /* Double check that all the memory on the free lists are recycled */
-    HDassert(H5FL_arr_gc_head.mem_freed == 0);
+    HDassert(trim || H5FL_arr_gc_head.mem_freed == 0);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2096,12 +2141,12 @@ H5FL_fac_free(H5FL_fac_head_t *head, void *obj)
     /* Check for exceeding free list memory use limits */
     /* First check this particular list */
     if(head->onlist * head->size > H5FL_fac_lst_mem_lim)
-        if(H5FL__fac_gc_list(head) < 0)
+        if(H5FL__fac_gc_list(head, TRUE) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
 
     /* Then check the global amount memory on factory free lists */
     if(H5FL_fac_gc_head.mem_freed > H5FL_fac_glb_mem_lim)
-        if(H5FL__fac_gc() < 0)
+        if(H5FL__fac_gc(TRUE) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
 
 done:
@@ -2231,7 +2276,9 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5FL__fac_gc_list
  *
- * Purpose:	Garbage collect on a particular factory free list
+ * Purpose:	Garbage collect on a particular factory free list.  If TRIM
+ *      is set, only the older half of the free blocks are released, keeping
+ *      the rest for reuse.
  *
  * Return:	Success:	Non-negative
  * 		Failure:	Negative
@@ -2242,18 +2289,28 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FL__fac_gc_list(H5FL_fac_head_t *head)
+H5FL__fac_gc_list(H5FL_fac_head_t *head, hbool_t trim)
 {
+    H5FL_fac_node_t **last;     /* Pointer to the link to the first node released */
     H5FL_fac_node_t *free_list; /* Pointer to nodes in free list being garbage collected */
-    size_t total_mem;   /* Total memory used on list */
+    unsigned nkeep;     /* Number of nodes to keep on the list */
+    unsigned u;         /* Local index variable */
+    size_t total_mem;   /* Total memory released from list */
 
     FUNC_ENTER_STATIC_NOERR
 
-    /* Calculate the total memory used on this list */
-    total_mem = head->onlist * head->size;
+    /* Keep the most recently freed half of the nodes, if trimming the list */
+    nkeep = trim ? head->onlist / 2 : 0;
+    last = &head->list;
+    for(u = 0; u < nkeep; u++)
+        last = &(*last)->next;
+
+    /* Calculate the total memory released from this list */
+    total_mem = (head->onlist - nkeep) * head->size;
 
     /* For each free list being garbage collected, walk through the nodes and free them */
-    free_list = head->list;
+    free_list = *last;
+    *last = NULL;
     while(free_list != NULL) {
         void *tmp;          /* Temporary node pointer */
 
@@ -2267,9 +2324,8 @@ H5FL__fac_gc_list(H5FL_fac_head_t *head)
         free_list = (H5FL_fac_node_t *)tmp;
     } /* end while */
 
-    /* Indicate no free nodes on the free list */
-    head->list = NULL;
-    head->onlist = 0;
+    /* Update the number of free nodes on the free list */
+    head->onlist = nkeep;
 
     /* Decrement global count of free memory on "factory" lists */
     H5FL_fac_gc_head.mem_freed -= total_mem;
@@ -2281,7 +2337,8 @@ H5FL__fac_gc_list(H5FL_fac_head_t *head)
 /*-------------------------------------------------------------------------
  * Function:	H5FL__fac_gc
  *
- * Purpose:	Garbage collect on all the factory free lists
+ * Purpose:	Garbage collect on all the factory free lists.  If TRIM is set, only
+ *      the older half of the free blocks on each list are released.
  *
  * Return:	Success:	Non-negative
  * 		Failure:	Negative
@@ -2292,7 +2349,7 @@ H5FL__fac_gc_list(H5FL_fac_head_t *head)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FL__fac_gc(void)
+H5FL__fac_gc(hbool_t trim)
 {
     H5FL_fac_gc_node_t *gc_node;    /* Pointer into the list of things to garbage collect */
     herr_t ret_value = SUCCEED;   /* return value*/
@@ -2303,7 +2360,7 @@ H5FL__fac_gc(void)
     gc_node = H5FL_fac_gc_head.first;
     while(gc_node != NULL) {
         /* Release the free nodes on the list */
-        if(H5FL__fac_gc_list(gc_node->list) < 0)
+        if(H5FL__fac_gc_list(gc_node->list, trim) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection of list failed")
 
         /* Go on to the next free list to garbage collect */
@@ -2311,7 +2368,7 @@ H5FL__fac_gc(void)
     } /* end while */
 
     /* Double check that all the memory on the free lists is recycled */
-    HDassert(H5FL_fac_gc_head.mem_freed == 0);
+    HDassert(trim || H5FL_fac_gc_head.mem_freed == 0);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2349,7 +2406,7 @@ H5FL_fac_term(H5FL_fac_head_t *factory)
     HDassert(factory);
 
     /* Garbage collect all the blocks in the factory's free list */
-    if(H5FL__fac_gc_list(factory) < 0)
+    if(H5FL__fac_gc_list(factory, FALSE) < 0)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection of factory failed")
 
     /* Verify that all the blocks have been freed */
@@ -2450,19 +2507,19 @@ H5FL_garbage_coll(void)
     FUNC_ENTER_NOAPI(FAIL)
 
     /* Garbage collect the free lists for array objects */
-    if(H5FL__arr_gc() < 0)
+    if(H5FL__arr_gc(FALSE) < 0)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "can't garbage collect array objects")
 
     /* Garbage collect free lists for blocks */
-    if(H5FL__blk_gc() < 0)
+    if(H5FL__blk_gc(FALSE) < 0)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "can't garbage collect block objects")
 
     /* Garbage collect the free lists for regular objects */
-    if(H5FL__reg_gc() < 0)
+    if(H5FL__reg_gc(FALSE) < 0)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "can't garbage collect regular objects")
 
     /* Garbage collect the free lists for factory objects */
-    if(H5FL__fac_gc() < 0)
+    if(H5FL__fac_gc(FALSE) < 0)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "can't garbage collect factory objects")
 
 done:
@@ -926,6 +926,9 @@ H5F__new(H5F_file_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5FD_
         f->shared->sohm_vers = HDF5_SHAREDHEADER_VERSION;
         f->shared->accum.loc = HADDR_UNDEF;
         f->shared->lf = lf;
+#ifdef H5_HAVE_PARALLEL
+        f->shared->node_comm = MPI_COMM_NULL;
+#endif /* H5_HAVE_PARALLEL */
 
         /* Initialization for handling file space */
         for(u = 0; u < NELMTS(f->shared->fs_addr); u++) {
@@ -1341,6 +1344,16 @@ H5F__dest(H5F_t *f, hbool_t flush)
             f->shared->root_grp = NULL;
         } /* end if */
 
+        /* Release the cache of resolved paths */
+        if(H5G_path_cache_clear(f) < 0)
+            /* Push error, but keep going*/
+            HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
+
+        /* Release the link name filters */
+        if(H5G_name_filter_clear(f) < 0)
+            /* Push error, but keep going*/
+            HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
+
         /* Destroy other components of the file */
         if(H5F__accum_reset(f, TRUE) < 0)
             /* Push error, but keep going*/
@@ -1380,6 +1393,17 @@ H5F__dest(H5F_t *f, hbool_t flush)
                 /* Push error, but keep going*/
                 HDONE_ERROR(H5E_FILE, H5E_CANTDEC, FAIL, "can't close VOL connector ID")
 
+#ifdef H5_HAVE_PARALLEL
+        /* Free the node communicator */
+        if(MPI_COMM_NULL != f->shared->node_comm) {
+            int mpi_code;                   /* MPI return code */
+
+            if(MPI_SUCCESS != (mpi_code = MPI_Comm_free(&f->shared->node_comm)))
+                /* Push error, but keep going*/
+                HMPI_DONE_ERROR(FAIL, "MPI_Comm_free failed", mpi_code)
+        } /* end if */
+#endif /* H5_HAVE_PARALLEL */
+
         /* Close the file */
         if(H5FD_close(f->shared->lf) < 0)
             /* Push error, but keep going*/
@@ -3741,3 +3765,60 @@ H5F_set_min_dset_ohdr(H5F_t *f, hbool_t minimize)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5F_set_min_dset_ohdr() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_attr_cache_reserve
+ *
+ * Purpose:     Reserve memory for an object header's cache of decoded
+ *              attributes, from the file's budget for those caches.
+ *
+ *              The caches live outside the metadata cache, so their
+ *              memory isn't limited by its size; this budget bounds it
+ *              instead.
+ *
+ * Return:      TRUE if the memory was reserved, FALSE if it would go
+ *              over the budget
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F_attr_cache_reserve(H5F_file_t *shared, size_t size)
+{
+    hbool_t ret_value = FALSE;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(shared);
+
+    if(size <= H5F_ATTR_CACHE_MAX_SIZE - shared->attr_cache_size) {
+        shared->attr_cache_size += size;
+        ret_value = TRUE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5F_attr_cache_reserve() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_attr_cache_unreserve
+ *
+ * Purpose:     Return memory reserved by H5F_attr_cache_reserve to the
+ *              file's budget, when an attribute cache is freed.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+void
+H5F_attr_cache_unreserve(H5F_file_t *shared, size_t size)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(shared);
+    HDassert(shared->attr_cache_size >= size);
+
+    shared->attr_cache_size -= size;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5F_attr_cache_unreserve() */
+
@@ -78,6 +78,10 @@ H5F__close_mounts(H5F_t *f)
         }
     }
 
+    /* Paths in the file may have gone through the mount points */
+    if(H5G_path_cache_clear(f) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "can't empty path cache")
+
     HDassert(f->nmounts == 0);
 
 done:
@@ -193,6 +197,10 @@ H5F__mount(H5G_loc_t *loc, const char *name, H5F_t *child, hid_t H5_ATTR_UNUSED
     if(!cmp)
         HGOTO_ERROR(H5E_FILE, H5E_MOUNT, FAIL, "mount point is already in use")
 
+    /* Paths in the parent may go through the new mount point */
+    if(H5G_path_cache_clear(parent) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "can't empty path cache")
+
     /* Make room in the table */
     if(parent->shared->mtab.nmounts >= parent->shared->mtab.nalloc) {
         unsigned n = MAX(16, 2 * parent->shared->mtab.nalloc);
@@ -369,6 +377,10 @@ H5F__unmount(H5G_loc_t *loc, const char *name)
             mp_loc.path->full_path_r, root_loc.oloc->file, root_loc.path->full_path_r) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to replace name")
 
+    /* Paths in the parent may go through the mount point */
+    if(H5G_path_cache_clear(parent) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "can't empty path cache")
+
     /* Eliminate the mount point from the table */
     HDmemmove(parent->shared->mtab.child + (unsigned)child_idx, (parent->shared->mtab.child + (unsigned)child_idx) + 1,
             ((parent->shared->mtab.nmounts - (unsigned)child_idx) - 1) * sizeof(parent->shared->mtab.child[0]));
@@ -206,6 +206,53 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_mpi_get_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_mpi_get_node_comm
+ *
+ * Purpose:     Retrieves a communicator for the processes of the file's
+ *              communicator that are on the same node as this process,
+ *              creating it the first time it's needed.  This is collective
+ *              over the file's communicator the first time.
+ *
+ *              Without MPI-3, each process is treated as being on a node
+ *              by itself.
+ *
+ * Return:      Success:        The node communicator
+ *              Failure:        MPI_COMM_NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+MPI_Comm
+H5F_mpi_get_node_comm(const H5F_t *f)
+{
+    MPI_Comm	ret_value = MPI_COMM_NULL;
+
+    FUNC_ENTER_NOAPI(MPI_COMM_NULL)
+
+    HDassert(f && f->shared);
+
+    if(MPI_COMM_NULL == f->shared->node_comm) {
+        MPI_Comm file_comm;             /* File's communicator */
+        int mpi_code;                   /* MPI return code */
+
+        if(MPI_COMM_NULL == (file_comm = H5F_mpi_get_comm(f)))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, MPI_COMM_NULL, "can't get MPI communicator")
+#if MPI_VERSION >= 3
+        if(MPI_SUCCESS != (mpi_code = MPI_Comm_split_type(file_comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &f->shared->node_comm)))
+            HMPI_GOTO_ERROR(MPI_COMM_NULL, "MPI_Comm_split_type failed", mpi_code)
+#else /* MPI_VERSION >= 3 */
+        if(MPI_SUCCESS != (mpi_code = MPI_Comm_dup(MPI_COMM_SELF, &f->shared->node_comm)))
+            HMPI_GOTO_ERROR(MPI_COMM_NULL, "MPI_Comm_dup failed", mpi_code)
+#endif /* MPI_VERSION >= 3 */
+    } /* end if */
+
+    ret_value = f->shared->node_comm;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_mpi_get_node_comm() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Fset_mpi_atomicity
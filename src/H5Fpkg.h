@@ -71,6 +71,9 @@
     ((F)->shared->fs_strategy == H5F_FSPACE_STRATEGY_FSM_AGGR ||                        \
      (F)->shared->fs_strategy == H5F_FSPACE_STRATEGY_PAGE)
 
+/* Max. memory for object headers' caches of decoded attributes, per file */
+#define H5F_ATTR_CACHE_MAX_SIZE     (16 * 1024 * 1024)
+
 /* Macros for encoding/decoding superblock */
 #define H5F_MAX_DRVINFOBLOCK_SIZE  1024         /* Maximum size of superblock driver info buffer */
 #define H5F_DRVINFOBLOCK_HDR_SIZE 16            /* Size of superblock driver info header */
@@ -264,6 +267,7 @@ struct H5F_file_t {
     unsigned	flags;		/* Access Permissions for file          */
     H5F_mtab_t	mtab;		/* File mount table                     */
     H5F_efc_t   *efc;           /* External file cache                  */
+    size_t      attr_cache_size; /* Bytes held by object headers' caches of decoded attributes */
 
     /* Cached values from FCPL/superblock */
     uint8_t	sizeof_addr;	/* Size of addresses in file            */
@@ -307,6 +311,9 @@ struct H5F_file_t {
     unsigned	ncwfs;		/* Num entries on cwfs list		*/
     struct H5HG_heap_t **cwfs;	/* Global heap cache			*/
     struct H5G_t *root_grp;	/* Open root group			*/
+    H5SL_t *path_cache;         /* Paths resolved from the root group (see H5Gpath.c) */
+    H5SL_t *name_filters;       /* Link name filters for large groups (see H5Gbloom.c) */
+    size_t name_filters_size;   /* Total size of link name filters    */
     H5FO_t *open_objs;          /* Open objects in file                 */
     H5UC_t *grp_btree_shared;   /* Ref-counted group B-tree node info   */
 
@@ -359,6 +366,11 @@ struct H5F_file_t {
     /* Object flush info */
     H5F_object_flush_t 	object_flush;	    /* Information for object flush callback */
     hbool_t crt_dset_min_ohdr_flag; /* flag to minimize created dataset object header */
+
+#ifdef H5_HAVE_PARALLEL
+    /* Node-local aggregation info */
+    MPI_Comm            node_comm;          /* Communicator for processes on this node (created when first needed) */
+#endif /* H5_HAVE_PARALLEL */
 };
 
 /*
@@ -89,6 +89,8 @@
 #include "H5Pprivate.h"         /* Property lists                           */
 #include "H5VLprivate.h"        /* Virtual Object Layer                     */
 
+#include "H5VLnative_private.h" /* Native VOL connector                     */
+
 
 /****************/
 /* Local Macros */
@@ -460,6 +462,89 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Gcreate_anon() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Gcreate_multi
+ *
+ * Purpose:     Creates COUNT new empty groups, named NAMES, as members of
+ *              the group NAME relative to LOC_ID, giving each of them the
+ *              creation property list GCPL_ID.  This is much faster than
+ *              creating the groups one at a time with H5Gcreate2, since
+ *              the parent group is only located and updated once, and the
+ *              new groups aren't opened.
+ *
+ *              Each of NAMES must be a single link name (without any '/'
+ *              characters) that isn't already used in the parent group,
+ *              and may only appear once in NAMES.  The links are created
+ *              with the default link creation properties.
+ *
+ * Usage:       H5Gcreate_multi(loc_id, name, count, names, gcpl_id)
+ *                  hid_t loc_id;	  IN: File or group identifier
+ *                  const char *name; IN: Name of the group to create the
+ *                                        new groups in
+ *                  size_t count;         IN: Number of groups to create
+ *                  const char *names[];  IN: Names of the new groups
+ *                  hid_t gcpl_id;	  IN: Property list for group creation
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Gcreate_multi(hid_t loc_id, const char *name, size_t count,
+    const char *names[], hid_t gcpl_id)
+{
+    H5VL_object_t      *vol_obj = NULL;         /* object token of loc_id */
+    H5VL_loc_params_t   loc_params;
+    size_t              u;                      /* Local index variable */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "i*sz**si", loc_id, name, count, names, gcpl_id);
+
+    /* Check arguments */
+    if(!name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "name parameter cannot be NULL")
+    if(!*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "name parameter cannot be an empty string")
+    if(count > 0 && !names)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "names parameter cannot be NULL")
+    for(u = 0; u < count; u++) {
+        if(!names[u] || !*names[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no name specified for new group")
+        if(HDstrchr(names[u], '/') || !HDstrcmp(names[u], "."))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "name of new group must be a single link name")
+    } /* end for */
+
+    /* Check group creation property list */
+    if(H5P_DEFAULT == gcpl_id)
+        gcpl_id = H5P_GROUP_CREATE_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(gcpl_id, H5P_GROUP_CREATE))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a group creation property list")
+
+    /* Set up collective metadata if appropriate */
+    if(H5CX_set_loc(loc_id) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't set collective metadata read info")
+
+    /* Get the location object */
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object(loc_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid location identifier")
+
+    /* Set the location parameters */
+    loc_params.type                         = H5VL_OBJECT_BY_NAME;
+    loc_params.loc_data.loc_by_name.name    = name;
+    loc_params.loc_data.loc_by_name.lapl_id = H5P_LINK_ACCESS_DEFAULT;
+    loc_params.obj_type                     = H5I_get_type(loc_id);
+
+    /* Create the groups */
+    if(H5VL_group_optional(vol_obj, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, H5VL_NATIVE_GROUP_CREATE_MULTI, &loc_params, count, names, gcpl_id) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create groups")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Gcreate_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Gopen2
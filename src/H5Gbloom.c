@@ -0,0 +1,450 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:		H5Gbloom.c
+ *
+ * Purpose:		In-memory Bloom filters of the link names in large
+ *                      groups with dense link storage.
+ *
+ *                      A filter is built from the hash values in the
+ *                      group's name index the first time a name is looked
+ *                      up in the group, so that looking up a name that
+ *                      isn't in the group usually doesn't have to search
+ *                      the index or read the fractal heap.  Filters are
+ *                      kept for each file, keyed by the address of the name
+ *                      index, and the hash of each link inserted into the
+ *                      group afterwards is added to its filter.  Links
+ *                      removed from the group are left in the filter.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#define H5F_FRIEND		/*suppress error about including H5Fpkg	  */
+#include "H5Gmodule.h"          /* This source code file is part of the H5G module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5B2private.h"	/* v2 B-trees				*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fpkg.h"		/* File access				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
+#include "H5Gpkg.h"		/* Groups		  		*/
+#include "H5SLprivate.h"	/* Skip lists				*/
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Minimum # of links in a group, for a filter to be built for it */
+#define H5G_NAME_FILTER_MIN_NLINKS      1024
+
+/* # of filter bits per link, when a filter is built */
+#define H5G_NAME_FILTER_BITS_PER_LINK   16
+
+/* # of bits set for each name */
+#define H5G_NAME_FILTER_NHASHES         8
+
+/* Largest filter built, in bytes (a power of two, no larger than the
+ * maximum total size below, so one filter can't exceed the total) */
+#define H5G_NAME_FILTER_MAX_NBYTES      ((size_t)1 << 24)
+
+/* Maximum total size of the filters for a file, before they are all released */
+#define H5G_NAME_FILTER_MAX_TOTAL       ((size_t)64 * 1024 * 1024)
+
+/* Derive the step between the bits for a name from the name's hash value,
+ * so that names whose hash values differ in only a few bits still set
+ * different bits (uses the finalizer from MurmurHash3) */
+#define H5G_NAME_FILTER_STEP(h, step)                                         \
+{                                                                             \
+    (step) = (h);                                                             \
+    (step) ^= (step) >> 16;                                                   \
+    (step) *= 0x85ebca6bU;                                                    \
+    (step) ^= (step) >> 13;                                                   \
+    (step) *= 0xc2b2ae35U;                                                    \
+    (step) ^= (step) >> 16;                                                   \
+    (step) |= 1;                                                              \
+}
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* Bloom filter for the link names in a group */
+typedef struct H5G_name_filter_t {
+    haddr_t addr;               /* Address of the group's name index (key) */
+    size_t nbytes;              /* Size of filter bits, in bytes (power of 2) */
+    hsize_t nnames;             /* # of names added to filter */
+    hsize_t max_nnames;         /* # of names filter is sized for */
+    uint8_t *bits;              /* Filter bits */
+} H5G_name_filter_t;
+
+/* User data for adding the names in an index to a filter */
+typedef struct {
+    H5G_name_filter_t *filter;  /* Filter being built */
+} H5G_name_filter_ud_t;
+
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static void H5G__name_filter_set(H5G_name_filter_t *filter, uint32_t name_hash);
+static hbool_t H5G__name_filter_get(const H5G_name_filter_t *filter,
+    uint32_t name_hash);
+static int H5G__name_filter_build_cb(const void *record, void *_udata);
+static herr_t H5G__name_filter_free_cb(void *item, void *key, void *op_data);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5G_name_filter_t struct */
+H5FL_DEFINE_STATIC(H5G_name_filter_t);
+
+/* Declare a free list to manage the filter bits */
+H5FL_BLK_DEFINE_STATIC(name_filter_bits);
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__name_filter_set
+ *
+ * Purpose:	Set the bits for a name's hash value in a filter.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5G__name_filter_set(H5G_name_filter_t *filter, uint32_t name_hash)
+{
+    size_t mask = (filter->nbytes * 8) - 1;     /* Mask for bit index */
+    size_t bit = name_hash;                     /* Index of bit */
+    uint32_t step;                              /* Step between bits */
+    unsigned u;                                 /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    H5G_NAME_FILTER_STEP(name_hash, step)
+    for(u = 0; u < H5G_NAME_FILTER_NHASHES; u++, bit += step)
+        filter->bits[(bit & mask) >> 3] |= (uint8_t)(1 << (bit & 7));
+    filter->nnames++;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5G__name_filter_set() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__name_filter_get
+ *
+ * Purpose:	Check whether the bits for a name's hash value are set in a
+ *		filter.
+ *
+ * Return:	TRUE if they are all set (the name may be in the group),
+ *		FALSE if not (the name isn't in the group)
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5G__name_filter_get(const H5G_name_filter_t *filter, uint32_t name_hash)
+{
+    size_t mask = (filter->nbytes * 8) - 1;     /* Mask for bit index */
+    size_t bit = name_hash;                     /* Index of bit */
+    uint32_t step;                              /* Step between bits */
+    unsigned u;                                 /* Local index variable */
+    hbool_t ret_value = TRUE;                   /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    H5G_NAME_FILTER_STEP(name_hash, step)
+    for(u = 0; u < H5G_NAME_FILTER_NHASHES; u++, bit += step)
+        if(0 == (filter->bits[(bit & mask) >> 3] & (1 << (bit & 7))))
+            HGOTO_DONE(FALSE)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__name_filter_get() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__name_filter_build_cb
+ *
+ * Purpose:	Add the hash value in a record of a name index to the filter
+ *		being built.  This is the callback for H5B2_iterate().
+ *
+ * Return:	H5_ITER_CONT (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G__name_filter_build_cb(const void *record, void *_udata)
+{
+    const H5G_dense_bt2_name_rec_t *rec = (const H5G_dense_bt2_name_rec_t *)record;
+    H5G_name_filter_ud_t *udata = (H5G_name_filter_ud_t *)_udata;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    H5G__name_filter_set(udata->filter, rec->hash);
+
+    FUNC_LEAVE_NOAPI(H5_ITER_CONT)
+} /* end H5G__name_filter_build_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__name_filter_check
+ *
+ * Purpose:	Check whether the name with hash value NAME_HASH could be in
+ *		the dense link storage described by LINFO, building the
+ *		filter for the group if it's large enough and doesn't have
+ *		one yet.
+ *
+ * Return:	TRUE if the name may be in the group and the name index has
+ *		to be searched, FALSE if the name definitely isn't in the
+ *		group, FAIL on error
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5G__name_filter_check(H5F_t *f, const H5O_linfo_t *linfo, uint32_t name_hash)
+{
+    H5G_name_filter_t *filter = NULL;   /* Filter for group */
+    H5B2_t *bt2_name = NULL;            /* v2 B-tree handle for name index */
+    hsize_t nrec;                       /* # of records in name index */
+    htri_t ret_value = TRUE;            /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(linfo);
+    HDassert(H5F_addr_defined(linfo->name_bt2_addr));
+
+    /* Use the group's filter, if it has one */
+    if(f->shared->name_filters && (filter = (H5G_name_filter_t *)H5SL_search(f->shared->name_filters, &linfo->name_bt2_addr)))
+        HGOTO_DONE(H5G__name_filter_get(filter, name_hash))
+
+    /* Another process may be adding links to a file opened for SWMR reads */
+    if(H5F_INTENT(f) & H5F_ACC_SWMR_READ)
+        HGOTO_DONE(TRUE)
+
+    /* Check whether the group is large enough to have a filter */
+    if(linfo->nlinks < H5G_NAME_FILTER_MIN_NLINKS || linfo->nlinks == HSIZET_MAX)
+        HGOTO_DONE(TRUE)
+
+    /* Open the name index v2 B-tree */
+    if(NULL == (bt2_name = H5B2_open(f, linfo->name_bt2_addr, NULL)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for name index")
+    if(H5B2_get_nrec(bt2_name, &nrec) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't retrieve # of records in index")
+    HDcompile_assert(H5G_NAME_FILTER_MAX_NBYTES <= H5G_NAME_FILTER_MAX_TOTAL);
+    if(nrec < H5G_NAME_FILTER_MIN_NLINKS || (nrec * H5G_NAME_FILTER_BITS_PER_LINK) / 8 > H5G_NAME_FILTER_MAX_NBYTES)
+        HGOTO_DONE(TRUE)
+
+    /* Set up the filter */
+    if(NULL == (filter = H5FL_CALLOC(H5G_name_filter_t)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    filter->addr = linfo->name_bt2_addr;
+    filter->nbytes = 1;
+    while(filter->nbytes * 8 < nrec * H5G_NAME_FILTER_BITS_PER_LINK)
+        filter->nbytes *= 2;
+    filter->max_nnames = (filter->nbytes * 8) / (H5G_NAME_FILTER_BITS_PER_LINK / 2);
+    if(NULL == (filter->bits = H5FL_BLK_CALLOC(name_filter_bits, filter->nbytes)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "memory allocation failed")
+
+    /* Add the hash values of the names in the index */
+    {
+        H5G_name_filter_ud_t udata;     /* User data for iteration */
+
+        udata.filter = filter;
+        if(H5B2_iterate(bt2_name, H5G__name_filter_build_cb, &udata) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTNEXT, FAIL, "can't iterate over name index")
+    }
+
+    /* Create the set of filters, or start it over when it's too large */
+    if(NULL == f->shared->name_filters) {
+        if(NULL == (f->shared->name_filters = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTCREATE, FAIL, "can't create link name filters")
+    } /* end if */
+    else if(f->shared->name_filters_size + filter->nbytes > H5G_NAME_FILTER_MAX_TOTAL) {
+        if(H5SL_free(f->shared->name_filters, H5G__name_filter_free_cb, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release link name filters")
+        f->shared->name_filters_size = 0;
+    } /* end if */
+
+    if(H5SL_insert(f->shared->name_filters, filter, &filter->addr) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't insert link name filter")
+    f->shared->name_filters_size += filter->nbytes;
+
+    ret_value = H5G__name_filter_get(filter, name_hash);
+    filter = NULL;
+
+done:
+    if(bt2_name && H5B2_close(bt2_name) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for name index")
+    if(ret_value < 0 && filter) {
+        if(filter->bits)
+            filter->bits = H5FL_BLK_FREE(name_filter_bits, filter->bits);
+        filter = H5FL_FREE(H5G_name_filter_t, filter);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__name_filter_check() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__name_filter_add
+ *
+ * Purpose:	Add the hash value of a name inserted into the name index at
+ *		BT2_ADDR to the filter for the group, if it has one.  When
+ *		more names have been added to a filter than it was sized
+ *		for, it is released, to be built again at the next lookup.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__name_filter_add(const H5F_t *f, haddr_t bt2_addr, uint32_t name_hash)
+{
+    H5G_name_filter_t *filter;          /* Filter for group */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    if(f->shared->name_filters && (filter = (H5G_name_filter_t *)H5SL_search(f->shared->name_filters, &bt2_addr))) {
+        if(filter->nnames < filter->max_nnames)
+            H5G__name_filter_set(filter, name_hash);
+        else if(H5G__name_filter_remove(f, bt2_addr) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release link name filter")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__name_filter_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__name_filter_remove
+ *
+ * Purpose:	Release the filter for the name index at BT2_ADDR, if there
+ *		is one, when the index is deleted or created.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__name_filter_remove(const H5F_t *f, haddr_t bt2_addr)
+{
+    H5G_name_filter_t *filter;          /* Filter for group */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    if(f->shared->name_filters && (filter = (H5G_name_filter_t *)H5SL_remove(f->shared->name_filters, &bt2_addr))) {
+        f->shared->name_filters_size -= filter->nbytes;
+        if(H5G__name_filter_free_cb(filter, NULL, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release link name filter")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__name_filter_remove() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__name_filter_free_cb
+ *
+ * Purpose:	Release a filter.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__name_filter_free_cb(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *op_data)
+{
+    H5G_name_filter_t *filter = (H5G_name_filter_t *)item;      /* Filter */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(filter);
+
+    filter->bits = H5FL_BLK_FREE(name_filter_bits, filter->bits);
+    filter = H5FL_FREE(H5G_name_filter_t, filter);
+
+    FUNC_LEAVE_NOAPI(0)
+} /* end H5G__name_filter_free_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_name_filter_clear
+ *
+ * Purpose:	Release the link name filters for a file, when groups in it
+ *		may have changed on disk or the file is closing.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_name_filter_clear(const H5F_t *f)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    if(f->shared->name_filters) {
+        if(H5SL_destroy(f->shared->name_filters, H5G__name_filter_free_cb, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release link name filters")
+        f->shared->name_filters = NULL;
+        f->shared->name_filters_size = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_name_filter_clear() */
+
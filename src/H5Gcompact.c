@@ -46,24 +46,10 @@ typedef struct {
     const char *name;           /* Link name to search for */
 } H5G_iter_rm_t;
 
-/* User data for link message iteration when querying link info */
-typedef struct {
-    /* downward */
-    const char *name;           /* Name to search for */
-
-    /* upward */
-    H5O_link_t *lnk;            /* Link struct to fill in */
-    hbool_t found;              /* Flag to indicate that the object was found */
-} H5G_iter_lkp_t;
-
 /* Private macros */
 
 /* PRIVATE PROTOTYPES */
 static herr_t H5G__compact_build_table_cb(const void *_mesg, unsigned idx, void *_udata);
-static herr_t H5G__compact_build_table(const H5O_loc_t *oloc, 
-    const H5O_linfo_t *linfo, H5_index_t idx_type, H5_iter_order_t order,
-    H5G_link_table_t *ltable);
-static herr_t H5G__compact_lookup_cb(const void *_mesg, unsigned H5_ATTR_UNUSED idx, void *_udata);
 
 
 /*-------------------------------------------------------------------------
@@ -120,13 +106,13 @@ done:
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
+herr_t
 H5G__compact_build_table(const H5O_loc_t *oloc, const H5O_linfo_t *linfo,
     H5_index_t idx_type, H5_iter_order_t order, H5G_link_table_t *ltable)
 {
     herr_t	ret_value = SUCCEED;    /* Return value */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_PACKAGE
 
     /* Sanity check */
     HDassert(oloc);
@@ -431,53 +417,6 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__compact_iterate() */
 
-
-/*-------------------------------------------------------------------------
- * Function:    H5G__compact_lookup_cb
- *
- * Purpose:     Callback routine for searching 'link' messages for a particular
- *              name & gettting object location for it
- *
- * Return:      SUCCEED/FAIL
- *
- * Programmer:	Quincey Koziol
- *		koziol@ncsa.uiuc.edu
- *		Sep 20 2005
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5G__compact_lookup_cb(const void *_mesg, unsigned H5_ATTR_UNUSED idx, void *_udata)
-{
-    const H5O_link_t *lnk = (const H5O_link_t *)_mesg;  /* Pointer to link */
-    H5G_iter_lkp_t *udata = (H5G_iter_lkp_t *)_udata;     /* 'User data' passed in */
-    herr_t ret_value = H5_ITER_CONT;           /* Return value */
-
-    FUNC_ENTER_STATIC
-
-    /* check arguments */
-    HDassert(lnk);
-    HDassert(udata);
-
-    /* Check for name to get information */
-    if(HDstrcmp(lnk->name, udata->name) == 0) {
-        if(udata->lnk) {
-            /* Copy link information */
-            if(NULL == H5O_msg_copy(H5O_LINK_ID, lnk, udata->lnk))
-                HGOTO_ERROR(H5E_SYM, H5E_CANTCOPY, H5_ITER_ERROR, "can't copy link message")
-        } /* end if */
-
-        /* Indicate that the correct link was found */
-        udata->found = TRUE;
-
-        /* Stop iteration now */
-        HGOTO_DONE(H5_ITER_STOP)
-    } /* end if */
-
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5G__compact_lookup_cb() */
-
 
 /*-------------------------------------------------------------------------
  * Function:	H5G__compact_lookup
@@ -495,8 +434,6 @@ done:
 htri_t
 H5G__compact_lookup(const H5O_loc_t *oloc, const char *name, H5O_link_t *lnk)
 {
-    H5G_iter_lkp_t udata;               /* User data for iteration callback */
-    H5O_mesg_operator_t op;             /* Message operator */
     htri_t     ret_value = FAIL;        /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -505,19 +442,9 @@ H5G__compact_lookup(const H5O_loc_t *oloc, const char *name, H5O_link_t *lnk)
     HDassert(lnk && oloc->file);
     HDassert(name && *name);
 
-    /* Set up user data for iteration */
-    udata.name = name;
-    udata.lnk = lnk;
-    udata.found = FALSE;
-
-    /* Iterate through the link messages, adding them to the table */
-    op.op_type = H5O_MESG_OP_APP;
-    op.u.app_op = H5G__compact_lookup_cb;
-    if(H5O_msg_iterate(oloc, H5O_LINK_ID, &op, &udata) < 0)
-        HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "error iterating over link messages")
-
-    /* Determine if we found the link we were looking for */
-    ret_value = (htri_t)udata.found;
+    /* Look up the link message, decoding only the one that matches */
+    if((ret_value = H5O_link_lookup(oloc, name, lnk)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "error looking up link message")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
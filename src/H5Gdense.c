@@ -215,6 +215,23 @@ typedef struct {
     H5O_link_t  *lnk;                   /* Pointer to link                   */
 } H5G_fh_ud_lbi_t;
 
+/* Link record for inserting a batch of links into dense link storage */
+typedef struct {
+    const char  *name;                  /* Name of link                      */
+    uint32_t    name_hash;              /* Hash of link's name               */
+    int64_t     corder;                 /* Creation order value of link      */
+    uint8_t     id[H5G_DENSE_FHEAP_ID_LEN]; /* Heap ID for link              */
+} H5G_dense_bulk_rec_t;
+
+/*
+ * Data exchange structure to pass through the v2 B-tree layer for the
+ * H5B2_insert_bulk function when building an index for a batch of links.
+ */
+typedef struct {
+    const H5G_dense_bulk_rec_t *recs;   /* Sorted records for the links      */
+    size_t      next;                   /* Next record to fill in            */
+} H5G_bt2_ud_bulk_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -224,6 +241,10 @@ typedef struct {
 /********************/
 /* Local Prototypes */
 /********************/
+static int H5G__dense_bulk_cmp_name(const void *rec1, const void *rec2);
+static int H5G__dense_bulk_cmp_corder(const void *rec1, const void *rec2);
+static herr_t H5G__dense_fill_name_cb(void *record, void *op_data);
+static herr_t H5G__dense_fill_corder_cb(void *record, void *op_data);
 
 
 /*********************/
@@ -325,6 +346,10 @@ HDfprintf(stderr, "%s: fheap_id_len = %Zu\n", FUNC, fheap_id_len);
 HDfprintf(stderr, "%s: linfo->name_bt2_addr = %a\n", FUNC, linfo->name_bt2_addr);
 #endif /* QAK */
 
+    /* Make certain a filter for an index deleted from the same address isn't used */
+    if(H5G__name_filter_remove(f, linfo->name_bt2_addr) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release link name filter")
+
     /* Check if we should create a creation order index v2 B-tree */
     if(linfo->index_corder) {
         /* Create the creation order index v2 B-tree */
@@ -440,6 +465,10 @@ HDfprintf(stderr, "%s: HDstrlen(lnk->name) = %Zu, link_size = %Zu\n", FUNC, HDst
     udata.common.found_op_data = NULL;
     /* udata.id already set in H5HF_insert() call */
 
+    /* Add the name to the group's filter, before it can be found in the index */
+    if(H5G__name_filter_add(f, linfo->name_bt2_addr, udata.common.name_hash) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't add name to link name filter")
+
     /* Insert link into 'name' tracking v2 B-tree */
     if(H5B2_insert(bt2_name, &udata) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert record into v2 B-tree")
@@ -470,6 +499,293 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__dense_insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__dense_bulk_cmp_name
+ *
+ * Purpose:	Callback routine for sorting link records in the order of
+ *              the 'name' index, i.e. by hash value, then by name.
+ *
+ * Return:	An integer less than, equal to, or greater than zero if the
+ *              first argument is considered to be respectively less than,
+ *              equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G__dense_bulk_cmp_name(const void *_rec1, const void *_rec2)
+{
+    const H5G_dense_bulk_rec_t *rec1 = (const H5G_dense_bulk_rec_t *)_rec1;
+    const H5G_dense_bulk_rec_t *rec2 = (const H5G_dense_bulk_rec_t *)_rec2;
+    int ret_value = 0;                  /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(rec1->name_hash < rec2->name_hash)
+        ret_value = -1;
+    else if(rec1->name_hash > rec2->name_hash)
+        ret_value = 1;
+    else
+        ret_value = HDstrcmp(rec1->name, rec2->name);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__dense_bulk_cmp_name() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__dense_bulk_cmp_corder
+ *
+ * Purpose:	Callback routine for sorting link records in increasing
+ *              creation order.
+ *
+ * Return:	An integer less than, equal to, or greater than zero if the
+ *              first argument is considered to be respectively less than,
+ *              equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G__dense_bulk_cmp_corder(const void *_rec1, const void *_rec2)
+{
+    const H5G_dense_bulk_rec_t *rec1 = (const H5G_dense_bulk_rec_t *)_rec1;
+    const H5G_dense_bulk_rec_t *rec2 = (const H5G_dense_bulk_rec_t *)_rec2;
+    int ret_value = 0;                  /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(rec1->corder < rec2->corder)
+        ret_value = -1;
+    else if(rec1->corder > rec2->corder)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__dense_bulk_cmp_corder() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__dense_fill_name_cb
+ *
+ * Purpose:	Fill in the next 'name' index record for a batch of links.
+ *              This is the callback for H5B2_insert_bulk() which is called
+ *              in H5G__dense_insert_multi().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__dense_fill_name_cb(void *_record, void *_udata)
+{
+    H5G_dense_bt2_name_rec_t *record = (H5G_dense_bt2_name_rec_t *)_record;
+    H5G_bt2_ud_bulk_t *udata = (H5G_bt2_ud_bulk_t *)_udata;
+    const H5G_dense_bulk_rec_t *rec;    /* Next link's records */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    rec = &udata->recs[udata->next++];
+    HDmemcpy(record->id, rec->id, (size_t)H5G_DENSE_FHEAP_ID_LEN);
+    record->hash = rec->name_hash;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5G__dense_fill_name_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__dense_fill_corder_cb
+ *
+ * Purpose:	Fill in the next 'creation order' index record for a batch
+ *              of links.  This is the callback for H5B2_insert_bulk() which
+ *              is called in H5G__dense_insert_multi().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__dense_fill_corder_cb(void *_record, void *_udata)
+{
+    H5G_dense_bt2_corder_rec_t *record = (H5G_dense_bt2_corder_rec_t *)_record;
+    H5G_bt2_ud_bulk_t *udata = (H5G_bt2_ud_bulk_t *)_udata;
+    const H5G_dense_bulk_rec_t *rec;    /* Next link's records */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    rec = &udata->recs[udata->next++];
+    HDmemcpy(record->id, rec->id, (size_t)H5G_DENSE_FHEAP_ID_LEN);
+    record->corder = rec->corder;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5G__dense_fill_corder_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__dense_insert_multi
+ *
+ * Purpose:	Insert a batch of links into the dense link storage
+ *              structures for a group.  The fractal heap and index
+ *              B-trees are opened once for the whole batch, and an index
+ *              that is still empty is built from the sorted records in a
+ *              single pass, instead of by splitting nodes as each link is
+ *              inserted.
+ *
+ *              The link names must not already exist in the group, or be
+ *              repeated in the batch.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__dense_insert_multi(H5F_t *f, const H5O_linfo_t *linfo, size_t nlinks,
+    const H5O_link_t *lnks)
+{
+    H5G_dense_bulk_rec_t *recs = NULL;  /* Records for the links */
+    H5G_bt2_ud_bulk_t bulk_udata;       /* User data for v2 B-tree bulk insertion */
+    H5G_bt2_ud_ins_t udata;             /* User data for v2 B-tree insertion */
+    H5HF_t *fheap = NULL;               /* Fractal heap handle */
+    H5B2_t *bt2_name = NULL;            /* v2 B-tree handle for name index */
+    H5B2_t *bt2_corder = NULL;          /* v2 B-tree handle for creation order index */
+    hsize_t nrec;                       /* # of records already in an index */
+    H5WB_t *wb = NULL;                  /* Wrapped buffer for link data */
+    uint8_t link_buf[H5G_LINK_BUF_SIZE];        /* Buffer for serializing link */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /*
+     * Check arguments.
+     */
+    HDassert(f);
+    HDassert(linfo);
+    HDassert(lnks || 0 == nlinks);
+
+    /* Check for nothing to do */
+    if(0 == nlinks)
+        HGOTO_DONE(SUCCEED)
+
+    /* Allocate the records for the links */
+    if(NULL == (recs = (H5G_dense_bulk_rec_t *)H5MM_malloc(nlinks * sizeof(H5G_dense_bulk_rec_t))))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "memory allocation failed")
+
+    /* Wrap the local buffer for serialized links */
+    if(NULL == (wb = H5WB_wrap(link_buf, sizeof(link_buf))))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't wrap buffer")
+
+    /* Open the fractal heap */
+    if(NULL == (fheap = H5HF_open(f, linfo->fheap_addr)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open fractal heap")
+
+    /* Insert the serialized links into the fractal heap */
+    for(u = 0; u < nlinks; u++) {
+        size_t link_size;               /* Size of serialized link in the heap */
+        void *link_ptr;                 /* Pointer to serialized link */
+
+        /* Find out the size of buffer needed for serialized link */
+        if((link_size = H5O_msg_raw_size(f, H5O_LINK_ID, FALSE, &lnks[u])) == 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTGETSIZE, FAIL, "can't get link size")
+
+        /* Get a pointer to a buffer that's large enough for link */
+        if(NULL == (link_ptr = H5WB_actual(wb, link_size)))
+            HGOTO_ERROR(H5E_SYM, H5E_NOSPACE, FAIL, "can't get actual buffer")
+
+        /* Create serialized form of link */
+        if(H5O_msg_encode(f, H5O_LINK_ID, FALSE, (unsigned char *)link_ptr, &lnks[u]) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTENCODE, FAIL, "can't encode link")
+
+        /* Insert the serialized link into the fractal heap */
+        if(H5HF_insert(fheap, link_size, link_ptr, recs[u].id) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert link into fractal heap")
+
+        /* Set up the rest of the record */
+        recs[u].name = lnks[u].name;
+        recs[u].name_hash = H5_checksum_lookup3(lnks[u].name, HDstrlen(lnks[u].name), 0);
+        recs[u].corder = lnks[u].corder;
+    } /* end for */
+
+    /* Set up the callback information for v2 B-tree record insertion */
+    udata.common.f = f;
+    udata.common.fheap = fheap;
+    udata.common.found_op = NULL;
+    udata.common.found_op_data = NULL;
+
+    /* Open the name index v2 B-tree */
+    if(NULL == (bt2_name = H5B2_open(f, linfo->name_bt2_addr, NULL)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for name index")
+    if(H5B2_get_nrec(bt2_name, &nrec) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't retrieve # of records in name index")
+
+    /* Add the names to the group's filter, before they can be found in the index */
+    for(u = 0; u < nlinks; u++)
+        if(H5G__name_filter_add(f, linfo->name_bt2_addr, recs[u].name_hash) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't add name to link name filter")
+
+    /* Build an empty name index from the sorted records, or add the records one at a time */
+    if(0 == nrec) {
+        HDqsort(recs, nlinks, sizeof(H5G_dense_bulk_rec_t), H5G__dense_bulk_cmp_name);
+
+        bulk_udata.recs = recs;
+        bulk_udata.next = 0;
+        if(H5B2_insert_bulk(bt2_name, (hsize_t)nlinks, H5G__dense_fill_name_cb, &bulk_udata) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to bulk insert records into v2 B-tree")
+    } /* end if */
+    else
+        for(u = 0; u < nlinks; u++) {
+            udata.common.name = recs[u].name;
+            udata.common.name_hash = recs[u].name_hash;
+            udata.common.corder = recs[u].corder;
+            HDmemcpy(udata.id, recs[u].id, (size_t)H5G_DENSE_FHEAP_ID_LEN);
+
+            if(H5B2_insert(bt2_name, &udata) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert record into v2 B-tree")
+        } /* end for */
+
+    /* Check if we should create creation order index v2 B-tree records */
+    if(linfo->index_corder) {
+        /* Open the creation order index v2 B-tree */
+        HDassert(H5F_addr_defined(linfo->corder_bt2_addr));
+        if(NULL == (bt2_corder = H5B2_open(f, linfo->corder_bt2_addr, NULL)))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for creation order index")
+        if(H5B2_get_nrec(bt2_corder, &nrec) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't retrieve # of records in creation order index")
+
+        /* Build an empty creation order index from the sorted records, or add the records one at a time */
+        if(0 == nrec) {
+            HDqsort(recs, nlinks, sizeof(H5G_dense_bulk_rec_t), H5G__dense_bulk_cmp_corder);
+
+            bulk_udata.recs = recs;
+            bulk_udata.next = 0;
+            if(H5B2_insert_bulk(bt2_corder, (hsize_t)nlinks, H5G__dense_fill_corder_cb, &bulk_udata) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to bulk insert records into v2 B-tree")
+        } /* end if */
+        else
+            for(u = 0; u < nlinks; u++) {
+                udata.common.name = recs[u].name;
+                udata.common.name_hash = recs[u].name_hash;
+                udata.common.corder = recs[u].corder;
+                HDmemcpy(udata.id, recs[u].id, (size_t)H5G_DENSE_FHEAP_ID_LEN);
+
+                if(H5B2_insert(bt2_corder, &udata) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert record into v2 B-tree")
+            } /* end for */
+    } /* end if */
+
+done:
+    /* Release resources */
+    if(fheap && H5HF_close(fheap) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close fractal heap")
+    if(bt2_name && H5B2_close(bt2_name) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for name index")
+    if(bt2_corder && H5B2_close(bt2_corder) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for creation order index")
+    if(wb && H5WB_unwrap(wb) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close wrapped buffer")
+    if(recs)
+        recs = (H5G_dense_bulk_rec_t *)H5MM_xfree(recs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__dense_insert_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G_dense_lookup_cb
@@ -540,6 +856,14 @@ H5G__dense_lookup(H5F_t *f, const H5O_linfo_t *linfo, const char *name,
     HDassert(name && *name);
     HDassert(lnk);
 
+    /* Check the group's filter, to avoid searching for names that aren't there */
+    udata.name_hash = H5_checksum_lookup3(name, HDstrlen(name), 0);
+    if((ret_value = H5G__name_filter_check(f, linfo, udata.name_hash)) <= 0) {
+        if(ret_value < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check link name filter")
+        HGOTO_DONE(FALSE)
+    } /* end if */
+
     /* Open the fractal heap */
     if(NULL == (fheap = H5HF_open(f, linfo->fheap_addr)))
         HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open fractal heap")
@@ -552,7 +876,6 @@ H5G__dense_lookup(H5F_t *f, const H5O_linfo_t *linfo, const char *name,
     udata.f = f;
     udata.fheap = fheap;
     udata.name = name;
-    udata.name_hash = H5_checksum_lookup3(name, HDstrlen(name), 0);
     udata.found_op = H5G_dense_lookup_cb;       /* v2 B-tree comparison callback */
     udata.found_op_data = lnk;
 
@@ -570,6 +893,86 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__dense_lookup() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__dense_lookup_multi
+ *
+ * Purpose:	Look for any of NNAMES link names in the dense link storage
+ *              for a group, opening the storage once for all the names.
+ *
+ * Return:	Success:	TRUE if a name exists, with the index of the
+ *				first one found in FOUND_IDX, FALSE if none
+ *				of them do
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5G__dense_lookup_multi(H5F_t *f, const H5O_linfo_t *linfo, size_t nnames,
+    const char *names[], size_t *found_idx)
+{
+    H5G_bt2_ud_common_t udata;          /* User data for v2 B-tree link lookup */
+    H5HF_t *fheap = NULL;               /* Fractal heap handle */
+    H5B2_t *bt2_name = NULL;            /* v2 B-tree handle for name index */
+    size_t u;                           /* Local index variable */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /*
+     * Check arguments.
+     */
+    HDassert(f);
+    HDassert(linfo);
+    HDassert(names || 0 == nnames);
+    HDassert(found_idx);
+
+    /* Construct the user data for v2 B-tree callback */
+    udata.f = f;
+    udata.fheap = NULL;
+    udata.found_op = NULL;
+    udata.found_op_data = NULL;
+
+    /* Look for each name in the 'name' index */
+    for(u = 0; u < nnames; u++) {
+        htri_t maybe_found;             /* Whether the name may be in the group */
+
+        udata.name = names[u];
+        udata.name_hash = H5_checksum_lookup3(names[u], HDstrlen(names[u]), 0);
+
+        /* Check the group's filter, to avoid searching for names that aren't there */
+        if((maybe_found = H5G__name_filter_check(f, linfo, udata.name_hash)) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check link name filter")
+        if(!maybe_found)
+            continue;
+
+        /* Open the fractal heap & name index v2 B-tree for the first name searched for */
+        if(NULL == bt2_name) {
+            if(NULL == (fheap = H5HF_open(f, linfo->fheap_addr)))
+                HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open fractal heap")
+            if(NULL == (bt2_name = H5B2_open(f, linfo->name_bt2_addr, NULL)))
+                HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for name index")
+            udata.fheap = fheap;
+        } /* end if */
+
+        if((ret_value = H5B2_find(bt2_name, &udata, NULL, NULL)) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "unable to locate link in name index")
+        if(ret_value) {
+            *found_idx = u;
+            break;
+        } /* end if */
+    } /* end for */
+
+done:
+    /* Release resources */
+    if(fheap && H5HF_close(fheap) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close fractal heap")
+    if(bt2_name && H5B2_close(bt2_name) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for name index")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__dense_lookup_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G_dense_lookup_by_idx_fh_cb
@@ -1718,6 +2121,10 @@ H5G__dense_delete(H5F_t *f, H5O_linfo_t *linfo, hbool_t adj_link)
     HDassert(f);
     HDassert(linfo);
 
+    /* Release the group's filter */
+    if(H5G__name_filter_remove(f, linfo->name_bt2_addr) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release link name filter")
+
     /* Check if we are to adjust the ref. count for all the links */
     /* (we adjust the ref. count when deleting a group and we _don't_ adjust
      *  the ref. count when transitioning back to compact storage)
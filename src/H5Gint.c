@@ -240,6 +240,147 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__create() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__create_multi
+ *
+ * Purpose:	Creates COUNT new empty groups, named NAMES, in the group
+ *		NAME (relative to LOC), with the group creation property
+ *		list GCPL_ID.  The new groups aren't opened.
+ *
+ *		The parent group is located once for the whole batch, the
+ *		object headers for all the new groups are created before
+ *		any of them are linked in (so that they're allocated next
+ *		to each other in the file) and the links are inserted into
+ *		the parent group together.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__create_multi(const H5G_loc_t *loc, const char *name, size_t count,
+    const char *names[], hid_t gcpl_id)
+{
+    H5G_loc_t   grp_loc;                /* Location of parent group */
+    H5G_name_t  grp_path;            	/* Parent group hier. path */
+    H5O_loc_t   grp_oloc;            	/* Parent group object location */
+    hbool_t     loc_found = FALSE;      /* Location at 'name' found */
+    H5O_type_t  obj_type;               /* Type of object at location */
+    H5P_genplist_t *gc_plist;           /* Group creation property list */
+    H5O_ginfo_t ginfo;                  /* Group info */
+    H5O_linfo_t linfo;                  /* Link info */
+    H5O_pline_t pline;                  /* Pipeline */
+    H5G_obj_create_t *gcrt_info = NULL; /* Creation info for new groups */
+    const void **crt_info = NULL;       /* Pointers to creation info */
+    H5O_link_t *lnks = NULL;            /* Links to new groups */
+    size_t      ncreated = 0;           /* # of new groups created */
+    hbool_t     linked = FALSE;         /* Whether the new groups were linked in */
+    size_t      found_idx;              /* Index of name that can't be used */
+    htri_t      found;                  /* Whether a name can't be used */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(loc);
+    HDassert(name && *name);
+    HDassert(names || 0 == count);
+
+    /* Set up parent group location to fill in */
+    grp_loc.oloc = &grp_oloc;
+    grp_loc.path = &grp_path;
+    H5G_loc_reset(&grp_loc);
+
+    /* Find the parent group */
+    if(H5G_loc_find(loc, name, &grp_loc/*out*/) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "group not found")
+    loc_found = TRUE;
+
+    /* Check that the object found is a group */
+    if(H5O_obj_type(&grp_oloc, &obj_type) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't get object type")
+    if(obj_type != H5O_TYPE_GROUP)
+        HGOTO_ERROR(H5E_SYM, H5E_BADTYPE, FAIL, "not a group")
+
+    /* Check for nothing to do */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Make certain the names can be used for new links */
+    if((found = H5G_obj_lookup_multi(&grp_oloc, count, names, &found_idx)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check names of new groups")
+    if(found)
+        HGOTO_ERROR(H5E_SYM, H5E_EXISTS, FAIL, "name '%s' already exists", names[found_idx])
+
+    /* Get the group creation properties, once for all the groups */
+    if(NULL == (gc_plist = (H5P_genplist_t *)H5I_object(gcpl_id)))
+        HGOTO_ERROR(H5E_SYM, H5E_BADTYPE, FAIL, "not a property list")
+    if(H5P_get(gc_plist, H5G_CRT_GROUP_INFO_NAME, &ginfo) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't get group info")
+    if(H5P_get(gc_plist, H5G_CRT_LINK_INFO_NAME, &linfo) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't get group info")
+    if(H5P_peek(gc_plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't get group info")
+
+    /* Allocate the creation info & links for the new groups */
+    if(NULL == (gcrt_info = (H5G_obj_create_t *)H5MM_calloc(count * sizeof(H5G_obj_create_t))))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    if(NULL == (crt_info = (const void **)H5MM_malloc(count * sizeof(void *))))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    if(NULL == (lnks = (H5O_link_t *)H5MM_calloc(count * sizeof(H5O_link_t))))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "memory allocation failed")
+
+    /* Create the object headers for all the new groups */
+    for(u = 0; u < count; u++) {
+        H5O_loc_t oloc;                 /* New group's object location */
+
+        H5O_loc_reset(&oloc);
+        gcrt_info[u].gcpl_id = gcpl_id;
+        gcrt_info[u].cache_type = H5G_NOTHING_CACHED;
+        if(H5G__obj_create_real(grp_oloc.file, &ginfo, &linfo, &pline, &gcrt_info[u], &oloc/*out*/) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create group object header")
+        ncreated++;
+
+        /* Don't keep the new group's object header pinned while the rest are created */
+        if(H5O_dec_rc_by_loc(&oloc) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTDEC, FAIL, "unable to decrement refcount on newly created object")
+        if(H5O_close(&oloc, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "unable to close")
+
+        /* Set up the link to the new group */
+        crt_info[u] = &gcrt_info[u];
+        lnks[u].type = H5L_TYPE_HARD;
+        lnks[u].cset = H5T_CSET_ASCII;
+        lnks[u].name = (char *)names[u];        /* (Casting away const OK) */
+        lnks[u].u.hard.addr = oloc.addr;
+    } /* end for */
+
+    /* Insert the links to the new groups into the parent group */
+    linked = TRUE;
+    if(H5G_obj_insert_multi(&grp_oloc, count, lnks, TRUE, H5O_TYPE_GROUP, crt_info) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert links to new groups")
+
+done:
+    /* Delete the new groups if they couldn't be linked in */
+    if(ret_value < 0 && !linked)
+        for(u = 0; u < ncreated; u++)
+            if(H5O_delete(grp_oloc.file, lnks[u].u.hard.addr) < 0)
+                HDONE_ERROR(H5E_SYM, H5E_CANTDELETE, FAIL, "unable to delete object header")
+
+    if(gcrt_info)
+        gcrt_info = (H5G_obj_create_t *)H5MM_xfree(gcrt_info);
+    if(crt_info)
+        crt_info = (const void **)H5MM_xfree(crt_info);
+    if(lnks)
+        lnks = (H5O_link_t *)H5MM_xfree(lnks);
+    if(loc_found && H5G_loc_free(&grp_loc) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't free location")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__create_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G__open_name
@@ -76,6 +76,12 @@ typedef struct {
     const H5O_loc_t   *grp_oloc;              /* Pointer to group for insertion */
 } H5G_obj_stab_it_ud1_t;
 
+/* Link name, for finding names repeated in a batch of new links */
+typedef struct {
+    const char *name;                   /* Name of link */
+    size_t idx;                         /* Index of name in batch */
+} H5G_obj_name_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -88,6 +94,7 @@ typedef struct {
 static herr_t H5G_obj_compact_to_dense_cb(const void *_mesg, unsigned idx,
     void *_udata);
 static herr_t H5G__obj_remove_update_linfo(const H5O_loc_t *oloc, H5O_linfo_t *linfo);
+static int H5G__obj_name_cmp(const void *name1, const void *name2);
 
 
 /*********************/
@@ -467,6 +474,10 @@ H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk,
     HDassert(name && *name);
     HDassert(obj_lnk);
 
+    /* Paths resolved before the links in the group change can't be reused */
+    if(H5G_path_cache_clear(grp_oloc->file) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't empty path cache")
+
     /* Check if we have information about the number of objects in this group */
     /* (by attempting to get the link info message for this group) */
     if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
@@ -630,6 +641,314 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5G_obj_insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__obj_name_cmp
+ *
+ * Purpose:	Callback routine for sorting link names, in increasing
+ *              alphabetic order.
+ *
+ * Return:	An integer less than, equal to, or greater than zero if the
+ *              first argument is considered to be respectively less than,
+ *              equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G__obj_name_cmp(const void *name1, const void *name2)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(HDstrcmp(((const H5G_obj_name_t *)name1)->name, ((const H5G_obj_name_t *)name2)->name))
+} /* end H5G__obj_name_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_obj_lookup_multi
+ *
+ * Purpose:	Check whether NNAMES names can be used for new links in a
+ *              group, i.e. that none of them is the name of a link that is
+ *              already in the group, or appears more than once in NAMES.
+ *
+ * Return:	Success:	TRUE if a name can't be used, with its index
+ *				in NAMES in FOUND_IDX, FALSE if all the names
+ *				can be used
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5G_obj_lookup_multi(const H5O_loc_t *grp_oloc, size_t nnames,
+    const char *names[], size_t *found_idx)
+{
+    H5G_obj_name_t *sorted = NULL;      /* Names, sorted */
+    H5O_linfo_t linfo;		        /* Link info message */
+    htri_t linfo_exists;                /* Whether the link info message exists */
+    size_t u;                           /* Local index variable */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(grp_oloc->addr, FAIL)
+
+    /* check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(names || 0 == nnames);
+    HDassert(found_idx);
+
+    /* Look for names that are repeated */
+    if(nnames > 1) {
+        if(NULL == (sorted = (H5G_obj_name_t *)H5MM_malloc(nnames * sizeof(H5G_obj_name_t))))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "memory allocation failed")
+        for(u = 0; u < nnames; u++) {
+            sorted[u].name = names[u];
+            sorted[u].idx = u;
+        } /* end for */
+        HDqsort(sorted, nnames, sizeof(H5G_obj_name_t), H5G__obj_name_cmp);
+
+        for(u = 1; u < nnames; u++)
+            if(0 == HDstrcmp(sorted[u - 1].name, sorted[u].name)) {
+                *found_idx = MAX(sorted[u - 1].idx, sorted[u].idx);
+                HGOTO_DONE(TRUE)
+            } /* end if */
+    } /* end if */
+
+    /* Attempt to get the link info message for this group */
+    if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
+
+    /* Look for names that are already in the group */
+    if(linfo_exists && H5F_addr_defined(linfo.fheap_addr)) {
+        /* Look up all the names in the dense link storage at once */
+        if((ret_value = H5G__dense_lookup_multi(grp_oloc->file, &linfo, nnames, names, found_idx)) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't locate object")
+    } /* end if */
+    else if(!linfo_exists || linfo.nlinks > 0)
+        for(u = 0; u < nnames; u++) {
+            H5O_link_t lnk;             /* Link found */
+
+            /* Look up the name in the link messages or the symbol table */
+            if(linfo_exists)
+                ret_value = H5G__compact_lookup(grp_oloc, names[u], &lnk);
+            else
+                ret_value = H5G__stab_lookup(grp_oloc, names[u], &lnk);
+            if(ret_value < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't locate object")
+
+            if(ret_value) {
+                H5O_msg_reset(H5O_LINK_ID, &lnk);
+                *found_idx = u;
+                break;
+            } /* end if */
+        } /* end for */
+
+done:
+    if(sorted)
+        sorted = (H5G_obj_name_t *)H5MM_xfree(sorted);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5G_obj_lookup_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_obj_insert_multi
+ *
+ * Purpose:	Insert a batch of NLINKS new links into a group, updating
+ *              the group's link info message once for all of them.
+ *
+ *              When the links won't fit into the group's link messages,
+ *              the group is converted to dense link storage before any of
+ *              them are inserted, so that the indices for the links already
+ *              in the group and the new links are built together.  The link
+ *              count on each object a hard link points to is incremented
+ *              if ADJ_LINK is true.
+ *
+ *              The names of the links must be valid for new links in the
+ *              group (see H5G_obj_lookup_multi).  CRT_INFO is NULL or holds
+ *              the creation info for the object each link points to.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_obj_insert_multi(const H5O_loc_t *grp_oloc, size_t nlinks,
+    H5O_link_t *lnks, hbool_t adj_link, H5O_type_t obj_type,
+    const void *crt_info[])
+{
+    H5O_pline_t tmp_pline;              /* Pipeline message */
+    H5O_pline_t *pline = NULL;          /* Pointer to pipeline message */
+    H5O_linfo_t linfo;		        /* Link info message */
+    htri_t linfo_exists;                /* Whether the link info message exists */
+    H5G_link_table_t ltable = {0, NULL};        /* Links already in the group */
+    H5O_link_t *all_lnks = NULL;        /* Links already in the group and new links */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(grp_oloc->addr, FAIL)
+
+    /* check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(lnks || 0 == nlinks);
+
+    /* Check for nothing to do */
+    if(0 == nlinks)
+        HGOTO_DONE(SUCCEED)
+
+    /* Paths resolved before the links in the group change can't be reused */
+    if(H5G_path_cache_clear(grp_oloc->file) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't empty path cache")
+
+    /* Check if we have information about the number of objects in this group */
+    /* (by attempting to get the link info message for this group) */
+    if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
+    if(linfo_exists) {
+        hbool_t use_new_dense;          /* Whether to use "dense" form of 'new format' group */
+
+        /* Check for tracking creation order on this group's links */
+        if(linfo.track_corder)
+            for(u = 0; u < nlinks; u++) {
+                /* Set the creation order for the new link & indicate that it's valid */
+                lnks[u].corder = linfo.max_corder;
+                lnks[u].corder_valid = TRUE;
+
+                /* Increment the max. creation order used in the group */
+                linfo.max_corder++;
+            } /* end for */
+
+        /* If all the links fit with the links already in the group, use 'link' messages */
+        /* (If the encoded form of a link is too large to fit into an object
+         *  header message, convert to using dense link storage instead of link messages)
+         */
+        if(H5F_addr_defined(linfo.fheap_addr))
+            use_new_dense = TRUE;
+        else {
+            H5O_ginfo_t ginfo;	        /* Group info message */
+
+            /* Get the group info */
+            if(NULL == H5O_msg_read(grp_oloc, H5O_GINFO_ID, &ginfo))
+                HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get group info")
+
+            use_new_dense = (linfo.nlinks + nlinks) > ginfo.max_compact;
+            for(u = 0; u < nlinks && !use_new_dense; u++) {
+                size_t link_msg_size;   /* Size of new link message in the file */
+
+                /* Get the link's message size */
+                if((link_msg_size = H5O_msg_raw_size(grp_oloc->file, H5O_LINK_ID, FALSE, &lnks[u])) == 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTGETSIZE, FAIL, "can't get link size")
+                if(link_msg_size >= H5O_MESG_MAX_SIZE)
+                    use_new_dense = TRUE;
+            } /* end for */
+
+            if(use_new_dense) {
+                htri_t pline_exists;    /* Whether the pipeline message exists */
+
+                /* Get the pipeline message, if it exists */
+                if((pline_exists = H5O_msg_exists(grp_oloc, H5O_PLINE_ID)) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "unable to read object header")
+                if(pline_exists) {
+                    if(NULL == H5O_msg_read(grp_oloc, H5O_PLINE_ID, &tmp_pline))
+                        HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get link pipeline")
+                    pline = &tmp_pline;
+                } /* end if */
+
+                /* Retrieve the 'link' messages already in the group */
+                if(H5G__compact_build_table(grp_oloc, &linfo, H5_INDEX_NAME, H5_ITER_NATIVE, &ltable) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't build link table")
+
+                /* The group doesn't currently have "dense" storage for links */
+                if(H5G__dense_create(grp_oloc->file, &linfo, pline) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create 'dense' form of new format group")
+
+                /* Remove all the 'link' messages */
+                if(ltable.nlinks > 0) {
+                    if(H5O_msg_remove(grp_oloc, H5O_LINK_ID, H5O_ALL, FALSE) < 0)
+                        HGOTO_ERROR(H5E_SYM, H5E_CANTDELETE, FAIL, "unable to delete link messages")
+
+                    /* Put the links that were in the group ahead of the new links */
+                    if(NULL == (all_lnks = (H5O_link_t *)H5MM_malloc((ltable.nlinks + nlinks) * sizeof(H5O_link_t))))
+                        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "memory allocation failed")
+                    HDmemcpy(all_lnks, ltable.lnks, ltable.nlinks * sizeof(H5O_link_t));
+                    HDmemcpy(all_lnks + ltable.nlinks, lnks, nlinks * sizeof(H5O_link_t));
+                } /* end if */
+            } /* end if */
+        } /* end else */
+
+        if(use_new_dense) {
+            /* Insert into dense link storage */
+            if(all_lnks) {
+                if(H5G__dense_insert_multi(grp_oloc->file, &linfo, ltable.nlinks + nlinks, all_lnks) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert links into dense storage")
+            } /* end if */
+            else
+                if(H5G__dense_insert_multi(grp_oloc->file, &linfo, nlinks, lnks) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert links into dense storage")
+        } /* end if */
+        else
+            for(u = 0; u < nlinks; u++)
+                /* Insert with link message */
+                if(H5G__compact_insert(grp_oloc, &lnks[u]) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert link as link message")
+
+        /* Increment the number of objects in this group */
+        linfo.nlinks += nlinks;
+        if(H5O_msg_write(grp_oloc, H5O_LINFO_ID, 0, H5O_UPDATE_TIME, &linfo) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't update link info message")
+    } /* end if */
+    else {
+        H5O_stab_t stab;                /* Symbol table message */
+
+        /* Check for links that need a "new format" group */
+        for(u = 0; u < nlinks; u++)
+            if(lnks[u].cset != H5T_CSET_ASCII || lnks[u].type > H5L_TYPE_BUILTIN_MAX)
+                break;
+        if(u < nlinks) {
+            /* Insert the links one at a time, letting the group be converted */
+            for(u = 0; u < nlinks; u++)
+                if(H5G_obj_insert(grp_oloc, lnks[u].name, &lnks[u], adj_link, obj_type, crt_info ? crt_info[u] : NULL) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert link into group")
+
+            /* Done with insertion now */
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+
+        /* Retrieve symbol table message */
+        if(NULL == H5O_msg_read(grp_oloc, H5O_STAB_ID, &stab))
+            HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "not a symbol table")
+
+        /* Insert into symbol table */
+        for(u = 0; u < nlinks; u++)
+            if(H5G__stab_insert_real(grp_oloc->file, &stab, lnks[u].name, &lnks[u], obj_type, crt_info ? crt_info[u] : NULL) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert entry into symbol table")
+    } /* end else */
+
+    /* Increment link count on objects, if requested, for hard links */
+    if(adj_link)
+        for(u = 0; u < nlinks; u++)
+            if(lnks[u].type == H5L_TYPE_HARD) {
+                H5O_loc_t obj_oloc;     /* Object location */
+                H5O_loc_reset(&obj_oloc);
+
+                /* Create temporary object location */
+                obj_oloc.file = grp_oloc->file;
+                obj_oloc.addr = lnks[u].u.hard.addr;
+
+                /* Increment reference count for object */
+                if(H5O_link(&obj_oloc, 1) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_LINKCOUNT, FAIL, "unable to increment hard link count")
+            } /* end if */
+
+done:
+    /* Free any space used by the pipeline message */
+    if(pline && H5O_msg_reset(H5O_PLINE_ID, pline) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CANTFREE, FAIL, "can't release pipeline")
+    if(H5G__link_release_table(&ltable) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CANTFREE, FAIL, "unable to release link table")
+    if(all_lnks)
+        all_lnks = (H5O_link_t *)H5MM_xfree(all_lnks);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5G_obj_insert_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G__obj_iterate
@@ -981,6 +1300,10 @@ H5G_obj_remove(const H5O_loc_t *oloc, H5RS_str_t *grp_full_path_r, const char *n
     HDassert(oloc);
     HDassert(name && *name);
 
+    /* Paths resolved before the links in the group change can't be reused */
+    if(H5G_path_cache_clear(oloc->file) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't empty path cache")
+
     /* Attempt to get the link info for this group */
     if((linfo_exists = H5G__obj_get_linfo(oloc, &linfo)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -1045,6 +1368,10 @@ H5G_obj_remove_by_idx(const H5O_loc_t *grp_oloc, H5RS_str_t *grp_full_path_r,
     /* Sanity check */
     HDassert(grp_oloc && grp_oloc->file);
 
+    /* Paths resolved before the links in the group change can't be reused */
+    if(H5G_path_cache_clear(grp_oloc->file) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't empty path cache")
+
     /* Attempt to get the link info for this group */
     if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -0,0 +1,309 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:		H5Gpath.c
+ *
+ * Purpose:		Cache of paths resolved by group traversal.
+ *
+ *                      Each file keeps the paths from its root group that
+ *                      were resolved through hard links only, along with
+ *                      the group holding the last link and a copy of that
+ *                      link, so that traversing the same path again doesn't
+ *                      have to look up every component.  The cache is
+ *                      emptied whenever a link is inserted or removed in
+ *                      the file, a file is mounted on or unmounted from it,
+ *                      or an object in it is refreshed.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#define H5F_FRIEND		/*suppress error about including H5Fpkg	  */
+#include "H5Gmodule.h"          /* This source code file is part of the H5G module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fpkg.h"		/* File access				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
+#include "H5Gpkg.h"		/* Groups		  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
+#include "H5SLprivate.h"	/* Skip lists				*/
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Maximum # of paths cached for a file, before the cache is emptied */
+#define H5G_PATH_CACHE_MAX_NENTRIES     1024
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* A cached path */
+typedef struct H5G_path_ent_t {
+    char *path;                 /* Path from the root group (key) */
+    haddr_t grp_addr;           /* Address of the group holding the last link */
+    H5O_link_t lnk;             /* Copy of the (hard) link for the last component */
+} H5G_path_ent_t;
+
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static herr_t H5G__path_cache_free_cb(void *item, void *key, void *op_data);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5G_path_ent_t struct */
+H5FL_DEFINE_STATIC(H5G_path_ent_t);
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__path_cache_key
+ *
+ * Purpose:	Check whether NAME is in the form that is cached, i.e.
+ *		components separated by single slashes, without "."
+ *		components or a trailing slash.
+ *
+ * Return:	Success:	Pointer into NAME past any leading slashes,
+ *				which is the key for the path.
+ *
+ *		Failure:	NULL, if NAME can't be cached
+ *
+ *-------------------------------------------------------------------------
+ */
+const char *
+H5G__path_cache_key(const char *name)
+{
+    const char *s;                      /* Start of current component */
+    const char *ret_value = NULL;       /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(name);
+
+    /* Skip leading slashes */
+    while('/' == *name)
+        name++;
+
+    /* Check each component */
+    s = name;
+    while(1) {
+        const char *p = s;
+
+        while(*p && '/' != *p)
+            p++;
+
+        /* Empty (from "//" or a trailing slash) or "." components aren't cached */
+        if(p == s || (p - s == 1 && '.' == *s))
+            HGOTO_DONE(NULL)
+
+        if(!*p)
+            break;
+        s = p + 1;
+    } /* end while */
+
+    ret_value = name;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__path_cache_key() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__path_cache_lookup
+ *
+ * Purpose:	Look up PATH (a key from H5G__path_cache_key) in the file's
+ *		path cache.  If it's found, the address of the group holding
+ *		the last link is returned in GRP_ADDR and the link is copied
+ *		into LNK.
+ *
+ * Return:	TRUE if found, FALSE if not, FAIL on error
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5G__path_cache_lookup(const H5F_t *f, const char *path, haddr_t *grp_addr,
+    H5O_link_t *lnk)
+{
+    H5G_path_ent_t *ent;                /* Cached path */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(path);
+    HDassert(grp_addr);
+    HDassert(lnk);
+
+    if(f->shared->path_cache && (ent = (H5G_path_ent_t *)H5SL_search(f->shared->path_cache, path))) {
+        if(NULL == H5O_msg_copy(H5O_LINK_ID, &ent->lnk, lnk))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTCOPY, FAIL, "can't copy link message")
+        *grp_addr = ent->grp_addr;
+        ret_value = TRUE;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__path_cache_lookup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__path_cache_insert
+ *
+ * Purpose:	Cache PATH (a key from H5G__path_cache_key) as resolving to
+ *		the hard link LNK in the group at GRP_ADDR.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__path_cache_insert(const H5F_t *f, const char *path, haddr_t grp_addr,
+    const H5O_link_t *lnk)
+{
+    H5G_path_ent_t *ent = NULL;         /* New cached path */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(path);
+    HDassert(H5F_addr_defined(grp_addr));
+    HDassert(lnk);
+    HDassert(H5L_TYPE_HARD == lnk->type);
+
+    /* Create the cache, or start it over when it's full */
+    if(NULL == f->shared->path_cache) {
+        if(NULL == (f->shared->path_cache = H5SL_create(H5SL_TYPE_STR, NULL)))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTCREATE, FAIL, "can't create path cache")
+    } /* end if */
+    else if(H5SL_count(f->shared->path_cache) >= H5G_PATH_CACHE_MAX_NENTRIES) {
+        if(H5SL_free(f->shared->path_cache, H5G__path_cache_free_cb, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't empty path cache")
+    } /* end if */
+    else if(H5SL_search(f->shared->path_cache, path))
+        HGOTO_DONE(SUCCEED)
+
+    /* Set up the cached path */
+    if(NULL == (ent = H5FL_CALLOC(H5G_path_ent_t)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    if(NULL == (ent->path = H5MM_strdup(path)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    ent->grp_addr = grp_addr;
+    if(NULL == H5O_msg_copy(H5O_LINK_ID, lnk, &ent->lnk))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTCOPY, FAIL, "can't copy link message")
+
+    if(H5SL_insert(f->shared->path_cache, ent, ent->path) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't insert path into cache")
+    ent = NULL;
+
+done:
+    if(ent) {
+        if(ent->lnk.name)
+            H5O_msg_reset(H5O_LINK_ID, &ent->lnk);
+        H5MM_xfree(ent->path);
+        ent = H5FL_FREE(H5G_path_ent_t, ent);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__path_cache_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__path_cache_free_cb
+ *
+ * Purpose:	Release a cached path.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__path_cache_free_cb(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *op_data)
+{
+    H5G_path_ent_t *ent = (H5G_path_ent_t *)item;       /* Cached path */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(ent);
+
+    H5O_msg_reset(H5O_LINK_ID, &ent->lnk);
+    H5MM_xfree(ent->path);
+    ent = H5FL_FREE(H5G_path_ent_t, ent);
+
+    FUNC_LEAVE_NOAPI(0)
+} /* end H5G__path_cache_free_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_path_cache_clear
+ *
+ * Purpose:	Empty the path cache for a file, when links in it may have
+ *		changed or the file is closing.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_path_cache_clear(const H5F_t *f)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    if(f->shared->path_cache) {
+        if(H5SL_destroy(f->shared->path_cache, H5G__path_cache_free_cb, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release path cache")
+        f->shared->path_cache = NULL;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_path_cache_clear() */
+
@@ -329,6 +329,8 @@ H5FL_EXTERN(H5G_shared_t);
  * General group routines
  */
 H5_DLL H5G_t *H5G__create(H5F_t *file, H5G_obj_create_t *gcrt_info);
+H5_DLL herr_t H5G__create_multi(const H5G_loc_t *loc, const char *name,
+    size_t count, const char *names[], hid_t gcpl_id);
 H5_DLL H5G_t *H5G__create_named(const H5G_loc_t *loc, const char *name,
     hid_t lcpl_id, hid_t gcpl_id);
 H5_DLL H5G_t *H5G__open_name(const H5G_loc_t *loc, const char *name);
@@ -344,6 +346,24 @@ H5_DLL herr_t H5G__traverse_special(const H5G_loc_t *grp_loc,
     const H5O_link_t *lnk, unsigned target, hbool_t last_comp,
     H5G_loc_t *obj_loc, hbool_t *obj_exists);
 
+/*
+ * Link name filter routines
+ */
+H5_DLL htri_t H5G__name_filter_check(H5F_t *f, const H5O_linfo_t *linfo,
+    uint32_t name_hash);
+H5_DLL herr_t H5G__name_filter_add(const H5F_t *f, haddr_t bt2_addr,
+    uint32_t name_hash);
+H5_DLL herr_t H5G__name_filter_remove(const H5F_t *f, haddr_t bt2_addr);
+
+/*
+ * Resolved path cache routines
+ */
+H5_DLL const char *H5G__path_cache_key(const char *name);
+H5_DLL htri_t H5G__path_cache_lookup(const H5F_t *f, const char *path,
+    haddr_t *grp_addr, H5O_link_t *lnk);
+H5_DLL herr_t H5G__path_cache_insert(const H5F_t *f, const char *path,
+    haddr_t grp_addr, const H5O_link_t *lnk);
+
 /*
  * Utility functions
  */
@@ -428,6 +448,9 @@ H5_DLL herr_t H5G__link_release_table(H5G_link_table_t *ltable);
 H5_DLL herr_t H5G__link_name_replace(H5F_t *file, H5RS_str_t *grp_full_path_r, const H5O_link_t *lnk);
 
 /* Functions that understand "compact" link storage */
+H5_DLL herr_t H5G__compact_build_table(const H5O_loc_t *oloc,
+    const H5O_linfo_t *linfo, H5_index_t idx_type, H5_iter_order_t order,
+    H5G_link_table_t *ltable);
 H5_DLL herr_t H5G__compact_insert(const H5O_loc_t *grp_oloc, H5O_link_t *obj_lnk);
 H5_DLL ssize_t H5G__compact_get_name_by_idx(const H5O_loc_t *oloc,
     const H5O_linfo_t *linfo, H5_index_t idx_type, H5_iter_order_t order,
@@ -453,8 +476,12 @@ H5_DLL herr_t H5G__dense_create(H5F_t *f, H5O_linfo_t *linfo,
     const H5O_pline_t *pline);
 H5_DLL herr_t H5G__dense_insert(H5F_t *f, const H5O_linfo_t *linfo,
     const H5O_link_t *lnk);
+H5_DLL herr_t H5G__dense_insert_multi(H5F_t *f, const H5O_linfo_t *linfo,
+    size_t nlinks, const H5O_link_t *lnks);
 H5_DLL htri_t H5G__dense_lookup(H5F_t *f, const H5O_linfo_t *linfo,
     const char *name, H5O_link_t *lnk);
+H5_DLL htri_t H5G__dense_lookup_multi(H5F_t *f, const H5O_linfo_t *linfo,
+    size_t nnames, const char *names[], size_t *found_idx);
 H5_DLL herr_t H5G__dense_lookup_by_idx(H5F_t *f, const H5O_linfo_t *linfo,
     H5_index_t idx_type, H5_iter_order_t order, hsize_t n, H5O_link_t *lnk);
 H5_DLL herr_t H5G__dense_iterate(H5F_t *f, const H5O_linfo_t *linfo,
@@ -226,6 +226,11 @@ H5_DLL herr_t H5G_link_to_info(const struct H5O_link_t *lnk, H5L_info_t *linfo);
 H5_DLL herr_t H5G_obj_insert(const struct H5O_loc_t *grp_oloc, const char *name,
     struct H5O_link_t *obj_lnk, hbool_t adj_link, H5O_type_t obj_type,
     const void *crt_info);
+H5_DLL herr_t H5G_obj_insert_multi(const struct H5O_loc_t *grp_oloc,
+    size_t nlinks, struct H5O_link_t *lnks, hbool_t adj_link,
+    H5O_type_t obj_type, const void *crt_info[]);
+H5_DLL htri_t H5G_obj_lookup_multi(const struct H5O_loc_t *grp_oloc,
+    size_t nnames, const char *names[], size_t *found_idx);
 H5_DLL ssize_t H5G_obj_get_name_by_idx(const struct H5O_loc_t *oloc, H5_index_t idx_type,
     H5_iter_order_t order, hsize_t n, char* name, size_t size);
 H5_DLL herr_t H5G_obj_remove(const struct H5O_loc_t *oloc, H5RS_str_t *grp_full_path_r,
@@ -294,5 +299,15 @@ H5_DLL herr_t H5G_root_loc(H5F_t *f, H5G_loc_t *loc);
 H5_DLL herr_t H5G_root_free(H5G_t *grp);
 H5_DLL H5G_t *H5G_rootof(H5F_t *f);
 
+/*
+ * These functions operate on the resolved path cache
+ */
+H5_DLL herr_t H5G_path_cache_clear(const H5F_t *f);
+
+/*
+ * These functions operate on the link name filters
+ */
+H5_DLL herr_t H5G_name_filter_clear(const H5F_t *f);
+
 #endif /* _H5Gprivate_H */
 
@@ -486,6 +486,9 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
     char                *comp;          /* Pointer to buffer for path components */
     H5WB_t              *wb = NULL;     /* Wrapped buffer for temporary buffer */
     hbool_t last_comp = FALSE;          /* Flag to indicate that a component is the last component in the name */
+    H5G_t               *root_grp;      /* Root group of file           */
+    const char          *key = NULL;    /* Key for the name in the path cache (NULL if not cached) */
+    hbool_t cached_lnk = FALSE;         /* Flag to indicate that the link came from the path cache */
     herr_t              ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_STATIC
@@ -499,14 +502,12 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
      * Where does the searching start?  For absolute names it starts at the
      * root of the file; for relative names it starts at CWG.
      */
+    /* Look up root group of the file */
+    root_grp = H5G_rootof(_loc->oloc->file);
+    HDassert(root_grp);
+
     /* Check if we need to get the root group's entry */
     if('/' == *name) {
-        H5G_t *root_grp;         /* Temporary pointer to root group of file */
-
-        /* Look up root group for starting location */
-        root_grp = H5G_rootof(_loc->oloc->file);
-        HDassert(root_grp);
-
         /* Set the location entry to the root group's info */
         loc.oloc = &(root_grp->oloc);
         loc.path = &(root_grp->path);
@@ -516,6 +517,10 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
         loc.path = _loc->path;
     } /* end else */
 
+    /* Only names traversed from the root group are cached */
+    if(loc.oloc->file == root_grp->oloc.file && H5F_addr_eq(loc.oloc->addr, root_grp->oloc.addr))
+        key = H5G__path_cache_key(name);
+
     /* Set up group & object locations */
     grp_loc.oloc = &grp_oloc;
     grp_loc.path = &grp_path;
@@ -545,6 +550,39 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
     if(NULL == (comp = (char *)H5WB_actual(wb, (HDstrlen(name) + 1))))
         HGOTO_ERROR(H5E_SYM, H5E_NOSPACE, FAIL, "can't get actual buffer")
 
+    /* Check if the name has been resolved before */
+    if(key) {
+        haddr_t cache_grp_addr;         /* Address of group holding the link */
+        htri_t cache_status;            /* Status from path cache lookup */
+
+        if((cache_status = H5G__path_cache_lookup(loc.oloc->file, key, &cache_grp_addr, &lnk/*out*/)) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't look up path in cache")
+        if(cache_status) {
+            const char *s = HDstrrchr(key, '/');        /* Start of last component */
+
+            link_valid = TRUE;
+            cached_lnk = TRUE;
+
+            /* Skip to the group holding the link for the last component */
+            if(s) {
+                HDmemcpy(comp, key, (size_t)(s - key));
+                comp[s - key] = '\0';
+
+                H5G_loc_free(&grp_loc);
+                H5G_loc_reset(&grp_loc);
+                if(H5G_name_set(loc.path, grp_loc.path, comp) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "cannot set name")
+                grp_loc.oloc->file = loc.oloc->file;
+                grp_loc.oloc->addr = cache_grp_addr;
+                name = s + 1;
+            } /* end if */
+            else {
+                HDassert(H5F_addr_eq(grp_loc.oloc->addr, cache_grp_addr));
+                name = key;
+            } /* end else */
+        } /* end if */
+    } /* end if */
+
     /* Traverse the path */
     while((name = H5G__component(name, &nchars)) && *name) {
         const char *s;                  /* Temporary string pointer */
@@ -570,15 +608,21 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
         if(!((s = H5G__component(name + nchars, NULL)) && *s))
             last_comp = TRUE;
 
-        /* If there's valid information in the link, reset it */
-        if(link_valid) {
-            H5O_msg_reset(H5O_LINK_ID, &lnk);
-            link_valid = FALSE;
+        /* Get information for object in current group */
+        if(cached_lnk) {
+            HDassert(last_comp);
+            lookup_status = TRUE;
         } /* end if */
+        else {
+            /* If there's valid information in the link, reset it */
+            if(link_valid) {
+                H5O_msg_reset(H5O_LINK_ID, &lnk);
+                link_valid = FALSE;
+            } /* end if */
 
-        /* Get information for object in current group */
-        if((lookup_status = H5G__obj_lookup(grp_loc.oloc, comp, &lnk/*out*/)) < 0)
-            HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't look up component")
+            if((lookup_status = H5G__obj_lookup(grp_loc.oloc, comp, &lnk/*out*/)) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't look up component")
+        } /* end else */
         obj_exists = FALSE;
 
         /* If the lookup was OK, build object location and traverse special links, etc. */
@@ -600,6 +644,10 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
             /* (soft links, user-defined links, file mounting, etc.) */
             if(H5G__traverse_special(&grp_loc, &lnk, target, last_comp, &obj_loc, &obj_exists) < 0)
                 HGOTO_ERROR(H5E_LINK, H5E_TRAVERSE, FAIL, "special link traversal failed")
+
+            /* Only names resolved through hard links within the file are cached */
+            if(H5L_TYPE_HARD != lnk.type || (!last_comp && obj_loc.oloc->file != grp_loc.oloc->file))
+                key = NULL;
         } /* end if */
 
         /* Check for last component in name provided */
@@ -609,6 +657,12 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
 
             /* Set callback parameters appropriately, based on link being found */
             if(lookup_status) {
+                /* Remember how the name was resolved (before the callback
+                 * has a chance to change it) */
+                if(key && !cached_lnk)
+                    if(H5G__path_cache_insert(grp_loc.oloc->file, key, grp_loc.oloc->addr, &lnk) < 0)
+                        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't cache path")
+
                 cb_lnk = &lnk;
                 if(obj_exists)
                     cb_loc = &obj_loc;
@@ -40,9 +40,9 @@
 #include "H5Ipkg.h"             /* IDs                                      */
 #include "H5MMprivate.h"        /* Memory management                        */
 #include "H5Oprivate.h"         /* Object headers                           */
-#include "H5SLprivate.h"        /* Skip Lists                               */
 #include "H5Tpkg.h"             /* Datatypes                                */
 #include "H5VLprivate.h"        /* Virtual Object Layer                     */
+#include "H5VMprivate.h"        /* Vectors and arrays                       */
 
 
 /* Local Macros */
@@ -51,6 +51,16 @@
 #define H5I_MAKE(g,i)	((((hid_t)(g) & TYPE_MASK) << ID_BITS) |	  \
 			     ((hid_t)(i) & ID_MASK))
 
+/* Minimum number of slots in a type's hash table of IDs */
+#define H5I_MIN_SLOTS   64
+
+/* Marker for a hash table slot whose ID has been removed */
+#define H5I_REMOVED     (&H5I_removed_g)
+
+/* Home slot of an ID in a hash table with N slots (IDs are handed out
+ * sequentially, so the low bits of the atom index spread them evenly) */
+#define H5I_HASH(i,n)   ((size_t)((i) & ID_MASK) & ((n) - 1))
+
 /* Local typedefs */
 
 /* Atom information structure used */
@@ -61,15 +71,24 @@ typedef struct H5I_id_info_t {
     const void	*obj_ptr;	/* pointer associated with the atom	    */
 } H5I_id_info_t;
 
+/* Pointer to atom information, for the hash table free list */
+typedef H5I_id_info_t *H5I_id_info_ptr_t;
+
 /* ID type structure used */
 typedef struct {
     const H5I_class_t *cls;     /* Pointer to ID class                      */
     unsigned	init_count;	/* # of times this type has been initialized*/
     uint64_t	id_count;	/* Current number of IDs held		    */
     uint64_t	nextid;		/* ID to use for the next atom		    */
-    H5SL_t      *ids;           /* Pointer to skip list that stores IDs     */
+    H5I_id_info_t **ids;        /* Hash table of IDs (open addressing)      */
+    size_t      nslots;         /* Number of slots in hash table (power of 2) */
+    size_t      nused;          /* # of slots holding IDs or removed markers */
+    H5I_id_info_t *last_id;     /* Most recently looked up ID               */
 } H5I_id_type_t;
 
+/* Callback for iterating over the IDs in a type */
+typedef int (*H5I_id_op_t)(H5I_id_info_t *id_ptr, void *udata);
+
 typedef struct {
     H5I_search_func_t   app_cb;     /* Application's callback routine */
     void               *app_key;    /* Application's "key" (user data) */
@@ -81,13 +100,6 @@ typedef struct {
     void               *op_data;        /* Application's user data */
 } H5I_iterate_pub_ud_t;
 
-/* User data for iterator callback for retrieving an ID corresponding to an object pointer */
-typedef struct {
-    const void         *object;         /* object pointer to search for */
-    H5I_type_t          obj_type;       /* type of object we are searching for */
-    hid_t               ret_id;         /* ID returned */
-} H5I_get_id_ud_t;
-
 /* User data for iterator callback for ID iteration */
 typedef struct {
     H5I_search_func_t   user_func;      /* 'User' function to invoke */
@@ -119,9 +131,15 @@ static H5I_id_type_t *H5I_id_type_list_g[H5I_MAX_NUM_TYPES];
 /* and/or increase size of hid_t */
 static H5I_type_t H5I_next_type = (H5I_type_t) H5I_NTYPES;
 
+/* Marker for removed IDs in the hash tables (only its address is used) */
+static H5I_id_info_t H5I_removed_g;
+
 /* Declare a free list to manage the H5I_id_info_t struct */
 H5FL_DEFINE_STATIC(H5I_id_info_t);
 
+/* Declare a free list to manage the hash tables of IDs */
+H5FL_SEQ_DEFINE_STATIC(H5I_id_info_ptr_t);
+
 /* Declare a free list to manage the H5I_id_type_t struct */
 H5FL_DEFINE_STATIC(H5I_id_type_t);
 
@@ -132,17 +150,24 @@ H5FL_EXTERN(H5VL_object_t);
 
 /*--------------------- Local function prototypes ---------------------------*/
 static void *H5I__unwrap(void *obj_ptr, H5I_type_t type);
-static htri_t H5I__clear_type_cb(void *_id, void *key, void *udata);
+static int H5I__clear_type_cb(H5I_id_info_t *id, void *udata);
 static int H5I__destroy_type(H5I_type_t type);
 static void *H5I__remove_verify(hid_t id, H5I_type_t id_type);
 static void *H5I__remove_common(H5I_id_type_t *type_ptr, hid_t id);
 static int H5I__inc_type_ref(H5I_type_t type);
 static int H5I__get_type_ref(H5I_type_t type);
 static int H5I__search_cb(void *obj, hid_t id, void *_udata);
+static H5I_id_info_t **H5I__find_slot(const H5I_id_type_t *type_ptr, hid_t id);
+static herr_t H5I__resize_ids(H5I_id_type_t *type_ptr, size_t nslots);
+static herr_t H5I__insert_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr);
+static H5I_id_info_t *H5I__remove_id(H5I_id_type_t *type_ptr, hid_t id);
+static int H5I__cmp_id(const void *_id1, const void *_id2);
+static int H5I__iterate_ids(H5I_id_type_t *type_ptr, H5I_id_op_t op,
+    void *udata);
 static H5I_id_info_t *H5I__find_id(hid_t id);
 static int H5I__iterate_pub_cb(void *obj, hid_t id, void *udata);
-static int H5I__find_id_cb(void *_item, void *_key, void *_udata);
-static int H5I__id_dump_cb(void *_item, void *_key, void *_udata);
+static int H5I__iterate_cb(H5I_id_info_t *item, void *_udata);
+static int H5I__id_dump_cb(H5I_id_info_t *item, void *_udata);
 
 
 /*-------------------------------------------------------------------------
@@ -317,8 +342,11 @@ H5I_register_type(const H5I_class_t *cls)
         type_ptr->cls = cls;
         type_ptr->id_count = 0;
         type_ptr->nextid = cls->reserved;
-        if(NULL == (type_ptr->ids = H5SL_create(H5SL_TYPE_HID, NULL)))
-            HGOTO_ERROR(H5E_ATOM, H5E_CANTCREATE, FAIL, "skip list creation failed")
+        type_ptr->nslots = H5I_MIN_SLOTS;
+        type_ptr->nused = 0;
+        type_ptr->last_id = NULL;
+        if(NULL == (type_ptr->ids = H5FL_SEQ_CALLOC(H5I_id_info_ptr_t, type_ptr->nslots)))
+            HGOTO_ERROR(H5E_ATOM, H5E_CANTALLOC, FAIL, "ID hash table allocation failed")
     } /* end if */
 
     /* Increment the count of the times this type has been initialized */
@@ -328,7 +356,7 @@ done:
     if(ret_value < 0) {	/* Clean up on error */
         if(type_ptr) {
             if(type_ptr->ids)
-                H5SL_close(type_ptr->ids);
+                type_ptr->ids = H5FL_SEQ_FREE(H5I_id_info_ptr_t, type_ptr->ids);
             (void)H5FL_FREE(H5I_id_type_t, type_ptr);
         } /* end if */
     } /* end if */
@@ -562,7 +590,7 @@ H5I_clear_type(H5I_type_t type, hbool_t force, hbool_t app_ref)
     udata.app_ref = app_ref;
 
     /* Attempt to free all ids in the type */
-    if(H5SL_try_free_safe(udata.type_ptr->ids, H5I__clear_type_cb, &udata) < 0)
+    if(H5I__iterate_ids(udata.type_ptr, H5I__clear_type_cb, &udata) < 0)
         HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, FAIL, "can't free ids in type")
 
 done:
@@ -574,21 +602,21 @@ done:
  * Function:    H5I__clear_type_cb
  *
  * Purpose:     Attempts to free the specified ID, calling the free
- *              function for the object.
+ *              function for the object, and removes it from the type if
+ *              it was freed.
  *
- * Return:      TRUE/FALSE/FAIL
+ * Return:      H5_ITER_CONT (always)
  *
  * Programmer:  Neil Fortner
  *              Friday, July 10, 2015
  *
  *-------------------------------------------------------------------------
  */
-static htri_t
-H5I__clear_type_cb(void *_id, void H5_ATTR_UNUSED *key, void *_udata)
+static int
+H5I__clear_type_cb(H5I_id_info_t *id, void *_udata)
 {
-    H5I_id_info_t       *id = (H5I_id_info_t *)_id; /* Current ID being worked with */
     H5I_clear_type_ud_t *udata = (H5I_clear_type_ud_t *)_udata; /* udata struct */
-    htri_t              ret_value = FALSE;    /* Return value */
+    hbool_t             remove_id = FALSE;    /* Whether to remove the ID */
 
     FUNC_ENTER_STATIC_NOERR
 
@@ -614,25 +642,25 @@ H5I__clear_type_cb(void *_id, void H5_ATTR_UNUSED *key, void *_udata)
 #endif /*H5I_DEBUG*/
 
                 /* Indicate node should be removed from list */
-                ret_value = TRUE;
+                remove_id = TRUE;
             } /* end if */
         } /* end if */
         else {
             /* Indicate node should be removed from list */
-            ret_value = TRUE;
+            remove_id = TRUE;
         } /* end else */
 
         /* Remove ID if requested */
-        if(ret_value) {
+        if(remove_id) {
+            /* Remove the ID from the type's hash table */
+            H5I__remove_id(udata->type_ptr, id->id);
+
             /* Free ID info */
             id = H5FL_FREE(H5I_id_info_t, id);
-
-            /* Decrement the number of IDs in the type */
-            udata->type_ptr->id_count--;
         } /* end if */
     } /* end if */
 
-    FUNC_LEAVE_NOAPI(ret_value)
+    FUNC_LEAVE_NOAPI(H5_ITER_CONT)
 } /* end H5I__clear_type_cb() */
 
 
@@ -709,9 +737,7 @@ H5I__destroy_type(H5I_type_t type)
     if(type_ptr->cls->flags & H5I_CLASS_IS_APPLICATION)
         type_ptr->cls = H5FL_FREE(H5I_class_t, (void *)type_ptr->cls);
 
-    if(H5SL_close(type_ptr->ids) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTCLOSEOBJ, FAIL, "can't close skip list")
-    type_ptr->ids = NULL;
+    type_ptr->ids = H5FL_SEQ_FREE(H5I_id_info_ptr_t, type_ptr->ids);
 
     type_ptr = H5FL_FREE(H5I_id_type_t, type_ptr);
     H5I_id_type_list_g[type] = NULL;
@@ -792,9 +818,8 @@ H5I_register(H5I_type_t type, const void *object, hbool_t app_ref)
     id_ptr->obj_ptr     = object;
 
     /* Insert into the type */
-    if (H5SL_insert(type_ptr->ids, id_ptr, &id_ptr->id) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert ID node into skip list")
-    type_ptr->id_count++;
+    if (H5I__insert_id(type_ptr, id_ptr) < 0)
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert ID node into hash table")
     type_ptr->nextid++;
 
     /* Sanity check for the 'nextid' getting too large and wrapping around */
@@ -867,9 +892,8 @@ H5I_register_using_existing_id(H5I_type_t type, void *object, hbool_t app_ref, h
     id_ptr->obj_ptr     = object;
 
     /* Insert into the type */
-    if(H5SL_insert(type_ptr->ids, id_ptr, &id_ptr->id) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID node into skip list")
-    type_ptr->id_count++;
+    if(H5I__insert_id(type_ptr, id_ptr) < 0)
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID node into hash table")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1175,16 +1199,13 @@ H5I__remove_common(H5I_id_type_t *type_ptr, hid_t id)
     HDassert(type_ptr);
 
     /* Get the ID node for the ID */
-    if(NULL == (curr_id = (H5I_id_info_t *)H5SL_remove(type_ptr->ids, &id)))
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, NULL, "can't remove ID node from skip list")
+    if(NULL == (curr_id = H5I__remove_id(type_ptr, id)))
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, NULL, "can't remove ID node from hash table")
 
     /* (Casting away const OK -QAK) */
     ret_value = (void *)curr_id->obj_ptr;
     curr_id = H5FL_FREE(H5I_id_info_t, curr_id);
 
-    /* Decrement the number of IDs in the type */
-    (type_ptr->id_count)--;
-
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I__remove_common() */
@@ -1928,7 +1949,7 @@ H5I__iterate_pub_cb(void H5_ATTR_UNUSED *obj, hid_t id, void *_udata)
 {
     H5I_iterate_pub_ud_t   *udata = (H5I_iterate_pub_ud_t *)_udata; /* User data for callback */
     herr_t                  cb_ret_val;                             /* User callback return value */
-    int                     ret_value = H5_ITER_ERROR;              /* Callback return value */
+    int                     ret_value = H5_ITER_CONT;               /* Callback return value */
 
     FUNC_ENTER_STATIC_NOERR
 
@@ -2005,9 +2026,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5I__iterate_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__iterate_cb(H5I_id_info_t *item, void *_udata)
 {
-    H5I_id_info_t *item = (H5I_id_info_t *)_item;       /* Pointer to the ID node */
     H5I_iterate_ud_t *udata = (H5I_iterate_ud_t *)_udata; /* User data for callback */
     int ret_value = H5_ITER_CONT;     /* Callback return value */
 
@@ -2081,7 +2101,6 @@ H5I_iterate(H5I_type_t type, H5I_search_func_t func, void *udata, hbool_t app_re
     /* Only iterate through ID list if it is initialized and there are IDs in type */
     if (type_ptr && type_ptr->init_count > 0 && type_ptr->id_count > 0) {
         H5I_iterate_ud_t iter_udata;    /* User data for iteration callback */
-        herr_t iter_status;             /* Iteration status */
 
         /* Set up iterator user data */
         iter_udata.user_func    = func;
@@ -2090,7 +2109,7 @@ H5I_iterate(H5I_type_t type, H5I_search_func_t func, void *udata, hbool_t app_re
         iter_udata.obj_type     = type;
 
         /* Iterate over IDs */
-        if ((iter_status = H5SL_iterate(type_ptr->ids, H5I__iterate_cb, &iter_udata)) < 0)
+        if (H5I__iterate_ids(type_ptr, H5I__iterate_cb, &iter_udata) < 0)
             HGOTO_ERROR(H5E_ATOM, H5E_BADITER, FAIL, "iteration failed")
     } /* end if */
 
@@ -2098,6 +2117,281 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_iterate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__find_slot
+ *
+ * Purpose:     Locate the slot holding an ID in a type's hash table.
+ *
+ * Return:      Success:    Pointer to the slot holding the ID
+ *
+ *              Failure:    NULL (the ID isn't in the type)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_info_t **
+H5I__find_slot(const H5I_id_type_t *type_ptr, hid_t id)
+{
+    H5I_id_info_t *item;                /* Pointer to the ID node */
+    size_t idx;                         /* Index of slot */
+    H5I_id_info_t **ret_value = NULL;   /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(type_ptr);
+    HDassert(type_ptr->ids);
+
+    /* Probe from the ID's home slot until reaching an empty slot.
+     * (The table is never more than half full, so there always is one)
+     */
+    idx = H5I_HASH(id, type_ptr->nslots);
+    while (NULL != (item = type_ptr->ids[idx])) {
+        if (item != H5I_REMOVED && item->id == id)
+            HGOTO_DONE(&type_ptr->ids[idx])
+        idx = (idx + 1) & (type_ptr->nslots - 1);
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__find_slot() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__resize_ids
+ *
+ * Purpose:     Rebuild a type's hash table with a new number of slots,
+ *              dropping the markers for removed IDs.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__resize_ids(H5I_id_type_t *type_ptr, size_t nslots)
+{
+    H5I_id_info_t **new_ids;            /* New hash table */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(type_ptr);
+    HDassert(POWER_OF_TWO(nslots));
+    HDassert(nslots > 2 * type_ptr->id_count);
+
+    if (NULL == (new_ids = H5FL_SEQ_CALLOC(H5I_id_info_ptr_t, nslots)))
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTALLOC, FAIL, "ID hash table allocation failed")
+
+    /* Move the IDs over */
+    for (u = 0; u < type_ptr->nslots; u++) {
+        H5I_id_info_t *item = type_ptr->ids[u];     /* Pointer to the ID node */
+
+        if (item && item != H5I_REMOVED) {
+            size_t idx = H5I_HASH(item->id, nslots);    /* Index of slot */
+
+            while (new_ids[idx])
+                idx = (idx + 1) & (nslots - 1);
+            new_ids[idx] = item;
+        } /* end if */
+    } /* end for */
+
+    type_ptr->ids = H5FL_SEQ_FREE(H5I_id_info_ptr_t, type_ptr->ids);
+    type_ptr->ids = new_ids;
+    type_ptr->nslots = nslots;
+    type_ptr->nused = (size_t)type_ptr->id_count;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__resize_ids() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__insert_id
+ *
+ * Purpose:     Add an ID to a type's hash table.  The ID must not be in
+ *              the table already.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__insert_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr)
+{
+    size_t idx;                         /* Index of slot */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(type_ptr);
+    HDassert(id_ptr);
+    HDassert(NULL == H5I__find_slot(type_ptr, id_ptr->id));
+
+    /* Rebuild the table once it is half full, counting the slots of
+     * removed IDs, so that probe sequences stay short.  The new table
+     * is at most one quarter full.
+     */
+    if (2 * (type_ptr->nused + 1) > type_ptr->nslots) {
+        hsize_t nslots = H5VM_power2up((hsize_t)MAX((uint64_t)H5I_MIN_SLOTS, 4 * (type_ptr->id_count + 1)));
+
+        if (H5I__resize_ids(type_ptr, (size_t)nslots) < 0)
+            HGOTO_ERROR(H5E_ATOM, H5E_CANTALLOC, FAIL, "can't resize ID hash table")
+    } /* end if */
+
+    /* Use the first empty or removed slot, starting at the ID's home slot */
+    idx = H5I_HASH(id_ptr->id, type_ptr->nslots);
+    while (type_ptr->ids[idx] && type_ptr->ids[idx] != H5I_REMOVED)
+        idx = (idx + 1) & (type_ptr->nslots - 1);
+    if (NULL == type_ptr->ids[idx])
+        type_ptr->nused++;
+    type_ptr->ids[idx] = id_ptr;
+    type_ptr->id_count++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__insert_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__remove_id
+ *
+ * Purpose:     Remove an ID from a type's hash table.  The ID node itself
+ *              is not freed.
+ *
+ * Return:      Success:    Pointer to the removed ID node
+ *
+ *              Failure:    NULL (the ID isn't in the type)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_info_t *
+H5I__remove_id(H5I_id_type_t *type_ptr, hid_t id)
+{
+    H5I_id_info_t **slot;               /* Slot holding the ID */
+    size_t mask;                        /* Mask for wrapping slot indices */
+    size_t idx;                         /* Index of slot */
+    H5I_id_info_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(type_ptr);
+
+    if (NULL == (slot = H5I__find_slot(type_ptr, id)))
+        HGOTO_DONE(NULL)
+    ret_value = *slot;
+
+    /* If the next slot is empty, no probe sequence passes through this
+     * slot, or through a run of removed IDs right before it, so all of
+     * them can be emptied.  Otherwise, leave a marker in the slot.
+     */
+    mask = type_ptr->nslots - 1;
+    idx = (size_t)(slot - type_ptr->ids);
+    if (NULL == type_ptr->ids[(idx + 1) & mask]) {
+        do {
+            type_ptr->ids[idx] = NULL;
+            type_ptr->nused--;
+            idx = (idx - 1) & mask;
+        } while (type_ptr->ids[idx] == H5I_REMOVED);
+    } /* end if */
+    else
+        *slot = H5I_REMOVED;
+
+    /* Forget the ID, if it was the last one looked up */
+    if (type_ptr->last_id == ret_value)
+        type_ptr->last_id = NULL;
+
+    /* Decrement the number of IDs in the type */
+    type_ptr->id_count--;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__remove_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__cmp_id
+ *
+ * Purpose:     Compare two IDs, for sorting.
+ *
+ * Return:      -1, 0 or 1, as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5I__cmp_id(const void *_id1, const void *_id2)
+{
+    hid_t id1 = *(const hid_t *)_id1;   /* First ID */
+    hid_t id2 = *(const hid_t *)_id2;   /* Second ID */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI((id1 > id2) - (id1 < id2))
+} /* end H5I__cmp_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__iterate_ids
+ *
+ * Purpose:     Call OP for each ID in a type, in increasing order of ID.
+ *              Stop if OP returns a non-zero value, and return that value.
+ *
+ *              The callback may register and remove IDs in the type.  IDs
+ *              removed before being reached are skipped and IDs registered
+ *              during the iteration aren't visited.
+ *
+ * Return:      Success:    H5_ITER_CONT (0) or the value returned by OP
+ *
+ *              Failure:    H5_ITER_ERROR (-1)
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5I__iterate_ids(H5I_id_type_t *type_ptr, H5I_id_op_t op, void *udata)
+{
+    hid_t *ids = NULL;                  /* Snapshot of the IDs in the type */
+    size_t nids = 0;                    /* Number of IDs in snapshot */
+    size_t u;                           /* Local index variable */
+    int ret_value = H5_ITER_CONT;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(type_ptr);
+    HDassert(op);
+
+    if (0 == type_ptr->id_count)
+        HGOTO_DONE(H5_ITER_CONT)
+
+    /* Take a sorted snapshot of the IDs, since the callback may change the
+     * hash table
+     */
+    if (NULL == (ids = (hid_t *)H5MM_malloc((size_t)type_ptr->id_count * sizeof(hid_t))))
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTALLOC, H5_ITER_ERROR, "memory allocation failed for IDs")
+    for (u = 0; u < type_ptr->nslots; u++)
+        if (type_ptr->ids[u] && type_ptr->ids[u] != H5I_REMOVED)
+            ids[nids++] = type_ptr->ids[u]->id;
+    HDassert(nids == type_ptr->id_count);
+    HDqsort(ids, nids, sizeof(hid_t), H5I__cmp_id);
+
+    /* Visit the IDs that are still in the type */
+    for (u = 0; u < nids; u++) {
+        H5I_id_info_t **slot;           /* Slot holding the ID */
+
+        if (NULL != (slot = H5I__find_slot(type_ptr, ids[u])))
+            if (H5_ITER_CONT != (ret_value = (*op)(*slot, udata)))
+                break;
+    } /* end for */
+
+done:
+    H5MM_xfree(ids);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__iterate_ids() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5I__find_id
@@ -2116,6 +2410,7 @@ H5I__find_id(hid_t id)
 {
     H5I_type_t		type;			/*ID's type		*/
     H5I_id_type_t	*type_ptr;		/*ptr to the type	*/
+    H5I_id_info_t	**slot;			/*hash table slot of ID	*/
     H5I_id_info_t	*ret_value = NULL;	/* Return value */
 
     FUNC_ENTER_STATIC_NOERR
@@ -2129,8 +2424,15 @@ H5I__find_id(hid_t id)
     if (!type_ptr || type_ptr->init_count <= 0)
         HGOTO_DONE(NULL)
 
+    /* Check the most recently used ID first */
+    if (type_ptr->last_id && type_ptr->last_id->id == id)
+        HGOTO_DONE(type_ptr->last_id)
+
     /* Locate the ID node for the ID */
-    ret_value = (H5I_id_info_t *)H5SL_search(type_ptr->ids, &id);
+    if (NULL != (slot = H5I__find_slot(type_ptr, id))) {
+        ret_value = *slot;
+        type_ptr->last_id = ret_value;
+    } /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2225,44 +2527,6 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Iget_file_id() */
 
-
-/*-------------------------------------------------------------------------
- * Function:    H5I__find_id_cb
- *
- * Purpose:     Callback for searching for an ID with a specific pointer
- *
- * Return:      Success:    H5_ITER_CONT (0) or H5_ITER_STOP (1)
- *              Failure:    H5_ITER_ERROR (-1)
- *
- *-------------------------------------------------------------------------
- */
-static int
-H5I__find_id_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
-{
-    H5I_id_info_t *item = (H5I_id_info_t *)_item;       /* Pointer to the ID node */
-    H5I_get_id_ud_t *udata = (H5I_get_id_ud_t *)_udata;     /* Pointer to user data */
-    H5I_type_t type = udata->obj_type;
-    const void *obj_ptr = NULL;
-    int ret_value = H5_ITER_CONT;                       /* Return value */
-
-    FUNC_ENTER_STATIC_NOERR
-
-    /* Sanity check */
-    HDassert(item);
-    HDassert(udata);
-
-    /* Get a pointer to the VOL connector's data */
-    obj_ptr = H5I__unwrap(item->obj_ptr, type);
-
-    /* Check for a match */
-    if (obj_ptr == udata->object) {
-        udata->ret_id = item->id;
-        ret_value = H5_ITER_STOP;
-    } /* end if */
-
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5I__find_id_cb() */
-
 
 /*-------------------------------------------------------------------------
  * Function:    H5I_find_id
@@ -2291,21 +2555,18 @@ H5I_find_id(const void *object, H5I_type_t type, hid_t *id)
     if (!type_ptr || type_ptr->init_count <= 0)
         HGOTO_ERROR(H5E_ATOM, H5E_BADGROUP, FAIL, "invalid type")
 
-    /* Only iterate through ID list if it is initialized and there are IDs in type */
+    /* Only search the ID list if it is initialized and there are IDs in type */
     if (type_ptr->init_count > 0 && type_ptr->id_count > 0) {
-        H5I_get_id_ud_t udata;    /* User data */
-        herr_t iter_status;       /* Iteration status */
+        size_t u;                   /* Local index variable */
 
-        /* Set up iterator user data */
-        udata.object    = object;
-        udata.obj_type  = type;
-        udata.ret_id    = H5I_INVALID_HID;
+        /* Scan the hash table for the lowest ID referring to the object */
+        for (u = 0; u < type_ptr->nslots; u++) {
+            H5I_id_info_t *item = type_ptr->ids[u];     /* Pointer to the ID node */
 
-        /* Iterate over IDs for the ID type */
-        if ((iter_status = H5SL_iterate(type_ptr->ids, H5I__find_id_cb, &udata)) < 0)
-            HGOTO_ERROR(H5E_ATOM, H5E_BADITER, FAIL, "iteration failed")
-
-        *id = udata.ret_id;
+            if (item && item != H5I_REMOVED && H5I__unwrap((void *)item->obj_ptr, type) == object
+                    && (H5I_INVALID_HID == *id || item->id < *id))
+                *id = item->id;
+        } /* end for */
     } /* end if */
 
 done:
@@ -2323,9 +2584,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5I__id_dump_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__id_dump_cb(H5I_id_info_t *item, void *_udata)
 {
-    H5I_id_info_t  *item    = (H5I_id_info_t *)_item;       /* Pointer to the ID node */
     H5I_type_t      type    = *(H5I_type_t *)_udata;        /* User data */
     H5G_name_t     *path    = NULL;                         /* Path to file object */
     const void     *obj_ptr = NULL;                         /* Pointer to VOL connector object */
@@ -2425,7 +2685,7 @@ H5I_dump_ids_for_type(H5I_type_t type)
         /* List */
         if(type_ptr->id_count > 0) {
             HDfprintf(stderr, "	 List:\n");
-            H5SL_iterate(type_ptr->ids, H5I__id_dump_cb, &type);
+            H5I__iterate_ids(type_ptr, H5I__id_dump_cb, &type);
         }
     }
     else
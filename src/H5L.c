@@ -35,6 +35,8 @@
 #include "H5Pprivate.h"         /* Property lists                           */
 #include "H5VLprivate.h"        /* Virtual Object Layer                     */
 
+#include "H5VLnative_private.h" /* Native VOL connector                     */
+
 
 /****************/
 /* Local Macros */
@@ -605,6 +607,106 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Lcreate_hard() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Lcreate_hard_multi
+ *
+ * Purpose:     Creates COUNT hard links in the group NEW_GRP_NAME
+ *              (relative to NEW_LOC_ID), named NEW_NAMES, to the objects
+ *              CUR_NAMES (relative to CUR_LOC_ID).  This is equivalent to
+ *              calling H5Lcreate_hard() for each link, but the group is
+ *              only located and updated once for the whole batch, which
+ *              is much faster when many links are added to a group.
+ *
+ *              Either CUR_LOC_ID or NEW_LOC_ID (but not both) may be
+ *              H5L_SAME_LOC, in which case the other location is used.
+ *              None of the new names may exist in the group already and
+ *              they must be distinct; if any does, no links are created.
+ *              The new names must be plain link names, not paths.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Lcreate_hard_multi(hid_t cur_loc_id, size_t count, const char *cur_names[],
+    hid_t new_loc_id, const char *new_grp_name, const char *new_names[])
+{
+    H5VL_object_t      *vol_obj1 = NULL;        /* Object token of cur_loc_id */
+    H5VL_object_t      *vol_obj2 = NULL;        /* Object token of new_loc_id */
+    H5VL_loc_params_t   loc_params1;
+    H5VL_loc_params_t   loc_params2;
+    size_t              u;                      /* Local index variable */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE6("e", "iz**si*s**s", cur_loc_id, count, cur_names, new_loc_id,
+             new_grp_name, new_names);
+
+    /* Check arguments */
+    if(cur_loc_id == H5L_SAME_LOC && new_loc_id == H5L_SAME_LOC)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "source and destination should not be both H5L_SAME_LOC")
+    if(count > 0 && (!cur_names || !new_names))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "name arrays cannot be NULL")
+    if(!new_grp_name || !*new_grp_name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no group name specified")
+    for(u = 0; u < count; u++) {
+        if(!cur_names[u] || !*cur_names[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no object name specified")
+        if(!new_names[u] || !*new_names[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no link name specified")
+        if(HDstrchr(new_names[u], '/') || !HDstrcmp(new_names[u], "."))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "link name '%s' is not a single component", new_names[u])
+    } /* end for */
+
+    /* Set up collective metadata if appropriate */
+    if(H5CX_set_loc(H5L_SAME_LOC != new_loc_id ? new_loc_id : cur_loc_id) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTSET, FAIL, "can't set collective metadata read info")
+
+    /* Set up current & new location structs */
+    loc_params1.type                            = H5VL_OBJECT_BY_NAME;
+    loc_params1.obj_type                        = H5I_get_type(cur_loc_id);
+    loc_params1.loc_data.loc_by_name.name       = NULL;
+    loc_params1.loc_data.loc_by_name.lapl_id    = H5P_LINK_ACCESS_DEFAULT;
+
+    loc_params2.type                            = H5VL_OBJECT_BY_NAME;
+    loc_params2.obj_type                        = H5I_get_type(new_loc_id);
+    loc_params2.loc_data.loc_by_name.name       = new_grp_name;
+    loc_params2.loc_data.loc_by_name.lapl_id    = H5P_LINK_ACCESS_DEFAULT;
+
+    if(H5L_SAME_LOC != cur_loc_id)
+        /* Get the current location object */
+        if(NULL == (vol_obj1 = (H5VL_object_t *)H5VL_vol_object(cur_loc_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid location identifier")
+    if(H5L_SAME_LOC != new_loc_id)
+        /* Get the new location object */
+        if(NULL == (vol_obj2 = (H5VL_object_t *)H5VL_vol_object(new_loc_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid location identifier")
+
+    /* Make sure that the VOL connectors are the same */
+    if(vol_obj1 && vol_obj2)
+        if(vol_obj1->connector->cls->value != vol_obj2->connector->cls->value)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "Objects are accessed through different VOL connectors and can't be linked")
+
+    /* Use the other location for H5L_SAME_LOC */
+    if(NULL == vol_obj1) {
+        vol_obj1 = vol_obj2;
+        loc_params1.obj_type = loc_params2.obj_type;
+    } /* end if */
+    else if(NULL == vol_obj2) {
+        vol_obj2 = vol_obj1;
+        loc_params2.obj_type = loc_params1.obj_type;
+    } /* end else-if */
+
+    /* Create the links */
+    if(H5VL_link_optional(vol_obj2, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, H5VL_NATIVE_LINK_CREATE_HARD_MULTI,
+            vol_obj1->data, &loc_params1, count, cur_names, &loc_params2, new_names) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTCREATE, FAIL, "unable to create hard links")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Lcreate_hard_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Lcreate_ud
@@ -2130,6 +2232,108 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5L_create_hard() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5L__create_hard_multi
+ *
+ * Purpose:     Creates COUNT hard links, named LINK_NAMES, in the group
+ *              GRP_NAME (relative to LINK_LOC), to the objects CUR_NAMES
+ *              (relative to CUR_LOC).  The group is located once for the
+ *              whole batch and the links are inserted into it together.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5L__create_hard_multi(const H5G_loc_t *cur_loc, size_t count,
+    const char *cur_names[], const H5G_loc_t *link_loc, const char *grp_name,
+    const char *link_names[])
+{
+    H5G_loc_t grp_loc;                  /* Location of group for links */
+    H5G_name_t grp_path;                /* grp_loc's path */
+    H5O_loc_t grp_oloc;                 /* grp_loc's oloc */
+    hbool_t grp_loc_valid = FALSE;
+    H5O_type_t obj_type;                /* Type of object at grp_loc */
+    H5O_link_t *lnks = NULL;            /* Links to insert */
+    size_t found_idx;                   /* Index of name that can't be used */
+    htri_t found;                       /* Whether a name can't be used */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(cur_loc);
+    HDassert(cur_names || 0 == count);
+    HDassert(link_loc);
+    HDassert(grp_name && *grp_name);
+    HDassert(link_names || 0 == count);
+
+    /* Find the group for the links */
+    grp_loc.path = &grp_path;
+    grp_loc.oloc = &grp_oloc;
+    H5G_loc_reset(&grp_loc);
+    if(H5G_loc_find(link_loc, grp_name, &grp_loc) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_NOTFOUND, FAIL, "group not found")
+    grp_loc_valid = TRUE;
+    if(H5O_obj_type(&grp_oloc, &obj_type) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get object type")
+    if(obj_type != H5O_TYPE_GROUP)
+        HGOTO_ERROR(H5E_LINK, H5E_BADTYPE, FAIL, "not a group")
+
+    /* Check for nothing to do */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Make certain the names can be used for new links */
+    if((found = H5G_obj_lookup_multi(&grp_oloc, count, link_names, &found_idx)) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't check names of new links")
+    if(found)
+        HGOTO_ERROR(H5E_LINK, H5E_EXISTS, FAIL, "name '%s' already exists", link_names[found_idx])
+
+    /* Set up the links to the objects */
+    if(NULL == (lnks = (H5O_link_t *)H5MM_calloc(count * sizeof(H5O_link_t))))
+        HGOTO_ERROR(H5E_LINK, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    for(u = 0; u < count; u++) {
+        H5G_loc_t obj_loc;              /* Location of object to link to */
+        H5G_name_t path;                /* obj_loc's path*/
+        H5O_loc_t oloc;                 /* obj_loc's oloc */
+        hbool_t same_file;              /* Whether the object is in the group's file */
+
+        /* Get object location for object pointed to */
+        obj_loc.path = &path;
+        obj_loc.oloc = &oloc;
+        H5G_loc_reset(&obj_loc);
+        if(H5G_loc_find(cur_loc, cur_names[u], &obj_loc) < 0)
+            HGOTO_ERROR(H5E_LINK, H5E_NOTFOUND, FAIL, "source object not found")
+        lnks[u].u.hard.addr = oloc.addr;
+        same_file = H5F_SAME_SHARED(grp_oloc.file, oloc.file);
+        if(H5G_loc_free(&obj_loc) < 0)
+            HGOTO_ERROR(H5E_LINK, H5E_CANTRELEASE, FAIL, "unable to free location")
+
+        /* Check that both objects are in same file */
+        if(!same_file)
+            HGOTO_ERROR(H5E_LINK, H5E_BADVALUE, FAIL, "interfile hard links are not allowed")
+
+        lnks[u].type = H5L_TYPE_HARD;
+        lnks[u].cset = H5T_CSET_ASCII;
+        lnks[u].name = (char *)link_names[u];   /* (Casting away const OK) */
+    } /* end for */
+
+    /* Insert the links into the group */
+    if(H5G_obj_insert_multi(&grp_oloc, count, lnks, TRUE, H5O_TYPE_UNKNOWN, NULL) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTINSERT, FAIL, "unable to insert links")
+
+done:
+    if(lnks)
+        lnks = (H5O_link_t *)H5MM_xfree(lnks);
+    if(grp_loc_valid && H5G_loc_free(&grp_loc) < 0)
+        HDONE_ERROR(H5E_LINK, H5E_CANTRELEASE, FAIL, "unable to free location")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5L__create_hard_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5L_create_soft
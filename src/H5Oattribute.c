@@ -45,11 +45,30 @@
 /* Local Macros */
 /****************/
 
+/* Min. # of attributes on an object, for its attributes to be cached */
+#define H5O_ATTR_CACHE_MIN_NATTRS       16
+
+/* Min. # of lookups by name on an object before its attributes are cached,
+ * and # of attributes that each lookup pays for decoding */
+#define H5O_ATTR_CACHE_LOOKUPS          4
+
+/* Max. size of attribute data cached for an object */
+#define H5O_ATTR_CACHE_MAX_DATA         (4 * 1024 * 1024)
+
 
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Decoded attributes of an object, sorted for lookups by name and by index */
+typedef struct H5O_attr_cache_t {
+    size_t      rc;                     /* Reference count, for iterations under way */
+    H5A_attr_table_t atable;            /* Attributes, in increasing name order */
+    H5A_t       **sorted[H5_INDEX_N][2];    /* Attributes in increasing & decreasing order, for each index */
+    H5F_file_t  *shared;                /* Shared file struct, whose budget holds the cache's memory */
+    size_t      size;                   /* Memory reserved for the cache */
+} H5O_attr_cache_t;
+
 /* User data for iteration when converting attributes to dense storage */
 typedef struct {
     H5F_t      *f;              /* Pointer to file for insertion */
@@ -145,6 +164,12 @@ static herr_t H5O__attr_remove_cb(H5O_t *oh, H5O_mesg_t *mesg,
     unsigned H5_ATTR_UNUSED sequence, unsigned *oh_modified, void *_udata);
 static herr_t H5O__attr_exists_cb(H5O_t H5_ATTR_UNUSED *oh, H5O_mesg_t *mesg,
     unsigned H5_ATTR_UNUSED sequence, unsigned H5_ATTR_UNUSED *oh_modified, void *_udata);
+static herr_t H5O__attr_cache_get(H5F_t *f, H5O_t *oh, const H5O_ainfo_t *ainfo,
+    hbool_t build, H5O_attr_cache_t **cache);
+static H5A_t *H5O__attr_cache_find(const H5O_attr_cache_t *cache, const char *name);
+static herr_t H5O__attr_cache_table(H5O_attr_cache_t *cache, H5_index_t idx_type,
+    H5_iter_order_t order, H5A_attr_table_t *atable);
+static herr_t H5O__attr_cache_release(H5O_attr_cache_t *cache);
 
 /*********************/
 /* Package Variables */
@@ -160,6 +185,8 @@ static herr_t H5O__attr_exists_cb(H5O_t H5_ATTR_UNUSED *oh, H5O_mesg_t *mesg,
 /* Local Variables */
 /*******************/
 
+/* Declare a free list to manage the H5O_attr_cache_t struct */
+H5FL_DEFINE_STATIC(H5O_attr_cache_t);
 
 
 /*-------------------------------------------------------------------------
@@ -241,6 +268,10 @@ H5O__attr_create(const H5O_loc_t *loc, H5A_t *attr)
     if(NULL == (oh = H5O_pin(loc)))
 	HGOTO_ERROR(H5E_ATTR, H5E_CANTPIN, FAIL, "unable to pin object header")
 
+    /* Drop any cached attributes, since they're about to change */
+    if(H5O__attr_cache_reset(oh) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTFREE, FAIL, "unable to reset attribute cache")
+
     /* Check if this object already has attribute information */
     if(oh->version > H5O_VERSION_1) {
         hbool_t new_ainfo = FALSE;      /* Flag to indicate that the attribute information is new */
@@ -505,8 +536,23 @@ H5O__attr_open_by_name(const H5O_loc_t *loc, const char *name)
             HGOTO_ERROR(H5E_ATTR, H5E_CANTCOPY, NULL, "can't copy existing attribute")
     } /* end else if */
     else {
+        H5O_attr_cache_t *cache;        /* Cache of decoded attributes */
+
+        /* Check for cached attributes */
+        if(H5O__attr_cache_get(loc->file, oh, &ainfo, FALSE, &cache) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, NULL, "can't get attribute cache")
+
+        if(cache) {
+            H5A_t *cached_attr;         /* Cached attribute */
+
+            /* Share the attribute information with the cache */
+            if(NULL == (cached_attr = H5O__attr_cache_find(cache, name)))
+                HGOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, NULL, "can't locate attribute: '%s'", name)
+            if(NULL == (opened_attr = H5A__copy(NULL, cached_attr)))
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTCOPY, NULL, "can't copy cached attribute")
+        } /* end if */
         /* Check for attributes in dense storage */
-        if(H5F_addr_defined(ainfo.fheap_addr)) {
+        else if(H5F_addr_defined(ainfo.fheap_addr)) {
             /* Open attribute with dense storage */
             if(NULL == (opened_attr = H5A__dense_open(loc->file, &ainfo, name)))
                 HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, NULL, "can't open attribute")
@@ -927,6 +973,10 @@ H5O__attr_write(const H5O_loc_t *loc, H5A_t *attr)
     if(NULL == (oh = H5O_pin(loc)))
         HGOTO_ERROR(H5E_ATTR, H5E_CANTPIN, FAIL, "unable to pin object header")
 
+    /* Drop any cached attributes, since they're about to change */
+    if(H5O__attr_cache_reset(oh) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTFREE, FAIL, "unable to reset attribute cache")
+
     /* Check for attribute info stored */
     ainfo.fheap_addr = HADDR_UNDEF;
     if(oh->version > H5O_VERSION_1) {
@@ -1174,6 +1224,10 @@ H5O__attr_rename(const H5O_loc_t *loc, const char *old_name,
     if(NULL == (oh = H5O_pin(loc)))
         HGOTO_ERROR(H5E_ATTR, H5E_CANTPIN, FAIL, "unable to pin object header")
 
+    /* Drop any cached attributes, since they're about to change */
+    if(H5O__attr_cache_reset(oh) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTFREE, FAIL, "unable to reset attribute cache")
+
     /* Check for attribute info stored */
     ainfo.fheap_addr = HADDR_UNDEF;
     if(oh->version > H5O_VERSION_1) {
@@ -1251,6 +1305,7 @@ H5O_attr_iterate_real(hid_t loc_id, const H5O_loc_t *loc, H5_index_t idx_type,
     H5O_t *oh = NULL;                   /* Pointer to actual object header */
     H5O_ainfo_t ainfo;                  /* Attribute information for object */
     H5A_attr_table_t atable = {0, NULL};        /* Table of attributes */
+    H5O_attr_cache_t *cache = NULL;     /* Cache of decoded attributes */
     herr_t ret_value = FAIL;            /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT_TAG(loc->addr)
@@ -1273,8 +1328,37 @@ H5O_attr_iterate_real(hid_t loc_id, const H5O_loc_t *loc, H5_index_t idx_type,
             HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't check for attribute info message")
     } /* end if */
 
+    /* Use the cached attributes, already sorted, for increasing or decreasing order */
+    if(order != H5_ITER_NATIVE) {
+        if(H5O__attr_cache_get(loc->file, oh, &ainfo, TRUE, &cache) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute cache")
+    } /* end if */
+
+    if(cache) {
+        H5A_attr_table_t sorted;        /* Cached attributes, in iteration order */
+
+        /* Hold on to the cache, in case the callbacks change the attributes */
+        cache->rc++;
+
+        /* Retrieve the attributes in iteration order */
+        if(H5O__attr_cache_table(cache, idx_type, order, &sorted) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "error sorting attribute table")
+
+        /* Release the object header */
+        if(H5O_unprotect(loc, oh, H5AC__NO_FLAGS_SET) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+        oh = NULL;
+
+        /* Check for skipping too many attributes */
+        if(skip > 0 && skip >= sorted.nattrs)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid index specified")
+
+        /* Iterate over attributes in table */
+        if((ret_value = H5A__attr_iterate_table(&sorted, skip, last_attr, loc_id, attr_op, op_data)) < 0)
+            HERROR(H5E_ATTR, H5E_BADITER, "iteration operator failed");
+    } /* end if */
     /* Check for attributes stored densely */
-    if(H5F_addr_defined(ainfo.fheap_addr)) {
+    else if(H5F_addr_defined(ainfo.fheap_addr)) {
         /* Check for skipping too many attributes */
         if(skip > 0 && skip >= ainfo.nattrs)
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid index specified")
@@ -1313,6 +1397,8 @@ done:
         HDONE_ERROR(H5E_ATTR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
     if(atable.attrs && H5A__attr_release_table(&atable) < 0)
         HDONE_ERROR(H5E_ATTR, H5E_CANTFREE, FAIL, "unable to release attribute table")
+    if(cache && H5O__attr_cache_release(cache) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTFREE, FAIL, "unable to release attribute cache")
 
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5O_attr_iterate_real() */
@@ -1560,6 +1646,10 @@ H5O__attr_remove(const H5O_loc_t *loc, const char *name)
     if(NULL == (oh = H5O_pin(loc)))
         HGOTO_ERROR(H5E_ATTR, H5E_CANTPIN, FAIL, "unable to pin object header")
 
+    /* Drop any cached attributes, since they're about to change */
+    if(H5O__attr_cache_reset(oh) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTFREE, FAIL, "unable to reset attribute cache")
+
     /* Check for attribute info stored */
     ainfo.fheap_addr = HADDR_UNDEF;
     if(oh->version > H5O_VERSION_1) {
@@ -1643,6 +1733,10 @@ H5O__attr_remove_by_idx(const H5O_loc_t *loc, H5_index_t idx_type,
     if(NULL == (oh = H5O_pin(loc)))
         HGOTO_ERROR(H5E_ATTR, H5E_CANTPIN, FAIL, "unable to pin object header")
 
+    /* Drop any cached attributes, since they're about to change */
+    if(H5O__attr_cache_reset(oh) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTFREE, FAIL, "unable to reset attribute cache")
+
     /* Check for attribute info stored */
     ainfo.fheap_addr = HADDR_UNDEF;
     if(oh->version > H5O_VERSION_1) {
@@ -1815,6 +1909,7 @@ H5O__attr_exists(const H5O_loc_t *loc, const char *name)
 {
     H5O_t *oh = NULL;           /* Pointer to actual object header */
     H5O_ainfo_t ainfo;          /* Attribute information for object */
+    H5O_attr_cache_t *cache;    /* Cache of decoded attributes */
     htri_t ret_value = FAIL;    /* Return value */
 
     FUNC_ENTER_PACKAGE_TAG(loc->addr)
@@ -1835,8 +1930,14 @@ H5O__attr_exists(const H5O_loc_t *loc, const char *name)
             HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't check for attribute info message")
     } /* end if */
 
+    /* Check for cached attributes */
+    if(H5O__attr_cache_get(loc->file, oh, &ainfo, FALSE, &cache) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute cache")
+
+    if(cache)
+        ret_value = (htri_t)(NULL != H5O__attr_cache_find(cache, name));
     /* Check for attributes stored densely */
-    if(H5F_addr_defined(ainfo.fheap_addr)) {
+    else if(H5F_addr_defined(ainfo.fheap_addr)) {
         /* Check if attribute exists in dense storage */
         if((ret_value = H5A__dense_exists(loc->file, &ainfo, name)) < 0)
             HGOTO_ERROR(H5E_ATTR, H5E_BADITER, FAIL, "error checking for existence of attribute")
@@ -1995,3 +2096,311 @@ done:
 } /* end H5O__attr_count */
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_cache_get
+ *
+ * Purpose:     Retrieve the cache of decoded attributes for an object,
+ *              building it if the object has enough attributes and they
+ *              are looked up often enough.  When BUILD is set, the cache
+ *              is built without waiting for more lookups.
+ *
+ *              The cache is left NULL when the attributes aren't cached.
+ *
+ *              The cache's memory is reserved from the file's budget for
+ *              attribute caches, since it isn't part of the header's
+ *              entry in the metadata cache.  The cache may be built for a
+ *              header protected with H5AC__READ_ONLY_FLAG: it's only held
+ *              in memory, never written to the file or counted in the
+ *              header's image, and all access to it is serialized by the
+ *              library's API lock, like the rest of the header struct.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__attr_cache_get(H5F_t *f, H5O_t *oh, const H5O_ainfo_t *ainfo,
+    hbool_t build, H5O_attr_cache_t **cache)
+{
+    H5A_attr_table_t atable = {0, NULL};        /* Table of attributes */
+    H5O_attr_cache_t *new_cache = NULL;         /* New attribute cache */
+    hsize_t nattrs;                     /* # of attributes on object */
+    size_t data_size = 0;               /* Size of attribute data */
+    size_t size;                        /* Memory to reserve for the cache */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments */
+    HDassert(f);
+    HDassert(oh);
+    HDassert(ainfo);
+    HDassert(cache);
+
+    /* Check for attributes already cached, or too large to cache */
+    *cache = oh->attr_cache;
+    if(oh->attr_cache || oh->attr_cache_off)
+        HGOTO_DONE(SUCCEED)
+
+    /* Searching a few attributes is as fast as looking them up in the cache */
+    if(H5F_addr_defined(ainfo->fheap_addr))
+        nattrs = ainfo->nattrs;
+    else
+        nattrs = (hsize_t)H5O__msg_count_real(oh, H5O_MSG_ATTR);
+    if(nattrs < H5O_ATTR_CACHE_MIN_NATTRS)
+        HGOTO_DONE(SUCCEED)
+
+    /* Wait for enough lookups to pay for decoding all the attributes, so
+     * objects looked at once, or whose attributes change between lookups,
+     * don't keep rebuilding the cache.
+     */
+    if(oh->attr_lookups < UINT_MAX)
+        oh->attr_lookups++;
+    if(!build && (oh->attr_lookups < H5O_ATTR_CACHE_LOOKUPS ||
+            (hsize_t)oh->attr_lookups * H5O_ATTR_CACHE_LOOKUPS < nattrs))
+        HGOTO_DONE(SUCCEED)
+
+    /* Build table of the attributes */
+    if(H5F_addr_defined(ainfo->fheap_addr)) {
+        if(H5A__dense_build_table(f, ainfo, H5_INDEX_NAME, H5_ITER_NATIVE, &atable) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "error building attribute table")
+    } /* end if */
+    else {
+        if(H5A__compact_build_table(f, oh, H5_INDEX_NAME, H5_ITER_NATIVE, &atable) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "error building attribute table")
+    } /* end else */
+
+    /* Don't hold on to large amounts of attribute data */
+    for(u = 0; u < atable.nattrs; u++)
+        data_size += atable.attrs[u]->shared->data_size;
+    if(data_size > H5O_ATTR_CACHE_MAX_DATA) {
+        oh->attr_cache_off = TRUE;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Sort the attributes by name, for lookups */
+    if(H5A__attr_sort_table(&atable, H5_INDEX_NAME, H5_ITER_INC) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTSORT, FAIL, "error sorting attribute table")
+
+    /* Reserve memory for the cache from the file's budget, counting the
+     * attributes, their data and every sorted copy of the table the cache
+     * may keep.  When the budget is used up, the object's attributes
+     * aren't cached until they change.
+     */
+    size = sizeof(H5O_attr_cache_t) + data_size;
+    for(u = 0; u < atable.nattrs; u++)
+        size += sizeof(H5A_t) + sizeof(H5A_shared_t) + HDstrlen(atable.attrs[u]->shared->name) + 1;
+    size += atable.nattrs * (size_t)(1 + 2 * H5_INDEX_N) * sizeof(H5A_t *);
+    if(!H5F_attr_cache_reserve(H5F_SHARED(f), size)) {
+        oh->attr_cache_off = TRUE;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Set up the cache */
+    if(NULL == (new_cache = H5FL_CALLOC(H5O_attr_cache_t))) {
+        H5F_attr_cache_unreserve(H5F_SHARED(f), size);
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for attribute cache")
+    } /* end if */
+    new_cache->rc = 1;
+    new_cache->shared = H5F_SHARED(f);
+    new_cache->size = size;
+    new_cache->atable = atable;
+    new_cache->sorted[H5_INDEX_NAME][0] = atable.attrs;
+    atable.nattrs = 0;
+    atable.attrs = NULL;
+
+    /* Attach the cache to the object header */
+    oh->attr_cache = new_cache;
+    *cache = new_cache;
+
+done:
+    if(atable.attrs && H5A__attr_release_table(&atable) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTFREE, FAIL, "unable to release attribute table")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__attr_cache_get() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_cache_find
+ *
+ * Purpose:     Look up an attribute by name in the cache of decoded
+ *              attributes for an object.
+ *
+ * Return:      Success:    Pointer to the cached attribute
+ *              Failure:    NULL, if there's no attribute with that name
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5A_t *
+H5O__attr_cache_find(const H5O_attr_cache_t *cache, const char *name)
+{
+    size_t lo, hi;                      /* Bounds of binary search */
+    H5A_t *ret_value = NULL;            /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check arguments */
+    HDassert(cache);
+    HDassert(name);
+
+    /* Binary search of the attributes, which are in increasing name order */
+    lo = 0;
+    hi = cache->atable.nattrs;
+    while(lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;    /* Attribute to compare with */
+        int cmp = HDstrcmp(name, cache->atable.attrs[mid]->shared->name);
+
+        if(cmp == 0) {
+            ret_value = cache->atable.attrs[mid];
+            break;
+        } /* end if */
+        else if(cmp < 0)
+            hi = mid;
+        else
+            lo = mid + 1;
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__attr_cache_find() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_cache_table
+ *
+ * Purpose:     Retrieve a table of the cached attributes for an object,
+ *              sorted by an index in increasing or decreasing order.  The
+ *              table is sorted the first time it's needed, and kept with
+ *              the cache after that.
+ *
+ *              The table is owned by the cache and must not be released.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__attr_cache_table(H5O_attr_cache_t *cache, H5_index_t idx_type,
+    H5_iter_order_t order, H5A_attr_table_t *atable)
+{
+    unsigned dir = (order == H5_ITER_DEC) ? 1 : 0;  /* Which sort direction */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments */
+    HDassert(cache);
+    HDassert(idx_type == H5_INDEX_NAME || idx_type == H5_INDEX_CRT_ORDER);
+    HDassert(order == H5_ITER_INC || order == H5_ITER_DEC);
+    HDassert(atable);
+
+    atable->nattrs = cache->atable.nattrs;
+
+    /* Sort a copy of the table, if it's not sorted this way yet */
+    if(NULL == cache->sorted[idx_type][dir]) {
+        H5A_t **attrs;                  /* Attributes to sort */
+
+        if(NULL == (attrs = (H5A_t **)H5MM_malloc(cache->atable.nattrs * sizeof(H5A_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for attribute table")
+        HDmemcpy(attrs, cache->atable.attrs, cache->atable.nattrs * sizeof(H5A_t *));
+
+        atable->attrs = attrs;
+        if(H5A__attr_sort_table(atable, idx_type, order) < 0) {
+            H5MM_xfree(attrs);
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTSORT, FAIL, "error sorting attribute table")
+        } /* end if */
+        cache->sorted[idx_type][dir] = attrs;
+    } /* end if */
+
+    atable->attrs = cache->sorted[idx_type][dir];
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__attr_cache_table() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_cache_release
+ *
+ * Purpose:     Release a reference to a cache of decoded attributes,
+ *              freeing it when the last reference is gone.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__attr_cache_release(H5O_attr_cache_t *cache)
+{
+    unsigned u;                         /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments */
+    HDassert(cache);
+    HDassert(cache->rc > 0);
+
+    if(--cache->rc == 0) {
+        /* Return the cache's memory to the file's budget */
+        H5F_attr_cache_unreserve(cache->shared, cache->size);
+
+        /* Release the sorted copies of the table */
+        for(u = 0; u < H5_INDEX_N; u++) {
+            if(cache->sorted[u][0] != cache->atable.attrs)
+                H5MM_xfree(cache->sorted[u][0]);
+            H5MM_xfree(cache->sorted[u][1]);
+        } /* end for */
+
+        /* Release the attributes */
+        if(cache->atable.attrs && H5A__attr_release_table(&cache->atable) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTFREE, FAIL, "unable to release attribute table")
+
+        cache = H5FL_FREE(H5O_attr_cache_t, cache);
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__attr_cache_release() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_cache_reset
+ *
+ * Purpose:     Drop the cache of decoded attributes for an object, when
+ *              its attributes change or its header is freed.
+ *
+ *              Iterations over the cached attributes that are under way
+ *              hold their own reference and finish with the old cache.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O__attr_cache_reset(H5O_t *oh)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(oh);
+
+    /* Count lookups again, in case the attributes can be cached now */
+    oh->attr_lookups = 0;
+    oh->attr_cache_off = FALSE;
+
+    if(oh->attr_cache) {
+        H5O_attr_cache_t *cache = oh->attr_cache;   /* Cache to release */
+
+        oh->attr_cache = NULL;
+        if(H5O__attr_cache_release(cache) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTFREE, FAIL, "unable to release attribute cache")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__attr_cache_reset() */
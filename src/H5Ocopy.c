@@ -33,6 +33,7 @@
 #include "H5private.h"          /* Generic Functions                        */
 #include "H5Aprivate.h"         /* Attributes                               */
 #include "H5CXprivate.h"        /* API Contexts                             */
+#include "H5Dprivate.h"         /* Datasets                                 */
 #include "H5Eprivate.h"         /* Error handling                           */
 #include "H5FLprivate.h"        /* Free lists                               */
 #include "H5Iprivate.h"         /* IDs                                      */
@@ -382,6 +383,12 @@ H5O__copy_header_real(const H5O_loc_t *oloc_src, H5O_loc_t *oloc_dst /*out*/,
     /* Set the pointer to the shared struct for the object if opened in the file */
     cpy_info->shared_fo = H5FO_opened(oloc_src->file, oloc_src->addr);
 
+    /* Write any chunks an open dataset is holding in its write-behind queue,
+     * so that they are in the chunk index when it is copied */
+    if(cpy_info->shared_fo && H5O_TYPE_DATASET == obj_class->type)
+        if(H5D_chunk_wb_flush_opened(oloc_src, cpy_info->shared_fo) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_WRITEERROR, FAIL, "unable to write queued chunks of open dataset")
+
     /* Get source object header */
     if(NULL == (oh_src = H5O_protect(oloc_src, H5AC__READ_ONLY_FLAG, FALSE)))
         HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to load object header")
@@ -1156,11 +1163,21 @@ H5O__copy_header(const H5O_loc_t *oloc_src, H5O_loc_t *oloc_dst /*out */,
     if(NULL == (cpy_info.map_list = H5SL_create(H5SL_TYPE_OBJ, NULL)))
         HGOTO_ERROR(H5E_SLIST, H5E_CANTCREATE, FAIL, "cannot make skip list")
 
+    /* Set up to copy raw data after all the object headers are copied */
+    if(H5O__copy_raw_create(&cpy_info, oloc_src->file, oloc_dst->file) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTINIT, FAIL, "can't set up raw data copying")
+
     /* copy the object from the source file to the destination file */
     if(H5O__copy_header_real(oloc_src, oloc_dst, &cpy_info, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_OHDR, H5E_CANTCOPY, FAIL, "unable to copy object")
 
+    /* Copy the raw data for the objects */
+    if(H5O__copy_raw_flush(&cpy_info) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTCOPY, FAIL, "unable to copy raw data")
+
 done:
+    if(cpy_info.raw_queue)
+        H5O__copy_raw_dest(&cpy_info);
     if(cpy_info.map_list)
         H5SL_destroy(cpy_info.map_list, H5O__copy_free_addrmap_cb, NULL);
     if(cpy_info.dst_dt_list)
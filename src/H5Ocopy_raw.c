@@ -0,0 +1,413 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5Ocopy_raw.c
+ *
+ * Purpose:     Deferred copying of raw data during object copies.
+ *
+ *              Raw data that is copied byte for byte (contiguous storage
+ *              and chunks that don't need to be converted) has its space
+ *              in the destination file allocated while the object headers
+ *              are copied, but the bytes themselves are only queued.  Once
+ *              all the object headers have been copied, or when the queue
+ *              fills, the queued copies are sorted by source address and
+ *              copies that are adjacent in the source file are read
+ *              together, with copies that are also adjacent in the
+ *              destination file written together.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Omodule.h"          /* This source code file is part of the H5O module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"          /* Generic Functions                        */
+#include "H5Eprivate.h"         /* Error handling                           */
+#include "H5Fprivate.h"         /* Files                                    */
+#include "H5FLprivate.h"        /* Free lists                               */
+#include "H5MMprivate.h"        /* Memory management                        */
+#include "H5Opkg.h"             /* Object headers                           */
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* # of copies queued before they are performed */
+#define H5O_COPY_RAW_MAX_NCOPIES        (128 * 1024)
+
+/* Size of the buffer for reading & writing raw data */
+#define H5O_COPY_RAW_BUF_SIZE           (8 * 1024 * 1024)
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* A queued copy of raw data */
+typedef struct H5O_copy_raw_ent_t {
+    haddr_t addr_src;           /* Address of data in source file */
+    haddr_t addr_dst;           /* Address of data in destination file */
+    hsize_t size;               /* Size of data */
+} H5O_copy_raw_ent_t;
+
+/* Queue of raw data copies */
+struct H5O_copy_raw_t {
+    H5F_t *file_src;            /* Source file */
+    H5F_t *file_dst;            /* Destination file */
+    size_t ncopies;             /* # of copies queued */
+    size_t nalloc;              /* # of copies allocated */
+    H5O_copy_raw_ent_t *copies; /* Queued copies */
+};
+
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static int H5O__copy_raw_cmp(const void *_ent1, const void *_ent2);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5O_copy_raw_t struct */
+H5FL_DEFINE_STATIC(H5O_copy_raw_t);
+
+/* Declare a free list to manage the copy buffer */
+H5FL_BLK_DEFINE_STATIC(copy_raw_buf);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__copy_raw_create
+ *
+ * Purpose:     Set up the queue of raw data copies for copying objects
+ *              from FILE_SRC to FILE_DST.  Only raw data copied between
+ *              these two files is queued.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O__copy_raw_create(H5O_copy_t *cpy_info, H5F_t *file_src, H5F_t *file_dst)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(cpy_info);
+    HDassert(NULL == cpy_info->raw_queue);
+    HDassert(file_src);
+    HDassert(file_dst);
+
+    if(NULL == (cpy_info->raw_queue = H5FL_CALLOC(H5O_copy_raw_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data copy queue")
+    cpy_info->raw_queue->file_src = file_src;
+    cpy_info->raw_queue->file_dst = file_dst;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__copy_raw_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O_copy_raw_can_defer
+ *
+ * Purpose:     Check whether raw data being copied byte for byte from
+ *              FILE_SRC to FILE_DST for the object currently being copied
+ *              can be queued.
+ *
+ *              Data for an object that's open in the source file may be
+ *              cached in memory, so it is always copied immediately.
+ *
+ * Return:      TRUE/FALSE (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5O_copy_raw_can_defer(const H5O_copy_t *cpy_info, const H5F_t *file_src,
+    const H5F_t *file_dst)
+{
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(cpy_info);
+
+    if(cpy_info->raw_queue && NULL == cpy_info->shared_fo)
+        ret_value = (hbool_t)(cpy_info->raw_queue->file_src == file_src && cpy_info->raw_queue->file_dst == file_dst);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O_copy_raw_can_defer() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O_copy_raw_defer
+ *
+ * Purpose:     Queue a copy of SIZE bytes of raw data from ADDR_SRC in the
+ *              source file to ADDR_DST in the destination file, which has
+ *              already been allocated.  The caller must have checked
+ *              H5O_copy_raw_can_defer() first.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O_copy_raw_defer(H5O_copy_t *cpy_info, haddr_t addr_src, haddr_t addr_dst,
+    hsize_t size)
+{
+    H5O_copy_raw_t *queue;              /* Queue of copies */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(cpy_info);
+    HDassert(cpy_info->raw_queue);
+    HDassert(H5F_addr_defined(addr_src));
+    HDassert(H5F_addr_defined(addr_dst));
+
+    queue = cpy_info->raw_queue;
+
+    /* Nothing to copy */
+    if(0 == size)
+        HGOTO_DONE(SUCCEED)
+
+    /* Perform the queued copies when the queue is full */
+    if(queue->ncopies == H5O_COPY_RAW_MAX_NCOPIES)
+        if(H5O__copy_raw_flush(cpy_info) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTCOPY, FAIL, "unable to copy queued raw data")
+
+    /* Make room for the copy */
+    if(queue->ncopies == queue->nalloc) {
+        size_t new_nalloc = MIN(H5O_COPY_RAW_MAX_NCOPIES, MAX(256, 2 * queue->nalloc));
+        H5O_copy_raw_ent_t *new_copies;
+
+        if(NULL == (new_copies = (H5O_copy_raw_ent_t *)H5MM_realloc(queue->copies, new_nalloc * sizeof(H5O_copy_raw_ent_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data copy queue")
+        queue->copies = new_copies;
+        queue->nalloc = new_nalloc;
+    } /* end if */
+
+    /* Queue the copy */
+    queue->copies[queue->ncopies].addr_src = addr_src;
+    queue->copies[queue->ncopies].addr_dst = addr_dst;
+    queue->copies[queue->ncopies].size = size;
+    queue->ncopies++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O_copy_raw_defer() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__copy_raw_cmp
+ *
+ * Purpose:     Compare two queued copies by source address, for HDqsort.
+ *
+ * Return:      -1, 0 or 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5O__copy_raw_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5O_copy_raw_ent_t *ent1 = (const H5O_copy_raw_ent_t *)_ent1;
+    const H5O_copy_raw_ent_t *ent2 = (const H5O_copy_raw_ent_t *)_ent2;
+    int ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(H5F_addr_lt(ent1->addr_src, ent2->addr_src))
+        ret_value = -1;
+    else if(H5F_addr_gt(ent1->addr_src, ent2->addr_src))
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__copy_raw_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__copy_raw_flush
+ *
+ * Purpose:     Perform the queued copies of raw data, in source address
+ *              order.  Runs of copies that are adjacent in the source file
+ *              are read with one call, up to the size of the copy buffer,
+ *              and the copies in a run that are also adjacent in the
+ *              destination file are written with one call.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O__copy_raw_flush(H5O_copy_t *cpy_info)
+{
+    H5O_copy_raw_t *queue;              /* Queue of copies */
+    H5O_copy_raw_ent_t *copies;         /* Queued copies */
+    uint8_t *buf = NULL;                /* Buffer for copying */
+    size_t buf_size = 0;                /* Size of buffer */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(cpy_info);
+
+    if(NULL == (queue = cpy_info->raw_queue) || 0 == queue->ncopies)
+        HGOTO_DONE(SUCCEED)
+    copies = queue->copies;
+
+    /* Sort the copies by source address */
+    HDqsort(copies, queue->ncopies, sizeof(H5O_copy_raw_ent_t), H5O__copy_raw_cmp);
+
+    /* Size the buffer for the largest run of adjacent copies */
+    {
+        hsize_t run_size = 0;           /* Size of current run */
+        hsize_t max_size = 0;           /* Size of largest run */
+
+        for(u = 0; u < queue->ncopies; u++) {
+            if(u > 0 && H5F_addr_eq(copies[u - 1].addr_src + copies[u - 1].size, copies[u].addr_src))
+                run_size += copies[u].size;
+            else
+                run_size = copies[u].size;
+            max_size = MAX(max_size, run_size);
+        } /* end for */
+        buf_size = (size_t)MIN(max_size, H5O_COPY_RAW_BUF_SIZE);
+    } /* end block */
+    if(NULL == (buf = H5FL_BLK_MALLOC(copy_raw_buf, buf_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for copy buffer")
+
+    u = 0;
+    while(u < queue->ncopies) {
+        /* Copy data that doesn't fit in the buffer a piece at a time */
+        if(copies[u].size > buf_size) {
+            haddr_t addr_src = copies[u].addr_src;
+            haddr_t addr_dst = copies[u].addr_dst;
+            hsize_t nbytes_left = copies[u].size;
+
+            while(nbytes_left > 0) {
+                size_t nbytes = (size_t)MIN(nbytes_left, buf_size);
+
+                if(H5F_block_read(queue->file_src, H5FD_MEM_DRAW, addr_src, nbytes, buf) < 0)
+                    HGOTO_ERROR(H5E_OHDR, H5E_READERROR, FAIL, "unable to read raw data")
+                if(H5F_block_write(queue->file_dst, H5FD_MEM_DRAW, addr_dst, nbytes, buf) < 0)
+                    HGOTO_ERROR(H5E_OHDR, H5E_WRITEERROR, FAIL, "unable to write raw data")
+
+                addr_src += nbytes;
+                addr_dst += nbytes;
+                nbytes_left -= nbytes;
+            } /* end while */
+            u++;
+        } /* end if */
+        else {
+            size_t run_size = (size_t)copies[u].size;   /* Size of run read */
+            size_t first = u;           /* First copy in run */
+            size_t buf_off;             /* Offset in buffer */
+
+            /* Extend the run over the following adjacent copies that fit */
+            for(u++; u < queue->ncopies; u++) {
+                if(!H5F_addr_eq(copies[u - 1].addr_src + copies[u - 1].size, copies[u].addr_src))
+                    break;
+                if(copies[u].size > (buf_size - run_size))
+                    break;
+                run_size += (size_t)copies[u].size;
+            } /* end for */
+
+            /* Read the run */
+            if(H5F_block_read(queue->file_src, H5FD_MEM_DRAW, copies[first].addr_src, run_size, buf) < 0)
+                HGOTO_ERROR(H5E_OHDR, H5E_READERROR, FAIL, "unable to read raw data")
+
+            /* Write the copies in the run, merging ones that are adjacent
+             * in the destination file */
+            buf_off = 0;
+            while(first < u) {
+                size_t nbytes = (size_t)copies[first].size;     /* Size of write */
+                size_t v;
+
+                for(v = first + 1; v < u; v++) {
+                    if(!H5F_addr_eq(copies[v - 1].addr_dst + copies[v - 1].size, copies[v].addr_dst))
+                        break;
+                    nbytes += (size_t)copies[v].size;
+                } /* end for */
+
+                if(H5F_block_write(queue->file_dst, H5FD_MEM_DRAW, copies[first].addr_dst, nbytes, buf + buf_off) < 0)
+                    HGOTO_ERROR(H5E_OHDR, H5E_WRITEERROR, FAIL, "unable to write raw data")
+
+                buf_off += nbytes;
+                first = v;
+            } /* end while */
+        } /* end else */
+    } /* end while */
+
+    /* Start the queue over */
+    queue->ncopies = 0;
+
+done:
+    if(buf)
+        buf = H5FL_BLK_FREE(copy_raw_buf, buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__copy_raw_flush() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__copy_raw_dest
+ *
+ * Purpose:     Release the queue of raw data copies, dropping any copies
+ *              that haven't been performed (when the object copy failed).
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O__copy_raw_dest(H5O_copy_t *cpy_info)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(cpy_info);
+
+    if(cpy_info->raw_queue) {
+        if(cpy_info->raw_queue->copies)
+            H5MM_xfree(cpy_info->raw_queue->copies);
+        cpy_info->raw_queue = H5FL_FREE(H5O_copy_raw_t, cpy_info->raw_queue);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5O__copy_raw_dest() */
+
@@ -330,6 +330,12 @@ H5O_refresh_metadata(hid_t oid, H5O_loc_t oloc)
          */
         connector->nrefs++;
 
+        /* Links may have changed since paths in the file were resolved */
+        if(H5G_path_cache_clear(oloc.file) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTRELEASE, FAIL, "can't empty path cache")
+        if(H5G_name_filter_clear(oloc.file) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTRELEASE, FAIL, "can't release link name filters")
+
         /* Close object & evict its metadata */
         if((H5O__refresh_metadata_close(oid, oloc, &obj_loc)) < 0)
             HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, FAIL, "unable to refresh object")
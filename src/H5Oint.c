@@ -3028,6 +3028,10 @@ H5O__free(H5O_t *oh)
     HDassert(oh);
     HDassert(0 == oh->rc);
 
+    /* Destroy cached attributes */
+    if(oh->attr_cache && H5O__attr_cache_reset(oh) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTFREE, FAIL, "unable to release attribute cache")
+
     /* Destroy chunks */
     if(oh->chunk) {
         for(u = 0; u < oh->nchunks; u++)
@@ -176,9 +176,15 @@ H5O__layout_decode(H5F_t *f, H5O_t H5_ATTR_UNUSED *open_oh,
         } /* end if */
         else {
             mesg->u.chunk.ndims=ndims;
-            for(u = 0; u < ndims; u++)
+            for(u = 0; u < ndims; u++) {
                 UINT32DECODE(p, mesg->u.chunk.dim[u]);
 
+                /* Just in case that something goes very wrong, such as file corruption. */
+                if(mesg->u.chunk.dim[u] == 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, NULL, "chunk dimension must be positive: mesg->u.chunk.dim[%u] = %u",
+                                u, mesg->u.chunk.dim[u])
+            } /* end for */
+
             /* Compute chunk size */
             for(u = 1, mesg->u.chunk.size = mesg->u.chunk.dim[0]; u < ndims; u++)
                 mesg->u.chunk.size *= mesg->u.chunk.dim[u];
@@ -283,9 +289,25 @@ H5O__layout_decode(H5F_t *f, H5O_t H5_ATTR_UNUSED *open_oh,
                         HGOTO_ERROR(H5E_OHDR, H5E_BADVALUE, NULL, "encoded chunk dimension size is too large")
 
                     /* Chunk dimensions */
-                    for(u = 0; u < mesg->u.chunk.ndims; u++)
+                    for(u = 0; u < mesg->u.chunk.ndims; u++) {
                         UINT64DECODE_VAR(p, mesg->u.chunk.dim[u], mesg->u.chunk.enc_bytes_per_dim);
 
+                        /* Just in case that something goes very wrong, such as file corruption. */
+                        if(mesg->u.chunk.dim[u] == 0)
+                            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, NULL, "chunk dimension must be positive: mesg->u.chunk.dim[%u] = %u",
+                                        u, mesg->u.chunk.dim[u])
+                    } /* end for */
+
+                    /* Shard dimensions */
+                    if(mesg->u.chunk.flags & H5O_LAYOUT_CHUNK_SHARDED)
+                        for(u = 0; u < mesg->u.chunk.ndims; u++) {
+                            UINT64DECODE_VAR(p, mesg->u.chunk.shard_dim[u], mesg->u.chunk.enc_bytes_per_dim);
+
+                            /* Each chunk dimension must be a multiple of the shard dimension */
+                            if(0 == mesg->u.chunk.shard_dim[u] || (mesg->u.chunk.dim[u] % mesg->u.chunk.shard_dim[u]))
+                                HGOTO_ERROR(H5E_OHDR, H5E_BADVALUE, NULL, "invalid shard dimension")
+                        } /* end for */
+
                     /* Compute chunk size */
                     for(u = 1, mesg->u.chunk.size = mesg->u.chunk.dim[0]; u < mesg->u.chunk.ndims; u++)
                         mesg->u.chunk.size *= mesg->u.chunk.dim[u];
@@ -625,6 +647,11 @@ H5O__layout_encode(H5F_t *f, hbool_t H5_ATTR_UNUSED disable_shared, uint8_t *p,
                 for(u = 0; u < mesg->u.chunk.ndims; u++)
                     UINT64ENCODE_VAR(p, mesg->u.chunk.dim[u], mesg->u.chunk.enc_bytes_per_dim);
 
+                /* Shard dimension sizes */
+                if(mesg->u.chunk.flags & H5O_LAYOUT_CHUNK_SHARDED)
+                    for(u = 0; u < mesg->u.chunk.ndims; u++)
+                        UINT64ENCODE_VAR(p, mesg->u.chunk.shard_dim[u], mesg->u.chunk.enc_bytes_per_dim);
+
                 /* Chunk index type */
                 *p++ = (uint8_t)mesg->u.chunk.idx_type;
 
@@ -55,6 +55,8 @@ static herr_t H5O__link_post_copy_file(const H5O_loc_t *src_oloc,
     unsigned *mesg_flags, H5O_copy_t *cpy_info);
 static herr_t H5O__link_debug(H5F_t *f, const void *_mesg, FILE *stream,
     int indent, int fwidth);
+static htri_t H5O__link_raw_name_eq(const uint8_t *p, size_t p_size,
+    const char *name, size_t name_len);
 
 /* This message derives from H5O message class */
 const H5O_msg_class_t H5O_MSG_LINK[1] = {{
@@ -664,6 +666,148 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O_link_delete() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__link_raw_name_eq
+ *
+ * Purpose:     Check whether the encoded link message in the P_SIZE bytes
+ *              at P has the name NAME, without decoding the rest of the
+ *              message.
+ *
+ * Return:      TRUE/FALSE/FAIL (when the message is corrupt)
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5O__link_raw_name_eq(const uint8_t *p, size_t p_size, const char *name,
+    size_t name_len)
+{
+    const uint8_t      *p_end = p + p_size;     /* End of the encoded message */
+    uint64_t            len = 0;        /* Length of the link's name */
+    unsigned char       link_flags;     /* Flags for encoding link info */
+    htri_t              ret_value = FAIL;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(p);
+    HDassert(name);
+
+    /* Skip the fields before the name, as H5O__link_decode reads them */
+    if(p_size < 2 || *p++ != H5O_LINK_VERSION)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, FAIL, "bad version number for message")
+    link_flags = *p++;
+    if(link_flags & ~H5O_LINK_ALL_FLAGS)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, FAIL, "bad flag value for message")
+    if(link_flags & H5O_LINK_STORE_LINK_TYPE)
+        p++;
+    if(link_flags & H5O_LINK_STORE_CORDER)
+        p += 8;
+    if(link_flags & H5O_LINK_STORE_NAME_CSET)
+        p++;
+    if(p + ((size_t)1 << (link_flags & H5O_LINK_NAME_SIZE)) > p_end)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, FAIL, "link message is too short")
+
+    /* Get the length of the link's name */
+    switch(link_flags & H5O_LINK_NAME_SIZE) {
+        case 0:     /* 1 byte size */
+            len = *p++;
+            break;
+
+        case 1:     /* 2 byte size */
+            UINT16DECODE(p, len);
+            break;
+
+        case 2:     /* 4 byte size */
+            UINT32DECODE(p, len);
+            break;
+
+        case 3:     /* 8 byte size */
+            UINT64DECODE(p, len);
+            break;
+
+        default:
+            HDassert(0 && "bad size for name");
+    } /* end switch */
+    if(len == 0 || len > (uint64_t)(p_end - p))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, FAIL, "invalid name length")
+
+    ret_value = (htri_t)(len == name_len && !HDmemcmp(p, name, name_len));
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__link_raw_name_eq() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O_link_lookup
+ *
+ * Purpose:     Look up the link message named NAME in the object header
+ *              at LOC and copy it into LNK.
+ *
+ *              Link messages that haven't been decoded yet are matched
+ *              against their encoded name, so only the message found is
+ *              decoded (and kept decoded in the object header).
+ *
+ * Return:      TRUE if found, FALSE if not, FAIL on error
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5O_link_lookup(const H5O_loc_t *loc, const char *name, H5O_link_t *lnk)
+{
+    H5O_t *oh = NULL;                   /* Object header */
+    H5O_mesg_t *mesg;                   /* Current message */
+    size_t name_len;                    /* Length of the name to look up */
+    unsigned u;                         /* Local index variable */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* check args */
+    HDassert(loc);
+    HDassert(loc->file);
+    HDassert(name && *name);
+    HDassert(lnk);
+
+    /* Protect the object header */
+    if(NULL == (oh = H5O_protect(loc, H5AC__READ_ONLY_FLAG, FALSE)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to protect object header")
+
+    name_len = HDstrlen(name);
+    for(u = 0, mesg = &oh->mesg[0]; u < oh->nmesgs; u++, mesg++)
+        if(H5O_MSG_LINK == mesg->type) {
+            /* The native form is current when there is one; the encoded
+             * form can be stale if the message has been changed */
+            if(mesg->native) {
+                if(HDstrcmp(((H5O_link_t *)mesg->native)->name, name))
+                    continue;
+            } /* end if */
+            else {
+                htri_t match;
+
+                if((match = H5O__link_raw_name_eq(mesg->raw, mesg->raw_size, name, name_len)) < 0)
+                    HGOTO_ERROR(H5E_OHDR, H5E_CANTDECODE, FAIL, "unable to decode link name")
+                if(!match)
+                    continue;
+
+                /* Decode the message */
+                H5O_LOAD_NATIVE(loc->file, 0, oh, mesg, FAIL)
+            } /* end else */
+
+            /* Copy the link */
+            if(NULL == H5O_link_copy(mesg->native, lnk))
+                HGOTO_ERROR(H5E_OHDR, H5E_CANTCOPY, FAIL, "can't copy link message")
+            HGOTO_DONE(TRUE)
+        } /* end if */
+
+done:
+    if(oh && H5O_unprotect(loc, oh, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_OHDR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O_link_lookup() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5O_link_pre_copy_file
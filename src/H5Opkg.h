@@ -330,6 +330,11 @@ struct H5O_t {
 
     /* Object header proxy information (not stored) */
     H5AC_proxy_entry_t *proxy;          /* Proxy cache entry for all ohdr entries */
+
+    /* Attribute lookup information (not stored) */
+    unsigned    attr_lookups;           /* # of lookups since attributes were changed */
+    hbool_t     attr_cache_off;         /* Whether attributes are too large to cache */
+    struct H5O_attr_cache_t *attr_cache; /* Decoded attributes, for lookups */
 };
 
 /* Class for types of objects in file */
@@ -592,6 +597,12 @@ H5_DLL herr_t H5O__chunk_resize(H5O_t *oh, H5O_chunk_proxy_t *chk_proxy);
 H5_DLL herr_t H5O__chunk_delete(H5F_t *f, H5O_t *oh, unsigned idx);
 H5_DLL herr_t H5O__chunk_dest(H5O_chunk_proxy_t *chunk_proxy);
 
+/* Deferred raw data copy routines */
+H5_DLL herr_t H5O__copy_raw_create(H5O_copy_t *cpy_info, H5F_t *file_src,
+    H5F_t *file_dst);
+H5_DLL herr_t H5O__copy_raw_flush(H5O_copy_t *cpy_info);
+H5_DLL herr_t H5O__copy_raw_dest(H5O_copy_t *cpy_info);
+
 /* Collect storage info for btree and heap */
 H5_DLL herr_t H5O__attr_bh_info(H5F_t *f, H5O_t *oh, H5_ih_info_t *bh_info);
 
@@ -629,6 +640,7 @@ H5_DLL herr_t H5O__attr_reset(void *_mesg);
 H5_DLL herr_t H5O__attr_delete(H5F_t *f, H5O_t *open_oh, void *_mesg);
 H5_DLL herr_t H5O__attr_link(H5F_t *f, H5O_t *open_oh, void *_mesg);
 H5_DLL herr_t H5O__attr_count_real(H5F_t *f, H5O_t *oh, hsize_t *nattrs);
+H5_DLL herr_t H5O__attr_cache_reset(H5O_t *oh);
 
 /* Arrays of versions for:
  * Object header, Attribute/Fill value/Filter pipeline messages
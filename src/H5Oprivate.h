@@ -168,6 +168,9 @@ typedef struct H5O_mcdt_cb_info_t {
     void  			*user_data;
 } H5O_mcdt_cb_info_t;
 
+/* Queue of raw data copies deferred during an object copy (defined in H5Ocopy_raw.c) */
+typedef struct H5O_copy_raw_t H5O_copy_raw_t;
+
 /* Settings/flags for copying an object */
 typedef struct H5O_copy_t {
     hbool_t copy_shallow;               /* Flag to perform shallow hierarchy copy */
@@ -193,6 +196,7 @@ typedef struct H5O_copy_t {
     H5O_mcdt_search_cb_t mcdt_cb;	/* The callback to invoke before searching the global list of committed datatypes at destination */
     void *mcdt_ud;			/* User data passed to callback */
     hid_t lcpl_id;			/* LCPL for callbacks' use */
+    H5O_copy_raw_t *raw_queue;          /* Raw data copies deferred until the object headers are copied */
 } H5O_copy_t;
 
 /* Header message IDs */
@@ -395,9 +399,11 @@ typedef struct H5O_efl_t {
 /* Flags for chunked layout feature encoding */
 #define H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS         0x01
 #define H5O_LAYOUT_CHUNK_SINGLE_INDEX_WITH_FILTER		  0x02
+#define H5O_LAYOUT_CHUNK_SHARDED                                  0x04
 #define H5O_LAYOUT_ALL_CHUNK_FLAGS                    (                     \
     H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS                       \
     | H5O_LAYOUT_CHUNK_SINGLE_INDEX_WITH_FILTER                             \
+    | H5O_LAYOUT_CHUNK_SHARDED                                              \
     )
 
 /* Version # of encoded virtual dataset global heap blocks */
@@ -627,6 +633,7 @@ typedef struct H5O_layout_chunk_t {
     hsize_t     max_chunks[H5O_LAYOUT_NDIMS];      /* # of chunks in each dataset's max. dimension */
     hsize_t    	down_chunks[H5O_LAYOUT_NDIMS];     /* "down" size of number of chunks in each dimension */
     hsize_t    	max_down_chunks[H5O_LAYOUT_NDIMS]; /* "down" size of number of chunks in each max dim */
+    uint32_t    shard_dim[H5O_LAYOUT_NDIMS];       /* Size of each independently filtered block in a chunk, in elements (only for sharded chunks) */
     union {
         H5O_layout_chunk_farray_t farray; /* Information for fixed array index */
         H5O_layout_chunk_earray_t earray; /* Information for extensible array index */
@@ -969,6 +976,10 @@ H5_DLL herr_t H5O_copy_expand_ref(H5F_t *file_src, void *_src_ref,
     H5O_copy_t *cpy_info);
 H5_DLL herr_t H5O_copy(const H5G_loc_t *src_loc, const char *src_name,
     H5G_loc_t *dst_loc, const char *dst_name, hid_t ocpypl_id, hid_t lcpl_id);
+H5_DLL hbool_t H5O_copy_raw_can_defer(const H5O_copy_t *cpy_info,
+    const H5F_t *file_src, const H5F_t *file_dst);
+H5_DLL herr_t H5O_copy_raw_defer(H5O_copy_t *cpy_info, haddr_t addr_src,
+    haddr_t addr_dst, hsize_t size);
 
 /* Debugging routines */
 H5_DLL herr_t H5O_debug_id(unsigned type_id, H5F_t *f, const void *mesg, FILE *stream, int indent, int fwidth);
@@ -992,6 +1003,7 @@ H5_DLL herr_t H5O_fill_set_version(H5F_t * f, H5O_fill_t *fill);
 
 /* Link operators */
 H5_DLL herr_t H5O_link_delete(H5F_t *f, H5O_t *open_oh, void *_mesg);
+H5_DLL htri_t H5O_link_lookup(const H5O_loc_t *loc, const char *name, H5O_link_t *lnk);
 
 /* Filter pipeline operators */
 H5_DLL herr_t H5O_pline_set_version(H5F_t *f, H5O_pline_t *pline);
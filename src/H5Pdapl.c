@@ -96,6 +96,11 @@
 #define H5D_ACS_EFILE_PREFIX_COPY               H5P__dapl_efile_pref_copy
 #define H5D_ACS_EFILE_PREFIX_CMP                H5P__dapl_efile_pref_cmp
 #define H5D_ACS_EFILE_PREFIX_CLOSE              H5P__dapl_efile_pref_close
+/* Definitions for chunk write-behind queue */
+#define H5D_ACS_CHUNK_WRITE_BEHIND_SIZE         sizeof(size_t)
+#define H5D_ACS_CHUNK_WRITE_BEHIND_DEF          0
+#define H5D_ACS_CHUNK_WRITE_BEHIND_ENC          H5P__encode_size_t
+#define H5D_ACS_CHUNK_WRITE_BEHIND_DEC          H5P__decode_size_t
 
 /******************/
 /* Local Typedefs */
@@ -199,6 +204,7 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
     double rdcc_w0 = H5D_ACS_PREEMPT_READ_CHUNKS_DEF;           /* Default raw data chunk cache dirty ratio */
     H5D_vds_view_t virtual_view = H5D_ACS_VDS_VIEW_DEF;         /* Default VDS view option */
     hsize_t printf_gap = H5D_ACS_VDS_PRINTF_GAP_DEF;            /* Default VDS printf gap */
+    size_t write_behind = H5D_ACS_CHUNK_WRITE_BEHIND_DEF;       /* Default chunk write-behind queue size */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_STATIC
@@ -248,6 +254,11 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
             H5D_ACS_EFILE_PREFIX_DEL, H5D_ACS_EFILE_PREFIX_COPY, H5D_ACS_EFILE_PREFIX_CMP, H5D_ACS_EFILE_PREFIX_CLOSE) < 0)
          HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the size of the chunk write-behind queue */
+    if(H5P__register_real(pclass, H5D_ACS_CHUNK_WRITE_BEHIND_NAME, H5D_ACS_CHUNK_WRITE_BEHIND_SIZE, &write_behind,
+             NULL, NULL, NULL, H5D_ACS_CHUNK_WRITE_BEHIND_ENC, H5D_ACS_CHUNK_WRITE_BEHIND_DEC, NULL, NULL, NULL, NULL) < 0)
+         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dacc_reg_prop() */
@@ -864,6 +875,82 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_chunk_cache() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_write_behind
+ *
+ * Purpose:     Sets the number of dirty chunks that may be queued for
+ *              writing when they are evicted from the raw data chunk
+ *              cache, instead of being written during the eviction.
+ *
+ *              Only chunks that must be run through the dataset's I/O
+ *              filters are queued.  In a thread-safe build the filters
+ *              are run on a background thread; the chunks are allocated
+ *              in the file and written by the library once they have
+ *              been filtered.  Otherwise the queued chunks are filtered
+ *              and written when the queue is full.  An H5Dwrite call only
+ *              waits for the queue when it is full, and the queue is
+ *              emptied when the dataset is flushed or closed.
+ *
+ *              A value of zero (the default) disables the queue.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_write_behind(hid_t dapl_id, size_t nchunks)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", dapl_id, nchunks);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set the queue size */
+    if(H5P_set(plist, H5D_ACS_CHUNK_WRITE_BEHIND_NAME, &nchunks) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk write-behind queue size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_write_behind() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_write_behind
+ *
+ * Purpose:     Retrieves the number of dirty chunks that may be queued
+ *              for writing when they are evicted from the raw data chunk
+ *              cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_write_behind(hid_t dapl_id, size_t *nchunks /*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", dapl_id, nchunks);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get the queue size */
+    if(nchunks)
+        if(H5P_get(plist, H5D_ACS_CHUNK_WRITE_BEHIND_NAME, nchunks) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk write-behind queue size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_write_behind() */
+
 
 /*-------------------------------------------------------------------------
  * Function:       H5P__encode_chunk_cache_nslots
@@ -54,7 +54,7 @@
 #define H5D_DEF_STORAGE_COMPACT_INIT  {(hbool_t)FALSE, (size_t)0, NULL}
 #define H5D_DEF_STORAGE_CONTIG_INIT   {HADDR_UNDEF, (hsize_t)0}
 #define H5D_DEF_STORAGE_CHUNK_INIT    {H5D_CHUNK_IDX_BTREE, HADDR_UNDEF, H5D_COPS_BTREE, {{HADDR_UNDEF, NULL}}}
-#define H5D_DEF_LAYOUT_CHUNK_INIT    {H5D_CHUNK_IDX_BTREE, (uint8_t)0, (unsigned)0, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, (unsigned)0, (uint32_t)0, (hsize_t)0, (hsize_t)0, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {{{(uint8_t)0}}}}
+#define H5D_DEF_LAYOUT_CHUNK_INIT    {H5D_CHUNK_IDX_BTREE, (uint8_t)0, (unsigned)0, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, (unsigned)0, (uint32_t)0, (hsize_t)0, (hsize_t)0, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {{{(uint8_t)0}}}}
 #define H5D_DEF_STORAGE_VIRTUAL_INIT  {{HADDR_UNDEF, 0}, 0, NULL, 0, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, H5D_VDS_ERROR, HSIZE_UNDEF, -1, -1, FALSE}
 #ifdef H5_HAVE_C99_DESIGNATED_INITIALIZER
 #define H5D_DEF_STORAGE_COMPACT  {H5D_COMPACT, { .compact = H5D_DEF_STORAGE_COMPACT_INIT }}
@@ -2684,7 +2684,7 @@ H5Pset_chunk_opts(hid_t plist_id, unsigned options)
     /* Update the layout message, including the version (if necessary) */
     /* This probably isn't the right way to do this, and should be changed once
      * this branch gets the "real" way to set the layout version */
-    layout.u.chunk.flags = layout_flags;
+    layout.u.chunk.flags = (uint8_t)((layout.u.chunk.flags & H5O_LAYOUT_CHUNK_SHARDED) | layout_flags);
     if(layout.version < H5O_LAYOUT_VERSION_4)
         layout.version = H5O_LAYOUT_VERSION_4;
 
@@ -2750,6 +2750,142 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_chunk_opts() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_shards
+ *
+ * Purpose:     Splits each chunk of a dataset into blocks ("shards") of
+ *              the given size, which are filtered independently of each
+ *              other and stored one after the other with a table of
+ *              their sizes in front.  Reading a small part of a large
+ *              chunk that isn't held in the chunk cache then only needs
+ *              to read and unfilter the shards that part touches, while
+ *              the chunk index still works with whole chunks.
+ *
+ *              The chunk size must be set with H5Pset_chunk first, and
+ *              must be a multiple of the shard size in each dimension.
+ *              Shards only matter for datasets with filters.  Passing
+ *              NDIMS of zero turns sharding off again.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_shards(hid_t plist_id, int ndims, const hsize_t dim[/*ndims*/])
+{
+    H5P_genplist_t      *plist;         /* Property list pointer */
+    H5O_layout_t        layout;         /* Layout information for setting chunk info */
+    unsigned            u;              /* Local index variable */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iIs*[a1]h", plist_id, ndims, dim);
+
+    /* Check arguments */
+    if(ndims < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "shard dimensionality must not be negative")
+    if(ndims > 0 && !dim)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no shard dimensions specified")
+
+#ifndef H5_HAVE_C99_DESIGNATED_INITIALIZER
+    /* If the compiler doesn't support C99 designated initializers, check if
+     *  the default layout structs have been initialized yet or not.  *ick* -QAK
+     */
+    if(!H5P_dcrt_def_layout_init_g)
+        if(H5P__init_def_layout() < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTINIT, FAIL, "can't initialize default layout info")
+#endif /* H5_HAVE_C99_DESIGNATED_INITIALIZER */
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Retrieve the layout property */
+    if(H5P_peek(plist, H5D_CRT_LAYOUT_NAME, &layout) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't get layout")
+    if(H5D_CHUNKED != layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a chunked storage layout")
+
+    HDmemset(layout.u.chunk.shard_dim, 0, sizeof(layout.u.chunk.shard_dim));
+    if(0 == ndims)
+        layout.u.chunk.flags &= (uint8_t)~H5O_LAYOUT_CHUNK_SHARDED;
+    else {
+        if((unsigned)ndims != layout.u.chunk.ndims)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "shard dimensionality doesn't match chunk dimensionality")
+        for(u = 0; u < (unsigned)ndims; u++) {
+            if(dim[u] == 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "all shard dimensions must be positive")
+            if(dim[u] > layout.u.chunk.dim[u] || (layout.u.chunk.dim[u] % dim[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "chunk dimensions must be multiples of the shard dimensions")
+            layout.u.chunk.shard_dim[u] = (uint32_t)dim[u];
+        } /* end for */
+
+        /* Update the layout message, including the version (if necessary) */
+        layout.u.chunk.flags |= H5O_LAYOUT_CHUNK_SHARDED;
+        if(layout.version < H5O_LAYOUT_VERSION_4)
+            layout.version = H5O_LAYOUT_VERSION_4;
+    } /* end else */
+
+    /* Set layout value */
+    if(H5P_poke(plist, H5D_CRT_LAYOUT_NAME, &layout) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINIT, FAIL, "can't set layout")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_shards() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_shards
+ *
+ * Purpose:     Retrieves the shard size set with H5Pset_chunk_shards.
+ *              At most MAX_NDIMS elements of DIM will be initialized.
+ *
+ * Return:      Success:        Shard dimensionality, or zero if chunks
+ *                              aren't split into shards
+ *
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5Pget_chunk_shards(hid_t plist_id, int max_ndims, hsize_t dim[]/*out*/)
+{
+    H5P_genplist_t      *plist;         /* Property list pointer */
+    H5O_layout_t        layout;         /* Layout information */
+    int                 ret_value = 0;  /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("Is", "iIsx", plist_id, max_ndims, dim);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Peek at the layout property */
+    if(H5P_peek(plist, H5D_CRT_LAYOUT_NAME, &layout) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't get layout")
+    if(H5D_CHUNKED != layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a chunked storage layout")
+
+    if(layout.u.chunk.flags & H5O_LAYOUT_CHUNK_SHARDED) {
+        if(dim) {
+            unsigned	u;      /* Local index variable */
+
+            /* Get the dimension sizes */
+            for(u = 0; u < layout.u.chunk.ndims && u < (unsigned)max_ndims; u++)
+                dim[u] = layout.u.chunk.shard_dim[u];
+        } /* end if */
+
+        /* Set the return value */
+        ret_value = (int)layout.u.chunk.ndims;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_shards() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_external
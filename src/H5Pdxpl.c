@@ -120,12 +120,20 @@
 #define H5D_XFER_MPIO_CHUNK_OPT_RATIO_DEF       H5D_MULTI_CHUNK_IO_COL_THRESHOLD
 #define H5D_XFER_MPIO_CHUNK_OPT_RATIO_ENC       H5P__encode_unsigned
 #define H5D_XFER_MPIO_CHUNK_OPT_RATIO_DEC       H5P__decode_unsigned
+/* Definitions for node-local aggregation of collective writes property */
+#define H5D_XFER_MPIO_NODE_AGG_SIZE     sizeof(hbool_t)
+#define H5D_XFER_MPIO_NODE_AGG_DEF      FALSE
+#define H5D_XFER_MPIO_NODE_AGG_ENC      H5P__encode_hbool_t
+#define H5D_XFER_MPIO_NODE_AGG_DEC      H5P__decode_hbool_t
 /* Definitions for chunk opt mode property. */
 #define H5D_MPIO_ACTUAL_CHUNK_OPT_MODE_SIZE     sizeof(H5D_mpio_actual_chunk_opt_mode_t)
 #define H5D_MPIO_ACTUAL_CHUNK_OPT_MODE_DEF      H5D_MPIO_NO_CHUNK_OPTIMIZATION
 /* Definitions for chunk io mode property. */
 #define H5D_MPIO_ACTUAL_IO_MODE_SIZE    sizeof(H5D_mpio_actual_io_mode_t)
 #define H5D_MPIO_ACTUAL_IO_MODE_DEF     H5D_MPIO_NO_COLLECTIVE
+/* Definitions for actual node-local aggregation property */
+#define H5D_MPIO_ACTUAL_NODE_AGG_SIZE   sizeof(hbool_t)
+#define H5D_MPIO_ACTUAL_NODE_AGG_DEF    FALSE
 /* Definitions for cause of broken collective io property */
 #define H5D_MPIO_NO_COLLECTIVE_CAUSE_SIZE   sizeof(uint32_t)
 #define H5D_MPIO_NO_COLLECTIVE_CAUSE_DEF   H5D_MPIO_COLLECTIVE 
@@ -243,8 +251,10 @@ static const H5FD_mpio_chunk_opt_t H5D_def_mpio_chunk_opt_mode_g = H5D_XFER_MPIO
 static const H5FD_mpio_collective_opt_t H5D_def_mpio_collective_opt_mode_g = H5D_XFER_MPIO_COLLECTIVE_OPT_DEF;
 static const unsigned H5D_def_mpio_chunk_opt_num_g = H5D_XFER_MPIO_CHUNK_OPT_NUM_DEF;
 static const unsigned H5D_def_mpio_chunk_opt_ratio_g = H5D_XFER_MPIO_CHUNK_OPT_RATIO_DEF;
+static const hbool_t H5D_def_mpio_node_agg_g = H5D_XFER_MPIO_NODE_AGG_DEF;
 static const H5D_mpio_actual_chunk_opt_mode_t H5D_def_mpio_actual_chunk_opt_mode_g = H5D_MPIO_ACTUAL_CHUNK_OPT_MODE_DEF;
 static const H5D_mpio_actual_io_mode_t H5D_def_mpio_actual_io_mode_g = H5D_MPIO_ACTUAL_IO_MODE_DEF;
+static const hbool_t H5D_def_mpio_actual_node_agg_g = H5D_MPIO_ACTUAL_NODE_AGG_DEF;
 static const H5D_mpio_no_collective_cause_t H5D_def_mpio_no_collective_cause_g = H5D_MPIO_NO_COLLECTIVE_CAUSE_DEF; 
 static const H5Z_EDC_t H5D_def_enable_edc_g = H5D_XFER_EDC_DEF;            /* Default value for EDC property */
 static const H5Z_cb_t H5D_def_filter_cb_g = H5D_XFER_FILTER_CB_DEF;        /* Default value for filter callback */
@@ -351,6 +361,10 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, H5D_XFER_MPIO_CHUNK_OPT_RATIO_ENC, H5D_XFER_MPIO_CHUNK_OPT_RATIO_DEC,
             NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+    if(H5P__register_real(pclass, H5D_XFER_MPIO_NODE_AGG_NAME, H5D_XFER_MPIO_NODE_AGG_SIZE, &H5D_def_mpio_node_agg_g, 
+            NULL, NULL, NULL, H5D_XFER_MPIO_NODE_AGG_ENC, H5D_XFER_MPIO_NODE_AGG_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
     /* Register the chunk optimization mode property. */
     /* (Note: this property should not have an encode/decode callback -QAK) */
@@ -364,6 +378,12 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the actual node-local aggregation property. */
+    /* (Note: this property should not have an encode/decode callback) */
+    if(H5P__register_real(pclass, H5D_MPIO_ACTUAL_NODE_AGG_NAME, H5D_MPIO_ACTUAL_NODE_AGG_SIZE, &H5D_def_mpio_actual_node_agg_g,
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the local cause of broken collective I/O */
     /* (Note: this property should not have an encode/decode callback -QAK) */
     if(H5P__register_real(pclass, H5D_MPIO_LOCAL_NO_COLLECTIVE_CAUSE_NAME, H5D_MPIO_NO_COLLECTIVE_CAUSE_SIZE, &H5D_def_mpio_no_collective_cause_g,
@@ -2017,6 +2037,42 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_mpio_actual_io_mode() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_mpio_actual_node_agg
+ *
+ * Purpose:	Retrieves whether the last collective write with the
+ *		transfer property list was aggregated on this process's
+ *		node (see H5Pset_dxpl_mpio_node_agg).  A write requested
+ *		with node aggregation is written without it when the
+ *		processes on a node can't set up the aggregation.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_mpio_actual_node_agg(hid_t plist_id, hbool_t *actual_node_agg)
+{
+    H5P_genplist_t     *plist;
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*b", plist_id, actual_node_agg);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Return values */
+    if(actual_node_agg)
+        if(H5P_get(plist, H5D_MPIO_ACTUAL_NODE_AGG_NAME, actual_node_agg) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_mpio_actual_node_agg() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Pget_mpio_no_collective_cause
@@ -25,13 +25,78 @@
 #include "H5Eprivate.h"		/* Error handling			*/
 #include "H5FLprivate.h"	/* Free Lists				*/
 #include "H5Iprivate.h"		/* ID Functions				*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Spkg.h"		/* Dataspace functions			*/
 #include "H5VMprivate.h"         /* Vector functions			*/
 
 /* Local Macros */
 
+/* Number of span tree nodes carved from each block of a span arena.
+ * A block can't be released while any of its nodes is in use, so one
+ * long-lived node can keep a whole block allocated; keeping blocks small
+ * bounds that at a few KiB per live node (64 span nodes are ~3.5 KiB),
+ * while still making most allocations a pointer bump.
+ */
+#define H5S_HYPER_ARENA_BLK_NNODES      64
+
+/* Round a size up to the alignment used for span arena nodes */
+#define H5S_HYPER_ARENA_ALIGN(S)        \
+    ((((S) + sizeof(H5S_hyper_arena_node_t) - 1) / sizeof(H5S_hyper_arena_node_t)) * sizeof(H5S_hyper_arena_node_t))
+
+/* Macros for allocating & releasing span tree nodes of type 't' through
+ *      the span arena for that type (mirroring the H5FL_MALLOC, etc. macros)
+ */
+#define H5S_HYPER_ARENA_NAME(t)         H5S_##t##_arena_g
+#ifndef H5_NO_REG_FREE_LISTS
+#define H5S_HYPER_ARENA_DEFINE_STATIC(t) static H5S_hyper_arena_t H5S_HYPER_ARENA_NAME(t) = {sizeof(t), NULL}
+#define H5S_HYPER_ARENA_MALLOC(t)       (t *)H5S__hyper_arena_malloc(&H5S_HYPER_ARENA_NAME(t))
+#define H5S_HYPER_ARENA_CALLOC(t)       (t *)H5S__hyper_arena_calloc(&H5S_HYPER_ARENA_NAME(t))
+#define H5S_HYPER_ARENA_FREE(t, obj)    (t *)H5S__hyper_arena_free(obj)
+#else /* H5_NO_REG_FREE_LISTS */
+/* Use malloc/free directly, so memory checkers see each span node */
+#define H5S_HYPER_ARENA_MALLOC(t)       (t *)H5MM_malloc(sizeof(t))
+#define H5S_HYPER_ARENA_CALLOC(t)       (t *)H5MM_calloc(sizeof(t))
+#define H5S_HYPER_ARENA_FREE(t, obj)    (t *)H5MM_xfree(obj)
+#endif /* H5_NO_REG_FREE_LISTS */
+
 /* Local datatypes */
 
+/* Header in front of each node allocated from a span arena */
+typedef union H5S_hyper_arena_node_t {
+    struct H5S_hyper_arena_blk_t *blk;          /* Block containing node (when in use) */
+    union H5S_hyper_arena_node_t *next;         /* Next free node in block (when free) */
+    hsize_t unused1;                            /* Unused normally, just here for alignment */
+    double unused2;                             /* Unused normally, just here for alignment */
+} H5S_hyper_arena_node_t;
+
+/* Block of contiguous span tree nodes in a span arena */
+typedef struct H5S_hyper_arena_blk_t {
+    struct H5S_hyper_arena_t *arena;            /* Arena that owns the block */
+    struct H5S_hyper_arena_blk_t *prev;         /* Previous block with free nodes */
+    struct H5S_hyper_arena_blk_t *next;         /* Next block with free nodes */
+    size_t nused;                               /* # of nodes in use */
+    size_t ncarved;                             /* # of nodes carved from the block so far */
+    H5S_hyper_arena_node_t *free_list;          /* Nodes released back to the block */
+} H5S_hyper_arena_blk_t;
+
+/* Span arena for one kind of span tree node.
+ *
+ * Nodes are carved sequentially out of large blocks, so span trees built
+ * together (i.e. by the same selection operation) are laid out contiguously
+ * in memory, and allocating a node is usually just a pointer bump.  Released
+ * nodes go back on a free list for their block and a block is returned to
+ * the 'hyper_arena_blk' block free list once all of its nodes are released,
+ * so the free list limits and H5garbage_collect() apply to arena memory.
+ *
+ * The span trees themselves keep their linked layout: spans are shared and
+ * spliced in place by the selection operations, which an array per span
+ * list would have to copy on every change.
+ */
+typedef struct H5S_hyper_arena_t {
+    size_t size;                                /* Size of the node objects */
+    H5S_hyper_arena_blk_t *avail;               /* List of blocks with free nodes */
+} H5S_hyper_arena_t;
+
 /* Static function prototypes */
 static H5S_hyper_span_t *H5S__hyper_new_span(hsize_t low, hsize_t high,
     H5S_hyper_span_info_t *down, H5S_hyper_span_t *next);
@@ -72,6 +137,20 @@ static void H5S__hyper_get_clip_diminfo(hsize_t start, hsize_t stride,
     hsize_t *count, hsize_t *block, hsize_t clip_size);
 static hsize_t H5S__hyper_get_clip_extent_real(const H5S_t *clip_space,
     hsize_t num_slices, hbool_t incl_trail);
+static htri_t H5S__hyper_seq_cache_get(const H5S_t *space, H5S_sel_iter_t *iter,
+    size_t maxseq, size_t maxelem, size_t *nseq, size_t *nelem, hsize_t *off,
+    size_t *len);
+static herr_t H5S__hyper_seq_cache_set(const H5S_t *space, size_t elmt_size,
+    size_t nseq, size_t nelem, const hsize_t *off, const size_t *len);
+static hbool_t H5S__hyper_seq_cache_shape_same(const H5S_hyper_seq_cache_t *seq_cache,
+    const H5S_t *space);
+static H5S_hyper_seq_cache_t *H5S__hyper_seq_cache_free(H5S_hyper_seq_cache_t *seq_cache);
+static void H5S__hyper_seq_cache_reset(H5S_t *space);
+#ifndef H5_NO_REG_FREE_LISTS
+static void *H5S__hyper_arena_malloc(H5S_hyper_arena_t *arena);
+static void *H5S__hyper_arena_calloc(H5S_hyper_arena_t *arena);
+static void *H5S__hyper_arena_free(void *obj);
+#endif /* H5_NO_REG_FREE_LISTS */
 
 /* Selection callbacks */
 static herr_t H5S__hyper_copy(H5S_t *dst, const H5S_t *src, hbool_t share_selection);
@@ -167,11 +246,23 @@ static const hsize_t H5S_hyper_ones_g[H5O_LAYOUT_NDIMS] = {
 /* Declare a free list to manage the H5S_hyper_sel_t struct */
 H5FL_DEFINE_STATIC(H5S_hyper_sel_t);
 
-/* Declare a free list to manage the H5S_hyper_span_t struct */
-H5FL_DEFINE_STATIC(H5S_hyper_span_t);
+#ifndef H5_NO_REG_FREE_LISTS
+/* Declare a free list to manage the blocks of span arenas */
+H5FL_BLK_DEFINE_STATIC(hyper_arena_blk);
+
+/* Declare an arena to manage the H5S_hyper_span_t struct */
+H5S_HYPER_ARENA_DEFINE_STATIC(H5S_hyper_span_t);
+
+/* Declare an arena to manage the H5S_hyper_span_info_t struct */
+H5S_HYPER_ARENA_DEFINE_STATIC(H5S_hyper_span_info_t);
+#endif /* H5_NO_REG_FREE_LISTS */
+
+/* Declare a free list to manage the H5S_hyper_seq_cache_t struct */
+H5FL_DEFINE_STATIC(H5S_hyper_seq_cache_t);
 
-/* Declare a free list to manage the H5S_hyper_span_info_t struct */
-H5FL_DEFINE_STATIC(H5S_hyper_span_info_t);
+/* Declare free lists to manage sequences of offsets & lengths for cached sequences */
+H5FL_SEQ_DEFINE_STATIC(hsize_t);
+H5FL_SEQ_DEFINE_STATIC(size_t);
 
 /* Declare extern free list to manage the H5S_sel_iter_t struct */
 H5FL_EXTERN(H5S_sel_iter_t);
@@ -1099,6 +1190,193 @@ H5S__hyper_iter_release(H5S_sel_iter_t *iter)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5S__hyper_iter_release() */
 
+#ifndef H5_NO_REG_FREE_LISTS
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_arena_malloc
+ PURPOSE
+    Allocate a span tree node from a span arena
+ USAGE
+    void *H5S__hyper_arena_malloc(arena)
+        H5S_hyper_arena_t *arena;   IN/OUT: Arena to allocate node from
+ RETURNS
+    Pointer to uninitialized node on success, NULL on failure
+ DESCRIPTION
+    Allocate a node from the first block in the arena with free space,
+    re-using released nodes in that block before carving new ones from
+    the end of the block.  A new block is allocated when no block has free
+    space.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static void *
+H5S__hyper_arena_malloc(H5S_hyper_arena_t *arena)
+{
+    H5S_hyper_arena_blk_t *blk;             /* Block to allocate from */
+    H5S_hyper_arena_node_t *node;           /* Node allocated */
+    size_t node_size;                       /* Size of each node, including header */
+    void *ret_value = NULL;                 /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(arena);
+    HDassert(arena->size > 0);
+
+    node_size = sizeof(H5S_hyper_arena_node_t) + H5S_HYPER_ARENA_ALIGN(arena->size);
+
+    /* Allocate a new block, if no block has free nodes */
+    if(NULL == (blk = arena->avail)) {
+        if(NULL == (blk = (H5S_hyper_arena_blk_t *)H5FL_BLK_MALLOC(hyper_arena_blk, H5S_HYPER_ARENA_ALIGN(sizeof(H5S_hyper_arena_blk_t)) + (H5S_HYPER_ARENA_BLK_NNODES * node_size))))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate span arena block")
+        blk->arena = arena;
+        blk->prev = blk->next = NULL;
+        blk->nused = 0;
+        blk->ncarved = 0;
+        blk->free_list = NULL;
+        arena->avail = blk;
+    } /* end if */
+
+    /* Re-use a released node, or carve a new node from the block */
+    if(blk->free_list) {
+        node = blk->free_list;
+        blk->free_list = node->next;
+    } /* end if */
+    else {
+        HDassert(blk->ncarved < H5S_HYPER_ARENA_BLK_NNODES);
+        node = (H5S_hyper_arena_node_t *)((uint8_t *)blk + H5S_HYPER_ARENA_ALIGN(sizeof(H5S_hyper_arena_blk_t)) + (blk->ncarved * node_size));
+        blk->ncarved++;
+    } /* end else */
+    node->blk = blk;
+    blk->nused++;
+
+    /* Remove block from list of blocks with free nodes, if it's full now */
+    if(blk->nused == H5S_HYPER_ARENA_BLK_NNODES) {
+        arena->avail = blk->next;
+        if(blk->next)
+            blk->next->prev = NULL;
+        blk->next = NULL;
+    } /* end if */
+
+    /* Set return value */
+    ret_value = (void *)(node + 1);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_arena_malloc() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_arena_calloc
+ PURPOSE
+    Allocate a zeroed span tree node from a span arena
+ USAGE
+    void *H5S__hyper_arena_calloc(arena)
+        H5S_hyper_arena_t *arena;   IN/OUT: Arena to allocate node from
+ RETURNS
+    Pointer to zeroed node on success, NULL on failure
+ DESCRIPTION
+    Allocate a node from a span arena and clear it.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static void *
+H5S__hyper_arena_calloc(H5S_hyper_arena_t *arena)
+{
+    void *ret_value = NULL;                 /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(arena);
+
+    /* Allocate the node */
+    if(NULL == (ret_value = H5S__hyper_arena_malloc(arena)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate span arena node")
+
+    /* Clear to zeros */
+    HDmemset(ret_value, 0, arena->size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_arena_calloc() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_arena_free
+ PURPOSE
+    Release a span tree node back to its span arena
+ USAGE
+    void *H5S__hyper_arena_free(obj)
+        void *obj;                  IN: Node to release
+ RETURNS
+    NULL (always)
+ DESCRIPTION
+    Put the node back on the free list of the block it was carved from.
+    When all the nodes in a block have been released, the whole block is
+    returned to the block free list, which caches it for the next block
+    allocated.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static void *
+H5S__hyper_arena_free(void *obj)
+{
+    H5S_hyper_arena_node_t *node;           /* Header for node to release */
+    H5S_hyper_arena_blk_t *blk;             /* Block containing node */
+    H5S_hyper_arena_t *arena;               /* Arena containing block */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(obj);
+
+    /* Locate the node's block & arena */
+    node = ((H5S_hyper_arena_node_t *)obj) - 1;
+    blk = node->blk;
+    HDassert(blk);
+    HDassert(blk->nused > 0);
+    arena = blk->arena;
+    HDassert(arena);
+
+    /* Put block back on list of blocks with free nodes, if it was full */
+    if(blk->nused == H5S_HYPER_ARENA_BLK_NNODES) {
+        blk->prev = NULL;
+        blk->next = arena->avail;
+        if(arena->avail)
+            arena->avail->prev = blk;
+        arena->avail = blk;
+    } /* end if */
+
+    /* Return node to the block */
+    node->next = blk->free_list;
+    blk->free_list = node;
+    blk->nused--;
+
+    /* Release block when it's unused */
+    if(0 == blk->nused) {
+        if(blk->prev)
+            blk->prev->next = blk->next;
+        else
+            arena->avail = blk->next;
+        if(blk->next)
+            blk->next->prev = blk->prev;
+        blk = (H5S_hyper_arena_blk_t *)H5FL_BLK_FREE(hyper_arena_blk, blk);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(NULL)
+} /* end H5S__hyper_arena_free() */
+#endif /* H5_NO_REG_FREE_LISTS */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -1129,7 +1407,7 @@ H5S__hyper_new_span(hsize_t low, hsize_t high, H5S_hyper_span_info_t *down, H5S_
     FUNC_ENTER_STATIC
 
     /* Allocate a new span node */
-    if(NULL == (ret_value = H5FL_MALLOC(H5S_hyper_span_t)))
+    if(NULL == (ret_value = H5S_HYPER_ARENA_MALLOC(H5S_hyper_span_t)))
         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate hyperslab span")
 
     /* Copy the span's basic information */
@@ -1332,7 +1610,7 @@ H5S__hyper_copy_span_helper(H5S_hyper_span_info_t *spans)
     } /* end if */
     else {
         /* Allocate a new span_info node */
-        if(NULL == (ret_value = H5FL_CALLOC(H5S_hyper_span_info_t)))
+        if(NULL == (ret_value = H5S_HYPER_ARENA_CALLOC(H5S_hyper_span_info_t)))
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate hyperslab span info")
 
         /* Copy the span_info information */
@@ -1555,7 +1833,7 @@ H5S__hyper_free_span_info(H5S_hyper_span_info_t *span_info)
         } /* end while */
 
         /* Free this span info */
-        span_info = H5FL_FREE(H5S_hyper_span_info_t, span_info);
+        span_info = H5S_HYPER_ARENA_FREE(H5S_hyper_span_info_t, span_info);
     } /* end if */
 
 done:
@@ -1597,7 +1875,7 @@ H5S__hyper_free_span(H5S_hyper_span_t *span)
             HGOTO_ERROR(H5E_INTERNAL, H5E_CANTFREE, FAIL, "failed to release hyperslab span tree")
 
     /* Free this span */
-    span = H5FL_FREE(H5S_hyper_span_t, span);
+    span = H5S_HYPER_ARENA_FREE(H5S_hyper_span_t, span);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1680,6 +1958,9 @@ H5S__hyper_copy(H5S_t *dst, const H5S_t *src, hbool_t share_selection)
     dst_hslab->unlim_dim = src_hslab->unlim_dim;
     dst_hslab->num_elem_non_unlim = src_hslab->num_elem_non_unlim;
 
+    /* Cached sequences are not copied */
+    dst_hslab->seq_cache = NULL;
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S__hyper_copy() */
@@ -3393,6 +3674,10 @@ H5S__hyper_release(H5S_t *space)
             if(H5S__hyper_free_span_info(space->select.sel_info.hslab->span_lst) < 0)
                 HGOTO_ERROR(H5E_INTERNAL, H5E_CANTFREE, FAIL, "failed to release hyperslab spans")
 
+        /* Release any cached sequences */
+        if(space->select.sel_info.hslab->seq_cache)
+            space->select.sel_info.hslab->seq_cache = H5S__hyper_seq_cache_free(space->select.sel_info.hslab->seq_cache);
+
         /* Release space for the hyperslab selection information */
         space->select.sel_info.hslab = H5FL_FREE(H5S_hyper_sel_t, space->select.sel_info.hslab);
     } /* end if */
@@ -3476,7 +3761,7 @@ H5S__hyper_coord_to_span(unsigned rank, const hsize_t *coords)
     /* Search for location to insert new element in tree */
     if(rank > 1) {
         /* Allocate a span info node */
-        if(NULL == (down = H5FL_CALLOC(H5S_hyper_span_info_t)))
+        if(NULL == (down = H5S_HYPER_ARENA_CALLOC(H5S_hyper_span_info_t)))
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate hyperslab span")
 
 
@@ -3740,7 +4025,7 @@ H5S_hyper_add_span_element(H5S_t *space, unsigned rank, const hsize_t *coords)
     /* Check if this is the first element in the selection */
     if(NULL == space->select.sel_info.hslab) {
         /* Allocate a span info node */
-        if(NULL == (head = H5FL_CALLOC(H5S_hyper_span_info_t)))
+        if(NULL == (head = H5S_HYPER_ARENA_CALLOC(H5S_hyper_span_info_t)))
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate hyperslab span info")
 
         /* Set the reference count */
@@ -3766,10 +4051,16 @@ H5S_hyper_add_span_element(H5S_t *space, unsigned rank, const hsize_t *coords)
         /* Set unlim_dim */
         space->select.sel_info.hslab->unlim_dim = -1;
 
+        /* No cached sequences yet */
+        space->select.sel_info.hslab->seq_cache = NULL;
+
         /* Set # of elements in selection */
         space->select.num_elem = 1;
     } /* end if */
     else {
+        /* Sequences cached for the selection are no longer valid */
+        H5S__hyper_seq_cache_reset(space);
+
         if(H5S__hyper_add_span_element_helper(space->select.sel_info.hslab->span_lst, rank, coords) < 0)
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't insert coordinate into span tree")
 
@@ -4383,7 +4674,7 @@ H5S__hyper_project_simple_higher(const H5S_t *base_space, H5S_t *new_space)
         H5S_hyper_span_t *new_span;     /* Temporary hyperslab span */
 
         /* Allocate a new span_info node */
-        if(NULL == (new_span_info = H5FL_CALLOC(H5S_hyper_span_info_t))) {
+        if(NULL == (new_span_info = H5S_HYPER_ARENA_CALLOC(H5S_hyper_span_info_t))) {
             if(prev_span)
                 if(H5S__hyper_free_span(prev_span) < 0)
                     HERROR(H5E_DATASPACE, H5E_CANTFREE, "can't free hyperslab span");
@@ -4398,7 +4689,7 @@ H5S__hyper_project_simple_higher(const H5S_t *base_space, H5S_t *new_space)
         if(NULL == (new_span = H5S__hyper_new_span((hsize_t)0, (hsize_t)0, NULL, NULL))) {
             HDassert(new_span_info);
             if(!prev_span)
-                (void)H5FL_FREE(H5S_hyper_span_info_t, new_span_info);
+                (void)H5S_HYPER_ARENA_FREE(H5S_hyper_span_info_t, new_span_info);
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate hyperslab span")
         } /* end if */
 
@@ -4429,7 +4720,7 @@ done:
             if(H5S__hyper_free_span(new_space->select.sel_info.hslab->span_lst->head) < 0)
                 HDONE_ERROR(H5E_DATASPACE, H5E_CANTFREE, FAIL, "can't free hyperslab span")
 
-        new_space->select.sel_info.hslab->span_lst = H5FL_FREE(H5S_hyper_span_info_t, new_space->select.sel_info.hslab->span_lst);
+        new_space->select.sel_info.hslab->span_lst = H5S_HYPER_ARENA_FREE(H5S_hyper_span_info_t, new_space->select.sel_info.hslab->span_lst);
     } /* end if */
 
     FUNC_LEAVE_NOAPI(ret_value)
@@ -4472,6 +4763,9 @@ H5S__hyper_project_simple(const H5S_t *base_space, H5S_t *new_space, hsize_t *of
     /* Set unlim_dim */
     new_space->select.sel_info.hslab->unlim_dim = -1;
 
+    /* No cached sequences yet */
+    new_space->select.sel_info.hslab->seq_cache = NULL;
+
     /* Check for a "regular" hyperslab selection */
     if(base_space->select.sel_info.hslab->diminfo_valid) {
         unsigned base_space_dim;    /* Current dimension in the base dataspace */
@@ -4860,7 +5154,7 @@ H5S__hyper_append_span(H5S_hyper_span_t **prev_span,
         HDassert(*span_tree == NULL);
 
         /* Allocate a new span_info node */
-        if(NULL == (*span_tree = H5FL_CALLOC(H5S_hyper_span_info_t)))
+        if(NULL == (*span_tree = H5S_HYPER_ARENA_CALLOC(H5S_hyper_span_info_t)))
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate hyperslab span")
 
         /* Set the span tree's basic information */
@@ -5780,6 +6074,9 @@ H5S__hyper_merge_spans(H5S_t *space, H5S_hyper_span_info_t *new_spans, hbool_t c
     else {
         H5S_hyper_span_info_t *merged_spans;
 
+        /* Sequences cached for the selection are no longer valid */
+        H5S__hyper_seq_cache_reset(space);
+
         /* Get the merged spans */
         merged_spans = H5S__hyper_merge_spans_helper(space->select.sel_info.hslab->span_lst, new_spans);
 
@@ -5906,7 +6203,7 @@ H5S__hyper_make_spans(unsigned rank, const hsize_t *start, const hsize_t *stride
             H5S_hyper_span_t      *span;            /* New hyperslab span */
 
             /* Allocate a span node */
-            if(NULL == (span = H5FL_MALLOC(H5S_hyper_span_t)))
+            if(NULL == (span = H5S_HYPER_ARENA_MALLOC(H5S_hyper_span_t)))
                 HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate hyperslab span")
 
             /* Set the span's basic information */
@@ -5935,7 +6232,7 @@ H5S__hyper_make_spans(unsigned rank, const hsize_t *start, const hsize_t *stride
         } /* end for */
 
         /* Allocate a span info node */
-        if(NULL == (down = H5FL_CALLOC(H5S_hyper_span_info_t)))
+        if(NULL == (down = H5S_HYPER_ARENA_CALLOC(H5S_hyper_span_info_t)))
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate hyperslab span")
 
         /* Keep the pointer to the next dimension down's completed list */
@@ -5961,13 +6258,13 @@ done:
             do {
                 if(down) {
                     head = down->head;
-                    down = H5FL_FREE(H5S_hyper_span_info_t, down);
+                    down = H5S_HYPER_ARENA_FREE(H5S_hyper_span_info_t, down);
                 } /* end if */
                 down = head->down;
 
                 while(head) {
                     last_span = head->next;
-                    head = H5FL_FREE(H5S_hyper_span_t, head);
+                    head = H5S_HYPER_ARENA_FREE(H5S_hyper_span_t, head);
                     head = last_span;
                 } /* end while */
             } while(down);
@@ -6439,7 +6736,7 @@ H5S__generate_hyperslab (H5S_t *space, H5S_seloper_t op,
             HDassert(space->select.num_elem == 0);
 
             /* Allocate a span info node */
-            if((spans = H5FL_MALLOC(H5S_hyper_span_info_t))==NULL)
+            if((spans = H5S_HYPER_ARENA_MALLOC(H5S_hyper_span_info_t))==NULL)
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate hyperslab span")
 
             /* Set the reference count */
@@ -6506,6 +6803,7 @@ H5S_select_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[],
     const hsize_t *opt_stride;      /* Optimized stride information */
     const hsize_t *opt_count;       /* Optimized count information */
     const hsize_t *opt_block;       /* Optimized block information */
+    H5S_hyper_seq_cache_t *seq_cache = NULL;    /* Sequences cached for previous selection */
     int unlim_dim = -1;             /* Unlimited dimension in selection, of -1 if none */
     unsigned u;                     /* Local index variable */
     herr_t ret_value = SUCCEED;     /* Return value */
@@ -6722,6 +7020,17 @@ H5S_select_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[],
     } /* end switch */
 
     if(op == H5S_SELECT_SET) {
+        /* Hold on to sequences cached for a regular hyperslab selection, so
+         *      they can be re-used if the new selection is the same shape
+         *      (i.e. the selection is just being moved around the dataspace)
+         */
+        if(H5S_GET_SELECT_TYPE(space) == H5S_SEL_HYPERSLABS &&
+                space->select.sel_info.hslab->seq_cache &&
+                space->select.sel_info.hslab->seq_cache->shape_valid) {
+            seq_cache = space->select.sel_info.hslab->seq_cache;
+            space->select.sel_info.hslab->seq_cache = NULL;
+        } /* end if */
+
         /* If we are setting a new selection, remove current selection first */
         if(H5S_SELECT_RELEASE(space) < 0)
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't release selection")
@@ -6755,6 +7064,9 @@ H5S_select_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[],
         /* Indicate that there's no slab information */
         space->select.sel_info.hslab->span_lst = NULL;
 
+        /* No cached sequences yet */
+        space->select.sel_info.hslab->seq_cache = NULL;
+
         /* Handle unlimited selections */
         if(unlim_dim >= 0) {
             /* Calculate num_elem_non_unlim */
@@ -6770,6 +7082,12 @@ H5S_select_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[],
 
         /* Set selection type */
         space->select.type = H5S_sel_hyper;
+
+        /* Re-use the previous selection's sequences, if it had the same shape */
+        if(seq_cache && unlim_dim < 0 && H5S__hyper_seq_cache_shape_same(seq_cache, space)) {
+            space->select.sel_info.hslab->seq_cache = seq_cache;
+            seq_cache = NULL;
+        } /* end if */
     } /* end if */
     else if(op >= H5S_SELECT_OR && op <= H5S_SELECT_NOTA) {
         /* Sanity check */
@@ -6827,6 +7145,10 @@ H5S_select_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[],
         HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
 
 done:
+    /* Release cached sequences that couldn't be re-used */
+    if(seq_cache)
+        seq_cache = H5S__hyper_seq_cache_free(seq_cache);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S_select_hyperslab() */
 
@@ -7068,7 +7390,7 @@ H5S_operate_hyperslab (H5S_t *result, H5S_hyper_span_info_t *spans1, H5S_seloper
             HDassert(result->select.num_elem == 0);
 
             /* Allocate a span info node */
-            if((spans = H5FL_MALLOC(H5S_hyper_span_info_t))==NULL)
+            if((spans = H5S_HYPER_ARENA_MALLOC(H5S_hyper_span_info_t))==NULL)
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "can't allocate hyperslab span")
 
             /* Set the reference count */
@@ -7153,6 +7475,9 @@ H5S__generate_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[],
 
         /* Set unlim_dim */
         space->select.sel_info.hslab->unlim_dim = -1;
+
+        /* No cached sequences yet */
+        space->select.sel_info.hslab->seq_cache = NULL;
     } /* end if */
 
     /* Combine tmp_space (really space) & new_space, with the result in space */
@@ -7442,6 +7767,9 @@ H5S_select_hyperslab (H5S_t *space, H5S_seloper_t op,
         /* Indicate that there's no slab information */
         space->select.sel_info.hslab->span_lst = NULL;
 
+        /* No cached sequences yet */
+        space->select.sel_info.hslab->seq_cache = NULL;
+
         /* Handle unlimited selections */
         if(unlim_dim >= 0) {
             /* Calculate num_elem_non_unlim */
@@ -9052,6 +9380,311 @@ H5S__hyper_get_seq_list_single(const H5S_t *space, H5S_sel_iter_t *iter,
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5S__hyper_get_seq_list_single() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_seq_cache_free
+ PURPOSE
+    Release sequences cached for a hyperslab selection
+ USAGE
+    H5S_hyper_seq_cache_t *H5S__hyper_seq_cache_free(seq_cache)
+        H5S_hyper_seq_cache_t *seq_cache;   IN: Cached sequences to release
+ RETURNS
+    NULL (always)
+ DESCRIPTION
+    Release the cached offset & length arrays, along with the cache itself.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static H5S_hyper_seq_cache_t *
+H5S__hyper_seq_cache_free(H5S_hyper_seq_cache_t *seq_cache)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(seq_cache);
+
+    if(seq_cache->off)
+        seq_cache->off = H5FL_SEQ_FREE(hsize_t, seq_cache->off);
+    if(seq_cache->len)
+        seq_cache->len = H5FL_SEQ_FREE(size_t, seq_cache->len);
+    seq_cache = H5FL_FREE(H5S_hyper_seq_cache_t, seq_cache);
+
+    FUNC_LEAVE_NOAPI(NULL)
+} /* end H5S__hyper_seq_cache_free() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_seq_cache_reset
+ PURPOSE
+    Invalidate the sequences cached for a hyperslab selection
+ USAGE
+    void H5S__hyper_seq_cache_reset(space)
+        H5S_t *space;           IN/OUT: Dataspace whose selection is changing
+ RETURNS
+    None
+ DESCRIPTION
+    Release any sequences cached for a hyperslab selection that is about to
+    be modified in place.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    Moving a selection around the dataspace (by changing its offset, or
+    adjusting its coordinates) doesn't invalidate the cached sequences, since
+    they are relocated to the selection's current position when re-used.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static void
+H5S__hyper_seq_cache_reset(H5S_t *space)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(space);
+    HDassert(space->select.sel_info.hslab);
+
+    if(space->select.sel_info.hslab->seq_cache)
+        space->select.sel_info.hslab->seq_cache = H5S__hyper_seq_cache_free(space->select.sel_info.hslab->seq_cache);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5S__hyper_seq_cache_reset() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_seq_cache_shape_same
+ PURPOSE
+    Check if cached sequences can be used for a regular hyperslab selection
+ USAGE
+    hbool_t H5S__hyper_seq_cache_shape_same(seq_cache, space)
+        const H5S_hyper_seq_cache_t *seq_cache;  IN: Cached sequences
+        const H5S_t *space;     IN: Dataspace with regular hyperslab selection
+ RETURNS
+    TRUE/FALSE
+ DESCRIPTION
+    Checks whether the sequences cached for a previous regular hyperslab
+    selection are valid for the regular hyperslab selection in the
+    dataspace.  This is the case when the selections have the same shape
+    (i.e. the same stride, count & block in each dimension) in the same
+    extent, since the new selection's sequences are then the cached ones
+    shifted by a constant offset.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static hbool_t
+H5S__hyper_seq_cache_shape_same(const H5S_hyper_seq_cache_t *seq_cache,
+    const H5S_t *space)
+{
+    const H5S_hyper_dim_t *diminfo;     /* Alias for selection's regular information */
+    unsigned u;                         /* Local index variable */
+    hbool_t ret_value = TRUE;           /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(seq_cache);
+    HDassert(space);
+    HDassert(space->select.sel_info.hslab);
+
+    if(!seq_cache->shape_valid || !space->select.sel_info.hslab->diminfo_valid)
+        HGOTO_DONE(FALSE)
+
+    diminfo = space->select.sel_info.hslab->opt_diminfo;
+    for(u = 0; u < space->extent.rank; u++)
+        if(seq_cache->dims[u] != space->extent.size[u]
+                || seq_cache->shape[u].stride != diminfo[u].stride
+                || seq_cache->shape[u].count != diminfo[u].count
+                || seq_cache->shape[u].block != diminfo[u].block)
+            HGOTO_DONE(FALSE)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_seq_cache_shape_same() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_seq_cache_set
+ PURPOSE
+    Cache the sequences generated for an entire hyperslab selection
+ USAGE
+    herr_t H5S__hyper_seq_cache_set(space, elmt_size, nseq, nelem, off, len)
+        const H5S_t *space;     IN: Dataspace with hyperslab selection
+        size_t elmt_size;       IN: Size of elements the sequences are for
+        size_t nseq;            IN: Number of sequences
+        size_t nelem;           IN: Number of elements in sequences
+        const hsize_t *off;     IN: Offsets of sequences
+        const size_t *len;      IN: Lengths of sequences
+ RETURNS
+    Non-negative on success/Negative on failure
+ DESCRIPTION
+    Save a copy of the sequences generated for all the elements in a
+    hyperslab selection, along with the location of the selection when
+    they were generated, so later iterations over the same selection (or
+    a selection of the same shape) can re-use them instead of walking the
+    selection again.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    The cache is a mutable field of the hyperslab selection (see
+    H5S_hyper_sel_t), so it's updated through a const dataspace pointer.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static herr_t
+H5S__hyper_seq_cache_set(const H5S_t *space, size_t elmt_size, size_t nseq,
+    size_t nelem, const hsize_t *off, const size_t *len)
+{
+    H5S_hyper_sel_t *hslab;                     /* Alias for hyperslab selection information */
+    H5S_hyper_seq_cache_t *seq_cache = NULL;    /* Cached sequences */
+    hsize_t base;                               /* Offset of first element in selection */
+    unsigned u;                                 /* Local index variable */
+    herr_t ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(space);
+    HDassert(elmt_size > 0);
+    HDassert(nseq > 0);
+    HDassert(off);
+    HDassert(len);
+
+    hslab = space->select.sel_info.hslab;
+    HDassert(hslab);
+
+    /* Get the location of the selection */
+    if(H5S__hyper_offset(space, &base) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't retrieve selection offset")
+
+    /* Re-use the existing cache, if the arrays are large enough */
+    if(hslab->seq_cache && hslab->seq_cache->nseq >= nseq) {
+        seq_cache = hslab->seq_cache;
+        hslab->seq_cache = NULL;
+    } /* end if */
+    else {
+        if(hslab->seq_cache)
+            hslab->seq_cache = H5S__hyper_seq_cache_free(hslab->seq_cache);
+
+        if(NULL == (seq_cache = H5FL_CALLOC(H5S_hyper_seq_cache_t)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate sequence cache")
+        if(NULL == (seq_cache->off = H5FL_SEQ_MALLOC(hsize_t, nseq)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate sequence offsets")
+        if(NULL == (seq_cache->len = H5FL_SEQ_MALLOC(size_t, nseq)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate sequence lengths")
+    } /* end else */
+
+    /* Save the information the sequences depend on */
+    seq_cache->elmt_size = elmt_size;
+    for(u = 0; u < space->extent.rank; u++)
+        seq_cache->dims[u] = space->extent.size[u];
+    seq_cache->shape_valid = hslab->diminfo_valid;
+    if(hslab->diminfo_valid)
+        for(u = 0; u < space->extent.rank; u++)
+            seq_cache->shape[u] = hslab->opt_diminfo[u];
+    seq_cache->base = base * elmt_size;
+
+    /* Copy the sequences */
+    seq_cache->nseq = nseq;
+    seq_cache->nelem = nelem;
+    HDmemcpy(seq_cache->off, off, nseq * sizeof(hsize_t));
+    HDmemcpy(seq_cache->len, len, nseq * sizeof(size_t));
+
+    /* Attach the cache to the selection */
+    hslab->seq_cache = seq_cache;
+    seq_cache = NULL;
+
+done:
+    if(seq_cache)
+        seq_cache = H5S__hyper_seq_cache_free(seq_cache);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_seq_cache_set() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_seq_cache_get
+ PURPOSE
+    Retrieve the sequences for an entire hyperslab selection from its cache
+ USAGE
+    htri_t H5S__hyper_seq_cache_get(space, iter, maxseq, maxelem, nseq, nelem, off, len)
+        const H5S_t *space;     IN: Dataspace containing selection to use.
+        H5S_sel_iter_t *iter;   IN/OUT: Selection iterator, positioned at
+                                    the beginning of the selection
+        size_t maxseq;          IN: Maximum number of sequences to generate
+        size_t maxelem;         IN: Maximum number of elements to include in the
+                                    generated sequences
+        size_t *nseq;           OUT: Actual number of sequences generated
+        size_t *nelem;          OUT: Actual number of elements in sequences generated
+        hsize_t *off;           OUT: Array of offsets
+        size_t *len;            OUT: Array of lengths
+ RETURNS
+    TRUE if the sequences were retrieved from the cache, FALSE if they need to
+    be generated, negative on failure.
+ DESCRIPTION
+    When the sequences for the whole selection were cached for the same
+    element size and the arrays given are large enough to hold all of them,
+    copy the cached sequences, relocated to the selection's current position
+    in the dataspace, and move the iterator to the end of the selection.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static htri_t
+H5S__hyper_seq_cache_get(const H5S_t *space, H5S_sel_iter_t *iter,
+    size_t maxseq, size_t maxelem, size_t *nseq, size_t *nelem, hsize_t *off,
+    size_t *len)
+{
+    const H5S_hyper_seq_cache_t *seq_cache;     /* Cached sequences */
+    hsize_t base;                       /* Offset of first element in selection */
+    size_t u;                           /* Local index variable */
+    htri_t ret_value = TRUE;            /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(space);
+    HDassert(iter);
+    HDassert(iter->elmt_left == space->select.num_elem);
+
+    seq_cache = space->select.sel_info.hslab->seq_cache;
+    HDassert(seq_cache);
+
+    /* Check if the cached sequences can be used */
+    if(seq_cache->elmt_size != iter->elmt_size || seq_cache->nseq > maxseq
+            || seq_cache->nelem > maxelem || seq_cache->nelem != iter->elmt_left)
+        HGOTO_DONE(FALSE)
+    for(u = 0; u < space->extent.rank; u++)
+        if(seq_cache->dims[u] != space->extent.size[u])
+            HGOTO_DONE(FALSE)
+
+    /* Get the current location of the selection */
+    if(H5S__hyper_offset(space, &base) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't retrieve selection offset")
+    base *= iter->elmt_size;
+
+    /* Copy the sequences, relocating them to the selection's location */
+    for(u = 0; u < seq_cache->nseq; u++)
+        off[u] = (seq_cache->off[u] - seq_cache->base) + base;
+    HDmemcpy(len, seq_cache->len, seq_cache->nseq * sizeof(size_t));
+
+    /* Set the number of sequences generated and elements used */
+    *nseq = seq_cache->nseq;
+    *nelem = seq_cache->nelem;
+
+    /* The iterator is now at the end of the selection */
+    iter->elmt_left = 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_seq_cache_get() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -9089,6 +9722,7 @@ H5S__hyper_get_seq_list(const H5S_t *space, unsigned H5_ATTR_UNUSED flags, H5S_s
     size_t maxseq, size_t maxelem, size_t *nseq, size_t *nelem,
     hsize_t *off, size_t *len)
 {
+    hbool_t at_start;           /* Whether the iterator is at the beginning of the selection */
     herr_t ret_value = FAIL;    /* return value */
 
     FUNC_ENTER_STATIC_NOERR
@@ -9105,6 +9739,19 @@ H5S__hyper_get_seq_list(const H5S_t *space, unsigned H5_ATTR_UNUSED flags, H5S_s
     HDassert(len);
     HDassert(space->select.sel_info.hslab->unlim_dim < 0);
 
+    /* Check if the iterator is at the beginning of the selection */
+    at_start = (hbool_t)(iter->elmt_left == space->select.num_elem);
+
+    /* Try to re-use sequences cached for the entire selection */
+    if(at_start && space->select.sel_info.hslab->seq_cache) {
+        htri_t cached;          /* Whether the cached sequences were used */
+
+        if((cached = H5S__hyper_seq_cache_get(space, iter, maxseq, maxelem, nseq, nelem, off, len)) < 0)
+            return(FAIL);
+        if(cached)
+            return(SUCCEED);
+    } /* end if */
+
     /* Check for the special case of just one H5Sselect_hyperslab call made */
     if(space->select.sel_info.hslab->diminfo_valid) {
         const H5S_hyper_dim_t *tdiminfo;    /* Temporary pointer to diminfo information */
@@ -9227,6 +9874,12 @@ H5S__hyper_get_seq_list(const H5S_t *space, unsigned H5_ATTR_UNUSED flags, H5S_s
         /* Call the general sequence generator routine */
         ret_value = H5S__hyper_get_seq_list_gen(space, iter, maxseq, maxelem, nseq, nelem, off, len);
 
+    /* Cache the sequences, if they cover the entire selection and it took
+     *  more than a single sequence to describe it.
+     */
+    if(ret_value >= 0 && at_start && 0 == iter->elmt_left && *nseq > 1)
+        ret_value = H5S__hyper_seq_cache_set(space, iter->elmt_size, *nseq, *nelem, off, len);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S__hyper_get_seq_list() */
 
@@ -9727,7 +10380,7 @@ H5S__hyper_subtract(H5S_t *space, H5S_t *subtract_space)
         space->select.num_elem = 0;
 
         /* Allocate a span info node */
-        if(NULL == (spans = H5FL_MALLOC(H5S_hyper_span_info_t)))
+        if(NULL == (spans = H5S_HYPER_ARENA_MALLOC(H5S_hyper_span_info_t)))
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate hyperslab span")
 
         /* Set the reference count */
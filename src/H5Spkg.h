@@ -111,6 +111,19 @@ struct H5S_hyper_span_info_t {
     struct H5S_hyper_span_t *head;  /* Pointer to list of spans in next dimension down */
 };
 
+/* Offset/length sequences cached for an entire hyperslab selection */
+typedef struct H5S_hyper_seq_cache_t {
+    size_t elmt_size;                   /* Size of elements the sequences were generated for */
+    hsize_t dims[H5S_MAX_RANK];         /* Dataspace extent the sequences were generated for */
+    hbool_t shape_valid;                /* Whether 'shape' holds a regular selection's shape */
+    H5S_hyper_dim_t shape[H5S_MAX_RANK];    /* Stride, count & block of a regular selection (start is unused) */
+    hsize_t base;                       /* Offset of the first byte of the selection when generated */
+    size_t nseq;                        /* Number of sequences */
+    size_t nelem;                       /* Number of elements in sequences */
+    hsize_t *off;                       /* Offsets of sequences */
+    size_t *len;                        /* Lengths of sequences */
+} H5S_hyper_seq_cache_t;
+
 /* Information about new-style hyperslab selection */
 typedef struct {
     hbool_t diminfo_valid;                      /* Whether the dataset has valid diminfo */
@@ -125,6 +138,13 @@ typedef struct {
     int unlim_dim;                      /* Dimension where selection is unlimited, or -1 if none */
     hsize_t num_elem_non_unlim;         /* # of elements in a "slice" excluding the unlimited dimension */
     H5S_hyper_span_info_t *span_lst;    /* List of hyperslab span information of all dimensions */
+    H5S_hyper_seq_cache_t *seq_cache;   /* Sequences cached for the entire selection, or NULL */
+        /* 'seq_cache' is a mutable cache, not part of the selection's value:
+         * it's filled in while iterating over the selection, which is done
+         * through const dataspace pointers (e.g. the 'get_seq_list' method),
+         * so it may be set through a const H5S_t.  It's checked against the
+         * selection's shape and extent before use, and isn't copied or
+         * serialized with the selection. */
 } H5S_hyper_sel_t;
 
 /* Selection information methods */
@@ -29,9 +29,21 @@
 #include "H5Spkg.h"		/* Dataspace functions			  */
 #include "H5VMprivate.h"         /* Vector functions */
 
+/* Local datatypes */
+
+/* Key for sorting points into file order */
+typedef struct H5S_pnt_sort_t {
+    hsize_t chunk;              /* Linear index of the chunk holding the point */
+    hsize_t off;                /* Linear offset of the point within the chunk */
+    size_t idx;                 /* Position of the point in the selection */
+} H5S_pnt_sort_t;
+
 /* Static function prototypes */
 
 /* Selection callbacks */
+static int H5S_point_sort_cmp(const void *_key1, const void *_key2);
+static H5S_t *H5S_point_sorted_space(const H5S_t *space, size_t num_elem,
+    const hsize_t *coord);
 static herr_t H5S_point_copy(H5S_t *dst, const H5S_t *src, hbool_t share_selection);
 static herr_t H5S_point_get_seq_list(const H5S_t *space, unsigned flags,
     H5S_sel_iter_t *iter, size_t maxseq, size_t maxbytes,
@@ -583,6 +595,278 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* H5S_select_elements() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S_point_sort_cmp
+ PURPOSE
+    Compare two point sort keys, for use with HDqsort()
+ USAGE
+    int H5S_point_sort_cmp(_key1, _key2)
+        const void *_key1, *_key2;  IN: Pointers to the keys to compare
+ RETURNS
+    An integer less than, equal to or greater than zero if the first key is
+    ordered before, with or after the second key.
+ DESCRIPTION
+    Orders points by the chunk they fall in, then by their offset within that
+    chunk.  Ties are broken by the original position of the point in the
+    selection so that the sort is deterministic.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static int
+H5S_point_sort_cmp(const void *_key1, const void *_key2)
+{
+    const H5S_pnt_sort_t *key1 = (const H5S_pnt_sort_t *)_key1;
+    const H5S_pnt_sort_t *key2 = (const H5S_pnt_sort_t *)_key2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(key1->chunk != key2->chunk)
+        ret_value = (key1->chunk < key2->chunk) ? -1 : 1;
+    else if(key1->off != key2->off)
+        ret_value = (key1->off < key2->off) ? -1 : 1;
+    else if(key1->idx != key2->idx)
+        ret_value = (key1->idx < key2->idx) ? -1 : 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5S_point_sort_cmp() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S_point_sorted_space
+ PURPOSE
+    Create a copy of a dataspace with a point selection in a given order
+ USAGE
+    H5S_t *H5S_point_sorted_space(space, num_elem, coord)
+        const H5S_t *space;     IN: Dataspace to copy extent & offset from
+        size_t num_elem;        IN: Number of elements in COORD array
+        const hsize_t *coord;   IN: The location of each element selected
+ RETURNS
+    Pointer to the new dataspace on success/NULL on failure
+ DESCRIPTION
+    Creates a dataspace with the same extent and selection offset as SPACE,
+    with NUM_ELEM points from COORD selected, in the order given.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static H5S_t *
+H5S_point_sorted_space(const H5S_t *space, size_t num_elem, const hsize_t *coord)
+{
+    H5S_t *new_space = NULL;    /* New dataspace */
+    H5S_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check args */
+    HDassert(space);
+    HDassert(num_elem);
+    HDassert(coord);
+
+    /* Create a dataspace with the same extent */
+    if(NULL == (new_space = H5S_create_simple(space->extent.rank, space->extent.size, space->extent.max)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, NULL, "unable to create dataspace")
+
+    /* Carry over the selection offset */
+    HDmemcpy(new_space->select.offset, space->select.offset, sizeof(hssize_t) * space->extent.rank);
+    new_space->select.offset_changed = space->select.offset_changed;
+
+    /* Select the points, in order */
+    if(H5S_select_elements(new_space, H5S_SELECT_SET, num_elem, coord) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, NULL, "unable to select elements")
+
+    /* Set the return value */
+    ret_value = new_space;
+
+done:
+    if(NULL == ret_value && new_space)
+        if(H5S_close(new_space) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, NULL, "unable to release dataspace")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5S_point_sorted_space() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S_select_sort_points
+ PURPOSE
+    Reorder a point selection and its paired selection into file order
+ USAGE
+    herr_t H5S_select_sort_points(file_space, mem_space, chunk_dims, sorted_file_space, sorted_mem_space)
+        const H5S_t *file_space;        IN: Dataspace with point selection
+        const H5S_t *mem_space;         IN: Dataspace with selection paired
+                                            element-for-element with FILE_SPACE
+        const hsize_t *chunk_dims;      IN: Chunk dimensions of the storage
+                                            FILE_SPACE describes, or NULL
+        H5S_t **sorted_file_space;      OUT: Point selection in file order
+        H5S_t **sorted_mem_space;       OUT: Point selection for memory,
+                                            permuted to match
+ RETURNS
+    Non-negative on success/Negative on failure
+ DESCRIPTION
+    Points in FILE_SPACE are visited in the order the application selected
+    them, which is generally random with respect to where they live in the
+    file.  This routine sorts the points by chunk (when CHUNK_DIMS is given)
+    and then by their offset, so that points which are adjacent in the file
+    are coalesced into single sequences by H5S_point_get_seq_list and each
+    chunk is visited once.  The selection in MEM_SPACE is converted into a
+    point selection permuted the same way, so that each element is still
+    transferred to/from the same location in memory.
+
+    If the points in FILE_SPACE are already in order, no new dataspaces are
+    created and both SORTED_FILE_SPACE and SORTED_MEM_SPACE are set to NULL.
+    Otherwise the caller is responsible for closing both dataspaces.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    Reordering changes which write "wins" when the same element is selected
+    more than once, so this should only be used for reads.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5S_select_sort_points(const H5S_t *file_space, const H5S_t *mem_space,
+    const hsize_t *chunk_dims, H5S_t **sorted_file_space, H5S_t **sorted_mem_space)
+{
+    H5S_sel_iter_t mem_iter;            /* Memory selection iterator */
+    hbool_t mem_iter_init = FALSE;      /* Whether the memory iterator has been initialized */
+    H5S_pnt_sort_t *keys = NULL;        /* Sort keys for points */
+    hsize_t *file_coords = NULL;        /* File coordinates, in selection order */
+    hsize_t *mem_coords = NULL;         /* Memory coordinates, in selection order */
+    hsize_t *sort_coords = NULL;        /* Coordinates, in file order */
+    hsize_t nchunks[H5S_MAX_RANK];      /* Number of chunks in each dimension */
+    H5S_pnt_node_t *node;               /* Point node */
+    hbool_t sorted = TRUE;              /* Whether the points are already in order */
+    hssize_t snpoints;                  /* Number of points selected (signed) */
+    size_t npoints;                     /* Number of points selected */
+    unsigned file_rank, mem_rank;       /* Dataspace ranks */
+    size_t u;                           /* Local index variable */
+    int i;                              /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(file_space);
+    HDassert(H5S_GET_SELECT_TYPE(file_space) == H5S_SEL_POINTS);
+    HDassert(mem_space);
+    HDassert(sorted_file_space);
+    HDassert(sorted_mem_space);
+
+    /* Initialize the output */
+    *sorted_file_space = NULL;
+    *sorted_mem_space = NULL;
+
+    /* Check for nothing to sort */
+    if((snpoints = H5S_GET_SELECT_NPOINTS(file_space)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOUNT, FAIL, "can't get number of points selected")
+    H5_CHECKED_ASSIGN(npoints, size_t, snpoints, hssize_t);
+    if(npoints < 2 || (hsize_t)H5S_GET_SELECT_NPOINTS(mem_space) != (hsize_t)npoints)
+        HGOTO_DONE(SUCCEED)
+
+    file_rank = file_space->extent.rank;
+    mem_rank = mem_space->extent.rank;
+
+    /* Compute the number of chunks in each dimension */
+    if(chunk_dims)
+        for(i = 0; i < (int)file_rank; i++)
+            nchunks[i] = (file_space->extent.size[i] + chunk_dims[i] - 1) / chunk_dims[i];
+
+    /* Allocate space for the keys & coordinates */
+    if(NULL == (keys = (H5S_pnt_sort_t *)H5MM_malloc(sizeof(H5S_pnt_sort_t) * npoints)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate point sort keys")
+    if(NULL == (file_coords = (hsize_t *)H5MM_malloc(sizeof(hsize_t) * file_rank * npoints)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate coordinate buffer")
+
+    /* Compute the sort key for each point, checking if they're already in order */
+    for(node = file_space->select.sel_info.pnt_lst->head, u = 0; node; node = node->next, u++) {
+        hsize_t chunk = 0;      /* Linear index of chunk holding point */
+        hsize_t off = 0;        /* Linear offset of point within chunk (or dataspace) */
+
+        HDassert(u < npoints);
+        for(i = 0; i < (int)file_rank; i++) {
+            hsize_t coord = (hsize_t)((hssize_t)node->pnt[i] + file_space->select.offset[i]);
+
+            if(chunk_dims) {
+                chunk = (chunk * nchunks[i]) + (coord / chunk_dims[i]);
+                off = (off * chunk_dims[i]) + (coord % chunk_dims[i]);
+            } /* end if */
+            else
+                off = (off * file_space->extent.size[i]) + coord;
+        } /* end for */
+        keys[u].chunk = chunk;
+        keys[u].off = off;
+        keys[u].idx = u;
+        HDmemcpy(&file_coords[u * file_rank], node->pnt, sizeof(hsize_t) * file_rank);
+
+        if(sorted && u > 0 && H5S_point_sort_cmp(&keys[u - 1], &keys[u]) > 0)
+            sorted = FALSE;
+    } /* end for */
+    HDassert(u == npoints);
+
+    /* Don't bother if the points are already in order */
+    if(sorted)
+        HGOTO_DONE(SUCCEED)
+
+    /* Retrieve the memory coordinates, in selection order */
+    if(NULL == (mem_coords = (hsize_t *)H5MM_malloc(sizeof(hsize_t) * mem_rank * npoints)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate coordinate buffer")
+    if(H5S_select_iter_init(&mem_iter, mem_space, (size_t)1) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
+    mem_iter_init = TRUE;
+    for(u = 0; u < npoints; u++) {
+        if(H5S_SELECT_ITER_COORDS(&mem_iter, &mem_coords[u * mem_rank]) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "unable to get selection coordinates")
+        if(u + 1 < npoints && H5S_SELECT_ITER_NEXT(&mem_iter, (size_t)1) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTNEXT, FAIL, "unable to advance selection iterator")
+    } /* end for */
+
+    /* Sort the points into file order */
+    HDqsort(keys, npoints, sizeof(H5S_pnt_sort_t), H5S_point_sort_cmp);
+
+    /* Build the sorted file selection */
+    if(NULL == (sort_coords = (hsize_t *)H5MM_malloc(sizeof(hsize_t) * MAX(file_rank, mem_rank) * npoints)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate coordinate buffer")
+    for(u = 0; u < npoints; u++)
+        HDmemcpy(&sort_coords[u * file_rank], &file_coords[keys[u].idx * file_rank], sizeof(hsize_t) * file_rank);
+    if(NULL == (*sorted_file_space = H5S_point_sorted_space(file_space, npoints, sort_coords)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "unable to create sorted file dataspace")
+
+    /* Build the memory selection, permuted to match */
+    for(u = 0; u < npoints; u++)
+        HDmemcpy(&sort_coords[u * mem_rank], &mem_coords[keys[u].idx * mem_rank], sizeof(hsize_t) * mem_rank);
+    if(NULL == (*sorted_mem_space = H5S_point_sorted_space(mem_space, npoints, sort_coords)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "unable to create sorted memory dataspace")
+
+done:
+    if(mem_iter_init && H5S_SELECT_ITER_RELEASE(&mem_iter) < 0)
+        HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "unable to release selection iterator")
+    if(keys)
+        keys = (H5S_pnt_sort_t *)H5MM_xfree(keys);
+    if(file_coords)
+        file_coords = (hsize_t *)H5MM_xfree(file_coords);
+    if(mem_coords)
+        mem_coords = (hsize_t *)H5MM_xfree(mem_coords);
+    if(sort_coords)
+        sort_coords = (hsize_t *)H5MM_xfree(sort_coords);
+    if(ret_value < 0) {
+        if(*sorted_file_space && H5S_close(*sorted_file_space) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "unable to release dataspace")
+        if(*sorted_mem_space && H5S_close(*sorted_mem_space) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "unable to release dataspace")
+        *sorted_file_space = NULL;
+        *sorted_mem_space = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5S_select_sort_points() */
+
 
 /*--------------------------------------------------------------------------
  NAME
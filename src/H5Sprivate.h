@@ -276,6 +276,9 @@ H5_DLL herr_t H5S_select_none(H5S_t *space);
 /* Operations on point selections */
 H5_DLL herr_t H5S_select_elements(H5S_t *space, H5S_seloper_t op,
     size_t num_elem, const hsize_t *coord);
+H5_DLL herr_t H5S_select_sort_points(const H5S_t *file_space,
+    const H5S_t *mem_space, const hsize_t *chunk_dims,
+    H5S_t **sorted_file_space, H5S_t **sorted_mem_space);
 
 /* Operations on hyperslab selections */
 H5_DLL herr_t H5S_select_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[],
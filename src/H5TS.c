@@ -528,5 +528,53 @@ H5TS_create_thread(void *(*func)(void *), H5TS_attr_t *attr, void *udata)
 
 } /* H5TS_create_thread */
 
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_create_detached_thread
+ *
+ * USAGE
+ *    H5TS_create_detached_thread(func, udata)
+ *
+ * RETURNS
+ *    Non-negative on success / Negative on failure
+ *
+ * DESCRIPTION
+ *    Spawn off a new thread calling function 'func' with input 'udata'.
+ *    The thread can't be waited for, and its resources are released when
+ *    it exits.  Unlike H5TS_create_thread, failure to create the thread is
+ *    reported to the caller.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_create_detached_thread(void *(*func)(void *), void *udata)
+{
+#ifdef  H5_HAVE_WIN_THREADS
+    HANDLE thread;
+
+    if(NULL == (thread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)func, udata, 0, NULL)))
+        return FAIL;
+    CloseHandle(thread);
+
+#else /* H5_HAVE_WIN_THREADS */
+    pthread_attr_t attr;
+    pthread_t thread;
+    int ret;
+
+    if(pthread_attr_init(&attr))
+        return FAIL;
+    if(0 == (ret = pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED)))
+        ret = pthread_create(&thread, &attr, (void * (*)(void *))func, udata);
+    (void)pthread_attr_destroy(&attr);
+    if(ret)
+        return FAIL;
+
+#endif /* H5_HAVE_WIN_THREADS */
+
+    return SUCCEED;
+
+} /* H5TS_create_detached_thread */
+
 #endif  /* H5_HAVE_THREADSAFE */
 
@@ -40,6 +40,7 @@ typedef struct H5TS_mutex_struct {
 	CRITICAL_SECTION CriticalSection;
 } H5TS_mutex_t;
 typedef CRITICAL_SECTION H5TS_mutex_simple_t;
+typedef CONDITION_VARIABLE H5TS_cond_t;
 typedef HANDLE H5TS_thread_t;
 typedef HANDLE H5TS_attr_t;
 typedef DWORD H5TS_key_t;
@@ -61,6 +62,12 @@ typedef INIT_ONCE H5TS_once_t;
 #define H5TS_mutex_init(mutex) InitializeCriticalSection(mutex)
 #define H5TS_mutex_lock_simple(mutex) EnterCriticalSection(mutex)
 #define H5TS_mutex_unlock_simple(mutex) LeaveCriticalSection(mutex)
+#define H5TS_mutex_destroy(mutex) DeleteCriticalSection(mutex)
+#define H5TS_cond_init(cond) InitializeConditionVariable(cond)
+#define H5TS_cond_wait(cond, mutex) SleepConditionVariableCS(cond, mutex, INFINITE)
+#define H5TS_cond_signal(cond) WakeConditionVariable(cond)
+#define H5TS_cond_broadcast(cond) WakeAllConditionVariable(cond)
+#define H5TS_cond_destroy(cond) 0
 
 /* Functions called from DllMain */
 H5_DLL BOOL CALLBACK H5TS_win32_process_enter(PINIT_ONCE InitOnce, PVOID Parameter, PVOID *lpContex);
@@ -84,6 +91,7 @@ typedef struct H5TS_mutex_struct {
 typedef pthread_t      H5TS_thread_t;
 typedef pthread_attr_t H5TS_attr_t;
 typedef pthread_mutex_t H5TS_mutex_simple_t;
+typedef pthread_cond_t H5TS_cond_t;
 typedef pthread_key_t  H5TS_key_t;
 typedef pthread_once_t H5TS_once_t;
 
@@ -102,6 +110,12 @@ typedef pthread_once_t H5TS_once_t;
 #define H5TS_mutex_init(mutex) pthread_mutex_init(mutex, NULL)
 #define H5TS_mutex_lock_simple(mutex) pthread_mutex_lock(mutex)
 #define H5TS_mutex_unlock_simple(mutex) pthread_mutex_unlock(mutex)
+#define H5TS_mutex_destroy(mutex) pthread_mutex_destroy(mutex)
+#define H5TS_cond_init(cond) pthread_cond_init(cond, NULL)
+#define H5TS_cond_wait(cond, mutex) pthread_cond_wait(cond, mutex)
+#define H5TS_cond_signal(cond) pthread_cond_signal(cond)
+#define H5TS_cond_broadcast(cond) pthread_cond_broadcast(cond)
+#define H5TS_cond_destroy(cond) pthread_cond_destroy(cond)
 
 #endif /* H5_HAVE_WIN_THREADS */
 
@@ -122,6 +136,7 @@ H5_DLL herr_t H5TS_mutex_unlock(H5TS_mutex_t *mutex);
 H5_DLL herr_t H5TS_cancel_count_inc(void);
 H5_DLL herr_t H5TS_cancel_count_dec(void);
 H5_DLL H5TS_thread_t H5TS_create_thread(void *(*func)(void *), H5TS_attr_t * attr, void *udata);
+H5_DLL herr_t H5TS_create_detached_thread(void *(*func)(void *), void *udata);
 
 #if defined c_plusplus || defined __cplusplus
 }
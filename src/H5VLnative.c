@@ -98,7 +98,7 @@ static H5VL_class_t H5VL_native_cls_g = {
         H5VL__native_link_move,                     /* move         */
         H5VL__native_link_get,                      /* get          */
         H5VL__native_link_specific,                 /* specific     */
-        NULL                                        /* optional     */
+        H5VL__native_link_optional                  /* optional     */
     },
     {   /* object_cls */
         H5VL__native_object_open,                   /* open         */
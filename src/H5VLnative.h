@@ -38,6 +38,9 @@ typedef int H5VL_native_dataset_optional_t;
 #define H5VL_NATIVE_DATASET_GET_CHUNK_STORAGE_SIZE  2   /* H5Dget_chunk_storage_size    */
 #define H5VL_NATIVE_DATASET_CHUNK_READ              3   /* H5Dchunk_read                */
 #define H5VL_NATIVE_DATASET_CHUNK_WRITE             4   /* H5Dchunk_write               */
+#define H5VL_NATIVE_DATASET_CHUNK_ITER              5   /* H5Dchunk_iter                */
+#define H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI       6   /* H5Dwrite_chunks              */
+#define H5VL_NATIVE_DATASET_CHUNK_READ_MULTI        7   /* H5Dread_chunks               */
 
 /* Typedef and values for native VOL connector file optional VOL operations */
 typedef int H5VL_native_file_optional_t;
@@ -75,6 +78,11 @@ typedef int H5VL_native_group_optional_t;
 #define H5VL_NATIVE_GROUP_ITERATE_OLD   0   /* HG5Giterate (deprecated routine) */
 #define H5VL_NATIVE_GROUP_GET_OBJINFO   1   /* HG5Gget_objinfo (deprecated routine) */
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
+#define H5VL_NATIVE_GROUP_CREATE_MULTI  2   /* H5Gcreate_multi                  */
+
+/* Typedef and values for native VOL connector link optional VOL operations */
+typedef int H5VL_native_link_optional_t;
+#define H5VL_NATIVE_LINK_CREATE_HARD_MULTI  0   /* H5Lcreate_hard_multi         */
 
 /* Typedef and values for native VOL connector object optional VOL operations */
 typedef int H5VL_native_object_optional_t;
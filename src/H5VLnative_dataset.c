@@ -539,6 +539,71 @@ H5VL__native_dataset_optional(void *obj, hid_t H5_ATTR_UNUSED dxpl_id,
                 break;
             }
 
+        case H5VL_NATIVE_DATASET_CHUNK_WRITE_MULTI:
+            {
+                size_t          nchunks             = HDva_arg(arguments, size_t);
+                const uint32_t *filters             = HDva_arg(arguments, const uint32_t *);
+                const hsize_t  *offsets             = HDva_arg(arguments, const hsize_t *);
+                const size_t   *data_sizes          = HDva_arg(arguments, const size_t *);
+                const void    **bufs                = HDva_arg(arguments, const void **);
+
+                dset = (H5D_t *)obj;
+
+                /* Check arguments */
+                if(NULL == dset->oloc.file)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+                if(H5D_CHUNKED != dset->shared->layout.type)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+                /* Write the chunks */
+                if(H5D__chunk_direct_write_multi(dset, nchunks, filters, offsets, data_sizes, bufs) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write unprocessed chunk data")
+
+                break;
+            }
+
+        case H5VL_NATIVE_DATASET_CHUNK_READ_MULTI:
+            {
+                size_t          nchunks             = HDva_arg(arguments, size_t);
+                const hsize_t  *offsets             = HDva_arg(arguments, const hsize_t *);
+                uint32_t       *filters             = HDva_arg(arguments, uint32_t *);
+                void          **bufs                = HDva_arg(arguments, void **);
+
+                dset = (H5D_t *)obj;
+
+                /* Check arguments */
+                if(NULL == dset->oloc.file)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+                if(H5D_CHUNKED != dset->shared->layout.type)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+                /* Read the chunks */
+                if(H5D__chunk_direct_read_multi(dset, nchunks, offsets, filters, bufs) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read unprocessed chunk data")
+
+                break;
+            }
+
+        case H5VL_NATIVE_DATASET_CHUNK_ITER:
+            {
+                H5_iter_order_t     order   = (H5_iter_order_t)HDva_arg(arguments, int);
+                H5D_chunk_iter_op_t op      = HDva_arg(arguments, H5D_chunk_iter_op_t);
+                void               *op_data = HDva_arg(arguments, void *);
+                herr_t             *op_ret  = HDva_arg(arguments, herr_t *);
+
+                dset = (H5D_t *)obj;
+
+                /* Make sure the dataset is chunked */
+                if(H5D_CHUNKED != dset->shared->layout.type)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+                /* Iterate over the chunks */
+                if((*op_ret = H5D__chunk_iter(dset, order, op, op_data)) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "chunk iteration failed")
+
+                break;
+            }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
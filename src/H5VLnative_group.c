@@ -328,6 +328,26 @@ H5VL__native_group_optional(void *obj, hid_t H5_ATTR_UNUSED dxpl_id,
             }
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
 
+        /* H5Gcreate_multi */
+        case H5VL_NATIVE_GROUP_CREATE_MULTI:
+            {
+                const H5VL_loc_params_t *loc_params = HDva_arg(arguments, const H5VL_loc_params_t *);
+                size_t count = HDva_arg(arguments, size_t);
+                const char **names = HDva_arg(arguments, const char **);
+                hid_t gcpl_id = HDva_arg(arguments, hid_t);
+                H5G_loc_t loc;
+
+                /* Get the location struct for the object */
+                if(H5G_loc_real(obj, loc_params->obj_type, &loc) < 0)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
+
+                /* Create the groups */
+                if(H5G__create_multi(&loc, loc_params->loc_data.loc_by_name.name, count, names, gcpl_id) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create groups")
+
+                break;
+            }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
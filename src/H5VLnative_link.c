@@ -433,3 +433,58 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5VL__native_link_specific() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_link_optional
+ *
+ * Purpose:     Handles the link optional callback
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_link_optional(void *obj, hid_t H5_ATTR_UNUSED dxpl_id,
+    void H5_ATTR_UNUSED **req, va_list arguments)
+{
+    H5VL_native_link_optional_t optional_type;
+    herr_t ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    optional_type = HDva_arg(arguments, H5VL_native_link_optional_t);
+    switch(optional_type) {
+        /* H5Lcreate_hard_multi */
+        case H5VL_NATIVE_LINK_CREATE_HARD_MULTI:
+            {
+                void *cur_obj = HDva_arg(arguments, void *);
+                const H5VL_loc_params_t *cur_params = HDva_arg(arguments, const H5VL_loc_params_t *);
+                size_t count = HDva_arg(arguments, size_t);
+                const char **cur_names = HDva_arg(arguments, const char **);
+                const H5VL_loc_params_t *loc_params = HDva_arg(arguments, const H5VL_loc_params_t *);
+                const char **link_names = HDva_arg(arguments, const char **);
+                H5G_loc_t cur_loc;
+                H5G_loc_t link_loc;
+
+                if(H5G_loc_real(cur_obj, cur_params->obj_type, &cur_loc) < 0)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
+                if(H5G_loc_real(obj, loc_params->obj_type, &link_loc) < 0)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
+                if(cur_loc.oloc->file != link_loc.oloc->file)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "source and destination should be in the same file.")
+
+                /* Create the links */
+                if(H5L__create_hard_multi(&cur_loc, count, cur_names, &link_loc,
+                        loc_params->loc_data.loc_by_name.name, link_names) < 0)
+                    HGOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "unable to create links")
+                break;
+            }
+
+        default:
+            HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_link_optional() */
+
@@ -31,6 +31,118 @@ typedef struct H5VM_memcpy_ud_t {
 /* Local macros */
 #define H5VM_HYPER_NDIMS H5O_LAYOUT_NDIMS
 
+/* Copy sequences of a fixed, small length with a loop where the length is
+ * a compile-time constant, so the compiler can inline the copy as a single
+ * load & store instead of calling memcpy for each sequence.  This is the
+ * common case for strided selections of single elements.  The STEP macro
+ * copies one sequence of LEN bytes and advances to the next sequence, and
+ * the copy loop continues while the next sequence is the same length and
+ * the state in H5VM_memcpyvv (given by COND) is unchanged.
+ */
+#define H5VM_MEMCPYVV_FIXED(STEP, LEN, SEQ_LEN, COND)                         \
+    case LEN:                                                                 \
+        do {                                                                  \
+            STEP(LEN)                                                         \
+        } while(SEQ_LEN == LEN && (COND));                                    \
+        break;
+#define H5VM_MEMCPYVV_DISPATCH(STEP, SEQ_LEN, COND)                           \
+    switch(SEQ_LEN) {                                                         \
+        H5VM_MEMCPYVV_FIXED(STEP, 1, SEQ_LEN, COND)                           \
+        H5VM_MEMCPYVV_FIXED(STEP, 2, SEQ_LEN, COND)                           \
+        H5VM_MEMCPYVV_FIXED(STEP, 4, SEQ_LEN, COND)                           \
+        H5VM_MEMCPYVV_FIXED(STEP, 8, SEQ_LEN, COND)                           \
+        H5VM_MEMCPYVV_FIXED(STEP, 16, SEQ_LEN, COND)                          \
+                                                                              \
+        default:                                                              \
+            STEP(SEQ_LEN)                                                     \
+            break;                                                            \
+    } /* end switch */
+
+/* Copy one source sequence, which is shorter than the destination sequence */
+#define H5VM_MEMCPYVV_SRC_SMALLER(LEN)                                        \
+    /* Copy data */                                                           \
+    HDmemcpy(dst, src, LEN);                                                  \
+                                                                              \
+    /* Accumulate number of bytes copied */                                   \
+    acc_len += LEN;                                                           \
+                                                                              \
+    /* Update destination length */                                           \
+    tmp_dst_len -= LEN;                                                       \
+                                                                              \
+    /* Advance source offset & check for being finished */                    \
+    src_off_ptr++;                                                            \
+    if(src_off_ptr >= max_src_off_ptr) {                                      \
+        /* Roll accumulated changes into appropriate counters */              \
+        *dst_off_ptr += acc_len;                                              \
+        *dst_len_ptr = tmp_dst_len;                                           \
+                                                                              \
+        /* Done with sequences */                                             \
+        goto finished;                                                        \
+    } /* end if */                                                            \
+                                                                              \
+    /* Update destination pointer */                                          \
+    dst += LEN;                                                               \
+                                                                              \
+    /* Update source information */                                           \
+    src_len_ptr++;                                                            \
+    tmp_src_len = *src_len_ptr;                                               \
+    src = (const unsigned char *)_src + *src_off_ptr;
+
+/* Copy one destination sequence, which is shorter than the source sequence */
+#define H5VM_MEMCPYVV_DST_SMALLER(LEN)                                        \
+    /* Copy data */                                                           \
+    HDmemcpy(dst, src, LEN);                                                  \
+                                                                              \
+    /* Accumulate number of bytes copied */                                   \
+    acc_len += LEN;                                                           \
+                                                                              \
+    /* Update source length */                                                \
+    tmp_src_len -= LEN;                                                       \
+                                                                              \
+    /* Advance destination offset & check for being finished */              \
+    dst_off_ptr++;                                                            \
+    if(dst_off_ptr >= max_dst_off_ptr) {                                      \
+        /* Roll accumulated changes into appropriate counters */              \
+        *src_off_ptr += acc_len;                                              \
+        *src_len_ptr = tmp_src_len;                                           \
+                                                                              \
+        /* Done with sequences */                                             \
+        goto finished;                                                        \
+    } /* end if */                                                            \
+                                                                              \
+    /* Update source pointer */                                               \
+    src += LEN;                                                               \
+                                                                              \
+    /* Update destination information */                                      \
+    dst_len_ptr++;                                                            \
+    tmp_dst_len = *dst_len_ptr;                                               \
+    dst = (unsigned char *)_dst + *dst_off_ptr;
+
+/* Copy one source & destination sequence, which are the same length */
+#define H5VM_MEMCPYVV_EQUAL(LEN)                                              \
+    /* Copy data */                                                           \
+    HDmemcpy(dst, src, LEN);                                                  \
+                                                                              \
+    /* Accumulate number of bytes copied */                                   \
+    acc_len += LEN;                                                           \
+                                                                              \
+    /* Advance source & destination offset & check for being finished */      \
+    src_off_ptr++;                                                            \
+    dst_off_ptr++;                                                            \
+    if(src_off_ptr >= max_src_off_ptr || dst_off_ptr >= max_dst_off_ptr)      \
+        /* Done with sequences */                                             \
+        goto finished;                                                        \
+                                                                              \
+    /* Update source information */                                           \
+    src_len_ptr++;                                                            \
+    tmp_src_len = *src_len_ptr;                                               \
+    src = (const unsigned char *)_src + *src_off_ptr;                         \
+                                                                              \
+    /* Update destination information */                                      \
+    dst_len_ptr++;                                                            \
+    tmp_dst_len = *dst_len_ptr;                                               \
+    dst = (unsigned char *)_dst + *dst_off_ptr;
+
 /* Local prototypes */
 static void
 H5VM_stride_optimize1(unsigned *np/*in,out*/, hsize_t *elmt_size/*in,out*/,
@@ -1556,6 +1668,9 @@ done:
  *              destination sequences, data copying stops when either the
  *              source or destination buffer runs out of sequence information.
  *
+ *              Runs of sequences with a small, fixed length are copied
+ *              with specialized loops, see H5VM_MEMCPYVV_DISPATCH.
+ *
  * Note:	The algorithm in this routine is [basically] the same as for
  *		H5VM_opvv().  Changes should be made to both!
  *
@@ -1622,33 +1737,7 @@ H5VM_memcpyvv(void *_dst,
 src_smaller:
         acc_len = 0;
         do {
-            /* Copy data */
-            HDmemcpy(dst, src, tmp_src_len);
-
-            /* Accumulate number of bytes copied */
-            acc_len += tmp_src_len;
-
-            /* Update destination length */
-            tmp_dst_len -= tmp_src_len;
-
-            /* Advance source offset & check for being finished */
-            src_off_ptr++;
-            if(src_off_ptr >= max_src_off_ptr) {
-                /* Roll accumulated changes into appropriate counters */
-                *dst_off_ptr += acc_len;
-                *dst_len_ptr = tmp_dst_len;
-
-                /* Done with sequences */
-                goto finished;
-            } /* end if */
-
-            /* Update destination pointer */
-            dst += tmp_src_len;
-
-            /* Update source information */
-            src_len_ptr++;
-            tmp_src_len = *src_len_ptr;
-            src = (const unsigned char *)_src + *src_off_ptr;
+            H5VM_MEMCPYVV_DISPATCH(H5VM_MEMCPYVV_SRC_SMALLER, tmp_src_len, tmp_src_len < tmp_dst_len)
         } while(tmp_src_len < tmp_dst_len);
 
         /* Roll accumulated sequence lengths into return value */
@@ -1665,33 +1754,7 @@ src_smaller:
 dst_smaller:
         acc_len = 0;
         do {
-            /* Copy data */
-            HDmemcpy(dst, src, tmp_dst_len);
-
-            /* Accumulate number of bytes copied */
-            acc_len += tmp_dst_len;
-
-            /* Update source length */
-            tmp_src_len -= tmp_dst_len;
-
-            /* Advance destination offset & check for being finished */
-            dst_off_ptr++;
-            if(dst_off_ptr >= max_dst_off_ptr) {
-                /* Roll accumulated changes into appropriate counters */
-                *src_off_ptr += acc_len;
-                *src_len_ptr = tmp_src_len;
-
-                /* Done with sequences */
-                goto finished;
-            } /* end if */
-
-            /* Update source pointer */
-            src += tmp_dst_len;
-
-            /* Update destination information */
-            dst_len_ptr++;
-            tmp_dst_len = *dst_len_ptr;
-            dst = (unsigned char *)_dst + *dst_off_ptr;
+            H5VM_MEMCPYVV_DISPATCH(H5VM_MEMCPYVV_DST_SMALLER, tmp_dst_len, tmp_dst_len < tmp_src_len)
         } while(tmp_dst_len < tmp_src_len);
 
         /* Roll accumulated sequence lengths into return value */
@@ -1708,28 +1771,7 @@ dst_smaller:
 equal:
         acc_len = 0;
         do {
-            /* Copy data */
-            HDmemcpy(dst, src, tmp_dst_len);
-
-            /* Accumulate number of bytes copied */
-            acc_len += tmp_dst_len;
-
-            /* Advance source & destination offset & check for being finished */
-            src_off_ptr++;
-            dst_off_ptr++;
-            if(src_off_ptr >= max_src_off_ptr || dst_off_ptr >= max_dst_off_ptr)
-                /* Done with sequences */
-                goto finished;
-
-            /* Update source information */
-            src_len_ptr++;
-            tmp_src_len = *src_len_ptr;
-            src = (const unsigned char *)_src + *src_off_ptr;
-
-            /* Update destination information */
-            dst_len_ptr++;
-            tmp_dst_len = *dst_len_ptr;
-            dst = (unsigned char *)_dst + *dst_off_ptr;
+            H5VM_MEMCPYVV_DISPATCH(H5VM_MEMCPYVV_EQUAL, tmp_dst_len, tmp_dst_len == tmp_src_len)
         } while(tmp_dst_len == tmp_src_len);
 
         /* Roll accumulated sequence lengths into return value */
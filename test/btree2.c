@@ -39,6 +39,7 @@ const char *FILENAME[] = {
 #define INSERT_MANY             (1000 * 1000)
 #define INSERT_MANY_REC         (2700 * 1000)
 #define FIND_MANY               (INSERT_MANY / 100)
+#define INSERT_BULK             (100 * 1000)
 #define FIND_MANY_REC           (INSERT_MANY_REC / 100)
 #define FIND_NEIGHBOR           2000
 #define DELETE_SMALL            20
@@ -367,6 +368,27 @@ iter_cb(const void *_record, void *_op_data)
     return(H5_ITER_CONT);
 } /* end iter_cb() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	fill_cb
+ *
+ * Purpose:	v2 B-tree bulk insertion callback, which supplies records
+ *		in increasing order
+ *
+ * Return:	SUCCEED
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+fill_cb(void *_record, void *_op_data)
+{
+    hsize_t *record = (hsize_t *)_record;
+    hsize_t *idx = (hsize_t *)_op_data;
+
+    *record = (*idx)++;
+    return(SUCCEED);
+} /* end fill_cb() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	iter_rec_cb
@@ -3176,6 +3198,193 @@ error:
     return 1;
 } /* test_insert_lots() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	test_insert_bulk
+ *
+ * Purpose:	Basic tests for building a v2 B-tree from sorted records
+ *
+ * Return:	Success:	0
+ *		Failure:	1
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_insert_bulk(hid_t fapl, const H5B2_create_t *cparam,
+    const bt2_test_param_t *tparam)
+{
+    hid_t	file = -1;              /* File ID */
+    char	filename[1024];         /* Filename to use */
+    H5F_t	*f = NULL;              /* Internal file object pointer */
+    H5B2_t      *bt2 = NULL;            /* v2 B-tree wrapper */
+    haddr_t     bt2_addr;               /* Address of B-tree created */
+    hsize_t     nrecs[] = {1, 200, INSERT_BULK};   /* # of records to build B-trees with */
+    hsize_t     record;                 /* Record to insert into tree */
+    hsize_t     idx;                    /* Index within B-tree, for iterator */
+    hsize_t     nrec;                   /* Number of records in B-tree */
+    unsigned    u;                      /* Local index variable */
+    herr_t      ret;                    /* Generic error return value */
+
+    /* Set the filename to use for this test (dependent on fapl) */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof(filename));
+
+    /* Create the file to work on */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+
+    /* Get a pointer to the internal file object */
+    if(NULL == (f = (H5F_t *)H5VL_object(file)))
+        STACK_ERROR
+
+    /* Ignore metadata tags in the file's cache */
+    if(H5AC_ignore_tags(f) < 0)
+        STACK_ERROR
+
+    /*
+     * Test building v2 B-trees of several depths from sorted records
+     */
+    TESTING("B-tree bulk insert: build B-trees from sorted records");
+
+    for(u = 0; u < NELMTS(nrecs); u++) {
+        /* Create the v2 B-tree & get its address */
+        if(create_btree(f, cparam, &bt2, &bt2_addr) < 0)
+            TEST_ERROR
+
+        /* Build the B-tree */
+        idx = 0;
+        if(H5B2_insert_bulk(bt2, nrecs[u], fill_cb, &idx) < 0)
+            FAIL_STACK_ERROR
+        if(idx != nrecs[u])
+            TEST_ERROR
+
+        /* Check for closing & re-opening the B-tree */
+        if(reopen_btree(f, &bt2, bt2_addr, tparam) < 0)
+            TEST_ERROR
+
+        /* Query the number of records in the B-tree */
+        if(H5B2_get_nrec(bt2, &nrec) < 0)
+            FAIL_STACK_ERROR
+        if(nrec != nrecs[u])
+            TEST_ERROR
+
+        /* Iterate over B-tree to check records have been inserted correctly */
+        idx = 0;
+        if(H5B2_iterate(bt2, iter_cb, &idx) < 0)
+            FAIL_STACK_ERROR
+        if(idx != nrecs[u])
+            TEST_ERROR
+
+        /* Find the first, middle & last records, by value & by index */
+        for(record = 0; record < nrecs[u]; record += MAX(nrecs[u] / 2, 1)) {
+            idx = record;
+            if(H5B2_find(bt2, &idx, find_cb, &idx) != TRUE)
+                FAIL_STACK_ERROR
+            if(H5B2_index(bt2, H5_ITER_INC, record, find_cb, &idx) < 0)
+                FAIL_STACK_ERROR
+        } /* end for */
+        idx = nrecs[u] - 1;
+        if(H5B2_find(bt2, &idx, find_cb, &idx) != TRUE)
+            FAIL_STACK_ERROR
+
+        /* Attempt to find non-existant record */
+        /* (Should not be found, but not fail) */
+        idx = nrecs[u] * 2;
+        if(H5B2_find(bt2, &idx, find_cb, &idx) != FALSE)
+            TEST_ERROR
+
+        /* Close the v2 B-tree */
+        if(H5B2_close(bt2) < 0)
+            FAIL_STACK_ERROR
+        bt2 = NULL;
+    } /* end for */
+
+    PASSED();
+
+    /*
+     * Test modifying a v2 B-tree built from sorted records
+     */
+    TESTING("B-tree bulk insert: insert & remove records after building");
+
+    /* Create the v2 B-tree & get its address */
+    if(create_btree(f, cparam, &bt2, &bt2_addr) < 0)
+        TEST_ERROR
+
+    /* Build the B-tree */
+    idx = 0;
+    if(H5B2_insert_bulk(bt2, (hsize_t)INSERT_BULK, fill_cb, &idx) < 0)
+        FAIL_STACK_ERROR
+
+    /* Check for closing & re-opening the B-tree */
+    if(reopen_btree(f, &bt2, bt2_addr, tparam) < 0)
+        TEST_ERROR
+
+    /* Remove the first half of the records */
+    for(record = 0; record < (INSERT_BULK / 2); record++)
+        if(H5B2_remove(bt2, &record, NULL, NULL) < 0)
+            FAIL_STACK_ERROR
+
+    /* Insert records after the last one */
+    for(record = INSERT_BULK; record < (INSERT_BULK + (INSERT_BULK / 2)); record++)
+        if(H5B2_insert(bt2, &record) < 0)
+            FAIL_STACK_ERROR
+
+    /* Check for closing & re-opening the B-tree */
+    if(reopen_btree(f, &bt2, bt2_addr, tparam) < 0)
+        TEST_ERROR
+
+    /* Insert the removed records again */
+    for(record = 0; record < (INSERT_BULK / 2); record++)
+        if(H5B2_insert(bt2, &record) < 0)
+            FAIL_STACK_ERROR
+
+    /* Iterate over B-tree to check records are all there */
+    idx = 0;
+    if(H5B2_iterate(bt2, iter_cb, &idx) < 0)
+        FAIL_STACK_ERROR
+    if(idx != (INSERT_BULK + (INSERT_BULK / 2)))
+        TEST_ERROR
+
+    PASSED();
+
+    TESTING("B-tree bulk insert: attempt to build non-empty B-tree");
+
+    /* Attempt to bulk insert records into B-tree with records */
+    idx = 0;
+    H5E_BEGIN_TRY {
+        ret = H5B2_insert_bulk(bt2, (hsize_t)10, fill_cb, &idx);
+    } H5E_END_TRY;
+    /* Should fail */
+    if(ret != FAIL)
+        TEST_ERROR
+
+    /* Query the number of records in the B-tree */
+    if(H5B2_get_nrec(bt2, &nrec) < 0)
+        FAIL_STACK_ERROR
+    if(nrec != (INSERT_BULK + (INSERT_BULK / 2)))
+        TEST_ERROR
+
+    /* Close the v2 B-tree */
+    if(H5B2_close(bt2) < 0)
+        FAIL_STACK_ERROR
+    bt2 = NULL;
+
+    /* Close file */
+    if(H5Fclose(file) < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(bt2)
+            H5B2_close(bt2);
+	H5Fclose(file);
+    } H5E_END_TRY;
+    return 1;
+} /* test_insert_bulk() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	test_update_basic
@@ -9997,6 +10206,7 @@ main(void)
             printf("***Express test mode on.  test_insert_lots skipped\n");
         else
             nerrors += test_insert_lots(fapl, &cparam, &tparam);
+        nerrors += test_insert_bulk(fapl, &cparam, &tparam);
 
         /* Test B-tree record update (ie. insert/modify) */
         /* (Iteration, find & index routines exercised in these routines as well) */
@@ -347,6 +347,11 @@ evict_entries(hid_t fid)
     /* Mark all entries investigated */
     mark_all_entries_investigated(fid);
 
+    /* Forget the paths resolved so far, so that looking them up again
+     * reads the groups along them */
+    if(H5G_path_cache_clear(f) < 0)
+        TEST_ERROR;
+
     /* Evict all we can from the cache to examine full tag creation tree */
         /* This function will likely return failure since the root group
          * is still protected. Thus, don't check its return value. */
@@ -2297,6 +2302,7 @@ check_dataset_write_tags(void)
     hid_t sid = -1;                         /* Dataspace Identifier */
     int verbose = FALSE;                    /* verbose file outout */
     hid_t dcpl = -1;                        /* dataset creation pl */
+    hid_t dapl = -1;                        /* dataset access pl */
     hsize_t cdims[2] = {1,1};               /* chunk dimensions */
     int fillval = 0;
     hid_t fapl = -1;         /* File access prop list */
@@ -2351,7 +2357,13 @@ check_dataset_write_tags(void)
     if ( H5Dclose(did) < 0 ) TEST_ERROR;
     if ( H5Fclose(fid) < 0 ) TEST_ERROR;
     if ( (fid = H5Fopen(FILENAME, H5F_ACC_RDWR, H5P_DEFAULT)) < 0 ) TEST_ERROR;
-    if (( did = H5Dopen2(fid, DATASETNAME, H5P_DEFAULT)) < 0 ) TEST_ERROR;
+
+    /* Limit the chunk cache to 521 chunks, so that the write evicts
+     * chunks and inserts them into the chunk index */
+    if ( (dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0 ) TEST_ERROR;
+    if ( H5Pset_chunk_cache(dapl, (size_t)521, 521 * sizeof(int), H5D_CHUNK_CACHE_W0_DEFAULT) < 0 ) TEST_ERROR;
+    if (( did = H5Dopen2(fid, DATASETNAME, dapl)) < 0 ) TEST_ERROR;
+    if ( H5Pclose(dapl) < 0 ) TEST_ERROR;
 
     /* Evict as much as we can from the cache so we can track full tag path */
     if ( evict_entries(fid) < 0 ) TEST_ERROR;
@@ -36,6 +36,11 @@
 #define DATASETNAME10       "read_w_valid_cache"
 #define DATASETNAME11       "unallocated_chunk"
 #define DATASETNAME12       "unfiltered_data"
+/* Dataset for chunk iteration test */
+#define DATASETNAME13       "chunk_iter"
+/* Datasets for batched chunk write/read test */
+#define DATASETNAME14       "write_chunks"
+#define DATASETNAME15       "write_chunks_unfiltered"
 
 #define RANK         2
 #define NX     16
@@ -43,6 +48,10 @@
 #define CHUNK_NX     4
 #define CHUNK_NY     4
 
+/* Number and size of chunks for batched chunk write/read test */
+#define MULTI_NCHUNKS       ((NX / CHUNK_NX) * (NY / CHUNK_NY))
+#define MULTI_CHUNK_SIZE    (CHUNK_NX * CHUNK_NY * sizeof(int))
+
 #define DEFLATE_SIZE_ADJUST(s) (HDceil(((double)(s))*H5_DOUBLE(1.001))+H5_DOUBLE(12.0))
 
 /* Temporary filter IDs used for testing */
@@ -2105,6 +2114,459 @@ error:
     return 1;
 } /* test_single_chunk_latest() */
 
+/* User data for chunk iteration test callback */
+typedef struct chunk_iter_ud_t {
+    H5_iter_order_t order;      /* Order chunks are expected in */
+    unsigned    count;          /* Number of chunks visited */
+    unsigned    stop_after;     /* Stop iterating after this many chunks, if non-zero */
+    haddr_t     last_addr;      /* Address of last chunk visited */
+    hsize_t     nbytes[NX / CHUNK_NX][NY / CHUNK_NY];       /* Size of each chunk */
+    uint32_t    filter_mask[NX / CHUNK_NX][NY / CHUNK_NY];  /* Filter mask of each chunk */
+    hbool_t     visited[NX / CHUNK_NX][NY / CHUNK_NY];      /* Whether each chunk was visited */
+} chunk_iter_ud_t;
+
+/*-------------------------------------------------------------------------
+ * Function:    chunk_iter_cb
+ *
+ * Purpose:     Callback for test_chunk_iter(), checks the information
+ *              for one chunk against what was written.
+ *
+ * Return:      Success:        0, or 1 to stop early
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+chunk_iter_cb(const hsize_t *offset, uint32_t filter_mask, haddr_t addr,
+    hsize_t nbytes, void *op_data)
+{
+    chunk_iter_ud_t *udata = (chunk_iter_ud_t *)op_data;
+    hsize_t i, j;
+
+    if(offset[0] % CHUNK_NX || offset[1] % CHUNK_NY)
+        return -1;
+    i = offset[0] / CHUNK_NX;
+    j = offset[1] / CHUNK_NY;
+    if(i >= NX / CHUNK_NX || j >= NY / CHUNK_NY)
+        return -1;
+
+    /* Each chunk should be visited once, with the right info */
+    if(udata->visited[i][j])
+        return -1;
+    udata->visited[i][j] = TRUE;
+    if(nbytes != udata->nbytes[i][j] || filter_mask != udata->filter_mask[i][j])
+        return -1;
+
+    /* Check the order of the addresses */
+    if(udata->count > 0) {
+        if(udata->order == H5_ITER_INC && addr <= udata->last_addr)
+            return -1;
+        if(udata->order == H5_ITER_DEC && addr >= udata->last_addr)
+            return -1;
+    } /* end if */
+    udata->last_addr = addr;
+
+    udata->count++;
+    if(udata->stop_after && udata->count == udata->stop_after)
+        return 1;
+
+    return 0;
+} /* chunk_iter_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_iter
+ *
+ * Purpose:     Tests H5Dchunk_iter, in each iteration order, on chunks
+ *              written directly and through the chunk cache.
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_chunk_iter(hid_t file)
+{
+    hid_t       dataspace = -1, dataset = -1;
+    hid_t       mem_space = -1;
+    hid_t       cparms = -1;
+    hsize_t     dims[2]  = {NX, NY};
+    hsize_t     maxdims[2] = {H5S_UNLIMITED, H5S_UNLIMITED};
+    hsize_t     chunk_dims[2] = {CHUNK_NX, CHUNK_NY};
+    hsize_t     offset[2];      /* Chunk offset */
+    int         direct_buf[CHUNK_NX][CHUNK_NY];     /* Chunk data */
+    chunk_iter_ud_t udata;      /* User data for callback */
+    unsigned    nchunks = 0;    /* Number of chunks written */
+    H5_iter_order_t orders[3] = {H5_ITER_NATIVE, H5_ITER_INC, H5_ITER_DEC};
+    herr_t      ret;            /* Return value from iteration */
+    int         i, j, k;        /* Local index variables */
+
+    TESTING("H5Dchunk_iter");
+
+    HDmemset(&udata, 0, sizeof(udata));
+    HDmemset(direct_buf, 0, sizeof(direct_buf));
+
+    /* Create the data space with unlimited dimensions. */
+    if((dataspace = H5Screate_simple(RANK, dims, maxdims)) < 0)
+        goto error;
+    if((mem_space = H5Screate_simple(RANK, chunk_dims, NULL)) < 0)
+        goto error;
+
+    /* Use a filter, so the chunks can have different sizes */
+    if((cparms = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if(H5Pset_chunk(cparms, RANK, chunk_dims) < 0)
+        goto error;
+    if(H5Pset_fletcher32(cparms) < 0)
+        goto error;
+
+    if((dataset = H5Dcreate2(file, DATASETNAME13, H5T_NATIVE_INT, dataspace, H5P_DEFAULT,
+            cparms, H5P_DEFAULT)) < 0)
+        goto error;
+
+    /* No chunks yet */
+    udata.order = H5_ITER_NATIVE;
+    if(H5Dchunk_iter(dataset, H5_ITER_NATIVE, chunk_iter_cb, &udata) != 0)
+        goto error;
+    if(udata.count != 0)
+        goto error;
+
+    /* Directly write half of the chunks, in reverse order, each with a
+     * different size */
+    for(i = (NX / CHUNK_NX) - 1; i >= 0; i--)
+        for(j = (NY / CHUNK_NY) - 1; j >= 0; j--)
+            if((i + j) % 2 == 0) {
+                offset[0] = (hsize_t)(i * CHUNK_NX);
+                offset[1] = (hsize_t)(j * CHUNK_NY);
+                udata.nbytes[i][j] = (hsize_t)(sizeof(int) * (size_t)(1 + (i * (NY / CHUNK_NY)) + j));
+                udata.filter_mask[i][j] = (uint32_t)(j % 2);
+                if(H5Dwrite_chunk(dataset, H5P_DEFAULT, udata.filter_mask[i][j], offset,
+                        (size_t)udata.nbytes[i][j], direct_buf) < 0)
+                    goto error;
+                nchunks++;
+            } /* end if */
+
+    /* Write one more chunk through the chunk cache, leaving it dirty */
+    offset[0] = 0;
+    offset[1] = CHUNK_NY;
+    if(H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, offset, NULL, chunk_dims, NULL) < 0)
+        goto error;
+    if(H5Dwrite(dataset, H5T_NATIVE_INT, mem_space, dataspace, H5P_DEFAULT, direct_buf) < 0)
+        goto error;
+    udata.nbytes[0][1] = sizeof(direct_buf) + 4;    /* Fletcher32 checksum */
+    udata.filter_mask[0][1] = 0;
+    nchunks++;
+
+    /* Visit all the chunks, in each order */
+    for(k = 0; k < 3; k++) {
+        HDmemset(udata.visited, 0, sizeof(udata.visited));
+        udata.order = orders[k];
+        udata.count = 0;
+        udata.stop_after = 0;
+        if(H5Dchunk_iter(dataset, orders[k], chunk_iter_cb, &udata) != 0)
+            goto error;
+        if(udata.count != nchunks)
+            goto error;
+    } /* end for */
+
+    /* Stop early */
+    HDmemset(udata.visited, 0, sizeof(udata.visited));
+    udata.order = H5_ITER_INC;
+    udata.count = 0;
+    udata.stop_after = 3;
+    if(H5Dchunk_iter(dataset, H5_ITER_INC, chunk_iter_cb, &udata) != 1)
+        goto error;
+    if(udata.count != 3)
+        goto error;
+
+    /* Invalid iteration order */
+    H5E_BEGIN_TRY {
+        ret = H5Dchunk_iter(dataset, H5_ITER_UNKNOWN, chunk_iter_cb, &udata);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        goto error;
+
+    /* Close/release resources. */
+    H5Dclose(dataset);
+    H5Sclose(mem_space);
+    H5Sclose(dataspace);
+    H5Pclose(cparms);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dataset);
+        H5Sclose(mem_space);
+        H5Sclose(dataspace);
+        H5Pclose(cparms);
+    } H5E_END_TRY;
+
+    H5_FAILED();
+    return 1;
+} /* test_chunk_iter() */
+
+/* User data for batched chunk write test's iteration callback */
+typedef struct chunks_multi_ud_t {
+    unsigned    count;          /* Number of chunks visited */
+    hbool_t     contiguous;     /* Whether the chunks are adjacent in the file */
+    haddr_t     next_addr;      /* Address just past the last chunk visited */
+} chunks_multi_ud_t;
+
+/*-------------------------------------------------------------------------
+ * Function:    chunks_multi_cb
+ *
+ * Purpose:     Callback for test_direct_chunks_multi(), checks whether
+ *              the chunks are stored one after the other in the file.
+ *
+ * Return:      0
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+chunks_multi_cb(const hsize_t H5_ATTR_UNUSED *offset, uint32_t H5_ATTR_UNUSED filter_mask,
+    haddr_t addr, hsize_t nbytes, void *op_data)
+{
+    chunks_multi_ud_t *udata = (chunks_multi_ud_t *)op_data;
+
+    if(udata->count > 0 && addr != udata->next_addr)
+        udata->contiguous = FALSE;
+    udata->next_addr = addr + nbytes;
+    udata->count++;
+
+    return 0;
+} /* chunks_multi_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_direct_chunks_multi
+ *
+ * Purpose:     Tests writing and reading many chunks at once with
+ *              H5Dwrite_chunks and H5Dread_chunks, for a filtered
+ *              dataset whose chunks change size and an unfiltered one.
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_direct_chunks_multi(hid_t file)
+{
+    hid_t       dataspace = -1, dataset = -1, dataset2 = -1;
+    hid_t       mem_space = -1;
+    hid_t       cparms = -1;
+    hsize_t     dims[2]  = {NX, NY};
+    hsize_t     maxdims[2] = {H5S_UNLIMITED, H5S_UNLIMITED};
+    hsize_t     chunk_dims[2] = {CHUNK_NX, CHUNK_NY};
+    hsize_t     start[2];
+    hsize_t     offsets[MULTI_NCHUNKS][2];      /* Chunk offsets */
+    uint32_t    filters[MULTI_NCHUNKS];         /* Filter masks */
+    uint32_t    read_filters[MULTI_NCHUNKS];    /* Filter masks read back */
+    size_t      sizes[MULTI_NCHUNKS];           /* Chunk sizes */
+    unsigned char wdata[MULTI_NCHUNKS][MULTI_CHUNK_SIZE];   /* Chunk data to write */
+    unsigned char rdata[MULTI_NCHUNKS][MULTI_CHUNK_SIZE];   /* Chunk data read back */
+    const void  *wbufs[MULTI_NCHUNKS];          /* Buffers to write */
+    void        *rbufs[MULTI_NCHUNKS];          /* Buffers to read into */
+    int         chunk_buf[CHUNK_NX][CHUNK_NY];  /* Chunk data written through the cache */
+    int         read_buf[NX][NY];               /* Data read with H5Dread */
+    chunks_multi_ud_t udata;                    /* User data for iteration */
+    hsize_t     chunk_nbytes;                   /* Chunk's storage size */
+    herr_t      ret;                            /* Generic return value */
+    int         i, j, k;                        /* Local index variables */
+
+    TESTING("H5Dwrite_chunks and H5Dread_chunks");
+
+    /* Set up the chunks, in reverse order, each with a different size */
+    for(k = 0; k < MULTI_NCHUNKS; k++) {
+        int c = MULTI_NCHUNKS - 1 - k;      /* Chunk's position in the dataset */
+
+        offsets[k][0] = (hsize_t)((c / (NY / CHUNK_NY)) * CHUNK_NX);
+        offsets[k][1] = (hsize_t)((c % (NY / CHUNK_NY)) * CHUNK_NY);
+        filters[k] = (uint32_t)(c % 2);
+        sizes[k] = (size_t)(4 * (1 + (c % 8)));
+        for(i = 0; i < (int)MULTI_CHUNK_SIZE; i++)
+            wdata[k][i] = (unsigned char)(c + i);
+        wbufs[k] = wdata[k];
+        rbufs[k] = rdata[k];
+    } /* end for */
+
+    if((dataspace = H5Screate_simple(RANK, dims, maxdims)) < 0)
+        goto error;
+    if((mem_space = H5Screate_simple(RANK, chunk_dims, NULL)) < 0)
+        goto error;
+
+    /* Use a filter, so the chunks can have different sizes */
+    if((cparms = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if(H5Pset_chunk(cparms, RANK, chunk_dims) < 0)
+        goto error;
+    if(H5Pset_fletcher32(cparms) < 0)
+        goto error;
+    if((dataset = H5Dcreate2(file, DATASETNAME14, H5T_NATIVE_INT, dataspace, H5P_DEFAULT,
+            cparms, H5P_DEFAULT)) < 0)
+        goto error;
+
+    /* Nothing to do for an empty batch */
+    if(H5Dwrite_chunks(dataset, H5P_DEFAULT, 0, NULL, NULL, NULL, NULL) < 0)
+        goto error;
+
+    /* Write all the chunks at once */
+    if(H5Dwrite_chunks(dataset, H5P_DEFAULT, MULTI_NCHUNKS, filters, &offsets[0][0], sizes, wbufs) < 0)
+        goto error;
+
+    /* The chunks should have been allocated together */
+    HDmemset(&udata, 0, sizeof(udata));
+    udata.contiguous = TRUE;
+    if(H5Dchunk_iter(dataset, H5_ITER_INC, chunks_multi_cb, &udata) < 0)
+        goto error;
+    if(udata.count != MULTI_NCHUNKS || !udata.contiguous)
+        goto error;
+
+    /* Read the chunks back, in a different order than written */
+    HDmemset(rdata, 0, sizeof(rdata));
+    HDmemset(read_filters, 0xff, sizeof(read_filters));
+    if(H5Dread_chunks(dataset, H5P_DEFAULT, MULTI_NCHUNKS / 2, &offsets[MULTI_NCHUNKS / 2][0],
+            &read_filters[MULTI_NCHUNKS / 2], &rbufs[MULTI_NCHUNKS / 2]) < 0)
+        goto error;
+    if(H5Dread_chunks(dataset, H5P_DEFAULT, MULTI_NCHUNKS / 2, &offsets[0][0], read_filters, rbufs) < 0)
+        goto error;
+    for(k = 0; k < MULTI_NCHUNKS; k++) {
+        if(read_filters[k] != filters[k])
+            goto error;
+        if(HDmemcmp(rdata[k], wdata[k], sizes[k]))
+            goto error;
+        if(H5Dget_chunk_storage_size(dataset, offsets[k], &chunk_nbytes) < 0)
+            goto error;
+        if(chunk_nbytes != sizes[k])
+            goto error;
+    } /* end for */
+
+    /* Write a chunk through the chunk cache, leaving it dirty */
+    HDmemset(chunk_buf, 0, sizeof(chunk_buf));
+    start[0] = offsets[0][0];
+    start[1] = offsets[0][1];
+    if(H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, start, NULL, chunk_dims, NULL) < 0)
+        goto error;
+    if(H5Dwrite(dataset, H5T_NATIVE_INT, mem_space, dataspace, H5P_DEFAULT, chunk_buf) < 0)
+        goto error;
+
+    /* Overwrite every third chunk, including the one in the cache, changing
+     * the size of some of them */
+    for(k = 0; k < MULTI_NCHUNKS; k += 3) {
+        sizes[k] = (k % 2) ? sizes[k] : MULTI_CHUNK_SIZE;
+        filters[k] = 0;
+        for(i = 0; i < (int)MULTI_CHUNK_SIZE; i++)
+            wdata[k][i] = (unsigned char)(100 + k + i);
+    } /* end for */
+    {
+        hsize_t     ow_offsets[MULTI_NCHUNKS][2];
+        uint32_t    ow_filters[MULTI_NCHUNKS];
+        size_t      ow_sizes[MULTI_NCHUNKS];
+        const void  *ow_bufs[MULTI_NCHUNKS];
+        size_t      n = 0;
+
+        for(k = 0; k < MULTI_NCHUNKS; k += 3) {
+            ow_offsets[n][0] = offsets[k][0];
+            ow_offsets[n][1] = offsets[k][1];
+            ow_filters[n] = filters[k];
+            ow_sizes[n] = sizes[k];
+            ow_bufs[n] = wbufs[k];
+            n++;
+        } /* end for */
+        if(H5Dwrite_chunks(dataset, H5P_DEFAULT, n, ow_filters, &ow_offsets[0][0], ow_sizes, ow_bufs) < 0)
+            goto error;
+
+        /* A chunk can't be written twice in one batch */
+        ow_offsets[1][0] = ow_offsets[0][0];
+        ow_offsets[1][1] = ow_offsets[0][1];
+        H5E_BEGIN_TRY {
+            ret = H5Dwrite_chunks(dataset, H5P_DEFAULT, n, ow_filters, &ow_offsets[0][0], ow_sizes, ow_bufs);
+        } H5E_END_TRY;
+        if(ret >= 0)
+            goto error;
+
+        /* Offsets must be on chunk boundaries */
+        ow_offsets[1][0] = 1;
+        H5E_BEGIN_TRY {
+            ret = H5Dwrite_chunks(dataset, H5P_DEFAULT, n, ow_filters, &ow_offsets[0][0], ow_sizes, ow_bufs);
+        } H5E_END_TRY;
+        if(ret >= 0)
+            goto error;
+        H5E_BEGIN_TRY {
+            ret = H5Dread_chunks(dataset, H5P_DEFAULT, n, &ow_offsets[0][0], read_filters, rbufs);
+        } H5E_END_TRY;
+        if(ret >= 0)
+            goto error;
+    } /* end block */
+
+    /* Check all the chunks, after reopening the dataset */
+    if(H5Dclose(dataset) < 0)
+        goto error;
+    if((dataset = H5Dopen2(file, DATASETNAME14, H5P_DEFAULT)) < 0)
+        goto error;
+    HDmemset(rdata, 0, sizeof(rdata));
+    if(H5Dread_chunks(dataset, H5P_DEFAULT, MULTI_NCHUNKS, &offsets[0][0], read_filters, rbufs) < 0)
+        goto error;
+    for(k = 0; k < MULTI_NCHUNKS; k++) {
+        if(read_filters[k] != filters[k])
+            goto error;
+        if(HDmemcmp(rdata[k], wdata[k], sizes[k]))
+            goto error;
+    } /* end for */
+
+    /* An unfiltered dataset, with chunks overwritten in place */
+    if(H5Premove_filter(cparms, H5Z_FILTER_FLETCHER32) < 0)
+        goto error;
+    if((dataset2 = H5Dcreate2(file, DATASETNAME15, H5T_NATIVE_INT, dataspace, H5P_DEFAULT,
+            cparms, H5P_DEFAULT)) < 0)
+        goto error;
+    for(k = 0; k < MULTI_NCHUNKS; k++) {
+        filters[k] = 0;
+        sizes[k] = MULTI_CHUNK_SIZE;
+        for(i = 0; i < CHUNK_NX * CHUNK_NY; i++)
+            ((int *)wdata[k])[i] = k * 1000 + i;
+    } /* end for */
+    if(H5Dwrite_chunks(dataset2, H5P_DEFAULT, MULTI_NCHUNKS, filters, &offsets[0][0], sizes, wbufs) < 0)
+        goto error;
+    for(k = 0; k < MULTI_NCHUNKS; k++)
+        for(i = 0; i < CHUNK_NX * CHUNK_NY; i++)
+            ((int *)wdata[k])[i] = -(k * 1000 + i);
+    if(H5Dwrite_chunks(dataset2, H5P_DEFAULT, MULTI_NCHUNKS, filters, &offsets[0][0], sizes, wbufs) < 0)
+        goto error;
+    if(H5Sselect_all(dataspace) < 0)
+        goto error;
+    if(H5Dread(dataset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) < 0)
+        goto error;
+    for(k = 0; k < MULTI_NCHUNKS; k++)
+        for(i = 0; i < CHUNK_NX; i++)
+            for(j = 0; j < CHUNK_NY; j++)
+                if(read_buf[offsets[k][0] + (hsize_t)i][offsets[k][1] + (hsize_t)j] != ((int *)wdata[k])[(i * CHUNK_NY) + j])
+                    goto error;
+
+    /* Close/release resources. */
+    H5Dclose(dataset2);
+    H5Dclose(dataset);
+    H5Sclose(mem_space);
+    H5Sclose(dataspace);
+    H5Pclose(cparms);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dataset2);
+        H5Dclose(dataset);
+        H5Sclose(mem_space);
+        H5Sclose(dataspace);
+        H5Pclose(cparms);
+    } H5E_END_TRY;
+
+    H5_FAILED();
+    return 1;
+} /* test_direct_chunks_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	Main function
  *
@@ -2148,6 +2610,8 @@ int main( void )
 #endif /* H5_HAVE_FILTER_DEFLATE */
     nerrors += test_read_unfiltered_dset(file_id);
     nerrors += test_read_unallocated_chunk(file_id);
+    nerrors += test_chunk_iter(file_id);
+    nerrors += test_direct_chunks_multi(file_id);
 
     nerrors += test_single_chunk_latest();
 
@@ -83,6 +83,11 @@ const char *FILENAME[] = {
     "dls_01_strings",   /* 23 */
     "power2up",         /* 24 */
     "version_bounds",   /* 25 */
+    "chunk_cache_grow", /* 26 */
+    "chunk_read_order", /* 27 */
+    "chunk_write_behind", /* 28 */
+    "chunk_shards",     /* 29 */
+    "chunk_alloc_batch", /* 30 */
     NULL
 };
 
@@ -255,6 +260,34 @@ const char *FILENAME[] = {
 #define BYPASS_CHUNK_DIM         500
 #define BYPASS_FILL_VALUE        7
 
+/* Parameters for the "chunk cache grow" test */
+#define GROW_DIM                 200
+#define GROW_CHUNK_DIM           5
+
+/* Parameters for the "chunk read order" test */
+#define ORDER_DIM                60
+#define ORDER_CHUNK_DIM          6
+#define ORDER_NCHUNKS            (ORDER_DIM / ORDER_CHUNK_DIM)
+
+/* Parameters for the "chunk write-behind" test */
+#define WB_DIM                   400
+#define WB_CHUNK_DIM             10
+#define WB_NQUEUE                4
+
+/* Parameters for the "chunk shards" test */
+#define SHARD_DIM0               40
+#define SHARD_DIM1               30
+#define SHARD_CHUNK_DIM0         20
+#define SHARD_CHUNK_DIM1         15
+#define SHARD_SHARD_DIM0         5
+#define SHARD_SHARD_DIM1         5
+
+/* Parameters for the "chunk allocation batch" test */
+#define ALLOC_DIM0               202
+#define ALLOC_DIM1               90
+#define ALLOC_CHUNK_DIM          4
+#define ALLOC_FILL               13
+
 /* Parameters for testing extensible array chunk indices */
 #define EARRAY_MAX_RANK         3
 #define EARRAY_DSET_DIM         15
@@ -8251,6 +8284,890 @@ error:
 } /* end test_big_chunks_bypass_cache() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_cache_grow
+ *
+ * Purpose:     Tests that the chunk cache holds many more chunks than the
+ *              number of slots requested, when there is room for them,
+ *              and that cached chunks survive the dataset being extended
+ *              and shrunk.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_cache_grow(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;           /* File ID */
+    hid_t       dcpl = -1;          /* Dataset creation property list ID */
+    hid_t       dapl = -1;          /* Dataset access property list ID */
+    hid_t       dapl2 = -1;         /* Dataset access property list ID */
+    hid_t       sid = -1;           /* Dataspace ID */
+    hid_t       mid = -1;           /* Memory dataspace ID */
+    hid_t       dsid = -1;          /* Dataset ID */
+    hsize_t     dims[2] = {GROW_DIM, GROW_DIM};     /* Dataset dimensions */
+    hsize_t     start[2] = {0, 0};  /* Hyperslab start */
+    hsize_t     max_dims[2] = {H5S_UNLIMITED, H5S_UNLIMITED};
+    hsize_t     chunk_dims[2] = {GROW_CHUNK_DIM, GROW_CHUNK_DIM};
+    hsize_t     ext_dims[2];        /* Extended dimensions */
+    size_t      nslots;             /* # of chunk slots */
+    int         *wbuf = NULL;       /* Write buffer */
+    int         *rbuf = NULL;       /* Read buffer */
+    int         i, j;               /* Local index variables */
+
+    TESTING("chunk cache holding more chunks than slots");
+
+    h5_fixname(FILENAME[26], fapl, filename, sizeof filename);
+
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * GROW_DIM * GROW_DIM)))
+        TEST_ERROR
+    if(NULL == (rbuf = (int *)HDmalloc(sizeof(int) * GROW_DIM * GROW_DIM)))
+        TEST_ERROR
+    for(i = 0; i < GROW_DIM * GROW_DIM; i++)
+        wbuf[i] = i;
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, max_dims)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+
+    /* Request only a few slots, but enough bytes to hold every chunk */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_cache(dapl, (size_t)3, sizeof(int) * GROW_DIM * GROW_DIM * 2, 1.0F) < 0)
+        FAIL_STACK_ERROR
+
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* The # of slots requested is still reported */
+    if((dapl2 = H5Dget_access_plist(dsid)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_cache(dapl2, &nslots, NULL, NULL) < 0) FAIL_STACK_ERROR
+    if(nslots != 3) FAIL_PUTS_ERROR("wrong # of chunk slots")
+    if(H5Pclose(dapl2) < 0) FAIL_STACK_ERROR
+
+    /* Write every chunk, leaving them all dirty in the cache */
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+
+    /* Extend the dataset, with the chunks still cached */
+    ext_dims[0] = GROW_DIM * 2;
+    ext_dims[1] = GROW_DIM + GROW_CHUNK_DIM;
+    if(H5Dset_extent(dsid, ext_dims) < 0) FAIL_STACK_ERROR
+
+    /* Read the original part of the dataset back */
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if((sid = H5Dget_space(dsid)) < 0) FAIL_STACK_ERROR
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, dims, NULL) < 0)
+        FAIL_STACK_ERROR
+    if((mid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(int) * GROW_DIM * GROW_DIM);
+    if(H5Dread(dsid, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sclose(mid) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < GROW_DIM * GROW_DIM; i++)
+        if(rbuf[i] != wbuf[i]) {
+            HDprintf("    rbuf[%d] = %d, should be %d\n", i, rbuf[i], wbuf[i]);
+            TEST_ERROR
+        } /* end if */
+
+    /* Shrink the dataset to a single chunk, evicting most of the cache */
+    ext_dims[0] = ext_dims[1] = GROW_CHUNK_DIM;
+    if(H5Dset_extent(dsid, ext_dims) < 0) FAIL_STACK_ERROR
+
+    /* Extend it again & re-write it, so the cache fills back up */
+    if(H5Dset_extent(dsid, dims) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < GROW_DIM * GROW_DIM; i++)
+        wbuf[i] = -i;
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+
+    /* Close & re-open the dataset, so the data comes from the file */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, "dset", dapl)) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(int) * GROW_DIM * GROW_DIM);
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for(i = 0; i < GROW_DIM; i++)
+        for(j = 0; j < GROW_DIM; j++)
+            if(rbuf[(i * GROW_DIM) + j] != -((i * GROW_DIM) + j)) {
+                HDprintf("    rbuf[%d][%d] = %d, should be %d\n", i, j,
+                        rbuf[(i * GROW_DIM) + j], -((i * GROW_DIM) + j));
+                TEST_ERROR
+            } /* end if */
+
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dsid);
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Pclose(dapl2);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return FAIL;
+} /* end test_chunk_cache_grow() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_read_order
+ *
+ * Purpose:     Tests reading chunks that were written out of order, which
+ *              the library reads in file address order, merging chunks
+ *              that are adjacent in the file into one read.  Some chunks
+ *              are left unwritten, some are left in the chunk cache, and
+ *              the cache only holds a few chunks, so that runs of
+ *              adjacent chunks are broken up.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_read_order(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;           /* File ID */
+    hid_t       dcpl = -1;          /* Dataset creation property list ID */
+    hid_t       dapl = -1;          /* Dataset access property list ID */
+    hid_t       sid = -1;           /* Dataspace ID */
+    hid_t       mid = -1;           /* Memory dataspace ID */
+    hid_t       dsid = -1;          /* Dataset ID */
+    hsize_t     dims[2] = {ORDER_DIM, ORDER_DIM};   /* Dataset dimensions */
+    hsize_t     chunk_dims[2] = {ORDER_CHUNK_DIM, ORDER_CHUNK_DIM};
+    hsize_t     start[2];           /* Hyperslab start */
+    hsize_t     count[2];           /* Hyperslab count */
+    int         fill = -1;          /* Fill value */
+    int         *wbuf = NULL;       /* Write buffer */
+    int         *rbuf = NULL;       /* Read buffer */
+    int         filtered;           /* Whether to use a filter */
+    int         i, j;               /* Local index variables */
+
+    TESTING("reading chunks in file address order");
+
+    h5_fixname(FILENAME[27], fapl, filename, sizeof filename);
+
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * ORDER_DIM * ORDER_DIM)))
+        TEST_ERROR
+    if(NULL == (rbuf = (int *)HDmalloc(sizeof(int) * ORDER_DIM * ORDER_DIM)))
+        TEST_ERROR
+    for(i = 0; i < ORDER_DIM * ORDER_DIM; i++)
+        wbuf[i] = i;
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((mid = H5Screate_simple(2, chunk_dims, NULL)) < 0) FAIL_STACK_ERROR
+
+    /* Cache holds 3 chunks */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_cache(dapl, (size_t)11, sizeof(int) * ORDER_CHUNK_DIM * ORDER_CHUNK_DIM * 3, 1.0F) < 0)
+        FAIL_STACK_ERROR
+
+    for(filtered = 0; filtered < 2; filtered++) {
+        char dset_name[16];
+
+        if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+        if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+        if(H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill) < 0) FAIL_STACK_ERROR
+        if(filtered && H5Pset_fletcher32(dcpl) < 0) FAIL_STACK_ERROR
+
+        HDsnprintf(dset_name, sizeof(dset_name), "dset%d", filtered);
+        if((dsid = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+            FAIL_STACK_ERROR
+
+        /* Write the chunks in reverse order, one at a time, skipping every
+         * seventh one */
+        count[0] = count[1] = 1;
+        for(i = ORDER_NCHUNKS - 1; i >= 0; i--)
+            for(j = ORDER_NCHUNKS - 1; j >= 0; j--) {
+                int k, l;
+
+                if(((i * ORDER_NCHUNKS) + j) % 7 == 3)
+                    continue;
+
+                start[0] = (hsize_t)(i * ORDER_CHUNK_DIM);
+                start[1] = (hsize_t)(j * ORDER_CHUNK_DIM);
+                if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, chunk_dims, NULL) < 0)
+                    FAIL_STACK_ERROR
+                for(k = 0; k < ORDER_CHUNK_DIM; k++)
+                    for(l = 0; l < ORDER_CHUNK_DIM; l++)
+                        rbuf[(k * ORDER_CHUNK_DIM) + l] = wbuf[((start[0] + (hsize_t)k) * ORDER_DIM) + start[1] + (hsize_t)l];
+                if(H5Dwrite(dsid, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, rbuf) < 0)
+                    FAIL_STACK_ERROR
+            } /* end for */
+
+        /* Read the whole dataset back, with the last chunks written still
+         * in the cache, then again from the file */
+        for(i = 0; i < 2; i++) {
+            int k;
+
+            if(i == 1) {
+                if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+                if((dsid = H5Dopen2(fid, dset_name, dapl)) < 0) FAIL_STACK_ERROR
+            } /* end if */
+
+            HDmemset(rbuf, 0, sizeof(int) * ORDER_DIM * ORDER_DIM);
+            if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+                FAIL_STACK_ERROR
+            for(k = 0; k < ORDER_DIM * ORDER_DIM; k++) {
+                int row = k / ORDER_DIM, col = k % ORDER_DIM;
+                int chunk = ((row / ORDER_CHUNK_DIM) * ORDER_NCHUNKS) + (col / ORDER_CHUNK_DIM);
+                int expect = (chunk % 7 == 3) ? fill : wbuf[k];
+
+                if(rbuf[k] != expect) {
+                    HDprintf("    rbuf[%d][%d] = %d, should be %d\n", row, col, rbuf[k], expect);
+                    TEST_ERROR
+                } /* end if */
+            } /* end for */
+        } /* end for */
+
+        /* Read a strided selection that touches every other chunk column */
+        start[0] = 1;
+        start[1] = 2;
+        count[0] = ORDER_DIM - 1;
+        count[1] = ORDER_NCHUNKS / 2;
+        {
+            hsize_t stride[2] = {1, ORDER_CHUNK_DIM * 2};
+            hsize_t mdims[1];
+            hid_t   mid2;
+
+            if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+                FAIL_STACK_ERROR
+            mdims[0] = count[0] * count[1];
+            if((mid2 = H5Screate_simple(1, mdims, NULL)) < 0) FAIL_STACK_ERROR
+            HDmemset(rbuf, 0, sizeof(int) * ORDER_DIM * ORDER_DIM);
+            if(H5Dread(dsid, H5T_NATIVE_INT, mid2, sid, H5P_DEFAULT, rbuf) < 0)
+                FAIL_STACK_ERROR
+            if(H5Sclose(mid2) < 0) FAIL_STACK_ERROR
+        }
+        for(i = 0; i < (int)count[0]; i++)
+            for(j = 0; j < (int)count[1]; j++) {
+                int row = (int)start[0] + i, col = (int)start[1] + (j * ORDER_CHUNK_DIM * 2);
+                int chunk = ((row / ORDER_CHUNK_DIM) * ORDER_NCHUNKS) + (col / ORDER_CHUNK_DIM);
+                int expect = (chunk % 7 == 3) ? fill : wbuf[(row * ORDER_DIM) + col];
+
+                if(rbuf[(i * (int)count[1]) + j] != expect) {
+                    HDprintf("    element [%d][%d] = %d, should be %d\n", row, col, rbuf[(i * (int)count[1]) + j], expect);
+                    TEST_ERROR
+                } /* end if */
+            } /* end for */
+
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+        if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    if(H5Sclose(mid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dsid);
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return FAIL;
+} /* end test_chunk_read_order() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_write_behind
+ *
+ * Purpose:     Tests queueing filtered chunks for writing when they are
+ *              evicted from the chunk cache.  Chunks are read, rewritten
+ *              and pruned while they are still in the queue, and the
+ *              data is checked after the dataset is closed.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_write_behind(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;           /* File ID */
+    hid_t       dcpl = -1;          /* Dataset creation property list ID */
+    hid_t       dapl = -1;          /* Dataset access property list ID */
+    hid_t       dapl2 = -1;         /* Dataset access property list ID */
+    hid_t       sid = -1;           /* Dataspace ID */
+    hid_t       mid = -1;           /* Memory dataspace ID */
+    hid_t       dsid = -1;          /* Dataset ID */
+    hsize_t     dims[1] = {WB_DIM}; /* Dataset dimensions */
+    hsize_t     max_dims[1] = {H5S_UNLIMITED};  /* Maximum dimensions */
+    hsize_t     chunk_dim = WB_CHUNK_DIM;       /* Chunk dimensions */
+    hsize_t     start[1];           /* Hyperslab start */
+    hsize_t     count[1];           /* Hyperslab count */
+    size_t      nchunks;            /* Size of write-behind queue */
+    int         fill = -1;          /* Fill value */
+    int         wbuf[WB_DIM];       /* Write buffer */
+    int         rbuf[WB_DIM];       /* Read buffer */
+    int         i;                  /* Local index variable */
+
+    TESTING("queueing evicted chunks for writing");
+
+    h5_fixname(FILENAME[28], fapl, filename, sizeof filename);
+
+    for(i = 0; i < WB_DIM; i++)
+        wbuf[i] = i * 3;
+
+    /* Check the property */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    nchunks = 99;
+    if(H5Pget_chunk_write_behind(dapl, &nchunks) < 0) FAIL_STACK_ERROR
+    if(nchunks != 0) TEST_ERROR
+    if(H5Pset_chunk_write_behind(dapl, (size_t)WB_NQUEUE) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_write_behind(dapl, &nchunks) < 0) FAIL_STACK_ERROR
+    if(nchunks != WB_NQUEUE) TEST_ERROR
+    if((dapl2 = H5Pcopy(dapl)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_write_behind(dapl2, &nchunks) < 0) FAIL_STACK_ERROR
+    if(nchunks != WB_NQUEUE) TEST_ERROR
+    if(H5Pclose(dapl2) < 0) FAIL_STACK_ERROR
+
+    /* Cache holds 2 chunks */
+    if(H5Pset_chunk_cache(dapl, (size_t)7, sizeof(int) * WB_CHUNK_DIM * 2, 1.0F) < 0)
+        FAIL_STACK_ERROR
+
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill) < 0) FAIL_STACK_ERROR
+    if(H5Pset_shuffle(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fletcher32(dcpl) < 0) FAIL_STACK_ERROR
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, dims, max_dims)) < 0) FAIL_STACK_ERROR
+    if((mid = H5Screate_simple(1, &chunk_dim, NULL)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Write the chunks one at a time, so they are evicted and queued */
+    count[0] = WB_CHUNK_DIM;
+    for(i = 0; i < WB_DIM / WB_CHUNK_DIM; i++) {
+        start[0] = (hsize_t)(i * WB_CHUNK_DIM);
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        if(H5Dwrite(dsid, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, &wbuf[start[0]]) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Read back a chunk that is probably still queued, then update part
+     * of another one
+     */
+    start[0] = WB_DIM - (4 * WB_CHUNK_DIM);
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dread(dsid, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for(i = 0; i < WB_CHUNK_DIM; i++)
+        if(rbuf[i] != wbuf[start[0] + (hsize_t)i]) TEST_ERROR
+
+    for(i = 0; i < WB_CHUNK_DIM / 2; i++)
+        wbuf[(WB_DIM - (3 * WB_CHUNK_DIM)) + i] = -100 - i;
+    start[0] = WB_DIM - (3 * WB_CHUNK_DIM);
+    count[0] = WB_CHUNK_DIM / 2;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    {
+        hid_t mid2;
+
+        if((mid2 = H5Screate_simple(1, count, NULL)) < 0) FAIL_STACK_ERROR
+        if(H5Dwrite(dsid, H5T_NATIVE_INT, mid2, sid, H5P_DEFAULT, &wbuf[start[0]]) < 0)
+            FAIL_STACK_ERROR
+        if(H5Sclose(mid2) < 0) FAIL_STACK_ERROR
+    }
+
+    /* Shrink the dataset, write more chunks to queue them, then extend it
+     * again; the pruned chunks must read back as the fill value
+     */
+    dims[0] = WB_DIM / 2;
+    if(H5Dset_extent(dsid, dims) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < 3; i++) {
+        start[0] = (hsize_t)(i * WB_CHUNK_DIM);
+        wbuf[start[0]] = 7000 + i;
+    } /* end for */
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if((sid = H5Dget_space(dsid)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+    dims[0] = WB_DIM;
+    if(H5Dset_extent(dsid, dims) < 0) FAIL_STACK_ERROR
+    for(i = WB_DIM / 2; i < WB_DIM; i++)
+        wbuf[i] = fill;
+
+    /* Read everything with queued chunks, then after closing the dataset */
+    for(i = 0; i < 2; i++) {
+        int j;
+
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        for(j = 0; j < WB_DIM; j++)
+            if(rbuf[j] != wbuf[j]) {
+                HDprintf("    rbuf[%d] = %d, should be %d\n", j, rbuf[j], wbuf[j]);
+                TEST_ERROR
+            } /* end if */
+
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+        if(i == 0) {
+            if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+            if((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0) FAIL_STACK_ERROR
+        } /* end if */
+        if((dsid = H5Dopen2(fid, "dset", dapl)) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Check that queued chunks are counted in the storage size */
+    for(i = 0; i < WB_DIM; i++)
+        wbuf[i] = i;
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dget_storage_size(dsid) != (WB_DIM / WB_CHUNK_DIM) * ((sizeof(int) * WB_CHUNK_DIM) + 4))
+        TEST_ERROR
+
+    /* Copy the open dataset while chunks are queued; the copy must get
+     * the queued data
+     */
+    if(H5Ocopy(fid, "dset", fid, "dset_copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, "dset_copy", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for(i = 0; i < WB_DIM; i++)
+        if(rbuf[i] != wbuf[i]) {
+            HDprintf("    copy: rbuf[%d] = %d, should be %d\n", i, rbuf[i], wbuf[i]);
+            TEST_ERROR
+        } /* end if */
+
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(mid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dsid);
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Pclose(dapl2);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return FAIL;
+} /* end test_chunk_write_behind() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_shards
+ *
+ * Purpose:     Tests splitting filtered chunks into shards.  Parts of the
+ *              chunks are read without the chunk cache, so that only the
+ *              shards which are needed get read and unfiltered, and the
+ *              data is checked against reads of whole chunks.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_shards(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;           /* File ID */
+    hid_t       dcpl = -1;          /* Dataset creation property list ID */
+    hid_t       dcpl2 = -1;         /* Dataset creation property list ID */
+    hid_t       dapl = -1;          /* Dataset access property list ID */
+    hid_t       sid = -1;           /* Dataspace ID */
+    hid_t       mid = -1;           /* Memory dataspace ID */
+    hid_t       dsid = -1;          /* Dataset ID */
+    hsize_t     dims[2] = {SHARD_DIM0, SHARD_DIM1};                 /* Dataset dimensions */
+    hsize_t     chunk_dims[2] = {SHARD_CHUNK_DIM0, SHARD_CHUNK_DIM1}; /* Chunk dimensions */
+    hsize_t     shard_dims[2] = {SHARD_SHARD_DIM0, SHARD_SHARD_DIM1}; /* Shard dimensions */
+    hsize_t     bad_dims[2];        /* Invalid shard dimensions */
+    hsize_t     out_dims[2];        /* Shard dimensions retrieved */
+    hsize_t     start[2];           /* Hyperslab start */
+    hsize_t     stride[2];          /* Hyperslab stride */
+    hsize_t     count[2];           /* Hyperslab count */
+    hsize_t     coord[3][2];        /* Point selection */
+    int         wbuf[SHARD_DIM0][SHARD_DIM1];   /* Write buffer */
+    int         rbuf[SHARD_DIM0][SHARD_DIM1];   /* Read buffer */
+    int         ndims;              /* Shard rank retrieved */
+    herr_t      ret;                /* Generic return value */
+    int         i, j;               /* Local index variables */
+
+    TESTING("splitting chunks into shards");
+
+    h5_fixname(FILENAME[29], fapl, filename, sizeof filename);
+
+    for(i = 0; i < SHARD_DIM0; i++)
+        for(j = 0; j < SHARD_DIM1; j++)
+            wbuf[i][j] = (i * 1000) + j;
+
+    /* Check the property */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_chunk_shards(dcpl, 2, shard_dims);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if((ndims = H5Pget_chunk_shards(dcpl, 2, out_dims)) < 0) FAIL_STACK_ERROR
+    if(ndims != 0) TEST_ERROR
+    bad_dims[0] = SHARD_SHARD_DIM0;
+    bad_dims[1] = SHARD_CHUNK_DIM1 - 1;
+    H5E_BEGIN_TRY {
+        ret = H5Pset_chunk_shards(dcpl, 2, bad_dims);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_chunk_shards(dcpl, 1, shard_dims);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    if(H5Pset_chunk_shards(dcpl, 2, shard_dims) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_opts(dcpl, H5D_CHUNK_DONT_FILTER_PARTIAL_CHUNKS) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_opts(dcpl, 0) < 0) FAIL_STACK_ERROR
+    if((ndims = H5Pget_chunk_shards(dcpl, 2, out_dims)) < 0) FAIL_STACK_ERROR
+    if(ndims != 2 || out_dims[0] != SHARD_SHARD_DIM0 || out_dims[1] != SHARD_SHARD_DIM1) TEST_ERROR
+    if(H5Pset_shuffle(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fletcher32(dcpl) < 0) FAIL_STACK_ERROR
+
+    /* Write the whole dataset through the chunk cache */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    /* Reopen the dataset with no chunk cache, so reads only unfilter the
+     * shards they need
+     */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_cache(dapl, (size_t)0, (size_t)0, 1.0F) < 0) FAIL_STACK_ERROR
+    if((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, "dset", dapl)) < 0) FAIL_STACK_ERROR
+
+    /* Check the shards are kept in the dataset's creation properties */
+    if((dcpl2 = H5Dget_create_plist(dsid)) < 0) FAIL_STACK_ERROR
+    out_dims[0] = out_dims[1] = 0;
+    if((ndims = H5Pget_chunk_shards(dcpl2, 2, out_dims)) < 0) FAIL_STACK_ERROR
+    if(ndims != 2 || out_dims[0] != SHARD_SHARD_DIM0 || out_dims[1] != SHARD_SHARD_DIM1) TEST_ERROR
+    if(H5Pclose(dcpl2) < 0) FAIL_STACK_ERROR
+
+    /* Read a block inside one shard, then a block across shards & chunks */
+    if((mid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < 2; i++) {
+        start[0] = i ? SHARD_SHARD_DIM0 - 1 : SHARD_CHUNK_DIM0 + 1;
+        start[1] = i ? SHARD_CHUNK_DIM1 - 2 : 1;
+        count[0] = i ? SHARD_CHUNK_DIM0 : 2;
+        count[1] = i ? SHARD_SHARD_DIM1 + 3 : 2;
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        if(H5Sselect_hyperslab(mid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if(H5Dread(dsid, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        for(j = 0; j < SHARD_DIM0 * SHARD_DIM1; j++) {
+            hsize_t r = (hsize_t)(j / SHARD_DIM1), c = (hsize_t)(j % SHARD_DIM1);
+            int expect = (r >= start[0] && r < start[0] + count[0] && c >= start[1] && c < start[1] + count[1])
+                    ? wbuf[r][c] : 0;
+
+            if(rbuf[r][c] != expect) TEST_ERROR
+        } /* end for */
+    } /* end for */
+
+    /* Read a strided selection */
+    start[0] = start[1] = 1;
+    stride[0] = SHARD_SHARD_DIM0 * 2;
+    stride[1] = 3;
+    count[0] = SHARD_DIM0 / stride[0];
+    count[1] = (SHARD_DIM1 - 1) / stride[1];
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sselect_hyperslab(mid, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for(i = 0; i < SHARD_DIM0; i++)
+        for(j = 0; j < SHARD_DIM1; j++) {
+            int expect = ((i - 1) % (int)stride[0] == 0 && (j - 1) % (int)stride[1] == 0
+                    && i >= 1 && j >= 1 && j < 1 + (int)(count[1] * stride[1]))
+                    ? wbuf[i][j] : 0;
+
+            if(rbuf[i][j] != expect) TEST_ERROR
+        } /* end for */
+
+    /* Read some points */
+    coord[0][0] = 0;                    coord[0][1] = 0;
+    coord[1][0] = SHARD_DIM0 - 1;       coord[1][1] = SHARD_DIM1 - 1;
+    coord[2][0] = SHARD_CHUNK_DIM0 + 3; coord[2][1] = SHARD_SHARD_DIM1 + 1;
+    if(H5Sselect_elements(sid, H5S_SELECT_SET, (size_t)3, (const hsize_t *)coord) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sselect_elements(mid, H5S_SELECT_SET, (size_t)3, (const hsize_t *)coord) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for(i = 0; i < 3; i++)
+        if(rbuf[coord[i][0]][coord[i][1]] != wbuf[coord[i][0]][coord[i][1]]) TEST_ERROR
+
+    /* Update part of a chunk without the cache, then read everything */
+    start[0] = SHARD_SHARD_DIM0 + 1;
+    start[1] = 2;
+    count[0] = 3;
+    count[1] = SHARD_CHUNK_DIM1;
+    for(i = 0; i < (int)count[0]; i++)
+        for(j = 0; j < (int)count[1]; j++)
+            wbuf[start[0] + (hsize_t)i][start[1] + (hsize_t)j] = -1 - j;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sselect_hyperslab(mid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    if(HDmemcmp(rbuf, wbuf, sizeof(rbuf))) TEST_ERROR
+
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Filters set up for the size of a whole chunk can't be used */
+    if(H5Pset_nbit(dcpl) < 0) FAIL_STACK_ERROR
+    H5E_BEGIN_TRY {
+        dsid = H5Dcreate2(fid, "nbit", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(dsid >= 0) TEST_ERROR
+
+    if(H5Sclose(mid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dsid);
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Pclose(dcpl2);
+        H5Pclose(dapl);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return FAIL;
+} /* end test_chunk_shards() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_alloc_batch
+ *
+ * Purpose:     Tests allocating and filling more chunks than fit in one
+ *              allocation batch, with early allocation and each chunk
+ *              index type.  Some datasets have filtered chunks with
+ *              unfiltered partial edge chunks among them, and some are
+ *              extended afterwards to allocate the new chunks.  The
+ *              storage size and the data are checked after reopening
+ *              the file.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_alloc_batch(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fapl2 = -1;         /* File access property list ID */
+    hid_t       fid = -1;           /* File ID */
+    hid_t       dcpl = -1;          /* Dataset creation property list ID */
+    hid_t       sid = -1;           /* Dataspace ID */
+    hid_t       dsid = -1;          /* Dataset ID */
+    hsize_t     dims[2] = {ALLOC_DIM0, ALLOC_DIM1};     /* Dataset dimensions */
+    hsize_t     max_dims[2];        /* Maximum dimensions */
+    hsize_t     ext_dims[2];        /* Extended dimensions */
+    hsize_t     chunk_dims[2] = {ALLOC_CHUNK_DIM, ALLOC_CHUNK_DIM};   /* Chunk dimensions */
+    hsize_t     start[2] = {0, 0};  /* Hyperslab start */
+    hsize_t     count[2] = {2 * ALLOC_CHUNK_DIM, ALLOC_DIM1};   /* Hyperslab count */
+    hsize_t     nfull, nchunks;     /* # of full and of all chunks */
+    hsize_t     chunk_size = sizeof(int) * ALLOC_CHUNK_DIM * ALLOC_CHUNK_DIM;   /* Size of a chunk */
+    hsize_t     filt_size;          /* Size of a filtered chunk */
+    char        dset_name[16];      /* Dataset name */
+    int         fill = ALLOC_FILL;  /* Fill value */
+    int         *wbuf = NULL;       /* Write buffer */
+    int         *rbuf = NULL;       /* Read buffer */
+    unsigned    u;                  /* Local index variable */
+    hsize_t     i, j;               /* Local index variables */
+
+    TESTING("allocating chunks in batches");
+
+    h5_fixname(FILENAME[30], fapl, filename, sizeof filename);
+
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * 2 * ALLOC_CHUNK_DIM * ALLOC_DIM1)))
+        TEST_ERROR
+    if(NULL == (rbuf = (int *)HDmalloc(sizeof(int) * 2 * ALLOC_DIM0 * (ALLOC_DIM1 + 10))))
+        TEST_ERROR
+    for(i = 0; i < 2 * ALLOC_CHUNK_DIM; i++)
+        for(j = 0; j < ALLOC_DIM1; j++)
+            wbuf[(i * ALLOC_DIM1) + j] = (int)((i * 1000) + j);
+
+    /* Use the latest format, for all the chunk index types */
+    if((fapl2 = H5Pcopy(fapl)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_libver_bounds(fapl2, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0) FAIL_STACK_ERROR
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl2)) < 0) FAIL_STACK_ERROR
+
+    /* Create the datasets: 0 has an implicit index, 1 a fixed array, 2 an
+     * extensible array and 3 a version 2 B-tree.  1 and 2 have filtered
+     * chunks, with unfiltered partial edge chunks.
+     */
+    for(u = 0; u < 4; u++) {
+        if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+        if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+        if(H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0) FAIL_STACK_ERROR
+        if(H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill) < 0) FAIL_STACK_ERROR
+        if(u == 1 || u == 2) {
+            if(H5Pset_fletcher32(dcpl) < 0) FAIL_STACK_ERROR
+            if(H5Pset_chunk_opts(dcpl, H5D_CHUNK_DONT_FILTER_PARTIAL_CHUNKS) < 0) FAIL_STACK_ERROR
+        } /* end if */
+        max_dims[0] = (u >= 2) ? H5S_UNLIMITED : ALLOC_DIM0;
+        max_dims[1] = (u == 3) ? H5S_UNLIMITED : ALLOC_DIM1;
+        if((sid = H5Screate_simple(2, dims, max_dims)) < 0) FAIL_STACK_ERROR
+        HDsprintf(dset_name, "dset%u", u);
+        if((dsid = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+
+        /* Check that all the chunks were allocated, at their sizes */
+        nfull = (ALLOC_DIM0 / ALLOC_CHUNK_DIM) * (ALLOC_DIM1 / ALLOC_CHUNK_DIM);
+        nchunks = ((ALLOC_DIM0 + ALLOC_CHUNK_DIM - 1) / ALLOC_CHUNK_DIM) * ((ALLOC_DIM1 + ALLOC_CHUNK_DIM - 1) / ALLOC_CHUNK_DIM);
+        filt_size = (u == 1 || u == 2) ? chunk_size + 4 : chunk_size;
+        if(H5Dget_storage_size(dsid) != (nfull * filt_size) + ((nchunks - nfull) * chunk_size))
+            TEST_ERROR
+
+        /* Write the first two rows of chunks */
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+        if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+        if((sid = H5Screate_simple(2, count, NULL)) < 0) FAIL_STACK_ERROR
+        {
+            hid_t fsid;
+
+            if((fsid = H5Dget_space(dsid)) < 0) FAIL_STACK_ERROR
+            if(H5Sselect_hyperslab(fsid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+            if(H5Dwrite(dsid, H5T_NATIVE_INT, sid, fsid, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+            if(H5Sclose(fsid) < 0) FAIL_STACK_ERROR
+        }
+
+        /* Extend the datasets that can be, allocating more chunks */
+        if(u >= 2) {
+            ext_dims[0] = 2 * ALLOC_DIM0;
+            ext_dims[1] = (u == 3) ? ALLOC_DIM1 + 10 : ALLOC_DIM1;
+            if(H5Dset_extent(dsid, ext_dims) < 0) FAIL_STACK_ERROR
+        } /* end if */
+
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+        if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+        if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Reopen the file and check the data */
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl2)) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < 4; u++) {
+        HDsprintf(dset_name, "dset%u", u);
+        if((dsid = H5Dopen2(fid, dset_name, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if((sid = H5Dget_space(dsid)) < 0) FAIL_STACK_ERROR
+        if(H5Sget_simple_extent_dims(sid, ext_dims, NULL) < 0) FAIL_STACK_ERROR
+        if(ext_dims[0] != ((u >= 2) ? 2 * ALLOC_DIM0 : ALLOC_DIM0)) TEST_ERROR
+        if(ext_dims[1] != ((u == 3) ? ALLOC_DIM1 + 10 : ALLOC_DIM1)) TEST_ERROR
+
+        HDmemset(rbuf, 0, (size_t)(sizeof(int) * ext_dims[0] * ext_dims[1]));
+        if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        for(i = 0; i < ext_dims[0]; i++)
+            for(j = 0; j < ext_dims[1]; j++) {
+                int val = (i < count[0] && j < count[1]) ? wbuf[(i * ALLOC_DIM1) + j] : ALLOC_FILL;
+
+                if(rbuf[(i * ext_dims[1]) + j] != val) {
+                    HDprintf("    %s[%llu][%llu] = %d, should be %d\n", dset_name,
+                        (unsigned long long)i, (unsigned long long)j, rbuf[(i * ext_dims[1]) + j], val);
+                    TEST_ERROR
+                } /* end if */
+            } /* end for */
+
+        if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(fapl2) < 0) FAIL_STACK_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dsid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Fclose(fid);
+        H5Pclose(fapl2);
+    } H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    return FAIL;
+} /* end test_chunk_alloc_batch() */
+
+
 /*-------------------------------------------------------------------------
  * Function: test_chunk_fast
  *
@@ -13322,6 +14239,11 @@ main(void)
             nerrors += (test_huge_chunks(my_fapl) < 0        ? 1 : 0);
             nerrors += (test_chunk_cache(my_fapl) < 0        ? 1 : 0);
             nerrors += (test_big_chunks_bypass_cache(my_fapl) < 0   ? 1 : 0);
+            nerrors += (test_chunk_cache_grow(my_fapl) < 0          ? 1 : 0);
+            nerrors += (test_chunk_read_order(my_fapl) < 0          ? 1 : 0);
+            nerrors += (test_chunk_write_behind(my_fapl) < 0        ? 1 : 0);
+            nerrors += (test_chunk_shards(my_fapl) < 0              ? 1 : 0);
+            nerrors += (test_chunk_alloc_batch(my_fapl) < 0         ? 1 : 0);
             nerrors += (test_chunk_fast(envval, my_fapl) < 0    ? 1 : 0);
             nerrors += (test_reopen_chunk_fast(my_fapl) < 0        ? 1 : 0);
             nerrors += (test_chunk_fast_bug1(my_fapl) < 0           ? 1 : 0);
@@ -1249,6 +1249,130 @@ error:
     return 1;
 } /* test_delete_open() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	test_open_twice_elmts
+ *
+ * Purpose:	Set & get elements of an extensible array through two
+ *              array wrappers, alternating between data blocks, so that
+ *              the data block kept pinned for lookups by the shared array
+ *              header changes between accesses and outlives the wrapper
+ *              which pinned it.
+ *
+ * Return:	Success:	0
+ *		Failure:	1
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_open_twice_elmts(hid_t fapl, H5EA_create_t *cparam, earray_test_param_t *tparam)
+{
+    hid_t	file = -1;              /* File ID */
+    H5F_t	*f = NULL;              /* Internal file object pointer */
+    H5EA_t      *ea = NULL;             /* Extensible array wrapper */
+    H5EA_t      *ea2 = NULL;            /* Extensible array wrapper */
+    haddr_t     ea_addr = HADDR_UNDEF;  /* Array address in file */
+    uint64_t    welmt;                  /* Element to write */
+    uint64_t    relmt;                  /* Element to read */
+    hsize_t     nelmts;                 /* # of elements to test */
+    hsize_t     cnt;                    /* Count of array indices */
+    hsize_t     idx;                    /* Index of element */
+
+    /* Create file & retrieve pointer to internal file object */
+    if(create_file(H5F_ACC_TRUNC, fapl, &file, &f) < 0)
+        TEST_ERROR
+
+    /*
+     * Display testing message
+     */
+    TESTING("setting elements through two extensible array wrappers");
+
+    /* Create array */
+    if(create_array(f, cparam, &ea, &ea_addr, NULL) < 0)
+        TEST_ERROR
+
+    /* Open the array again */
+    if(NULL == (ea2 = H5EA_open(f, ea_addr, NULL)))
+        FAIL_STACK_ERROR
+
+    /* Cover the index block and the data blocks of the first few super blocks */
+    nelmts = (hsize_t)(cparam->idx_blk_elmts + (8 * cparam->data_blk_min_elmts));
+
+    /* Set elements from both ends of the range through the first wrapper,
+     * checking each one through the second
+     */
+    for(cnt = 0; cnt < nelmts; cnt++) {
+        idx = (cnt % 2) ? (nelmts - 1) - (cnt / 2) : (cnt / 2);
+
+        welmt = (uint64_t)7 + idx;
+        if(H5EA_set(ea, idx, &welmt) < 0)
+            FAIL_STACK_ERROR
+
+        relmt = (uint64_t)0;
+        if(H5EA_get(ea2, idx, &relmt) < 0)
+            FAIL_STACK_ERROR
+        if(relmt != welmt)
+            TEST_ERROR
+    } /* end for */
+
+    /* Overwrite every other element through the second wrapper, checking
+     * each one through the first
+     */
+    for(idx = 0; idx < nelmts; idx += 2) {
+        welmt = (uint64_t)11 + idx;
+        if(H5EA_set(ea2, idx, &welmt) < 0)
+            FAIL_STACK_ERROR
+
+        relmt = (uint64_t)0;
+        if(H5EA_get(ea, idx, &relmt) < 0)
+            FAIL_STACK_ERROR
+        if(relmt != welmt)
+            TEST_ERROR
+    } /* end for */
+
+    /* Close the first extensible array wrapper */
+    if(H5EA_close(ea) < 0)
+        FAIL_STACK_ERROR
+    ea = NULL;
+
+    /* Check for closing & re-opening the file */
+    if(reopen_file(&file, &f, fapl, &ea2, ea_addr, tparam) < 0)
+        TEST_ERROR
+
+    /* Verify the elements, and that the ones past the end are fill values */
+    for(idx = 0; idx < nelmts + cparam->data_blk_min_elmts; idx++) {
+        relmt = (uint64_t)0;
+        if(H5EA_get(ea2, idx, &relmt) < 0)
+            FAIL_STACK_ERROR
+        if(idx >= nelmts)
+            welmt = H5EA_TEST_FILL;
+        else
+            welmt = (uint64_t)((idx % 2) ? 7 : 11) + idx;
+        if(relmt != welmt)
+            TEST_ERROR
+    } /* end for */
+
+    /* Close array, delete array, close file & verify file is empty */
+    if(finish(file, fapl, f, ea2, ea_addr) < 0)
+        TEST_ERROR
+
+    /* All tests passed */
+    PASSED()
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(ea)
+            H5EA_close(ea);
+        if(ea2)
+            H5EA_close(ea2);
+	H5Fclose(file);
+    } H5E_END_TRY;
+
+    return 1;
+} /* test_open_twice_elmts() */
+
 /* Extensible array iterator info for forward iteration */
 typedef struct eiter_fw_t {
     hsize_t idx;        /* Index of next array location */
@@ -2501,6 +2625,7 @@ main(void)
         nerrors += test_open_twice(fapl, &cparam, &tparam);
         nerrors += test_open_twice_diff(fapl, &cparam, &tparam);
         nerrors += test_delete_open(fapl, &cparam, &tparam);
+        nerrors += test_open_twice_elmts(fapl, &cparam, &tparam);
 
         /* Iterate over the type of capacity tests */
         for(curr_iter = EARRAY_ITER_FW; curr_iter < EARRAY_ITER_NITERS; H5_INC_ENUM(earray_iter_type_t, curr_iter)) {
@@ -963,6 +963,124 @@ error:
     return 1;
 } /* test_delete_open() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	test_open_twice_elmts
+ *
+ * Purpose:	Set & get elements of a fixed array through two array
+ *              wrappers, alternating between data block pages, so that
+ *              the page kept pinned for lookups by the shared array header
+ *              changes between accesses and outlives the wrapper which
+ *              pinned it.
+ *
+ * Return:	Success:	0
+ *		Failure:	1
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_open_twice_elmts(hid_t fapl, H5FA_create_t *cparam, farray_test_param_t *tparam)
+{
+    hid_t	file = -1;              /* File ID */
+    H5F_t	*f = NULL;              /* Internal file object pointer */
+    H5FA_t      *fa = NULL;             /* Fixed array wrapper */
+    H5FA_t      *fa2 = NULL;            /* Fixed array wrapper */
+    haddr_t     fa_addr = HADDR_UNDEF;  /* Array address in file */
+    uint64_t    welmt;                  /* Element to write */
+    uint64_t    relmt;                  /* Element to read */
+    hsize_t     nelmts = cparam->nelmts;    /* # of elements in array */
+    hsize_t     cnt;                    /* Count of array indices */
+    hsize_t     idx;                    /* Index of element */
+
+    /* Create file & retrieve pointer to internal file object */
+    if(create_file(fapl, &file, &f) < 0)
+        TEST_ERROR
+
+    /*
+     * Display testing message
+     */
+    TESTING("setting elements through two fixed array wrappers");
+
+    /* Create array */
+    if(create_array(f, cparam, &fa, &fa_addr) < 0)
+        TEST_ERROR
+
+    /* Open the array again */
+    if(NULL == (fa2 = H5FA_open(f, fa_addr, NULL)))
+        FAIL_STACK_ERROR
+
+    /* Set elements from both ends of the array through the first wrapper,
+     * checking each one through the second
+     */
+    for(cnt = 0; cnt < nelmts; cnt++) {
+        idx = (cnt % 2) ? (nelmts - 1) - (cnt / 2) : (cnt / 2);
+
+        welmt = (uint64_t)7 + idx;
+        if(H5FA_set(fa, idx, &welmt) < 0)
+            FAIL_STACK_ERROR
+
+        relmt = (uint64_t)0;
+        if(H5FA_get(fa2, idx, &relmt) < 0)
+            FAIL_STACK_ERROR
+        if(relmt != welmt)
+            TEST_ERROR
+    } /* end for */
+
+    /* Overwrite every other element through the second wrapper, checking
+     * each one through the first
+     */
+    for(idx = 0; idx < nelmts; idx += 2) {
+        welmt = (uint64_t)11 + idx;
+        if(H5FA_set(fa2, idx, &welmt) < 0)
+            FAIL_STACK_ERROR
+
+        relmt = (uint64_t)0;
+        if(H5FA_get(fa, idx, &relmt) < 0)
+            FAIL_STACK_ERROR
+        if(relmt != welmt)
+            TEST_ERROR
+    } /* end for */
+
+    /* Close the first fixed array wrapper */
+    if(H5FA_close(fa) < 0)
+        FAIL_STACK_ERROR
+    fa = NULL;
+
+    /* Check for closing & re-opening the file */
+    if(reopen_file(&file, &f, fapl, &fa2, fa_addr, tparam) < 0)
+        TEST_ERROR
+
+    /* Verify the elements */
+    for(idx = 0; idx < nelmts; idx++) {
+        relmt = (uint64_t)0;
+        if(H5FA_get(fa2, idx, &relmt) < 0)
+            FAIL_STACK_ERROR
+        welmt = (uint64_t)((idx % 2) ? 7 : 11) + idx;
+        if(relmt != welmt)
+            TEST_ERROR
+    } /* end for */
+
+    /* Close array, delete array, close file & verify file is empty */
+    if(finish(file, fapl, f, fa2, fa_addr) < 0)
+        TEST_ERROR
+
+    /* All tests passed */
+    PASSED()
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(fa)
+            H5FA_close(fa);
+        if(fa2)
+            H5FA_close(fa2);
+        H5Fclose(file);
+    } H5E_END_TRY;
+
+    return 1;
+} /* test_open_twice_elmts() */
+
 /* Fixed array iterator info for forward iteration */
 typedef struct fiter_fw_t {
     hsize_t idx;        /* Index of next array location */
@@ -1721,6 +1839,7 @@ main(void)
         nerrors += test_open_twice(fapl, &cparam, &tparam);
         nerrors += test_open_twice_diff(fapl, &cparam, &tparam);
         nerrors += test_delete_open(fapl, &cparam, &tparam);
+        nerrors += test_open_twice_elmts(fapl, &cparam, &tparam);
 
 	/* Iterate over the type of capacity tests */
 	for(curr_iter = FARRAY_ITER_FW; curr_iter < FARRAY_ITER_NITERS; H5_INC_ENUM(farray_iter_type_t, curr_iter)) {
@@ -1617,6 +1617,141 @@ error:
     return 1;
 } /* end test_move_preserves() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_path_cache
+ *
+ * Purpose:     Tests that paths opened repeatedly resolve to the right
+ *              objects after the links along them are deleted, moved,
+ *              re-created or mounted over.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_path_cache(hid_t fapl, hbool_t new_format)
+{
+    hid_t fid = -1, fid2 = -1;          /* File IDs */
+    hid_t gid = -1;                     /* Group ID */
+    hid_t lcpl = -1;                    /* Link creation property list ID */
+    H5O_info_t oinfo;                   /* Object info */
+    haddr_t old_addr;                   /* Address of object before re-creating it */
+    unsigned long fileno;               /* File number of the main file */
+    char filename[NAME_BUF_SIZE];
+    char filename2[NAME_BUF_SIZE];
+    char name[NAME_BUF_SIZE];
+    hid_t ret;
+
+    if(new_format)
+        TESTING("repeated path lookups (w/new group format)")
+    else
+        TESTING("repeated path lookups")
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    h5_fixname(FILENAME[1], fapl, filename2, sizeof filename2);
+
+    /* Create the file to mount, with a group named "d" in the root group */
+    if((fid2 = H5Fcreate(filename2, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) TEST_ERROR
+    if((gid = H5Gcreate2(fid2, "d", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if((gid = H5Gcreate2(fid2, "e", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+
+    /* Create "/a/b/c/d" */
+    if((lcpl = H5Pcreate(H5P_LINK_CREATE)) < 0) TEST_ERROR
+    if(H5Pset_create_intermediate_group(lcpl, TRUE) < 0) TEST_ERROR
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) TEST_ERROR
+    if((gid = H5Gcreate2(fid, "/a/b/c/d", lcpl, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+
+    /* Open it a few times, by absolute and relative name */
+    if((gid = H5Gopen2(fid, "/a/b/c/d", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Oget_info2(gid, &oinfo, H5O_INFO_BASIC) < 0) TEST_ERROR
+    old_addr = oinfo.addr;
+    fileno = oinfo.fileno;
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if((gid = H5Gopen2(fid, "a/b/c/d", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Oget_info2(gid, &oinfo, H5O_INFO_BASIC) < 0) TEST_ERROR
+    if(H5F_addr_ne(oinfo.addr, old_addr)) TEST_ERROR
+    if(H5Iget_name(gid, name, (size_t)NAME_BUF_SIZE) < 0) TEST_ERROR
+    if(HDstrcmp(name, "/a/b/c/d")) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+
+    /* Delete "c" and make sure the path is gone */
+    if(H5Ldelete(fid, "/a/b/c", H5P_DEFAULT) < 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Gopen2(fid, "/a/b/c/d", H5P_DEFAULT);
+    } H5E_END_TRY
+    if(ret >= 0) TEST_ERROR
+
+    /* Re-create it, with a new object (and a sibling) */
+    if((gid = H5Gcreate2(fid, "/a/b/c/z", lcpl, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if((gid = H5Gcreate2(fid, "/a/b/c/d", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if(H5Oget_info_by_name2(fid, "/a/b/c/d", &oinfo, H5O_INFO_BASIC, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5F_addr_eq(oinfo.addr, old_addr)) TEST_ERROR
+    old_addr = oinfo.addr;
+    if(H5Oget_info_by_name2(fid, "/a/b/c/d", &oinfo, H5O_INFO_BASIC, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5F_addr_ne(oinfo.addr, old_addr)) TEST_ERROR
+
+    /* Move "b" and check both the old and new paths */
+    if(H5Lmove(fid, "/a/b", fid, "/x", H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Gopen2(fid, "/a/b/c/d", H5P_DEFAULT);
+    } H5E_END_TRY
+    if(ret >= 0) TEST_ERROR
+    if((gid = H5Gopen2(fid, "/x/c/d", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if((gid = H5Gopen2(fid, "/x/c/d", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Oget_info2(gid, &oinfo, H5O_INFO_BASIC) < 0) TEST_ERROR
+    if(H5F_addr_ne(oinfo.addr, old_addr)) TEST_ERROR
+    if(H5Iget_name(gid, name, (size_t)NAME_BUF_SIZE) < 0) TEST_ERROR
+    if(HDstrcmp(name, "/x/c/d")) TEST_ERROR
+    if(H5Gclose(gid) < 0) TEST_ERROR
+
+    /* Look through a soft link to the same group */
+    if(H5Lcreate_soft("/x/c", fid, "s", H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5Oget_info_by_name2(fid, "/s/d", &oinfo, H5O_INFO_BASIC, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5F_addr_ne(oinfo.addr, old_addr)) TEST_ERROR
+    if(H5Oget_info_by_name2(fid, "/s/d", &oinfo, H5O_INFO_BASIC, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5F_addr_ne(oinfo.addr, old_addr)) TEST_ERROR
+
+    /* Mount the other file over "c" and check that its objects are found */
+    if(H5Fmount(fid, "/x/c", fid2, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5Oget_info_by_name2(fid, "/x/c/d", &oinfo, H5O_INFO_BASIC, H5P_DEFAULT) < 0) TEST_ERROR
+    if(oinfo.fileno == fileno) TEST_ERROR
+    if(H5Lexists(fid, "/x/c/e", H5P_DEFAULT) != TRUE) TEST_ERROR
+    if(H5Lexists(fid, "/x/c/z", H5P_DEFAULT) != FALSE) TEST_ERROR
+
+    /* Unmount it again */
+    if(H5Funmount(fid, "/x/c") < 0) TEST_ERROR
+    if(H5Lexists(fid, "/x/c/z", H5P_DEFAULT) != TRUE) TEST_ERROR
+    if(H5Lexists(fid, "/x/c/e", H5P_DEFAULT) != FALSE) TEST_ERROR
+    if(H5Oget_info_by_name2(fid, "/x/c/d", &oinfo, H5O_INFO_BASIC, H5P_DEFAULT) < 0) TEST_ERROR
+    if(oinfo.fileno != fileno) TEST_ERROR
+    if(H5F_addr_ne(oinfo.addr, old_addr)) TEST_ERROR
+
+    /* Close everything */
+    if(H5Pclose(lcpl) < 0) TEST_ERROR
+    if(H5Fclose(fid2) < 0) TEST_ERROR
+    if(H5Fclose(fid) < 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Gclose(gid);
+        H5Pclose(lcpl);
+        H5Fclose(fid2);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_path_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_deprec
@@ -14959,6 +15094,7 @@ main(void)
             nerrors += test_move(my_fapl, new_format);
             nerrors += test_copy(my_fapl, new_format);
             nerrors += test_move_preserves(my_fapl, new_format);
+            nerrors += test_path_cache(my_fapl, new_format);
 #ifndef H5_NO_DEPRECATED_SYMBOLS
             nerrors += test_deprec(my_fapl, new_format);
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
@@ -6607,6 +6607,178 @@ error:
 } /* end test_copy_group */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_copy_group_datasets
+ *
+ * Purpose:     Create a group with contiguous and chunked datasets whose
+ *              raw data is interleaved in SRC file and copy it to DST file
+ *
+ *              Note: The parameter "test_open" is added to test for H5Ocopy when
+ *                    one of the source datasets is open in the file.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_copy_group_datasets(hid_t fcpl_src, hid_t fcpl_dst, hid_t src_fapl,
+    hid_t dst_fapl, hbool_t test_open)
+{
+    hid_t fid_src = -1, fid_dst = -1;           /* File IDs */
+    hid_t sid = -1;                             /* Dataspace ID */
+    hid_t mid = -1;                             /* Memory dataspace ID */
+    hid_t pid = -1;                             /* Dataset creation property list ID */
+    hid_t did = -1;                             /* Dataset ID */
+    hid_t did_open = -1;                        /* Dataset ID for dataset left open */
+    hid_t gid = -1, gid2 = -1;                  /* Group IDs */
+    hsize_t dim2d[2];                           /* Dataset dimensions */
+    hsize_t chunk_dim2d[2] = {CHUNK_SIZE_1, CHUNK_SIZE_2};     /* Chunk dimensions */
+    hsize_t start[2], count[2];                 /* Hyperslab selection */
+    int buf[DIM_SIZE_1][DIM_SIZE_2];            /* Buffer for writing data */
+    int i, j, k;                                /* Local index variables */
+    char name[NAME_BUF_SIZE];                   /* Dataset name */
+    char src_filename[NAME_BUF_SIZE];
+    char dst_filename[NAME_BUF_SIZE];
+
+    if(test_open)
+        TESTING("H5Ocopy(): group with interleaved datasets, one opened")
+    else
+        TESTING("H5Ocopy(): group with interleaved datasets")
+
+    /* Initialize the filenames */
+    h5_fixname(FILENAME[0], src_fapl, src_filename, sizeof src_filename);
+    h5_fixname(FILENAME[1], dst_fapl, dst_filename, sizeof dst_filename);
+
+    /* Reset file address checking info */
+    addr_reset();
+
+    /* create source file */
+    if((fid_src = H5Fcreate(src_filename, H5F_ACC_TRUNC, fcpl_src, src_fapl)) < 0) TEST_ERROR
+
+    /* create group at the SRC file */
+    if((gid = H5Gcreate2(fid_src, NAME_GROUP_TOP, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+
+    /* Set dataspace dimensions */
+    dim2d[0] = DIM_SIZE_1;
+    dim2d[1] = DIM_SIZE_2;
+
+    /* create dataspaces */
+    if((sid = H5Screate_simple(2, dim2d, NULL)) < 0) TEST_ERROR
+    if((mid = H5Screate_simple(2, dim2d, NULL)) < 0) TEST_ERROR
+
+    /* Create the datasets: contiguous ones alternating with chunked ones,
+     * some of them compressed */
+    for(k = 0; k < NUM_DATASETS; k++) {
+        if((pid = H5Pcreate(H5P_DATASET_CREATE)) < 0) TEST_ERROR
+        if(k % 2) {
+            if(H5Pset_chunk(pid, 2, chunk_dim2d) < 0) TEST_ERROR
+#ifdef H5_HAVE_FILTER_DEFLATE
+            if((k % 4) == 3)
+                if(H5Pset_deflate(pid, 9) < 0) TEST_ERROR
+#endif /* H5_HAVE_FILTER_DEFLATE */
+        } /* end if */
+        else
+            if(H5Pset_alloc_time(pid, H5D_ALLOC_TIME_EARLY) < 0) TEST_ERROR
+
+        HDsprintf(name, "dataset_%d", k);
+        if((did = H5Dcreate2(gid, name, H5T_NATIVE_INT, sid, H5P_DEFAULT, pid, H5P_DEFAULT)) < 0) TEST_ERROR
+        if(H5Dclose(did) < 0) TEST_ERROR
+        if(H5Pclose(pid) < 0) TEST_ERROR
+    } /* end for */
+
+    /* Write the datasets a block of rows at a time, last block first, so
+     * that the chunks of the datasets are interleaved in the file */
+    for(i = ((DIM_SIZE_1 - 1) / CHUNK_SIZE_1) * CHUNK_SIZE_1; i >= 0; i -= CHUNK_SIZE_1) {
+        start[0] = (hsize_t)i;
+        start[1] = 0;
+        count[0] = (hsize_t)MIN(CHUNK_SIZE_1, DIM_SIZE_1 - i);
+        count[1] = DIM_SIZE_2;
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) TEST_ERROR
+        if(H5Sselect_hyperslab(mid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) TEST_ERROR
+
+        for(k = 0; k < NUM_DATASETS; k++) {
+            for(j = 0; j < DIM_SIZE_1 * DIM_SIZE_2; j++)
+                buf[j / DIM_SIZE_2][j % DIM_SIZE_2] = 1000 * k + j;
+
+            HDsprintf(name, "dataset_%d", k);
+            if((did = H5Dopen2(gid, name, H5P_DEFAULT)) < 0) TEST_ERROR
+            if(H5Dwrite(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, buf) < 0) TEST_ERROR
+            if(H5Dclose(did) < 0) TEST_ERROR
+        } /* end for */
+    } /* end for */
+
+    /* close dataspaces */
+    if(H5Sclose(mid) < 0) TEST_ERROR
+    if(H5Sclose(sid) < 0) TEST_ERROR
+
+    /* close the group */
+    if(H5Gclose(gid) < 0) TEST_ERROR
+
+    /* close the SRC file */
+    if(H5Fclose(fid_src) < 0) TEST_ERROR
+
+
+    /* open the source file with read-only */
+    if((fid_src = H5Fopen(src_filename, H5F_ACC_RDONLY, src_fapl)) < 0) TEST_ERROR
+
+    /* Keep one of the datasets open while copying */
+    if(test_open)
+        if((did_open = H5Dopen2(fid_src, NAME_GROUP_TOP "/dataset_1", H5P_DEFAULT)) < 0) TEST_ERROR
+
+    /* create destination file */
+    if((fid_dst = H5Fcreate(dst_filename, H5F_ACC_TRUNC, fcpl_dst, dst_fapl)) < 0) TEST_ERROR
+
+    /* Create an uncopied object in destination file so that addresses in source and destination files aren't the same */
+    if(H5Gclose(H5Gcreate2(fid_dst, NAME_GROUP_UNCOPIED, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+
+    /* copy the group from SRC to DST */
+    if(H5Ocopy(fid_src, NAME_GROUP_TOP, fid_dst, NAME_GROUP_TOP, H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+
+    /* open the group for copy */
+    if((gid = H5Gopen2(fid_src, NAME_GROUP_TOP, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+
+    /* open the destination group */
+    if((gid2 = H5Gopen2(fid_dst, NAME_GROUP_TOP, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+
+    /* Check if the groups are equal */
+    if(compare_groups(gid, gid2, H5P_DEFAULT, -1, 0) != TRUE) TEST_ERROR
+
+    /* close the destination group */
+    if(H5Gclose(gid2) < 0) TEST_ERROR
+
+    /* close the source group */
+    if(H5Gclose(gid) < 0) TEST_ERROR
+
+    /* close the dataset left open */
+    if(test_open)
+        if(H5Dclose(did_open) < 0) TEST_ERROR
+
+    /* close the SRC file */
+    if(H5Fclose(fid_src) < 0) TEST_ERROR
+
+    /* close the DST file */
+    if(H5Fclose(fid_dst) < 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(mid);
+        H5Sclose(sid);
+        H5Pclose(pid);
+        H5Dclose(did);
+        H5Dclose(did_open);
+        H5Gclose(gid2);
+        H5Gclose(gid);
+        H5Fclose(fid_dst);
+        H5Fclose(fid_src);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_copy_group_datasets */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_copy_group_deep
  *
@@ -10077,6 +10249,128 @@ error:
 } /* end test_copy_null_ref_open */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_copy_chunked_ref
+ *
+ * Purpose:     Creates a chunked, filtered dataset of object references.
+ *              Copies it within the same file, where the references are
+ *              copied as they are, and to a new file without expanding
+ *              references, where every chunk holds NULL references.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_copy_chunked_ref(hid_t fcpl_src, hid_t fcpl_dst, hid_t src_fapl, hid_t dst_fapl)
+{
+    hid_t fid_src = -1, fid_dst = -1;           /* File IDs */
+    hid_t sid = -1;                             /* Dataspace ID */
+    hid_t pid = -1;                             /* Dataset creation property list ID */
+    hid_t did = -1, did2 = -1;                  /* Dataset IDs */
+    hid_t oid = -1;                             /* Referenced object ID */
+    hsize_t dim1d[1] = {DIM_SIZE_1 * 10};       /* Dataset dimensions */
+    hsize_t chunk_dim1d[1] = {DIM_SIZE_1};      /* Chunk dimensions */
+    hobj_ref_t obj_buf[DIM_SIZE_1 * 10];        /* Buffer for object refs */
+    hobj_ref_t obj_buf2[DIM_SIZE_1 * 10];       /* Buffer for copied object refs */
+    hobj_ref_t zeros[DIM_SIZE_1 * 10];          /* Array of zeros, for memcmp */
+    unsigned u;                                 /* Local index variable */
+    char src_filename[NAME_BUF_SIZE];
+    char dst_filename[NAME_BUF_SIZE];
+
+    TESTING("H5Ocopy(): chunked dataset with references");
+
+    /* Initialize "zeros" array */
+    HDmemset(zeros, 0, sizeof(zeros));
+
+    /* Initialize the filenames */
+    h5_fixname(FILENAME[0], src_fapl, src_filename, sizeof src_filename);
+    h5_fixname(FILENAME[1], dst_fapl, dst_filename, sizeof dst_filename);
+
+    /* Reset file address checking info */
+    addr_reset();
+
+    /* Create source file */
+    if((fid_src = H5Fcreate(src_filename, H5F_ACC_TRUNC, fcpl_src, src_fapl)) < 0) TEST_ERROR
+
+    /* Create groups to refer to */
+    if((oid = H5Gcreate2(fid_src, NAME_GROUP_TOP, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(oid) < 0) TEST_ERROR
+    if((oid = H5Gcreate2(fid_src, NAME_GROUP_SUB, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(oid) < 0) TEST_ERROR
+
+    /* Create references, alternating between the groups */
+    for(u = 0; u < (unsigned)dim1d[0]; u++)
+        if(H5Rcreate(&obj_buf[u], fid_src, (u % 2) ? NAME_GROUP_SUB : NAME_GROUP_TOP, H5R_OBJECT, (hid_t)-1) < 0) TEST_ERROR
+
+    /* Create dataspace */
+    if((sid = H5Screate_simple(1, dim1d, NULL)) < 0) TEST_ERROR
+
+    /* Set up chunked, filtered dataset */
+    if((pid = H5Pcreate(H5P_DATASET_CREATE)) < 0) TEST_ERROR
+    if(H5Pset_chunk(pid, 1, chunk_dim1d) < 0) TEST_ERROR
+    if(H5Pset_shuffle(pid) < 0) TEST_ERROR
+#ifdef H5_HAVE_FILTER_DEFLATE
+    if(H5Pset_deflate(pid, 9) < 0) TEST_ERROR
+#endif /* H5_HAVE_FILTER_DEFLATE */
+    if(H5Pset_fletcher32(pid) < 0) TEST_ERROR
+
+    /* Create object reference dataset at SRC file */
+    if((did = H5Dcreate2(fid_src, NAME_DATASET_CHUNKED, H5T_STD_REF_OBJ, sid, H5P_DEFAULT, pid, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dwrite(did, H5T_STD_REF_OBJ, H5S_ALL, H5S_ALL, H5P_DEFAULT, obj_buf) < 0) TEST_ERROR
+    if(H5Dclose(did) < 0) TEST_ERROR
+
+    /* Copy the dataset within the source file */
+    if(H5Ocopy(fid_src, NAME_DATASET_CHUNKED, fid_src, NAME_DATASET_CHUNKED2, H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+
+    /* Create destination file */
+    if((fid_dst = H5Fcreate(dst_filename, H5F_ACC_TRUNC, fcpl_dst, dst_fapl)) < 0) TEST_ERROR
+
+    /* Copy the dataset to the destination file, without expanding references */
+    if(H5Ocopy(fid_src, NAME_DATASET_CHUNKED, fid_dst, NAME_DATASET_CHUNKED, H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+
+    /* Verify the references copied within the source file are the same */
+    if((did = H5Dopen2(fid_src, NAME_DATASET_CHUNKED2, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dread(did, H5T_STD_REF_OBJ, H5S_ALL, H5S_ALL, H5P_DEFAULT, obj_buf2) < 0) TEST_ERROR
+    if(HDmemcmp(obj_buf, obj_buf2, sizeof(obj_buf))) TEST_ERROR
+
+    /* Verify the copied references can be dereferenced */
+    if((oid = H5Rdereference2(did, H5P_DEFAULT, H5R_OBJECT, &obj_buf2[1])) < 0) TEST_ERROR
+    if(H5Iget_type(oid) != H5I_GROUP) TEST_ERROR
+    if(H5Gclose(oid) < 0) TEST_ERROR
+    if(H5Dclose(did) < 0) TEST_ERROR
+
+    /* Verify that the references copied to the destination file are NULL */
+    if((did2 = H5Dopen2(fid_dst, NAME_DATASET_CHUNKED, H5P_DEFAULT)) < 0) TEST_ERROR
+    HDmemset(obj_buf2, 0xff, sizeof(obj_buf2));
+    if(H5Dread(did2, H5T_STD_REF_OBJ, H5S_ALL, H5S_ALL, H5P_DEFAULT, obj_buf2) < 0) TEST_ERROR
+    if(HDmemcmp(obj_buf2, zeros, sizeof(obj_buf2))) TEST_ERROR
+    if(H5Dclose(did2) < 0) TEST_ERROR
+
+    /* Close */
+    if(H5Pclose(pid) < 0) TEST_ERROR
+    if(H5Sclose(sid) < 0) TEST_ERROR
+    if(H5Fclose(fid_dst) < 0) TEST_ERROR
+    if(H5Fclose(fid_src) < 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Oclose(oid);
+        H5Dclose(did2);
+        H5Dclose(did);
+        H5Pclose(pid);
+        H5Sclose(sid);
+        H5Fclose(fid_dst);
+        H5Fclose(fid_src);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_copy_chunked_ref */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_copy_attr_crt_order
  *
@@ -14250,6 +14544,8 @@ main(void)
         nerrors += test_copy_group_empty(fcpl_src, fcpl_dst, src_fapl, dst_fapl);
         nerrors += test_copy_root_group(fcpl_src, fcpl_dst, src_fapl, dst_fapl);
         nerrors += test_copy_group(fcpl_src, fcpl_dst, src_fapl, dst_fapl);
+        nerrors += test_copy_group_datasets(fcpl_src, fcpl_dst, src_fapl, dst_fapl, FALSE);
+        nerrors += test_copy_group_datasets(fcpl_src, fcpl_dst, src_fapl, dst_fapl, TRUE);
         nerrors += test_copy_group_deep(fcpl_src, fcpl_dst, src_fapl, dst_fapl);
         nerrors += test_copy_group_loop(fcpl_src, fcpl_dst, src_fapl, dst_fapl);
         nerrors += test_copy_group_wide_loop(fcpl_src, fcpl_dst, src_fapl, dst_fapl);
@@ -14369,6 +14665,7 @@ main(void)
             /* Test with dataset opened in the file or not */
             nerrors += test_copy_null_ref(fcpl_src, fcpl_dst, src_fapl, dst_fapl);
             nerrors += test_copy_null_ref_open(fcpl_src, fcpl_dst, src_fapl, dst_fapl);
+            nerrors += test_copy_chunked_ref(fcpl_src, fcpl_dst, src_fapl, dst_fapl);
 
             nerrors += test_copy_iterate(fcpl_src, fcpl_dst, src_fapl, dst_fapl);
         } /* end if */
@@ -37,6 +37,11 @@ const char *FILENAME[] = {
 /* Definitions for 'large' test */
 #define LARGE_NOBJS             5000
 
+/* Definitions for 'multi' test */
+#define MULTI_NOBJS             200
+#define MULTI_FIRST             4
+#define MULTI_SECOND            40
+
 /* Definitions for 'lifecycle' test */
 #define LIFECYCLE_TOP_GROUP     "top"
 #define LIFECYCLE_BOTTOM_GROUP  "bottom %u"
@@ -70,6 +75,11 @@ const char *FILENAME[] = {
 #define GCPL_ON_ROOT_MAX_COMPACT   4
 #define GCPL_ON_ROOT_MIN_DENSE     2
 
+/* Definitions for 'dense_lookup' test */
+#define DENSE_LOOKUP_GROUP      "dense"
+#define DENSE_LOOKUP_NLINKS     2000
+#define DENSE_LOOKUP_NLINKS2    6000
+
 /* Definitions for 'old_api' test */
 #define OLD_API_GROUP           "/old_api"
 
@@ -298,6 +308,160 @@ test_large(hid_t fcpl, hid_t fapl, hbool_t new_format)
     return 1;
 } /* end test_large() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_multi
+ *
+ * Purpose:     Creates groups and hard links in batches with
+ *              H5Gcreate_multi and H5Lcreate_hard_multi, so that the
+ *              parent goes from empty to compact to dense (w/new group
+ *              format), and checks that the result matches creating them
+ *              one at a time.
+ *
+ * Return:      Success:	0
+ *
+ * 		Failure:	number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_multi(hid_t fcpl, hid_t fapl, hbool_t new_format)
+{
+    hid_t	fid = (-1);             /* File ID */
+    hid_t       gid = (-1), gid2 = (-1); /* Group IDs */
+    hid_t       gcpl = (-1);            /* Group creation property list ID */
+    char	filename[NAME_BUF_SIZE];
+    char        name_buf[MULTI_NOBJS][16];      /* Buffers for group names */
+    char        link_buf[MULTI_NOBJS][16];      /* Buffers for link names */
+    const char *names[MULTI_NOBJS];     /* Group names */
+    const char *cur_names[MULTI_NOBJS]; /* Paths to groups */
+    const char *link_names[MULTI_NOBJS];        /* Link names */
+    char        path_buf[MULTI_NOBJS][24];      /* Buffers for paths to groups */
+    const char *dup_names[3];           /* Names with a duplicate */
+    H5G_info_t  grp_info;               /* Group info */
+    H5O_info_t  oinfo;                  /* Object info */
+    char        name[NAME_BUF_SIZE];    /* Name of link, by index */
+    herr_t      ret;                    /* Generic return value */
+    unsigned    u;                      /* Local index variable */
+
+    if(new_format)
+        TESTING("batch group & link creation (w/new group format)")
+    else
+        TESTING("batch group & link creation")
+
+    for(u = 0; u < MULTI_NOBJS; u++) {
+        HDsprintf(name_buf[u], "g%04u", (MULTI_NOBJS - 1) - u);
+        names[u] = name_buf[u];
+        HDsprintf(path_buf[u], "/multi/%s", name_buf[u]);
+        cur_names[u] = path_buf[u];
+        HDsprintf(link_buf[u], "l%04u", u);
+        link_names[u] = link_buf[u];
+    } /* end for */
+
+    /* Create file */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof(filename));
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl)) < 0) TEST_ERROR
+
+    /* Track & index creation order on the new format parent */
+    if((gcpl = H5Pcreate(H5P_GROUP_CREATE)) < 0) TEST_ERROR
+    if(new_format)
+        if(H5Pset_link_creation_order(gcpl, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) < 0) TEST_ERROR
+    if((gid = H5Gcreate2(fid, "multi", H5P_DEFAULT, gcpl, H5P_DEFAULT)) < 0) TEST_ERROR
+
+    /* Create a few groups, which fit in compact form */
+    if(H5Gcreate_multi(fid, "multi", (size_t)MULTI_FIRST, names, H5P_DEFAULT) < 0) TEST_ERROR
+    if(new_format)
+        if(H5G__is_new_dense_test(gid) != FALSE) TEST_ERROR
+
+    /* Create enough to convert the group to dense form */
+    if(H5Gcreate_multi(gid, ".", (size_t)(MULTI_SECOND - MULTI_FIRST), &names[MULTI_FIRST], H5P_DEFAULT) < 0) TEST_ERROR
+    if(new_format)
+        if(H5G__is_new_dense_test(gid) != TRUE) TEST_ERROR
+
+    /* Add the rest to the dense group */
+    if(H5Gcreate_multi(fid, "/multi", (size_t)(MULTI_NOBJS - MULTI_SECOND), &names[MULTI_SECOND], H5P_DEFAULT) < 0) TEST_ERROR
+
+    /* Duplicate names in a batch and names that exist already fail,
+     * without creating anything */
+    dup_names[0] = "new1";
+    dup_names[1] = "new2";
+    dup_names[2] = "new1";
+    H5E_BEGIN_TRY {
+        ret = H5Gcreate_multi(gid, ".", (size_t)3, dup_names, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    dup_names[2] = names[MULTI_NOBJS / 2];
+    H5E_BEGIN_TRY {
+        ret = H5Gcreate_multi(gid, ".", (size_t)3, dup_names, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    dup_names[2] = "a/b";
+    H5E_BEGIN_TRY {
+        ret = H5Gcreate_multi(gid, ".", (size_t)3, dup_names, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    if(H5Gget_info(gid, &grp_info) < 0) TEST_ERROR
+    if(grp_info.nlinks != MULTI_NOBJS) TEST_ERROR
+
+    /* Check the groups, by name and in creation order */
+    for(u = 0; u < MULTI_NOBJS; u++) {
+        if((gid2 = H5Gopen2(gid, names[u], H5P_DEFAULT)) < 0) TEST_ERROR
+        if(H5Gget_info(gid2, &grp_info) < 0) TEST_ERROR
+        if(grp_info.nlinks != 0) TEST_ERROR
+        if(H5Gclose(gid2) < 0) TEST_ERROR
+        if(H5Oget_info_by_name2(gid, names[u], &oinfo, H5O_INFO_BASIC, H5P_DEFAULT) < 0) TEST_ERROR
+        if(oinfo.rc != 1) TEST_ERROR
+
+        if(new_format) {
+            if(H5Lget_name_by_idx(gid, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, (hsize_t)u, name, (size_t)NAME_BUF_SIZE, H5P_DEFAULT) < 0) TEST_ERROR
+            if(HDstrcmp(name, names[u])) TEST_ERROR
+        } /* end if */
+    } /* end for */
+
+    /* Link to all the groups from another group, in one batch */
+    if((gid2 = H5Gcreate2(fid, "links", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Lcreate_hard_multi(fid, (size_t)MULTI_NOBJS, cur_names, H5L_SAME_LOC, "links", link_names) < 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Lcreate_hard_multi(fid, (size_t)1, cur_names, fid, "links", link_names);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    if(H5Gget_info(gid2, &grp_info) < 0) TEST_ERROR
+    if(grp_info.nlinks != MULTI_NOBJS) TEST_ERROR
+    if(new_format)
+        if(H5G__is_new_dense_test(gid2) != TRUE) TEST_ERROR
+    for(u = 0; u < MULTI_NOBJS; u++) {
+        if(H5Oget_info_by_name2(gid2, link_names[u], &oinfo, H5O_INFO_BASIC, H5P_DEFAULT) < 0) TEST_ERROR
+        if(oinfo.rc != 2) TEST_ERROR
+        if(H5Oget_info_by_name2(gid, names[u], &oinfo, H5O_INFO_BASIC, H5P_DEFAULT) < 0) TEST_ERROR
+        if(oinfo.rc != 2) TEST_ERROR
+    } /* end for */
+    if(H5Gclose(gid2) < 0) TEST_ERROR
+
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if(H5Pclose(gcpl) < 0) TEST_ERROR
+
+    /* Close file & check that the groups are still there when it's reopened */
+    if(H5Fclose(fid) < 0) TEST_ERROR
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0) TEST_ERROR
+    if(H5Gget_info_by_name(fid, "multi", &grp_info, H5P_DEFAULT) < 0) TEST_ERROR
+    if(grp_info.nlinks != MULTI_NOBJS) TEST_ERROR
+    for(u = 0; u < MULTI_NOBJS; u++)
+        if(H5Lexists(fid, cur_names[u], H5P_DEFAULT) != TRUE) TEST_ERROR
+    if(H5Fclose(fid) < 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+ error:
+    H5E_BEGIN_TRY {
+	H5Gclose(gid2);
+	H5Gclose(gid);
+	H5Pclose(gcpl);
+    	H5Fclose(fid);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    lifecycle
@@ -972,6 +1136,92 @@ error:
     return 1;
 } /* end gcpl_on_root() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    dense_lookup
+ *
+ * Purpose:     Test looking up names that are and aren't in a large group
+ *              with dense link storage, as links are added to and removed
+ *              from the group after it has been searched.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+dense_lookup(hid_t fcpl, hid_t fapl2)
+{
+    hid_t	fid = (-1);             /* File ID */
+    hid_t	gid = (-1);             /* Group ID */
+    char	filename[NAME_BUF_SIZE];
+    char        name[NAME_BUF_SIZE];    /* Link name */
+    unsigned    u;                      /* Local index variable */
+
+    TESTING("looking up names in large dense groups");
+
+    /* Create file & group */
+    h5_fixname(FILENAME[0], fapl2, filename, sizeof(filename));
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl2)) < 0) TEST_ERROR
+    if((gid = H5Gcreate2(fid, DENSE_LOOKUP_GROUP, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+
+    /* Add links for the even numbers */
+    for(u = 0; u < DENSE_LOOKUP_NLINKS; u += 2) {
+        HDsprintf(name, "link %u", u);
+        if(H5Lcreate_soft("/", gid, name, H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+    } /* end for */
+    if(H5G__is_new_dense_test(gid) != TRUE) TEST_ERROR
+
+    /* Look up the even & odd numbers */
+    for(u = 0; u < DENSE_LOOKUP_NLINKS; u++) {
+        HDsprintf(name, "link %u", u);
+        if(H5Lexists(gid, name, H5P_DEFAULT) != ((u % 2) == 0)) TEST_ERROR
+    } /* end for */
+
+    /* Add links for the odd numbers, then more than the group had before */
+    for(u = 1; u < DENSE_LOOKUP_NLINKS2; u++) {
+        if(u < DENSE_LOOKUP_NLINKS && (u % 2) == 0)
+            continue;
+        HDsprintf(name, "link %u", u);
+        if(H5Lcreate_soft("/", gid, name, H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+        if(H5Lexists(gid, name, H5P_DEFAULT) != TRUE) TEST_ERROR
+    } /* end for */
+
+    /* Remove the links for the multiples of 3 */
+    for(u = 0; u < DENSE_LOOKUP_NLINKS2; u += 3) {
+        HDsprintf(name, "link %u", u);
+        if(H5Ldelete(gid, name, H5P_DEFAULT) < 0) TEST_ERROR
+    } /* end for */
+
+    /* Close the group & file, then look up all the names in each */
+    for(u = 0; u < 2; u++) {
+        unsigned v;                     /* Local index variable */
+
+        for(v = 0; v < DENSE_LOOKUP_NLINKS2 + 10; v++) {
+            HDsprintf(name, "link %u", v);
+            if(H5Lexists(gid, name, H5P_DEFAULT) != (v < DENSE_LOOKUP_NLINKS2 && (v % 3) != 0)) TEST_ERROR
+        } /* end for */
+
+        if(H5Gclose(gid) < 0) TEST_ERROR
+        if(H5Fclose(fid) < 0) TEST_ERROR
+        if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl2)) < 0) TEST_ERROR
+        if((gid = H5Gopen2(fid, DENSE_LOOKUP_GROUP, H5P_DEFAULT)) < 0) TEST_ERROR
+    } /* end for */
+
+    if(H5Gclose(gid) < 0) TEST_ERROR
+    if(H5Fclose(fid) < 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+    	H5Gclose(gid);
+    	H5Fclose(fid);
+    } H5E_END_TRY;
+    return 1;
+} /* end dense_lookup() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    old_api
@@ -1214,6 +1464,7 @@ main(void)
         nerrors += test_misc(my_fcpl, my_fapl, new_format);
         nerrors += test_long(my_fcpl, my_fapl, new_format);
         nerrors += test_large(my_fcpl, my_fapl, new_format);
+        nerrors += test_multi(my_fcpl, my_fapl, new_format);
     } /* end for */
 
     /* New format group specific tests (require new format features) */
@@ -1223,6 +1474,7 @@ main(void)
         nerrors += read_old();
         nerrors += no_compact(fcpl2, fapl2);
         nerrors += gcpl_on_root(fapl2);
+        nerrors += dense_lookup(fcpl2, fapl2);
     }
 
     /* Old group API specific tests */
@@ -11125,6 +11125,185 @@ test_attr_delete_last_dense(hid_t fcpl, hid_t fapl)
 
 }   /* test_attr_delete_last_dense() */
 
+/* Number of attributes on the object for test_attr_lookup_cache() */
+#define LOOKUP_CACHE_NATTRS     100
+
+/****************************************************************
+**
+**  test_attr_lookup_cache_delete_cb(): Iteration callback that
+**      deletes each attribute as it's visited.
+**
+****************************************************************/
+static herr_t
+test_attr_lookup_cache_delete_cb(hid_t loc_id, const char *name,
+    const H5A_info_t H5_ATTR_UNUSED *ainfo, void *op_data)
+{
+    unsigned *count = (unsigned *)op_data;
+
+    (*count)++;
+
+    return(H5Adelete(loc_id, name) < 0 ? H5_ITER_ERROR : H5_ITER_CONT);
+} /* end test_attr_lookup_cache_delete_cb() */
+
+/****************************************************************
+**
+**  test_attr_lookup_cache(): Test looking up attributes by name
+**      and by index repeatedly, as the attributes are modified,
+**      on an object with many attributes.
+**
+****************************************************************/
+static void
+test_attr_lookup_cache(hbool_t new_format, hid_t fcpl, hid_t fapl)
+{
+    hid_t fid;          /* File ID */
+    hid_t gid;          /* Group ID */
+    hid_t gcpl;         /* Group creation property list ID */
+    hid_t sid;          /* Dataspace ID */
+    hid_t aid;          /* Attribute ID */
+    char attrname[NAME_BUF_SIZE];   /* Name of attribute */
+    char tmpname[NAME_BUF_SIZE];    /* Name of attribute, from library */
+    unsigned count;     /* # of attributes visited */
+    unsigned u, v;      /* Local index variables */
+    int value;          /* Attribute value */
+    htri_t is_present;  /* Whether an attribute is present */
+    ssize_t name_len;   /* Length of attribute name */
+    herr_t ret;         /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Looking Up Attributes Repeatedly\n"));
+
+    /* Create file */
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    /* Track & index creation order, when the file format allows */
+    gcpl = H5Pcreate(H5P_GROUP_CREATE);
+    CHECK(gcpl, FAIL, "H5Pcreate");
+    if(new_format) {
+        ret = H5Pset_attr_creation_order(gcpl, H5P_CRT_ORDER_TRACKED);
+        CHECK(ret, FAIL, "H5Pset_attr_creation_order");
+    } /* end if */
+
+    gid = H5Gcreate2(fid, GRPNAME, H5P_DEFAULT, gcpl, H5P_DEFAULT);
+    CHECK(gid, FAIL, "H5Gcreate2");
+
+    sid = H5Screate(H5S_SCALAR);
+    CHECK(sid, FAIL, "H5Screate");
+
+    /* Create attributes in the reverse of name order */
+    for(u = 0; u < LOOKUP_CACHE_NATTRS; u++) {
+        HDsprintf(attrname, "attr %04u", LOOKUP_CACHE_NATTRS - 1 - u);
+        aid = H5Acreate2(gid, attrname, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(aid, FAIL, "H5Acreate2");
+        value = (int)(LOOKUP_CACHE_NATTRS - 1 - u);
+        ret = H5Awrite(aid, H5T_NATIVE_INT, &value);
+        CHECK(ret, FAIL, "H5Awrite");
+        ret = H5Aclose(aid);
+        CHECK(ret, FAIL, "H5Aclose");
+    } /* end for */
+
+    /* Look up each attribute by name a few times */
+    for(v = 0; v < 3; v++)
+        for(u = 0; u < LOOKUP_CACHE_NATTRS; u++) {
+            HDsprintf(attrname, "attr %04u", u);
+            is_present = H5Aexists(gid, attrname);
+            VERIFY(is_present, TRUE, "H5Aexists");
+
+            aid = H5Aopen(gid, attrname, H5P_DEFAULT);
+            CHECK(aid, FAIL, "H5Aopen");
+            ret = H5Aread(aid, H5T_NATIVE_INT, &value);
+            CHECK(ret, FAIL, "H5Aread");
+            VERIFY(value, (int)u, "H5Aread");
+            ret = H5Aclose(aid);
+            CHECK(ret, FAIL, "H5Aclose");
+        } /* end for */
+
+    /* Look up attributes that don't exist */
+    is_present = H5Aexists(gid, "attr");
+    VERIFY(is_present, FALSE, "H5Aexists");
+    H5E_BEGIN_TRY {
+        aid = H5Aopen(gid, "attr 9999", H5P_DEFAULT);
+    } H5E_END_TRY;
+    VERIFY(aid, FAIL, "H5Aopen");
+
+    /* Check the attributes by index, in name order */
+    for(u = 0; u < LOOKUP_CACHE_NATTRS; u++) {
+        HDsprintf(attrname, "attr %04u", u);
+        name_len = H5Aget_name_by_idx(gid, ".", H5_INDEX_NAME, H5_ITER_INC, (hsize_t)u, tmpname, (size_t)NAME_BUF_SIZE, H5P_DEFAULT);
+        CHECK(name_len, FAIL, "H5Aget_name_by_idx");
+        VERIFY_STR(tmpname, attrname, "H5Aget_name_by_idx");
+
+        name_len = H5Aget_name_by_idx(gid, ".", H5_INDEX_NAME, H5_ITER_DEC, (hsize_t)(LOOKUP_CACHE_NATTRS - 1 - u), tmpname, (size_t)NAME_BUF_SIZE, H5P_DEFAULT);
+        CHECK(name_len, FAIL, "H5Aget_name_by_idx");
+        VERIFY_STR(tmpname, attrname, "H5Aget_name_by_idx");
+    } /* end for */
+
+    /* Check the attributes by index, in creation order */
+    if(new_format)
+        for(u = 0; u < LOOKUP_CACHE_NATTRS; u++) {
+            HDsprintf(attrname, "attr %04u", u);
+            name_len = H5Aget_name_by_idx(gid, ".", H5_INDEX_CRT_ORDER, H5_ITER_DEC, (hsize_t)u, tmpname, (size_t)NAME_BUF_SIZE, H5P_DEFAULT);
+            CHECK(name_len, FAIL, "H5Aget_name_by_idx");
+            VERIFY_STR(tmpname, attrname, "H5Aget_name_by_idx");
+        } /* end for */
+
+    /* Change the attributes, and check that lookups see the changes */
+    ret = H5Adelete(gid, "attr 0010");
+    CHECK(ret, FAIL, "H5Adelete");
+    is_present = H5Aexists(gid, "attr 0010");
+    VERIFY(is_present, FALSE, "H5Aexists");
+
+    ret = H5Arename(gid, "attr 0020", "attr 0010");
+    CHECK(ret, FAIL, "H5Arename");
+    is_present = H5Aexists(gid, "attr 0020");
+    VERIFY(is_present, FALSE, "H5Aexists");
+
+    aid = H5Aopen(gid, "attr 0030", H5P_DEFAULT);
+    CHECK(aid, FAIL, "H5Aopen");
+    value = -30;
+    ret = H5Awrite(aid, H5T_NATIVE_INT, &value);
+    CHECK(ret, FAIL, "H5Awrite");
+    ret = H5Aclose(aid);
+    CHECK(ret, FAIL, "H5Aclose");
+
+    aid = H5Aopen(gid, "attr 0010", H5P_DEFAULT);
+    CHECK(aid, FAIL, "H5Aopen");
+    ret = H5Aread(aid, H5T_NATIVE_INT, &value);
+    CHECK(ret, FAIL, "H5Aread");
+    VERIFY(value, 20, "H5Aread");
+    ret = H5Aclose(aid);
+    CHECK(ret, FAIL, "H5Aclose");
+
+    aid = H5Aopen_by_idx(gid, ".", H5_INDEX_NAME, H5_ITER_INC, (hsize_t)29, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(aid, FAIL, "H5Aopen_by_idx");
+    name_len = H5Aget_name(aid, (size_t)NAME_BUF_SIZE, tmpname);
+    CHECK(name_len, FAIL, "H5Aget_name");
+    VERIFY_STR(tmpname, "attr 0030", "H5Aget_name");
+    ret = H5Aread(aid, H5T_NATIVE_INT, &value);
+    CHECK(ret, FAIL, "H5Aread");
+    VERIFY(value, -30, "H5Aread");
+    ret = H5Aclose(aid);
+    CHECK(ret, FAIL, "H5Aclose");
+
+    /* Delete all the attributes while iterating over them */
+    count = 0;
+    ret = H5Aiterate2(gid, H5_INDEX_NAME, H5_ITER_DEC, NULL, test_attr_lookup_cache_delete_cb, &count);
+    CHECK(ret, FAIL, "H5Aiterate2");
+    VERIFY(count, LOOKUP_CACHE_NATTRS - 1, "H5Aiterate2");
+    is_present = H5Aexists(gid, "attr 0050");
+    VERIFY(is_present, FALSE, "H5Aexists");
+
+    /* Close IDs */
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Gclose(gid);
+    CHECK(ret, FAIL, "H5Gclose");
+    ret = H5Pclose(gcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+}   /* test_attr_lookup_cache() */
+
 /****************************************************************
 **
 **  test_attr(): Main H5A (attribute) testing routine.
@@ -11242,6 +11421,7 @@ test_attr(void)
                 test_attr_open_by_idx(new_format, my_fcpl, my_fapl);    /* Test opening attributes by index */
                 test_attr_open_by_name(new_format, my_fcpl, my_fapl);   /* Test opening attributes by name */
                 test_attr_create_by_name(new_format, my_fcpl, my_fapl); /* Test creating attributes by name */
+                test_attr_lookup_cache(new_format, my_fcpl, my_fapl);   /* Test looking up attributes repeatedly */
 
                 /* Tests that address specific bugs
                  */
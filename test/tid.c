@@ -727,6 +727,157 @@ out:
     return -1;
 } /* end test_remove_clear_type() */
 
+/*
+ * Test that lots of IDs of one type can be registered, looked up, removed
+ * and iterated over, in increasing order of ID.
+ */
+/* Macro definitions */
+#define TEST_MANY_NIDS 100000
+
+/* Iteration callback, checking that IDs are visited in increasing order */
+static herr_t test_many_ids_cb(hid_t id, void *_last_id) {
+    hid_t *last_id = (hid_t *)_last_id;
+
+    if(id <= *last_id)
+        return -1;
+    *last_id = id;
+
+    return 0;
+} /* end test_many_ids_cb() */
+
+/* Test function */
+static int test_many_ids(void)
+{
+    H5I_type_t obj_type = H5I_BADID;
+    hid_t *ids = NULL;
+    long *objs = NULL;
+    hid_t last_id;
+    hsize_t nmembers;
+    void *obj;
+    long i;
+    herr_t  ret;        /* return value */
+
+    /* Register type */
+    obj_type = H5Iregister_type((size_t)0, 0, NULL);
+    CHECK(obj_type, H5I_BADID, "H5Iregister_type");
+    if(obj_type == H5I_BADID)
+        goto out;
+
+    ids = (hid_t *)HDmalloc(TEST_MANY_NIDS * sizeof(hid_t));
+    CHECK_PTR(ids, "HDmalloc");
+    objs = (long *)HDmalloc(TEST_MANY_NIDS * sizeof(long));
+    CHECK_PTR(objs, "HDmalloc");
+    if(NULL == ids || NULL == objs)
+        goto out;
+
+    /* Register the objects */
+    for(i = 0; i < TEST_MANY_NIDS; i++) {
+        objs[i] = i;
+        ids[i] = H5Iregister(obj_type, &objs[i]);
+        CHECK(ids[i], FAIL, "H5Iregister");
+        if(ids[i] == FAIL)
+            goto out;
+    } /* end for */
+
+    /* Look up the objects */
+    for(i = 0; i < TEST_MANY_NIDS; i++) {
+        obj = H5Iobject_verify(ids[i], obj_type);
+        if(obj != &objs[i]) {
+            ERROR("H5Iobject_verify");
+            goto out;
+        } /* end if */
+    } /* end for */
+
+    /* Remove every other ID */
+    for(i = 0; i < TEST_MANY_NIDS; i += 2) {
+        obj = H5Iremove_verify(ids[i], obj_type);
+        if(obj != &objs[i]) {
+            ERROR("H5Iremove_verify");
+            goto out;
+        } /* end if */
+    } /* end for */
+    ret = H5Inmembers(obj_type, &nmembers);
+    CHECK(ret, FAIL, "H5Inmembers");
+    if(ret == FAIL)
+        goto out;
+    VERIFY(nmembers, (hsize_t)(TEST_MANY_NIDS / 2), "H5Inmembers");
+    if(nmembers != (hsize_t)(TEST_MANY_NIDS / 2))
+        goto out;
+
+    /* Check that only the remaining IDs are found */
+    for(i = 0; i < TEST_MANY_NIDS; i++) {
+        H5E_BEGIN_TRY
+            obj = H5Iobject_verify(ids[i], obj_type);
+        H5E_END_TRY
+        if(obj != ((i % 2) ? &objs[i] : NULL)) {
+            ERROR("H5Iobject_verify");
+            goto out;
+        } /* end if */
+    } /* end for */
+
+    /* Register the removed objects again */
+    for(i = 0; i < TEST_MANY_NIDS; i += 2) {
+        ids[i] = H5Iregister(obj_type, &objs[i]);
+        CHECK(ids[i], FAIL, "H5Iregister");
+        if(ids[i] == FAIL)
+            goto out;
+    } /* end for */
+
+    /* Look up the objects */
+    for(i = 0; i < TEST_MANY_NIDS; i++) {
+        obj = H5Iobject_verify(ids[i], obj_type);
+        if(obj != &objs[i]) {
+            ERROR("H5Iobject_verify");
+            goto out;
+        } /* end if */
+    } /* end for */
+
+    /* Iterate over the IDs */
+    last_id = H5I_INVALID_HID;
+    ret = H5Iiterate(obj_type, test_many_ids_cb, &last_id);
+    CHECK(ret, FAIL, "H5Iiterate");
+    if(ret == FAIL)
+        goto out;
+    VERIFY(last_id, ids[TEST_MANY_NIDS - 2], "H5Iiterate");
+    if(last_id != ids[TEST_MANY_NIDS - 2])
+        goto out;
+
+    /* Clear the type */
+    ret = H5Iclear_type(obj_type, FALSE);
+    CHECK(ret, FAIL, "H5Iclear_type");
+    if(ret == FAIL)
+        goto out;
+    ret = H5Inmembers(obj_type, &nmembers);
+    CHECK(ret, FAIL, "H5Inmembers");
+    if(ret == FAIL)
+        goto out;
+    VERIFY(nmembers, (hsize_t)0, "H5Inmembers");
+    if(nmembers != (hsize_t)0)
+        goto out;
+
+    /* Destroy type */
+    ret = H5Idestroy_type(obj_type);
+    CHECK(ret, FAIL, "H5Idestroy_type");
+    if(ret == FAIL)
+        goto out;
+
+    HDfree(ids);
+    HDfree(objs);
+
+    return 0;
+
+out:
+    /* Cleanup.  For simplicity, just destroy the type and ignore errors. */
+    H5E_BEGIN_TRY
+        H5Idestroy_type(obj_type);
+    H5E_END_TRY
+    if(ids)
+        HDfree(ids);
+    if(objs)
+        HDfree(objs);
+    return -1;
+} /* end test_many_ids() */
+
 void test_ids(void)
 {
     /* Set the random # seed */
@@ -738,5 +889,6 @@ void test_ids(void)
     if (test_get_type() < 0) TestErrPrintf("H5Iget_type test failed\n");
     if (test_id_type_list() < 0) TestErrPrintf("ID type list test failed\n");
     if (test_remove_clear_type() < 0) TestErrPrintf("ID remove during H5Iclear_type test failed\n");
+    if (test_many_ids() < 0) TestErrPrintf("Many IDs test failed\n");
 
 }
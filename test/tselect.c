@@ -167,6 +167,25 @@
 #define SPACE13_DIM3    50
 #define SPACE13_NPOINTS 4
 
+/* Information for test of hyperslab selections with many blocks */
+#define SPACE14_RANK	2
+#define SPACE14_DIM1    100
+#define SPACE14_DIM2    4000
+#define SPACE14_NBLOCKS_PER_ROW 1000
+
+/* Information for test of re-using sequences for moved hyperslab selections */
+#define SPACE15_RANK	2
+#define SPACE15_DIM1    20
+#define SPACE15_DIM2    24
+
+/* Information for test of reading scattered point selections */
+#define SPACE16_RANK	2
+#define SPACE16_DIM1    100
+#define SPACE16_DIM2    120
+#define SPACE16_CHUNK1  10
+#define SPACE16_CHUNK2  12
+#define SPACE16_NPOINTS 2000
+
 
 /* Location comparison function */
 static int compare_size_t(const void *s1, const void *s2);
@@ -13593,6 +13612,435 @@ test_hyper_unlim(void)
     CHECK(ret, FAIL, "H5Sclose");
 } /* end test_hyper_unlim() */
 
+/****************************************************************
+**
+**  test_select_hyper_many_blocks(): Tests building an irregular
+**      hyperslab selection by OR'ing many single-element blocks
+**      together, which stresses the allocation of hyperslab span
+**      trees.  Reports the time taken at higher verbosity levels.
+**
+****************************************************************/
+static void
+test_select_hyper_many_blocks(void)
+{
+    hid_t sid, copy_sid;    /* Dataspace IDs */
+    const hsize_t dims[SPACE14_RANK] = {SPACE14_DIM1, SPACE14_DIM2};    /* Dataspace dimensions */
+    hsize_t start[SPACE14_RANK];        /* The start of the hyperslab */
+    hsize_t count[SPACE14_RANK];        /* The number of blocks for the hyperslab */
+    H5_timer_t timer, total_timer;      /* Timers for building the selection */
+    hssize_t npoints;                   /* Number of elements selected */
+    hssize_t nblocks;                   /* Number of blocks selected */
+    unsigned u, v;                      /* Local index variables */
+    herr_t ret;                         /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing hyperslab selections with many blocks\n"));
+
+    /* Create dataspace */
+    sid = H5Screate_simple(SPACE14_RANK, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+
+    /* Start with nothing selected */
+    ret = H5Sselect_none(sid);
+    CHECK(ret, FAIL, "H5Sselect_none");
+
+    /* OR in single elements, staggered between rows so that neither rows
+     *  nor blocks can be merged together.
+     */
+    H5_timer_reset(&total_timer);
+    H5_timer_begin(&timer);
+    count[0] = count[1] = 1;
+    for(u = 0; u < SPACE14_DIM1; u++)
+        for(v = 0; v < SPACE14_NBLOCKS_PER_ROW; v++) {
+            start[0] = u;
+            start[1] = (2 * v) + (u % 2);
+            ret = H5Sselect_hyperslab(sid, H5S_SELECT_OR, start, NULL, count, NULL);
+            CHECK(ret, FAIL, "H5Sselect_hyperslab");
+        } /* end for */
+    H5_timer_end(&total_timer, &timer);
+    if(VERBOSE_MED)
+        HDfprintf(stdout, "\tOR'ing %u blocks: %.3f s\n", (unsigned)(SPACE14_DIM1 * SPACE14_NBLOCKS_PER_ROW), total_timer.etime);
+
+    /* Verify the selection */
+    npoints = H5Sget_select_npoints(sid);
+    VERIFY(npoints, SPACE14_DIM1 * SPACE14_NBLOCKS_PER_ROW, "H5Sget_select_npoints");
+    nblocks = H5Sget_select_hyper_nblocks(sid);
+    VERIFY(nblocks, SPACE14_DIM1 * SPACE14_NBLOCKS_PER_ROW, "H5Sget_select_hyper_nblocks");
+
+    /* Copy the selection & make certain the copy is the same */
+    copy_sid = H5Scopy(sid);
+    CHECK(copy_sid, FAIL, "H5Scopy");
+    nblocks = H5Sget_select_hyper_nblocks(copy_sid);
+    VERIFY(nblocks, SPACE14_DIM1 * SPACE14_NBLOCKS_PER_ROW, "H5Sget_select_hyper_nblocks");
+
+    /* Remove every other row from the copy, then release the original */
+    for(u = 0; u < SPACE14_DIM1; u += 2) {
+        start[0] = u;
+        start[1] = 0;
+        count[0] = 1;
+        count[1] = SPACE14_DIM2;
+        ret = H5Sselect_hyperslab(copy_sid, H5S_SELECT_NOTB, start, NULL, count, NULL);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    } /* end for */
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    nblocks = H5Sget_select_hyper_nblocks(copy_sid);
+    VERIFY(nblocks, (SPACE14_DIM1 / 2) * SPACE14_NBLOCKS_PER_ROW, "H5Sget_select_hyper_nblocks");
+
+    ret = H5Sclose(copy_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+}   /* test_select_hyper_many_blocks() */
+
+/****************************************************************
+**
+**  test_select_hyper_seq_cache_check(): Reads the elements in a
+**      file selection & verifies them against the coordinates
+**      expected for the elements, which have the same shape.
+**
+****************************************************************/
+static void
+test_select_hyper_seq_cache_check(hid_t dset, hid_t file_sid, hid_t mem_sid,
+    const hsize_t *start, const hsize_t *stride, const hsize_t *count,
+    const hsize_t *block)
+{
+    unsigned rbuf[SPACE15_DIM1 * SPACE15_DIM2];     /* Buffer for reading data */
+    unsigned *tbuf;             /* Pointer into read buffer */
+    hsize_t u, v, w, x;         /* Local index variables */
+    herr_t ret;                 /* Generic return value */
+
+    /* Read the selection */
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    ret = H5Dread(dset, H5T_NATIVE_UINT, mem_sid, file_sid, H5P_DEFAULT, rbuf);
+    CHECK(ret, FAIL, "H5Dread");
+
+    /* Verify the elements, in the order they are selected */
+    tbuf = rbuf;
+    for(u = 0; u < count[0]; u++)
+        for(v = 0; v < block[0]; v++)
+            for(w = 0; w < count[1]; w++)
+                for(x = 0; x < block[1]; x++) {
+                    unsigned expected = (unsigned)(((start[0] + (u * stride[0]) + v) * SPACE15_DIM2) + start[1] + (w * stride[1]) + x);
+
+                    if(*tbuf != expected)
+                        TestErrPrintf("Error! rbuf=%u, expected=%u\n", *tbuf, expected);
+                    tbuf++;
+                } /* end for */
+} /* test_select_hyper_seq_cache_check() */
+
+/****************************************************************
+**
+**  test_select_hyper_seq_cache(): Tests reading through selections
+**      that are moved around a dataspace, which re-uses the I/O
+**      sequences generated for the first read of the selection.
+**
+****************************************************************/
+static void
+test_select_hyper_seq_cache(void)
+{
+    hid_t fid;                  /* File ID */
+    hid_t dset;                 /* Dataset ID */
+    hid_t sid;                  /* Dataspace ID */
+    hid_t mem_sid;              /* Memory dataspace ID */
+    const hsize_t dims[SPACE15_RANK] = {SPACE15_DIM1, SPACE15_DIM2};    /* Dataspace dimensions */
+    hsize_t mem_dims[1] = {SPACE15_DIM1 * SPACE15_DIM2};    /* Memory dataspace dimensions */
+    hsize_t start[SPACE15_RANK];        /* The start of the hyperslab */
+    hsize_t stride[SPACE15_RANK];       /* The stride between block starts for the hyperslab */
+    hsize_t count[SPACE15_RANK];        /* The number of blocks for the hyperslab */
+    hsize_t block[SPACE15_RANK];        /* The size of each block for the hyperslab */
+    hsize_t mem_start[1];               /* The start of the memory hyperslab */
+    hsize_t mem_count[1];               /* The number of elements in the memory hyperslab */
+    hssize_t offset[SPACE15_RANK];      /* Selection offset */
+    unsigned *wbuf;             /* Buffer for writing data */
+    unsigned u;                 /* Local index variable */
+    herr_t ret;                 /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing re-using sequences for moved hyperslab selections\n"));
+
+    /* Create & write a dataset whose elements hold their linear offsets */
+    wbuf = (unsigned *)HDmalloc(sizeof(unsigned) * SPACE15_DIM1 * SPACE15_DIM2);
+    CHECK(wbuf, NULL, "HDmalloc");
+    for(u = 0; u < SPACE15_DIM1 * SPACE15_DIM2; u++)
+        wbuf[u] = u;
+
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fcreate");
+    sid = H5Screate_simple(SPACE15_RANK, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    dset = H5Dcreate2(fid, SPACE1_NAME, H5T_NATIVE_UINT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dset, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(dset, H5T_NATIVE_UINT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    mem_sid = H5Screate_simple(1, mem_dims, NULL);
+    CHECK(mem_sid, FAIL, "H5Screate_simple");
+
+    /* Read a regular selection from many different locations */
+    stride[0] = 3; stride[1] = 4;
+    count[0] = 4; count[1] = 3;
+    block[0] = 2; block[1] = 3;
+    mem_start[0] = 0;
+    mem_count[0] = count[0] * block[0] * count[1] * block[1];
+    ret = H5Sselect_hyperslab(mem_sid, H5S_SELECT_SET, mem_start, NULL, mem_count, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    for(start[0] = 0; start[0] < 10; start[0]++)
+        for(start[1] = 0; start[1] < 14; start[1] += 3) {
+            ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, block);
+            CHECK(ret, FAIL, "H5Sselect_hyperslab");
+            test_select_hyper_seq_cache_check(dset, sid, mem_sid, start, stride, count, block);
+        } /* end for */
+
+    /* Change the shape of the selection */
+    start[0] = 1; start[1] = 2;
+    count[1] = 2;
+    mem_count[0] = count[0] * block[0] * count[1] * block[1];
+    ret = H5Sselect_hyperslab(mem_sid, H5S_SELECT_SET, mem_start, NULL, mem_count, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    test_select_hyper_seq_cache_check(dset, sid, mem_sid, start, stride, count, block);
+
+    /* Move the selection with an offset */
+    offset[0] = 5; offset[1] = 7;
+    ret = H5Soffset_simple(sid, offset);
+    CHECK(ret, FAIL, "H5Soffset_simple");
+    start[0] += 5; start[1] += 7;
+    test_select_hyper_seq_cache_check(dset, sid, mem_sid, start, stride, count, block);
+    offset[0] = 0; offset[1] = 0;
+    ret = H5Soffset_simple(sid, offset);
+    CHECK(ret, FAIL, "H5Soffset_simple");
+    start[0] -= 5; start[1] -= 7;
+    test_select_hyper_seq_cache_check(dset, sid, mem_sid, start, stride, count, block);
+
+    /* Turn the selection into an irregular one, by adding another block,
+     *  and read it twice, moving it with an offset in between.
+     */
+    start[0] = 0; start[1] = 0;
+    count[0] = count[1] = 1;
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_OR, start, NULL, count, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    mem_count[0] = (hsize_t)H5Sget_select_npoints(sid);
+    VERIFY(mem_count[0], 4 * 2 * 2 * 3 + 1, "H5Sget_select_npoints");
+    ret = H5Sselect_hyperslab(mem_sid, H5S_SELECT_SET, mem_start, NULL, mem_count, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    for(u = 0; u < 3; u++) {
+        unsigned rbuf[SPACE15_DIM1 * SPACE15_DIM2];     /* Buffer for reading data */
+        unsigned v, w, x, y;            /* Local index variables */
+
+        offset[0] = (hssize_t)u; offset[1] = (hssize_t)u;
+        ret = H5Soffset_simple(sid, offset);
+        CHECK(ret, FAIL, "H5Soffset_simple");
+
+        ret = H5Dread(dset, H5T_NATIVE_UINT, mem_sid, sid, H5P_DEFAULT, rbuf);
+        CHECK(ret, FAIL, "H5Dread");
+
+        /* Single element block comes first */
+        VERIFY(rbuf[0], (u * SPACE15_DIM2) + u, "H5Dread");
+
+        /* Then the rows of the regular blocks */
+        x = 1;
+        for(v = 0; v < 4; v++)
+            for(w = 0; w < 2; w++)
+                for(y = 0; y < 2 * 3; y++) {
+                    unsigned row = 1 + u + (v * 3) + w;
+                    unsigned col = 2 + u + ((y / 3) * 4) + (y % 3);
+
+                    VERIFY(rbuf[x], (row * SPACE15_DIM2) + col, "H5Dread");
+                    x++;
+                } /* end for */
+    } /* end for */
+
+    /* Release resources */
+    ret = H5Sclose(mem_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Dclose(dset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    HDfree(wbuf);
+}   /* test_select_hyper_seq_cache() */
+
+/****************************************************************
+**
+**  test_select_point_read_sorted_check(): Read a point selection
+**      and verify that each element lands in the right place.
+**
+****************************************************************/
+static void
+test_select_point_read_sorted_check(hid_t dset, hid_t sid, hid_t mem_type,
+    const hsize_t *coords, const hssize_t *offset, hbool_t reverse)
+{
+    hid_t mem_sid;              /* Memory dataspace ID */
+    hsize_t mem_dims[1] = {SPACE16_NPOINTS};    /* Memory dataspace dimensions */
+    hsize_t *mem_coords = NULL; /* Memory coordinates */
+    double *rbuf;               /* Buffer for reading data */
+    unsigned u;                 /* Local index variable */
+    herr_t ret;                 /* Generic return value */
+
+    rbuf = (double *)HDcalloc(sizeof(double), SPACE16_NPOINTS);
+    CHECK(rbuf, NULL, "HDcalloc");
+    mem_sid = H5Screate_simple(1, mem_dims, NULL);
+    CHECK(mem_sid, FAIL, "H5Screate_simple");
+
+    /* Optionally scatter the elements into memory in reverse order */
+    if(reverse) {
+        mem_coords = (hsize_t *)HDmalloc(sizeof(hsize_t) * SPACE16_NPOINTS);
+        CHECK(mem_coords, NULL, "HDmalloc");
+        for(u = 0; u < SPACE16_NPOINTS; u++)
+            mem_coords[u] = SPACE16_NPOINTS - (u + 1);
+        ret = H5Sselect_elements(mem_sid, H5S_SELECT_SET, (size_t)SPACE16_NPOINTS, mem_coords);
+        CHECK(ret, FAIL, "H5Sselect_elements");
+    } /* end if */
+
+    if(mem_type == H5T_NATIVE_DOUBLE)
+        ret = H5Dread(dset, mem_type, mem_sid, sid, H5P_DEFAULT, rbuf);
+    else {
+        unsigned *ubuf = (unsigned *)rbuf;
+
+        ret = H5Dread(dset, mem_type, mem_sid, sid, H5P_DEFAULT, ubuf);
+        CHECK(ret, FAIL, "H5Dread");
+        for(u = SPACE16_NPOINTS; u > 0; u--)
+            rbuf[u - 1] = (double)ubuf[u - 1];
+    } /* end else */
+    CHECK(ret, FAIL, "H5Dread");
+
+    for(u = 0; u < SPACE16_NPOINTS; u++) {
+        hsize_t row = (hsize_t)((hssize_t)coords[u * SPACE16_RANK] + offset[0]);
+        hsize_t col = (hsize_t)((hssize_t)coords[(u * SPACE16_RANK) + 1] + offset[1]);
+        unsigned idx = reverse ? (SPACE16_NPOINTS - (u + 1)) : u;
+
+        if(rbuf[idx] != (double)((row * SPACE16_DIM2) + col)) {
+            TestErrPrintf("%d: point %u read wrong value %f\n", __LINE__, u, rbuf[idx]);
+            break;
+        } /* end if */
+    } /* end for */
+
+    ret = H5Sclose(mem_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    if(mem_coords)
+        HDfree(mem_coords);
+    HDfree(rbuf);
+}   /* test_select_point_read_sorted_check() */
+
+/****************************************************************
+**
+**  test_select_point_read_sorted(): Test reading point selections
+**      whose points are scattered through the file, which are
+**      read in file order and permuted back into memory order.
+**
+****************************************************************/
+static void
+test_select_point_read_sorted(void)
+{
+    hid_t fid;                  /* File ID */
+    hid_t dset_contig, dset_chunk;      /* Dataset IDs */
+    hid_t sid;                  /* Dataspace ID */
+    hid_t dcpl;                 /* Dataset creation property list ID */
+    const hsize_t dims[SPACE16_RANK] = {SPACE16_DIM1, SPACE16_DIM2};    /* Dataspace dimensions */
+    const hsize_t chunk_dims[SPACE16_RANK] = {SPACE16_CHUNK1, SPACE16_CHUNK2};  /* Chunk dimensions */
+    hssize_t offset[SPACE16_RANK];      /* Selection offset */
+    hsize_t *coords;            /* Coordinates of points */
+    unsigned *wbuf;             /* Buffer for writing data */
+    unsigned u;                 /* Local index variable */
+    herr_t ret;                 /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing reading scattered point selections\n"));
+
+    /* Create & write datasets whose elements hold their linear offsets */
+    wbuf = (unsigned *)HDmalloc(sizeof(unsigned) * SPACE16_DIM1 * SPACE16_DIM2);
+    CHECK(wbuf, NULL, "HDmalloc");
+    for(u = 0; u < SPACE16_DIM1 * SPACE16_DIM2; u++)
+        wbuf[u] = u;
+
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fcreate");
+    sid = H5Screate_simple(SPACE16_RANK, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, FAIL, "H5Pcreate");
+    ret = H5Pset_chunk(dcpl, SPACE16_RANK, chunk_dims);
+    CHECK(ret, FAIL, "H5Pset_chunk");
+    dset_contig = H5Dcreate2(fid, SPACE1_NAME, H5T_NATIVE_UINT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dset_contig, FAIL, "H5Dcreate2");
+    dset_chunk = H5Dcreate2(fid, SPACE2_NAME, H5T_NATIVE_UINT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(dset_chunk, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(dset_contig, H5T_NATIVE_UINT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Dwrite(dset_chunk, H5T_NATIVE_UINT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    /* Select scattered points, with some runs of adjacent points and
+     *  some duplicates.  Leave room for moving the selection with an
+     *  offset.
+     */
+    coords = (hsize_t *)HDmalloc(sizeof(hsize_t) * SPACE16_RANK * SPACE16_NPOINTS);
+    CHECK(coords, NULL, "HDmalloc");
+    for(u = 0; u < SPACE16_NPOINTS; u++) {
+        if(u % 10 == 9) {
+            /* Duplicate an earlier point */
+            coords[u * SPACE16_RANK] = coords[(u / 2) * SPACE16_RANK];
+            coords[(u * SPACE16_RANK) + 1] = coords[((u / 2) * SPACE16_RANK) + 1];
+        } /* end if */
+        else if(u % 10 >= 5) {
+            /* Continue a run of adjacent points, in descending order */
+            coords[u * SPACE16_RANK] = coords[(u - 1) * SPACE16_RANK];
+            coords[(u * SPACE16_RANK) + 1] = coords[((u - 1) * SPACE16_RANK) + 1] - 1;
+        } /* end if */
+        else {
+            coords[u * SPACE16_RANK] = (hsize_t)HDrandom() % (SPACE16_DIM1 - 5);
+            coords[(u * SPACE16_RANK) + 1] = 10 + ((hsize_t)HDrandom() % (SPACE16_DIM2 - 10));
+        } /* end else */
+    } /* end for */
+    ret = H5Sselect_elements(sid, H5S_SELECT_SET, (size_t)SPACE16_NPOINTS, coords);
+    CHECK(ret, FAIL, "H5Sselect_elements");
+
+    /* Read the points, in various ways */
+    offset[0] = 0; offset[1] = 0;
+    test_select_point_read_sorted_check(dset_contig, sid, H5T_NATIVE_UINT, coords, offset, FALSE);
+    test_select_point_read_sorted_check(dset_chunk, sid, H5T_NATIVE_UINT, coords, offset, FALSE);
+    test_select_point_read_sorted_check(dset_contig, sid, H5T_NATIVE_UINT, coords, offset, TRUE);
+    test_select_point_read_sorted_check(dset_chunk, sid, H5T_NATIVE_UINT, coords, offset, TRUE);
+    test_select_point_read_sorted_check(dset_contig, sid, H5T_NATIVE_DOUBLE, coords, offset, TRUE);
+    test_select_point_read_sorted_check(dset_chunk, sid, H5T_NATIVE_DOUBLE, coords, offset, FALSE);
+
+    /* Move the selection with an offset */
+    offset[0] = 3; offset[1] = -4;
+    ret = H5Soffset_simple(sid, offset);
+    CHECK(ret, FAIL, "H5Soffset_simple");
+    test_select_point_read_sorted_check(dset_contig, sid, H5T_NATIVE_UINT, coords, offset, TRUE);
+    test_select_point_read_sorted_check(dset_chunk, sid, H5T_NATIVE_UINT, coords, offset, TRUE);
+
+    /* Verify the selection itself was not reordered */
+    {
+        hsize_t *pnt_buf;       /* Buffer for retrieving points */
+
+        pnt_buf = (hsize_t *)HDmalloc(sizeof(hsize_t) * SPACE16_RANK * SPACE16_NPOINTS);
+        CHECK(pnt_buf, NULL, "HDmalloc");
+        ret = H5Sget_select_elem_pointlist(sid, (hsize_t)0, (hsize_t)SPACE16_NPOINTS, pnt_buf);
+        CHECK(ret, FAIL, "H5Sget_select_elem_pointlist");
+        if(HDmemcmp(pnt_buf, coords, sizeof(hsize_t) * SPACE16_RANK * SPACE16_NPOINTS))
+            TestErrPrintf("%d: point selection order changed by read\n", __LINE__);
+        HDfree(pnt_buf);
+    }
+
+    /* Release resources */
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Dclose(dset_contig);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Dclose(dset_chunk);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    HDfree(coords);
+    HDfree(wbuf);
+}   /* test_select_point_read_sorted() */
+
 /****************************************************************
 **
 **  test_select(): Main H5S selection testing routine.
@@ -13760,6 +14208,15 @@ test_select(void)
     /* Test unlimited hyperslab selections */
     test_hyper_unlim();
 
+    /* Test hyperslab selections with many blocks */
+    test_select_hyper_many_blocks();
+
+    /* Test re-using sequences for moved hyperslab selections */
+    test_select_hyper_seq_cache();
+
+    /* Test reading scattered point selections */
+    test_select_point_read_sorted();
+
 }   /* test_select() */
 
 
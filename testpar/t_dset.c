@@ -4441,3 +4441,173 @@ test_dense_attr(void)
     return;
 }
 
+
+/*
+ * Function:    node_agg_write
+ *
+ * Purpose:     Test collective writes aggregated on each node, with each
+ *              process writing many small pieces interleaved with the
+ *              pieces of the other processes.  Writes a contiguous and a
+ *              chunked dataset with hyperslab selections, then overwrites
+ *              part of the contiguous dataset with point selections in
+ *              reverse order, with process 0 selecting nothing.
+ */
+#define NODE_AGG_NELMTS_PER_PROC        1024
+#define NODE_AGG_CHUNK_NELMTS           256
+void
+node_agg_write(void)
+{
+    int mpi_size, mpi_rank;
+    hid_t fapl, fid, dcpl, dxpl;
+    hid_t file_space, mem_space;
+    hid_t dset_contig, dset_chunk;
+    hsize_t dims[1], chunk_dims[1], mem_dims[1];
+    hsize_t start[1], stride[1], count[1];
+    hsize_t *coords = NULL;
+    int *wbuf = NULL, *rbuf = NULL;
+    hbool_t actual_node_agg;
+    size_t u;
+    herr_t ret;
+    const char *filename;
+
+    filename = (const char *)GetTestParameters();
+    HDassert(filename != NULL);
+
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    dims[0] = (hsize_t)NODE_AGG_NELMTS_PER_PROC * (hsize_t)mpi_size;
+    chunk_dims[0] = NODE_AGG_CHUNK_NELMTS;
+    mem_dims[0] = NODE_AGG_NELMTS_PER_PROC;
+
+    wbuf = (int *)HDmalloc(NODE_AGG_NELMTS_PER_PROC * sizeof(int));
+    VRFY((wbuf != NULL), "HDmalloc succeeded");
+    rbuf = (int *)HDmalloc((size_t)dims[0] * sizeof(int));
+    VRFY((rbuf != NULL), "HDmalloc succeeded");
+    coords = (hsize_t *)HDmalloc(NODE_AGG_NELMTS_PER_PROC * sizeof(hsize_t));
+    VRFY((coords != NULL), "HDmalloc succeeded");
+
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((fapl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_fapl_mpio(fapl, MPI_COMM_WORLD, MPI_INFO_NULL);
+    VRFY((ret >= 0), "H5Pset_fapl_mpio succeeded");
+    fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    VRFY((fid >= 0), "H5Fcreate succeeded");
+    ret = H5Pclose(fapl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+
+    file_space = H5Screate_simple(1, dims, NULL);
+    VRFY((file_space >= 0), "H5Screate_simple succeeded");
+    mem_space = H5Screate_simple(1, mem_dims, NULL);
+    VRFY((mem_space >= 0), "H5Screate_simple succeeded");
+
+    dset_contig = H5Dcreate2(fid, "node_agg_contig", H5T_NATIVE_INT, file_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((dset_contig >= 0), "H5Dcreate2 succeeded");
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    VRFY((dcpl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_chunk(dcpl, 1, chunk_dims);
+    VRFY((ret >= 0), "H5Pset_chunk succeeded");
+    dset_chunk = H5Dcreate2(fid, "node_agg_chunk", H5T_NATIVE_INT, file_space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    VRFY((dset_chunk >= 0), "H5Dcreate2 succeeded");
+    ret = H5Pclose(dcpl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+
+    /* Aggregate collective writes on each node, doing I/O for each chunk */
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+    ret = H5Pset_dxpl_mpio_chunk_opt(dxpl, H5FD_MPIO_CHUNK_MULTI_IO);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio_chunk_opt succeeded");
+    ret = H5Pset_dxpl_mpio_node_agg(dxpl, TRUE);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio_node_agg succeeded");
+
+    /* Each process writes every mpi_size'th element */
+    start[0] = (hsize_t)mpi_rank;
+    stride[0] = (hsize_t)mpi_size;
+    count[0] = NODE_AGG_NELMTS_PER_PROC;
+    ret = H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, stride, count, NULL);
+    VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    for(u = 0; u < NODE_AGG_NELMTS_PER_PROC; u++)
+        wbuf[u] = (int)(u * (size_t)mpi_size) + mpi_rank;
+
+    ret = H5Dwrite(dset_contig, H5T_NATIVE_INT, mem_space, file_space, dxpl, wbuf);
+    VRFY((ret >= 0), "H5Dwrite succeeded");
+    ret = H5Pget_mpio_actual_node_agg(dxpl, &actual_node_agg);
+    VRFY((ret >= 0), "H5Pget_mpio_actual_node_agg succeeded");
+    VRFY((actual_node_agg == TRUE), "contiguous write was aggregated");
+    ret = H5Dwrite(dset_chunk, H5T_NATIVE_INT, mem_space, file_space, dxpl, wbuf);
+    VRFY((ret >= 0), "H5Dwrite succeeded");
+    ret = H5Pget_mpio_actual_node_agg(dxpl, &actual_node_agg);
+    VRFY((ret >= 0), "H5Pget_mpio_actual_node_agg succeeded");
+    VRFY((actual_node_agg == TRUE), "chunked write was aggregated");
+
+    /* Overwrite the first half of each process's elements in the contiguous
+     * dataset with points in reverse order, except for process 0 */
+    if(mpi_rank == 0) {
+        ret = H5Sselect_none(file_space);
+        VRFY((ret >= 0), "H5Sselect_none succeeded");
+        ret = H5Sselect_none(mem_space);
+        VRFY((ret >= 0), "H5Sselect_none succeeded");
+    } /* end if */
+    else {
+        for(u = 0; u < NODE_AGG_NELMTS_PER_PROC / 2; u++) {
+            coords[u] = (hsize_t)((NODE_AGG_NELMTS_PER_PROC / 2 - 1 - u) * (size_t)mpi_size) + (hsize_t)mpi_rank;
+            wbuf[u] = -(int)coords[u];
+        } /* end for */
+        ret = H5Sselect_elements(file_space, H5S_SELECT_SET, NODE_AGG_NELMTS_PER_PROC / 2, coords);
+        VRFY((ret >= 0), "H5Sselect_elements succeeded");
+        start[0] = 0;
+        count[0] = NODE_AGG_NELMTS_PER_PROC / 2;
+        ret = H5Sselect_hyperslab(mem_space, H5S_SELECT_SET, start, NULL, count, NULL);
+        VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+    } /* end else */
+    ret = H5Dwrite(dset_contig, H5T_NATIVE_INT, mem_space, file_space, dxpl, wbuf);
+    VRFY((ret >= 0), "H5Dwrite succeeded");
+    ret = H5Pget_mpio_actual_node_agg(dxpl, &actual_node_agg);
+    VRFY((ret >= 0), "H5Pget_mpio_actual_node_agg succeeded");
+    VRFY((actual_node_agg == TRUE), "point selection write was aggregated");
+
+    /* Write the same points again without aggregation, and check that the
+     * transfer property list says so */
+    ret = H5Pset_dxpl_mpio_node_agg(dxpl, FALSE);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio_node_agg succeeded");
+    ret = H5Dwrite(dset_contig, H5T_NATIVE_INT, mem_space, file_space, dxpl, wbuf);
+    VRFY((ret >= 0), "H5Dwrite succeeded");
+    ret = H5Pget_mpio_actual_node_agg(dxpl, &actual_node_agg);
+    VRFY((ret >= 0), "H5Pget_mpio_actual_node_agg succeeded");
+    VRFY((actual_node_agg == FALSE), "write without node aggregation wasn't aggregated");
+
+    /* Check the data */
+    ret = H5Dread(dset_chunk, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf);
+    VRFY((ret >= 0), "H5Dread succeeded");
+    for(u = 0; u < (size_t)dims[0]; u++)
+        VRFY((rbuf[u] == (int)u), "data read from chunked dataset is correct");
+
+    ret = H5Dread(dset_contig, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf);
+    VRFY((ret >= 0), "H5Dread succeeded");
+    for(u = 0; u < (size_t)dims[0]; u++) {
+        int expected = (int)u;
+
+        if(u % (size_t)mpi_size != 0 && u / (size_t)mpi_size < NODE_AGG_NELMTS_PER_PROC / 2)
+            expected = -(int)u;
+        VRFY((rbuf[u] == expected), "data read from contiguous dataset is correct");
+    } /* end for */
+
+    ret = H5Pclose(dxpl);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    ret = H5Sclose(mem_space);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Sclose(file_space);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Dclose(dset_chunk);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+    ret = H5Dclose(dset_contig);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    HDfree(coords);
+    HDfree(rbuf);
+    HDfree(wbuf);
+}
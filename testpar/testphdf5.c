@@ -559,6 +559,9 @@ int main(int argc, char **argv)
     AddTest("noselcollmdread", test_partial_no_selection_coll_md_read, NULL,
             "Collective Metadata read with some ranks having no selection", PARATESTFILE);
 
+    AddTest("nodeagg", node_agg_write, NULL,
+            "collective write aggregated on each node", PARATESTFILE);
+
 
     /* Display testing information */
     TestInfo(argv[0]);
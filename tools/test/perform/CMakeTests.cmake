@@ -42,6 +42,12 @@ add_test (
         chunk.txt.err
         iopipe.txt
         iopipe.txt.err
+        id_perf.txt
+        id_perf.txt.err
+        memcpyvv_perf.txt
+        memcpyvv_perf.txt.err
+        ocopy_perf.txt
+        ocopy_perf.txt.err
         overhead.txt
         overhead.txt.err
         perf_meta.txt
@@ -105,6 +111,54 @@ else ()
 endif ()
 set_tests_properties (PERFORM_iopipe PROPERTIES DEPENDS "PERFORM_h5perform-clearall-objects")
 
+if (HDF5_ENABLE_USING_MEMCHECKER)
+  add_test (NAME PERFORM_id_perf COMMAND $<TARGET_FILE:id_perf>)
+else ()
+  add_test (NAME PERFORM_id_perf COMMAND "${CMAKE_COMMAND}"
+      -D "TEST_PROGRAM=$<TARGET_FILE:id_perf>"
+      -D "TEST_ARGS:STRING="
+      -D "TEST_EXPECT=0"
+      -D "TEST_SKIP_COMPARE=TRUE"
+      -D "TEST_OUTPUT=id_perf.txt"
+      #-D "TEST_REFERENCE=id_perf.out"
+      -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+      -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+  )
+endif ()
+set_tests_properties (PERFORM_id_perf PROPERTIES DEPENDS "PERFORM_h5perform-clearall-objects")
+
+if (HDF5_ENABLE_USING_MEMCHECKER)
+  add_test (NAME PERFORM_memcpyvv_perf COMMAND $<TARGET_FILE:memcpyvv_perf>)
+else ()
+  add_test (NAME PERFORM_memcpyvv_perf COMMAND "${CMAKE_COMMAND}"
+      -D "TEST_PROGRAM=$<TARGET_FILE:memcpyvv_perf>"
+      -D "TEST_ARGS:STRING="
+      -D "TEST_EXPECT=0"
+      -D "TEST_SKIP_COMPARE=TRUE"
+      -D "TEST_OUTPUT=memcpyvv_perf.txt"
+      #-D "TEST_REFERENCE=memcpyvv_perf.out"
+      -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+      -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+  )
+endif ()
+set_tests_properties (PERFORM_memcpyvv_perf PROPERTIES DEPENDS "PERFORM_h5perform-clearall-objects")
+
+if (HDF5_ENABLE_USING_MEMCHECKER)
+  add_test (NAME PERFORM_ocopy_perf COMMAND $<TARGET_FILE:ocopy_perf> 16)
+else ()
+  add_test (NAME PERFORM_ocopy_perf COMMAND "${CMAKE_COMMAND}"
+      -D "TEST_PROGRAM=$<TARGET_FILE:ocopy_perf>"
+      -D "TEST_ARGS:STRING=16"
+      -D "TEST_EXPECT=0"
+      -D "TEST_SKIP_COMPARE=TRUE"
+      -D "TEST_OUTPUT=ocopy_perf.txt"
+      #-D "TEST_REFERENCE=ocopy_perf.out"
+      -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+      -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+  )
+endif ()
+set_tests_properties (PERFORM_ocopy_perf PROPERTIES DEPENDS "PERFORM_h5perform-clearall-objects")
+
 if (HDF5_ENABLE_USING_MEMCHECKER)
   add_test (NAME PERFORM_overhead COMMAND $<TARGET_FILE:overhead>)
 else ()
@@ -0,0 +1,188 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ *  Purpose: measure the throughput of looking up IDs (H5Iobject_verify),
+ *           which every API call does to resolve its arguments, with many
+ *           IDs of one type open.  IDs are looked up in the order they
+ *           were registered, in random order and repeatedly one at a
+ *           time, and registered and removed again.
+ *
+ *           Usage: id_perf [nids [niter]]
+ */
+#include "hdf5.h"
+#include "H5private.h"
+
+/* Default number of IDs to register */
+#define NIDS        (100 * 1000)
+
+/* Default number of times to look up each ID */
+#define NITER       20
+
+
+/*-------------------------------------------------------------------------
+ * Function:    print_rate
+ *
+ * Purpose:     Print the time per operation and the operation rate for
+ *              one case.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+print_rate(const char *what, double nops, const H5_timer_t *total)
+{
+    HDfprintf(stdout, "%-24s %12.2f %12.3f\n", what,
+        (total->etime * 1.0e9) / nops, nops / (total->etime * 1.0e6));
+} /* end print_rate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    time_lookups
+ *
+ * Purpose:     Look up the IDs in ORDER NITER times and print the timing.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+time_lookups(const char *what, H5I_type_t type, const hid_t *ids,
+    const size_t *order, size_t nids, unsigned niter)
+{
+    H5_timer_t timer, total;
+    size_t u;
+    unsigned v;
+
+    H5_timer_reset(&total);
+    H5_timer_begin(&timer);
+    for(v = 0; v < niter; v++)
+        for(u = 0; u < nids; u++)
+            if(NULL == H5Iobject_verify(ids[order[u]], type))
+                return -1;
+    H5_timer_end(&total, &timer);
+
+    print_rate(what, (double)nids * (double)niter, &total);
+
+    return 0;
+} /* end time_lookups() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Time ID lookups with many IDs open.
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    H5I_type_t type = H5I_BADID;
+    hid_t *ids = NULL;
+    size_t *order = NULL;
+    size_t nids = NIDS;
+    unsigned niter = NITER;
+    H5_timer_t timer, total;
+    int obj = 0;
+    size_t u;
+    unsigned v;
+
+    if(argc > 1)
+        nids = (size_t)HDatol(argv[1]);
+    if(argc > 2)
+        niter = (unsigned)HDatoi(argv[2]);
+    if(nids == 0)
+        nids = NIDS;
+    if(niter == 0)
+        niter = NITER;
+
+    if(NULL == (ids = (hid_t *)HDmalloc(nids * sizeof(hid_t))))
+        goto error;
+    if(NULL == (order = (size_t *)HDmalloc(nids * sizeof(size_t))))
+        goto error;
+    if((type = H5Iregister_type((size_t)0, 0, NULL)) < 0)
+        goto error;
+
+    HDfprintf(stdout, "%lu IDs\n", (unsigned long)nids);
+    HDfprintf(stdout, "%-24s %12s %12s\n", "case", "ns/op", "Mops/s");
+
+    /* Register the IDs */
+    H5_timer_reset(&total);
+    H5_timer_begin(&timer);
+    for(u = 0; u < nids; u++)
+        if((ids[u] = H5Iregister(type, &obj)) < 0)
+            goto error;
+    H5_timer_end(&total, &timer);
+    print_rate("register", (double)nids, &total);
+
+    /* Look them up in the order they were registered */
+    for(u = 0; u < nids; u++)
+        order[u] = u;
+    if(time_lookups("lookup, in order", type, ids, order, nids, niter) < 0)
+        goto error;
+
+    /* Look them up in random order */
+    HDsrandom(42);
+    for(u = nids - 1; u > 0; u--) {
+        size_t w = (size_t)HDrandom() % (u + 1);
+        size_t tmp = order[u];
+
+        order[u] = order[w];
+        order[w] = tmp;
+    } /* end for */
+    if(time_lookups("lookup, random order", type, ids, order, nids, niter) < 0)
+        goto error;
+
+    /* Look up the same ID over and over */
+    for(u = 0; u < nids; u++)
+        order[u] = nids / 2;
+    if(time_lookups("lookup, same ID", type, ids, order, nids, niter) < 0)
+        goto error;
+
+    /* Remove and register the IDs again */
+    H5_timer_reset(&total);
+    H5_timer_begin(&timer);
+    for(v = 0; v < niter; v++)
+        for(u = 0; u < nids; u++) {
+            if(NULL == H5Iremove_verify(ids[u], type))
+                goto error;
+            if((ids[u] = H5Iregister(type, &obj)) < 0)
+                goto error;
+        } /* end for */
+    H5_timer_end(&total, &timer);
+    print_rate("remove + register", (double)nids * (double)niter, &total);
+
+    if(H5Idestroy_type(type) < 0)
+        goto error;
+    HDfree(order);
+    HDfree(ids);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Idestroy_type(type);
+    } H5E_END_TRY;
+    if(order)
+        HDfree(order);
+    if(ids)
+        HDfree(ids);
+
+    HDfprintf(stderr, "id_perf failed\n");
+    return 1;
+} /* end main() */
@@ -0,0 +1,194 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ *  Purpose: measure the performance of copying sequences between memory
+ *           buffers (H5VM_memcpyvv), which is the inner loop for reading
+ *           and writing strided selections in compact datasets and in
+ *           chunks held in the chunk cache.  Each case reads a strided
+ *           selection from a compact dataset, so no file I/O is measured.
+ *
+ *           Usage: memcpyvv_perf [niter]
+ */
+#include "hdf5.h"
+#include "H5private.h"
+
+#define FILENAME    "memcpyvv_perf.h5"
+
+/* Size of the dataset, in bytes (compact datasets must be < 64KB) */
+#define DSET_SIZE   (48 * 1024)
+
+/* Default number of times to repeat each read */
+#define NITER       2000
+
+/* Element sizes to try */
+static const size_t elmt_sizes[] = {1, 2, 4, 8, 16, 24, 64, 256};
+
+
+/*-------------------------------------------------------------------------
+ * Function:    time_reads
+ *
+ * Purpose:     Read a strided selection from a dataset NITER times,
+ *              with the memory selection either contiguous or strided
+ *              the same way, and print the timing.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+time_reads(hid_t file, size_t elmt_size, hsize_t stride, hbool_t mem_strided,
+    unsigned niter)
+{
+    hid_t dset = -1, type = -1, fspace = -1, mspace = -1, dcpl = -1;
+    hsize_t dims[1], start[1], count[1], str[1];
+    char name[32];
+    unsigned char *buf = NULL;
+    H5_timer_t timer, total;
+    double mbytes;
+    unsigned u;
+
+    dims[0] = DSET_SIZE / elmt_size;
+    start[0] = 0;
+    str[0] = stride;
+    count[0] = dims[0] / stride;
+
+    if(NULL == (buf = (unsigned char *)HDcalloc((size_t)1, (size_t)DSET_SIZE)))
+        goto error;
+    if((type = H5Tcreate(H5T_OPAQUE, elmt_size)) < 0)
+        goto error;
+    if((fspace = H5Screate_simple(1, dims, NULL)) < 0)
+        goto error;
+    if((mspace = H5Scopy(fspace)) < 0)
+        goto error;
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if(H5Pset_layout(dcpl, H5D_COMPACT) < 0)
+        goto error;
+
+    /* Create the dataset & write it */
+    HDsnprintf(name, sizeof(name), "%lu_%lu_%d", (unsigned long)elmt_size, (unsigned long)stride, (int)mem_strided);
+    if((dset = H5Dcreate2(file, name, type, fspace, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        goto error;
+    if(H5Dwrite(dset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        goto error;
+
+    /* Select the elements to read */
+    if(H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, str, count, NULL) < 0)
+        goto error;
+    if(mem_strided) {
+        if(H5Sselect_hyperslab(mspace, H5S_SELECT_SET, start, str, count, NULL) < 0)
+            goto error;
+    } /* end if */
+    else {
+        if(H5Sselect_hyperslab(mspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            goto error;
+    } /* end else */
+
+    H5_timer_reset(&total);
+    for(u = 0; u < niter; u++) {
+        H5_timer_begin(&timer);
+        if(H5Dread(dset, type, mspace, fspace, H5P_DEFAULT, buf) < 0)
+            goto error;
+        H5_timer_end(&total, &timer);
+    } /* end for */
+
+    mbytes = ((double)count[0] * (double)elmt_size * (double)niter) / (1024.0 * 1024.0);
+    HDfprintf(stdout, "%8lu %8lu %-10s %12.4f %12.2f\n", (unsigned long)elmt_size,
+        (unsigned long)stride, mem_strided ? "strided" : "contiguous",
+        (total.etime * 1000.0) / (double)niter, mbytes / total.etime);
+
+    if(H5Dclose(dset) < 0)
+        goto error;
+    if(H5Pclose(dcpl) < 0)
+        goto error;
+    if(H5Sclose(mspace) < 0)
+        goto error;
+    if(H5Sclose(fspace) < 0)
+        goto error;
+    if(H5Tclose(type) < 0)
+        goto error;
+    HDfree(buf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Pclose(dcpl);
+        H5Sclose(mspace);
+        H5Sclose(fspace);
+        H5Tclose(type);
+    } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
+
+    return -1;
+} /* end time_reads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Time reads of strided selections for a range of element
+ *              sizes and strides.
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    hid_t file = -1, fapl = -1;
+    unsigned niter = NITER;
+    size_t u;
+
+    if(argc > 1)
+        niter = (unsigned)HDatoi(argv[1]);
+    if(niter == 0)
+        niter = NITER;
+
+    /* Use the core driver, so that no file I/O is measured */
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto error;
+    if(H5Pset_fapl_core(fapl, (size_t)(1024 * 1024), FALSE) < 0)
+        goto error;
+    if((file = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto error;
+
+    HDfprintf(stdout, "%8s %8s %-10s %12s %12s\n", "elmt", "stride", "memory", "ms/read", "MB/s");
+    for(u = 0; u < NELMTS(elmt_sizes); u++) {
+        if(time_reads(file, elmt_sizes[u], (hsize_t)2, FALSE, niter) < 0)
+            goto error;
+        if(time_reads(file, elmt_sizes[u], (hsize_t)2, TRUE, niter) < 0)
+            goto error;
+    } /* end for */
+
+    if(H5Fclose(file) < 0)
+        goto error;
+    if(H5Pclose(fapl) < 0)
+        goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Fclose(file);
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+
+    HDfprintf(stderr, "memcpyvv_perf failed\n");
+    return 1;
+} /* end main() */
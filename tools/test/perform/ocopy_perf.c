@@ -0,0 +1,277 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ *  Purpose: measure the throughput of copying a group of chunked, filtered
+ *           datasets between files with H5Ocopy, against copying the
+ *           source file with plain reads and writes of the same size.
+ *           The chunks are copied without being unfiltered, so H5Ocopy
+ *           should move data at close to the rate of the plain copy.
+ *
+ *           Usage: ocopy_perf [MiB]
+ */
+#include "hdf5.h"
+#include "H5private.h"
+
+#define SRC_FILENAME    "ocopy_perf_src.h5"
+#define DST_FILENAME    "ocopy_perf_dst.h5"
+#define RAW_FILENAME    "ocopy_perf.raw"
+
+/* Default amount of data in the source file, in MiB */
+#define DATA_MB         64
+
+/* # of datasets in the group copied */
+#define NDSETS          16
+
+/* # of elements in each chunk (256 KiB chunks of ints) */
+#define CHUNK_NELMTS    (64 * 1024)
+
+/* Size of the blocks for the plain copy */
+#define RAW_BLOCK_SIZE  (8 * 1024 * 1024)
+
+
+/*-------------------------------------------------------------------------
+ * Function:    create_src
+ *
+ * Purpose:     Create the source file, with a group of chunked, filtered
+ *              datasets holding NBYTES of data in all.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+create_src(hsize_t nbytes)
+{
+    hid_t file = -1, grp = -1, space = -1, dcpl = -1, dset = -1;
+    hsize_t dims[1], chunk_dims[1];
+    char name[32];
+    int *buf = NULL;
+    size_t u;
+    unsigned v;
+
+    dims[0] = nbytes / (NDSETS * sizeof(int));
+    dims[0] -= dims[0] % CHUNK_NELMTS;
+    chunk_dims[0] = CHUNK_NELMTS;
+
+    /* Data that compresses somewhat, so the chunks are of different sizes */
+    if(NULL == (buf = (int *)HDmalloc((size_t)dims[0] * sizeof(int))))
+        goto error;
+    for(u = 0; u < (size_t)dims[0]; u++)
+        buf[u] = (int)(u / 7) ^ (int)(u * 2654435761U >> 24);
+
+    if((file = H5Fcreate(SRC_FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    if((grp = H5Gcreate2(file, "group", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    if((space = H5Screate_simple(1, dims, NULL)) < 0)
+        goto error;
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if(H5Pset_chunk(dcpl, 1, chunk_dims) < 0)
+        goto error;
+    if(H5Pset_shuffle(dcpl) < 0)
+        goto error;
+#ifdef H5_HAVE_FILTER_DEFLATE
+    if(H5Pset_deflate(dcpl, 1) < 0)
+        goto error;
+#endif /* H5_HAVE_FILTER_DEFLATE */
+    if(H5Pset_fletcher32(dcpl) < 0)
+        goto error;
+
+    for(v = 0; v < NDSETS; v++) {
+        HDsnprintf(name, sizeof(name), "dset%u", v);
+        if((dset = H5Dcreate2(grp, name, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            goto error;
+        if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            goto error;
+        if(H5Dclose(dset) < 0)
+            goto error;
+    } /* end for */
+
+    if(H5Pclose(dcpl) < 0)
+        goto error;
+    if(H5Sclose(space) < 0)
+        goto error;
+    if(H5Gclose(grp) < 0)
+        goto error;
+    if(H5Fclose(file) < 0)
+        goto error;
+    HDfree(buf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Pclose(dcpl);
+        H5Sclose(space);
+        H5Gclose(grp);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
+
+    return -1;
+} /* end create_src() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    time_ocopy
+ *
+ * Purpose:     Copy the group in the source file to a new file with
+ *              H5Ocopy, and print the timing.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+time_ocopy(double mbytes)
+{
+    hid_t src = -1, dst = -1;
+    H5_timer_t timer, total;
+
+    H5_timer_reset(&total);
+    H5_timer_begin(&timer);
+    if((src = H5Fopen(SRC_FILENAME, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+        goto error;
+    if((dst = H5Fcreate(DST_FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    if(H5Ocopy(src, "group", dst, "group", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        goto error;
+    if(H5Fclose(dst) < 0)
+        goto error;
+    if(H5Fclose(src) < 0)
+        goto error;
+    H5_timer_end(&total, &timer);
+
+    HDfprintf(stdout, "%-12s %12.4f %12.2f\n", "H5Ocopy", total.etime, mbytes / total.etime);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Fclose(dst);
+        H5Fclose(src);
+    } H5E_END_TRY;
+
+    return -1;
+} /* end time_ocopy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    time_raw
+ *
+ * Purpose:     Copy the source file to another file with plain reads and
+ *              writes, and print the timing.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+time_raw(double mbytes)
+{
+    int src = -1, dst = -1;
+    unsigned char *buf = NULL;
+    H5_timer_t timer, total;
+    ssize_t nread;
+
+    if(NULL == (buf = (unsigned char *)HDmalloc((size_t)RAW_BLOCK_SIZE)))
+        goto error;
+
+    H5_timer_reset(&total);
+    H5_timer_begin(&timer);
+    if((src = HDopen(SRC_FILENAME, O_RDONLY)) < 0)
+        goto error;
+    if((dst = HDopen(RAW_FILENAME, O_WRONLY | O_CREAT | O_TRUNC, H5_POSIX_CREATE_MODE_RW)) < 0)
+        goto error;
+    while((nread = HDread(src, buf, (size_t)RAW_BLOCK_SIZE)) > 0)
+        if(HDwrite(dst, buf, (size_t)nread) != nread)
+            goto error;
+    if(nread < 0)
+        goto error;
+    if(HDclose(dst) < 0)
+        goto error;
+    dst = -1;
+    if(HDclose(src) < 0)
+        goto error;
+    src = -1;
+    H5_timer_end(&total, &timer);
+
+    HDfprintf(stdout, "%-12s %12.4f %12.2f\n", "read/write", total.etime, mbytes / total.etime);
+    HDfree(buf);
+
+    return 0;
+
+error:
+    if(dst >= 0)
+        HDclose(dst);
+    if(src >= 0)
+        HDclose(src);
+    if(buf)
+        HDfree(buf);
+
+    return -1;
+} /* end time_raw() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Time copying a group of chunked, filtered datasets with
+ *              H5Ocopy and copying the whole file it's in.
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    h5_stat_t sb;
+    unsigned data_mb = DATA_MB;
+    double mbytes;
+
+    if(argc > 1)
+        data_mb = (unsigned)HDatoi(argv[1]);
+    if(data_mb == 0)
+        data_mb = DATA_MB;
+
+    if(create_src((hsize_t)data_mb * 1024 * 1024) < 0)
+        goto error;
+    if(HDstat(SRC_FILENAME, &sb) < 0)
+        goto error;
+    mbytes = (double)sb.st_size / (1024.0 * 1024.0);
+
+    HDfprintf(stdout, "%u datasets, %.2f MiB in file\n", (unsigned)NDSETS, mbytes);
+    HDfprintf(stdout, "%-12s %12s %12s\n", "copy", "seconds", "MB/s");
+    if(time_raw(mbytes) < 0)
+        goto error;
+    if(time_ocopy(mbytes) < 0)
+        goto error;
+
+    HDremove(SRC_FILENAME);
+    HDremove(DST_FILENAME);
+    HDremove(RAW_FILENAME);
+
+    return 0;
+
+error:
+    HDfprintf(stderr, "ocopy_perf failed\n");
+    return 1;
+} /* end main() */